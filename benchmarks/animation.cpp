@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Benchmark of skeletal animation. Animates a crowd of skinned characters
+ * with a synthetic skeleton headlessly, i.e. without rendering, on 1 to N
+ * threads. N is either passed as the first argument or is the number of
+ * hardware threads.
+ */
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/format.hpp>
+
+#include "glm/gtc/quaternion.hpp"
+
+#include "../src/common/jobs.h"
+#include "../src/render/model/model.h"
+#include "../src/scene/animationbatch.h"
+#include "../src/scene/modelscenenode.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::render;
+using namespace reone::scene;
+
+static const int kCharacterCount = 500;
+static const int kBoneCount = 56;
+static const int kKeyframeCount = 30;
+static const float kAnimationLength = 2.0f;
+static const int kFrameCount = 600;
+static const float kFrameTime = 1.0f / 60.0f;
+
+static shared_ptr<ModelNode> buildSkeleton(bool animation) {
+    vector<shared_ptr<ModelNode>> nodes;
+
+    for (int i = 0; i < kBoneCount; ++i) {
+        ModelNode *parent = i > 0 ? nodes[(i - 1) / 2].get() : nullptr;
+        glm::vec3 position(0.0f, 0.0f, i > 0 ? 0.1f : 0.0f);
+        glm::quat orientation(1.0f, 0.0f, 0.0f, 0.0f);
+
+        shared_ptr<ModelNode> node(new ModelNode(i, parent, i, str(boost::format("bone%02d") % i), position, orientation));
+        if (animation) {
+            for (int j = 0; j < kKeyframeCount; ++j) {
+                float time = kAnimationLength * j / (kKeyframeCount - 1);
+                float angle = glm::radians(10.0f) * glm::sin(time + i);
+                node->addPositionKeyframe(time, glm::vec3(0.0f, 0.01f * glm::sin(time), 0.0f));
+                node->addOrientationKeyframe(time, glm::angleAxis(angle, glm::vec3(1.0f, 0.0f, 0.0f)));
+            }
+        }
+        if (parent) {
+            nodes[(i - 1) / 2]->addChild(node);
+        }
+        nodes.push_back(move(node));
+    }
+    if (!animation) {
+        shared_ptr<ModelNode> skinNode(new ModelNode(kBoneCount, nodes[0].get(), kBoneCount, "body", glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f)));
+        skinNode->setSkin(make_shared<ModelNode::Skin>());
+        nodes[0]->addChild(skinNode);
+    }
+
+    return nodes[0];
+}
+
+int main(int argc, char **argv) {
+    vector<unique_ptr<Animation>> anims;
+    anims.push_back(make_unique<Animation>("walk", kAnimationLength, 0.0f, buildSkeleton(true)));
+
+    shared_ptr<Model> model(new Model("character", buildSkeleton(false), anims));
+
+    vector<unique_ptr<ModelSceneNode>> characters;
+    for (int i = 0; i < kCharacterCount; ++i) {
+        unique_ptr<ModelSceneNode> character(new ModelSceneNode(nullptr, model));
+        character->playAnimation("walk", kAnimationLoop);
+        characters.push_back(move(character));
+    }
+
+    AnimationBatch batch;
+    for (auto &character : characters) {
+        batch.add(character.get());
+    }
+
+    int maxThreadCount = argc > 1 ? stoi(argv[1]) : max(1, static_cast<int>(thread::hardware_concurrency()));
+    double serialMillis = 0.0;
+
+    cout << boost::format("%d characters, %d bones, %d keyframes per track, %d frames") % kCharacterCount % kBoneCount % kKeyframeCount % kFrameCount << endl;
+
+    for (int threadCount = 1; threadCount <= maxThreadCount; ++threadCount) {
+        auto start = chrono::steady_clock::now();
+
+        for (int frame = 0; frame < kFrameCount; ++frame) {
+            batch.run(kFrameTime, threadCount);
+        }
+
+        auto end = chrono::steady_clock::now();
+        double millis = chrono::duration<double, milli>(end - start).count();
+        if (threadCount == 1) {
+            serialMillis = millis;
+        }
+
+        cout << boost::format("threads: %d, total: %.2f ms, per frame: %.3f ms, per character: %.2f us, speedup: %.2fx")
+            % threadCount % millis % (millis / kFrameCount) % (1000.0 * millis / (kFrameCount * kCharacterCount)) % (serialMillis / millis) << endl;
+    }
+
+    JobExecutor::instance().deinit();
+
+    return 0;
+}
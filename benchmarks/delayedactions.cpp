@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Benchmark of nested delayed actions. Every execution of the benchmarked
+ * script saves its state and schedules itself as a delayed action, much like
+ * DelayCommand/AssignCommand chains in cutscene scripts do.
+ */
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <boost/format.hpp>
+
+#include "../src/script/execution.h"
+#include "../src/script/routine.h"
+#include "../src/script/statepool.h"
+
+using namespace std;
+
+using namespace reone::script;
+
+static const int kChainCount = 100;
+static const int kChainDepth = 100;
+static const int kGlobalCount = 64;
+static const int kLocalCount = 16;
+
+class DelayRoutines : public IRoutineProvider {
+public:
+    struct DelayedAction {
+        ExecutionContext context;
+        int depth { 0 };
+    };
+
+    vector<DelayedAction> actions;
+    int depth { 0 };
+
+    DelayRoutines() : _routine("DelayCommand", VariableType::Void, { VariableType::Float, VariableType::Action }, [this](const vector<Variable> &args, ExecutionContext &ctx) {
+        if (depth < kChainDepth) {
+            DelayedAction action;
+            action.context = args[1].context;
+            action.depth = depth + 1;
+            actions.push_back(move(action));
+        }
+        return Variable();
+    }) {
+    }
+
+    const Routine &get(int index) override {
+        return _routine;
+    }
+
+private:
+    Routine _routine;
+};
+
+static shared_ptr<ScriptProgram> buildProgram() {
+    shared_ptr<ScriptProgram> program(new ScriptProgram("delayed"));
+    Instruction ins;
+    uint32_t offset = 13;
+
+    auto add = [&](ByteCode byteCode, InstructionType type, uint32_t size) {
+        ins.offset = offset;
+        ins.byteCode = byteCode;
+        ins.type = type;
+        ins.nextOffset = offset + size;
+        program->add(ins);
+        offset = ins.nextOffset;
+    };
+
+    for (int i = 0; i < kGlobalCount; ++i) {
+        add(ByteCode::Reserve, InstructionType::Int, 2);
+    }
+    add(ByteCode::SaveBP, InstructionType::None, 2);
+
+    for (int i = 0; i < kLocalCount; ++i) {
+        add(ByteCode::Reserve, InstructionType::Int, 2);
+    }
+    uint32_t storeStateOffset = offset;
+
+    ins.size = 4 * kGlobalCount;
+    ins.sizeLocals = 4 * kLocalCount;
+    add(ByteCode::StoreState, static_cast<InstructionType>(0x10), 10);
+
+    ins.jumpOffset = offset + 12;
+    add(ByteCode::Jump, InstructionType::None, 6);
+
+    // Delayed action: save state and schedule itself again
+
+    ins.jumpOffset = storeStateOffset;
+    add(ByteCode::Jump, InstructionType::None, 6);
+
+    ins.floatValue = 1.0f;
+    add(ByteCode::PushConstant, InstructionType::Float, 6);
+
+    ins.routine = 0;
+    ins.argCount = 2;
+    add(ByteCode::CallRoutine, InstructionType::None, 5);
+
+    add(ByteCode::Return, InstructionType::None, 2);
+
+    program->setLength(offset);
+
+    return move(program);
+}
+
+int main(int argc, char **argv) {
+    shared_ptr<ScriptProgram> program(buildProgram());
+    DelayRoutines routines;
+
+    ExecutionContext ctx;
+    ctx.routines = &routines;
+
+    int executionCount = 0;
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < kChainCount; ++i) {
+        routines.depth = 0;
+        ScriptExecution(program, ctx).run();
+        ++executionCount;
+
+        while (!routines.actions.empty()) {
+            DelayRoutines::DelayedAction action(move(routines.actions.back()));
+            routines.actions.pop_back();
+            routines.depth = action.depth;
+
+            ScriptExecution(action.context.savedState->program, action.context).run();
+            ++executionCount;
+        }
+    }
+
+    auto end = chrono::steady_clock::now();
+    double millis = chrono::duration<double, milli>(end - start).count();
+
+    ExecutionStatePool &pool = ExecutionStatePool::instance();
+
+    cout << boost::format("%d chains of %d nested delayed actions, %d globals, %d locals") % kChainCount % kChainDepth % kGlobalCount % kLocalCount << endl;
+    cout << boost::format("executions: %d, total: %.2f ms, per execution: %.3f us") % executionCount % millis % (1000.0 * millis / executionCount) << endl;
+    cout << boost::format("saved states allocated: %d, reused: %d") % pool.allocatedCount() % pool.reusedCount() << endl;
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Benchmark of the per-frame object visibility pass. Compares transforming
+ * bounding boxes and testing them against the frustum one at a time, as the
+ * area used to do, with doing it in an AABBBatch.
+ */
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <boost/format.hpp>
+
+#include "glm/gtc/matrix_transform.hpp"
+
+#include "../src/render/aabbbatch.h"
+#include "../src/scene/cameranode.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::render;
+using namespace reone::scene;
+
+static const int kObjectCount = 4000;
+static const int kFrameCount = 1000;
+
+int main(int argc, char **argv) {
+    mt19937 rng(1);
+    uniform_real_distribution<float> positionDist(-100.0f, 100.0f);
+    uniform_real_distribution<float> sizeDist(0.5f, 4.0f);
+    uniform_real_distribution<float> angleDist(0.0f, glm::two_pi<float>());
+
+    vector<AABB> aabbs;
+    vector<glm::mat4> transforms;
+    for (int i = 0; i < kObjectCount; ++i) {
+        glm::vec3 size(sizeDist(rng), sizeDist(rng), sizeDist(rng));
+        aabbs.push_back(AABB(-0.5f * size, 0.5f * size));
+
+        glm::mat4 transform(glm::translate(glm::mat4(1.0f), glm::vec3(positionDist(rng), positionDist(rng), 0.0f)));
+        transforms.push_back(glm::rotate(transform, angleDist(rng), glm::vec3(0.0f, 0.0f, 1.0f)));
+    }
+
+    CameraSceneNode camera(nullptr, glm::perspective(glm::radians(55.0f), 16.0f / 9.0f, 0.1f, 100.0f));
+
+    cout << boost::format("%d objects, %d frames") % kObjectCount % kFrameCount << endl;
+
+    vector<uint8_t> scalarInside(kObjectCount);
+    size_t scalarCount = 0;
+    auto start = chrono::steady_clock::now();
+
+    for (int frame = 0; frame < kFrameCount; ++frame) {
+        camera.setLocalTransform(glm::rotate(glm::rotate(glm::mat4(1.0f), 0.01f * frame, glm::vec3(0.0f, 0.0f, 1.0f)), glm::half_pi<float>(), glm::vec3(1.0f, 0.0f, 0.0f)));
+
+        for (int i = 0; i < kObjectCount; ++i) {
+            AABB aabb(aabbs[i] * transforms[i]);
+            scalarInside[i] = camera.isInFrustum(aabb) ? 1 : 0;
+            scalarCount += scalarInside[i];
+        }
+    }
+
+    auto end = chrono::steady_clock::now();
+    double scalarMillis = chrono::duration<double, milli>(end - start).count();
+
+    cout << boost::format("scalar: per frame: %.3f ms, boxes per ms: %.0f, visible: %d")
+        % (scalarMillis / kFrameCount) % (kObjectCount * kFrameCount / scalarMillis) % (scalarCount / kFrameCount) << endl;
+
+    AABBBatch batch;
+    vector<uint8_t> batchInside;
+    size_t batchCount = 0;
+    start = chrono::steady_clock::now();
+
+    for (int frame = 0; frame < kFrameCount; ++frame) {
+        camera.setLocalTransform(glm::rotate(glm::rotate(glm::mat4(1.0f), 0.01f * frame, glm::vec3(0.0f, 0.0f, 1.0f)), glm::half_pi<float>(), glm::vec3(1.0f, 0.0f, 0.0f)));
+
+        batch.clear();
+        for (int i = 0; i < kObjectCount; ++i) {
+            batch.add(aabbs[i], transforms[i]);
+        }
+        batch.testPlanes(camera.frustum(), kFrustumPlaneCount, batchInside);
+
+        for (int i = 0; i < kObjectCount; ++i) {
+            batchCount += batchInside[i];
+        }
+    }
+
+    end = chrono::steady_clock::now();
+    double batchMillis = chrono::duration<double, milli>(end - start).count();
+
+    cout << boost::format("batch: per frame: %.3f ms, boxes per ms: %.0f, visible: %d, speedup: %.2fx")
+        % (batchMillis / kFrameCount) % (kObjectCount * kFrameCount / batchMillis) % (batchCount / kFrameCount) % (scalarMillis / batchMillis) << endl;
+
+    return 0;
+}
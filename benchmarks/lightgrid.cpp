@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Benchmark of light assignment. Scatters hundreds of lights over a large
+ * synthetic area and moves a crowd of creatures around it, so that every
+ * creature looks up its lights every frame. Compares a light grid, rebuilt
+ * every frame, with sorting all lights in range, as scene graphs used to do.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/format.hpp>
+
+#include "glm/gtc/matrix_transform.hpp"
+
+#include "../src/scene/lightgrid.h"
+#include "../src/scene/lightnode.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::scene;
+
+static const int kLightCount = 600;
+static const int kCreatureCount = 400;
+static const float kAreaSize = 400.0f;
+static const int kFrameCount = 600;
+static const int kMaxLightCount = 8;
+
+static void getLightsAt(const vector<LightSceneNode *> &allLights, const glm::vec3 &position, vector<LightSceneNode *> &lights) {
+    unordered_map<LightSceneNode *, float> distances;
+    lights.clear();
+
+    for (auto &light : allLights) {
+        float distance = light->distanceTo(position);
+        float radius = light->radius();
+        if (distance > radius * radius) continue;
+
+        distances.insert(make_pair(light, distance));
+        lights.push_back(light);
+    }
+
+    sort(lights.begin(), lights.end(), [&distances](LightSceneNode *left, LightSceneNode *right) {
+        int leftPriority = left->priority();
+        int rightPriority = right->priority();
+
+        if (leftPriority < rightPriority) return true;
+        if (leftPriority > rightPriority) return false;
+
+        float leftDistance = distances.find(left)->second;
+        float rightDistance = distances.find(right)->second;
+
+        return leftDistance < rightDistance;
+    });
+
+    if (lights.size() > kMaxLightCount) {
+        lights.erase(lights.begin() + kMaxLightCount, lights.end());
+    }
+}
+
+int main(int argc, char **argv) {
+    mt19937 rng(1);
+    uniform_real_distribution<float> positionDist(-0.5f * kAreaSize, 0.5f * kAreaSize);
+    uniform_real_distribution<float> radiusDist(2.0f, 20.0f);
+    uniform_int_distribution<int> priorityDist(1, 5);
+    uniform_real_distribution<float> stepDist(-0.1f, 0.1f);
+
+    vector<unique_ptr<LightSceneNode>> lightNodes;
+    vector<LightSceneNode *> lights;
+
+    for (int i = 0; i < kLightCount; ++i) {
+        auto light = make_unique<LightSceneNode>(nullptr, priorityDist(rng), glm::vec3(1.0f), radiusDist(rng));
+        light->setLocalTransform(glm::translate(glm::mat4(1.0f), glm::vec3(positionDist(rng), positionDist(rng), 2.0f)));
+        lights.push_back(light.get());
+        lightNodes.push_back(move(light));
+    }
+
+    vector<glm::vec3> creatures;
+    for (int i = 0; i < kCreatureCount; ++i) {
+        creatures.push_back(glm::vec3(positionDist(rng), positionDist(rng), 1.0f));
+    }
+    vector<vector<glm::vec3>> positions(kFrameCount, creatures);
+    for (int frame = 1; frame < kFrameCount; ++frame) {
+        for (int i = 0; i < kCreatureCount; ++i) {
+            positions[frame][i] = positions[frame - 1][i] + glm::vec3(stepDist(rng), stepDist(rng), 0.0f);
+        }
+    }
+
+    cout << boost::format("%d lights, %d creatures, %d frames") % kLightCount % kCreatureCount % kFrameCount << endl;
+
+    // Sorting all lights in range
+
+    vector<LightSceneNode *> affecting;
+    int bruteForceLights = 0;
+    auto start = chrono::steady_clock::now();
+
+    for (int frame = 0; frame < kFrameCount; ++frame) {
+        for (auto &position : positions[frame]) {
+            getLightsAt(lights, position, affecting);
+            bruteForceLights += static_cast<int>(affecting.size());
+        }
+    }
+
+    auto end = chrono::steady_clock::now();
+    double bruteForceMillis = chrono::duration<double, milli>(end - start).count();
+
+    cout << boost::format("sorting all lights: per frame: %.3f ms, lights per creature: %.2f")
+        % (bruteForceMillis / kFrameCount)
+        % (bruteForceLights / static_cast<float>(kFrameCount * kCreatureCount)) << endl;
+
+    // Light grid, including rebuilding it every frame
+
+    LightGrid grid;
+    int gridLights = 0;
+    start = chrono::steady_clock::now();
+
+    for (int frame = 0; frame < kFrameCount; ++frame) {
+        grid.build(lights);
+        for (auto &position : positions[frame]) {
+            grid.getLightsAt(position, kMaxLightCount, affecting);
+            gridLights += static_cast<int>(affecting.size());
+        }
+    }
+
+    end = chrono::steady_clock::now();
+    double gridMillis = chrono::duration<double, milli>(end - start).count();
+
+    cout << boost::format("light grid: per frame: %.3f ms, lights per creature: %.2f, cells: %d, speedup: %.2fx")
+        % (gridMillis / kFrameCount)
+        % (gridLights / static_cast<float>(kFrameCount * kCreatureCount))
+        % grid.cellCount()
+        % (bruteForceMillis / gridMillis) << endl;
+
+    return 0;
+}
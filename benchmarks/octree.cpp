@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Benchmark of frustum culling. Registers a large synthetic area of static
+ * objects and a crowd of moving ones in an octree, and compares culling
+ * through the octree with testing every object against the frustum.
+ */
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <boost/format.hpp>
+
+#include "glm/gtc/matrix_transform.hpp"
+
+#include "../src/scene/cameranode.h"
+#include "../src/scene/octree.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::render;
+using namespace reone::scene;
+
+static const int kStaticObjectCount = 20000;
+static const int kMovingObjectCount = 500;
+static const float kAreaSize = 2000.0f;
+static const int kFrameCount = 600;
+
+class BenchmarkSceneNode : public SceneNode {
+public:
+    BenchmarkSceneNode() : SceneNode(nullptr) {
+    }
+};
+
+static glm::mat4 getCameraTransform(int frame) {
+    float angle = glm::two_pi<float>() * frame / kFrameCount;
+
+    glm::mat4 transform(1.0f);
+    transform = glm::translate(transform, glm::vec3(0.25f * kAreaSize * glm::cos(angle), 0.25f * kAreaSize * glm::sin(angle), 2.0f));
+    transform = glm::rotate(transform, angle, glm::vec3(0.0f, 0.0f, 1.0f));
+    transform = glm::rotate(transform, glm::half_pi<float>(), glm::vec3(1.0f, 0.0f, 0.0f));
+
+    return move(transform);
+}
+
+int main(int argc, char **argv) {
+    mt19937 rng(1);
+    uniform_real_distribution<float> positionDist(-0.5f * kAreaSize, 0.5f * kAreaSize);
+    uniform_real_distribution<float> sizeDist(0.5f, 10.0f);
+    uniform_real_distribution<float> stepDist(-0.1f, 0.1f);
+
+    vector<unique_ptr<BenchmarkSceneNode>> sceneNodes;
+    vector<AABB> aabbs;
+    Octree octree;
+
+    for (int i = 0; i < kStaticObjectCount + kMovingObjectCount; ++i) {
+        glm::vec3 min(positionDist(rng), positionDist(rng), 0.0f);
+        glm::vec3 size(sizeDist(rng), sizeDist(rng), sizeDist(rng));
+
+        sceneNodes.push_back(make_unique<BenchmarkSceneNode>());
+        aabbs.push_back(AABB(min, min + size));
+        octree.registerObject(sceneNodes.back().get(), aabbs.back());
+    }
+    octree.build();
+
+    CameraSceneNode camera(nullptr, glm::perspective(glm::radians(55.0f), 16.0f / 9.0f, 0.1f, 200.0f));
+
+    cout << boost::format("%d static objects, %d moving objects, %d frames") % kStaticObjectCount % kMovingObjectCount % kFrameCount << endl;
+
+    // Brute force
+
+    auto start = chrono::steady_clock::now();
+    int bruteForceVisible = 0;
+
+    for (int frame = 0; frame < kFrameCount; ++frame) {
+        camera.setLocalTransform(getCameraTransform(frame));
+        for (auto &aabb : aabbs) {
+            if (camera.isInFrustum(aabb)) {
+                ++bruteForceVisible;
+            }
+        }
+    }
+
+    auto end = chrono::steady_clock::now();
+    double bruteForceMillis = chrono::duration<double, milli>(end - start).count();
+
+    cout << boost::format("brute force: per frame: %.3f ms, visible: %d")
+        % (bruteForceMillis / kFrameCount) % (bruteForceVisible / kFrameCount) << endl;
+
+    // Octree, including incremental updates of moving objects
+
+    vector<SceneNode *> visible;
+    CullingStats stats;
+    int octreeVisible = 0;
+    int rebuildCount = 0;
+    start = chrono::steady_clock::now();
+
+    for (int frame = 0; frame < kFrameCount; ++frame) {
+        for (int i = kStaticObjectCount; i < kStaticObjectCount + kMovingObjectCount; ++i) {
+            glm::vec3 step(stepDist(rng), stepDist(rng), 0.0f);
+            aabbs[i] = AABB(aabbs[i].min() + step, aabbs[i].max() + step);
+            octree.updateObject(sceneNodes[i].get(), aabbs[i]);
+        }
+        if (octree.needsRebuild()) {
+            octree.build();
+            ++rebuildCount;
+        }
+        camera.setLocalTransform(getCameraTransform(frame));
+        octree.getNodesInFrustum(camera, visible, stats);
+        octreeVisible += static_cast<int>(visible.size());
+    }
+
+    end = chrono::steady_clock::now();
+    double octreeMillis = chrono::duration<double, milli>(end - start).count();
+
+    cout << boost::format("octree: per frame: %.3f ms, visible: %d, visited nodes: %d, visited objects: %d, culled nodes: %d, culled objects: %d, rebuilds: %d, speedup: %.2fx")
+        % (octreeMillis / kFrameCount)
+        % (octreeVisible / kFrameCount)
+        % (stats.visitedNodes / kFrameCount)
+        % (stats.visitedObjects / kFrameCount)
+        % (stats.culledNodes / kFrameCount)
+        % (stats.culledObjects / kFrameCount)
+        % rebuildCount
+        % (bruteForceMillis / octreeMillis) << endl;
+
+    return 0;
+}
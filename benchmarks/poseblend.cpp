@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Benchmark of pose blending. Blends pairs of local poses, as animation
+ * transitions do, either by decomposing local matrices as the animator
+ * used to, or by interpolating orientations of whole poses at once.
+ */
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <boost/format.hpp>
+
+#include "glm/gtc/quaternion.hpp"
+#include "glm/gtc/matrix_transform.hpp"
+#include "glm/gtx/quaternion.hpp"
+
+#include "../src/scene/poseblend.h"
+
+using namespace std;
+
+using namespace reone::scene;
+
+static const int kJointCount = 56;
+static const int kPoseCount = 1000;
+static const int kIterationCount = 100;
+
+static vector<glm::quat> makeOrientations(mt19937 &rng) {
+    uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    vector<glm::quat> orientations;
+    for (int i = 0; i < kJointCount * kPoseCount; ++i) {
+        orientations.push_back(glm::normalize(glm::quat(dist(rng), dist(rng), dist(rng), dist(rng))));
+    }
+    return move(orientations);
+}
+
+static void measure(const string &name, const function<void(float)> &blend) {
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < kIterationCount; ++i) {
+        blend(i / static_cast<float>(kIterationCount));
+    }
+
+    auto end = chrono::steady_clock::now();
+    double millis = chrono::duration<double, milli>(end - start).count();
+    double jointsPerMicro = kIterationCount * kPoseCount * kJointCount / (1000.0 * millis);
+
+    cout << boost::format("%-24s total: %.2f ms, per pose: %.3f us, joints per us: %.1f")
+        % name % millis % (1000.0 * millis / (kIterationCount * kPoseCount)) % jointsPerMicro << endl;
+}
+
+int main(int argc, char **argv) {
+    mt19937 rng(1);
+    vector<glm::quat> orientations0(makeOrientations(rng));
+    vector<glm::quat> orientations1(makeOrientations(rng));
+    vector<glm::vec3> positions(kJointCount * kPoseCount, glm::vec3(0.0f, 0.0f, 0.1f));
+    vector<glm::quat> blended(kJointCount * kPoseCount);
+    vector<glm::mat4> transforms0;
+    vector<glm::mat4> transforms1;
+    vector<glm::mat4> result(kJointCount * kPoseCount);
+
+    for (size_t i = 0; i < orientations0.size(); ++i) {
+        transforms0.push_back(glm::translate(glm::mat4(1.0f), positions[i]) * glm::mat4_cast(orientations0[i]));
+        transforms1.push_back(glm::translate(glm::mat4(1.0f), positions[i]) * glm::mat4_cast(orientations1[i]));
+    }
+
+    cout << boost::format("%d poses, %d joints, %d iterations") % kPoseCount % kJointCount % kIterationCount << endl;
+
+    measure("matrix decomposition", [&](float t) {
+        for (size_t i = 0; i < transforms0.size(); ++i) {
+            glm::quat orientation(glm::slerp(glm::toQuat(transforms1[i]), glm::toQuat(transforms0[i]), t));
+            result[i] = glm::translate(glm::mat4(1.0f), glm::vec3(transforms0[i][3])) * glm::mat4_cast(orientation);
+        }
+    });
+    measure("scalar slerp", [&](float t) {
+        for (size_t i = 0; i < orientations0.size(); ++i) {
+            blended[i] = glm::slerp(orientations1[i], orientations0[i], t);
+        }
+    });
+    measure("batched slerp", [&](float t) {
+        for (int pose = 0; pose < kPoseCount; ++pose) {
+            int offset = pose * kJointCount;
+            slerpQuats(&orientations1[offset], &orientations0[offset], t, kJointCount, &blended[offset]);
+        }
+    });
+    measure("batched nlerp", [&](float t) {
+        for (int pose = 0; pose < kPoseCount; ++pose) {
+            int offset = pose * kJointCount;
+            nlerpQuats(&orientations1[offset], &orientations0[offset], t, kJointCount, &blended[offset]);
+        }
+    });
+    measure("batched slerp, matrices", [&](float t) {
+        for (int pose = 0; pose < kPoseCount; ++pose) {
+            int offset = pose * kJointCount;
+            slerpQuats(&orientations1[offset], &orientations0[offset], t, kJointCount, &blended[offset]);
+        }
+        for (size_t i = 0; i < blended.size(); ++i) {
+            result[i] = glm::mat4_cast(blended[i]);
+            result[i][3] = glm::vec4(positions[i], 1.0f);
+        }
+    });
+
+    return 0;
+}
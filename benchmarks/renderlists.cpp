@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Benchmark of collecting meshes and lights for rendering. Compares
+ * traversing scene trees and casting every node to its type, as scene
+ * graphs used to do, with reading render lists kept by models.
+ */
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stack>
+#include <string>
+#include <vector>
+
+#include <boost/format.hpp>
+
+#include "glm/gtc/matrix_transform.hpp"
+#include "glm/gtc/quaternion.hpp"
+
+#include "../src/render/model/model.h"
+#include "../src/render/texture.h"
+#include "../src/scene/lightnode.h"
+#include "../src/scene/modelnodescenenode.h"
+#include "../src/scene/modelscenenode.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::render;
+using namespace reone::scene;
+
+static const int kModelCount = 400;
+static const int kNodeCount = 60;
+static const int kFrameCount = 600;
+
+static shared_ptr<Model> buildModel() {
+    vector<shared_ptr<ModelNode>> nodes;
+
+    for (int i = 0; i < kNodeCount; ++i) {
+        ModelNode *parent = i > 0 ? nodes[(i - 1) / 2].get() : nullptr;
+        shared_ptr<ModelNode> node(new ModelNode(i, parent, i, "node" + to_string(i), glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f)));
+        if (i % 2 == 0) {
+            node->setMesh(make_shared<ModelMesh>(true, 0));
+        }
+        if (i % 10 == 0) {
+            node->setLight(make_shared<ModelNode::Light>());
+        }
+        if (parent) {
+            nodes[(i - 1) / 2]->addChild(node);
+        }
+        nodes.push_back(move(node));
+    }
+
+    vector<unique_ptr<Animation>> anims;
+    shared_ptr<Model> model(new Model("model", nodes[0], anims));
+    model->setClassification(Model::Classification::Character);
+
+    return move(model);
+}
+
+struct RenderLists {
+    vector<ModelNodeSceneNode *> opaqueMeshes;
+    vector<ModelNodeSceneNode *> transparentMeshes;
+    vector<LightSceneNode *> lights;
+
+    void clear() {
+        opaqueMeshes.clear();
+        transparentMeshes.clear();
+        lights.clear();
+    }
+};
+
+static void traverse(SceneNode &root, RenderLists &lists) {
+    stack<SceneNode *> nodes;
+    nodes.push(&root);
+
+    while (!nodes.empty()) {
+        SceneNode *node = nodes.top();
+        nodes.pop();
+
+        ModelSceneNode *model = dynamic_cast<ModelSceneNode *>(node);
+        if (model) {
+            if (!model->isVisible() || !model->isOnScreen()) continue;
+
+        } else {
+            ModelNodeSceneNode *modelNode = dynamic_cast<ModelNodeSceneNode *>(node);
+            if (modelNode) {
+                if (modelNode->shouldRender()) {
+                    if (modelNode->isTransparent()) {
+                        lists.transparentMeshes.push_back(modelNode);
+                    } else {
+                        lists.opaqueMeshes.push_back(modelNode);
+                    }
+                }
+            } else {
+                LightSceneNode *light = dynamic_cast<LightSceneNode *>(node);
+                if (light) {
+                    lists.lights.push_back(light);
+                }
+            }
+        }
+        for (auto &child : node->children()) {
+            nodes.push(child.get());
+        }
+    }
+}
+
+static void collect(const ModelSceneNode &model, RenderLists &lists) {
+    if (!model.isVisible() || !model.isOnScreen()) return;
+
+    lists.opaqueMeshes.insert(lists.opaqueMeshes.end(), model.opaqueMeshes().begin(), model.opaqueMeshes().end());
+    lists.transparentMeshes.insert(lists.transparentMeshes.end(), model.transparentMeshes().begin(), model.transparentMeshes().end());
+    lists.lights.insert(lists.lights.end(), model.lights().begin(), model.lights().end());
+
+    for (auto &attached : model.attachedModels()) {
+        collect(*attached, lists);
+    }
+}
+
+int main(int argc, char **argv) {
+    shared_ptr<Model> model(buildModel());
+    shared_ptr<Texture> texture(new Texture("texture", TextureType::Diffuse));
+
+    vector<unique_ptr<ModelSceneNode>> models;
+    for (int i = 0; i < kModelCount; ++i) {
+        unique_ptr<ModelSceneNode> sceneNode(new ModelSceneNode(nullptr, model));
+        sceneNode->setTextureOverride(texture);
+        sceneNode->setLocalTransform(glm::translate(glm::mat4(1.0f), glm::vec3(i % 20, i / 20, 0.0f)));
+        sceneNode->setVisible(i % 8 != 0);
+        models.push_back(move(sceneNode));
+    }
+
+    cout << boost::format("%d models, %d nodes per model, %d frames") % kModelCount % kNodeCount % kFrameCount << endl;
+
+    RenderLists lists;
+    size_t traversedCount = 0;
+    auto start = chrono::steady_clock::now();
+
+    for (int frame = 0; frame < kFrameCount; ++frame) {
+        lists.clear();
+        for (auto &sceneNode : models) {
+            traverse(*sceneNode, lists);
+        }
+        traversedCount += lists.opaqueMeshes.size() + lists.transparentMeshes.size() + lists.lights.size();
+    }
+
+    auto end = chrono::steady_clock::now();
+    double traversalMillis = chrono::duration<double, milli>(end - start).count();
+
+    cout << boost::format("traversal: per frame: %.3f ms, meshes and lights: %d")
+        % (traversalMillis / kFrameCount) % (traversedCount / kFrameCount) << endl;
+
+    size_t collectedCount = 0;
+    start = chrono::steady_clock::now();
+
+    for (int frame = 0; frame < kFrameCount; ++frame) {
+        lists.clear();
+        for (auto &sceneNode : models) {
+            collect(*sceneNode, lists);
+        }
+        collectedCount += lists.opaqueMeshes.size() + lists.transparentMeshes.size() + lists.lights.size();
+    }
+
+    end = chrono::steady_clock::now();
+    double collectionMillis = chrono::duration<double, milli>(end - start).count();
+
+    cout << boost::format("render lists: per frame: %.3f ms, meshes and lights: %d, speedup: %.2fx")
+        % (collectionMillis / kFrameCount) % (collectedCount / kFrameCount) % (traversalMillis / collectionMillis) << endl;
+
+    return 0;
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Benchmark of building render queue passes on one and several threads.
+ * Reports wall time of prepare, CPU time of building commands and uniforms
+ * summed over threads, and prepare throughput in draw items per
+ * millisecond. Submission, which always runs on the calling thread, goes to
+ * the null graphics device and is reported separately for reference.
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <boost/format.hpp>
+
+#include "glm/gtc/matrix_transform.hpp"
+
+#include "../src/common/jobs.h"
+#include "../src/render/device/null.h"
+#include "../src/render/instancebuffer.h"
+#include "../src/render/mesh/modelmesh.h"
+#include "../src/render/renderqueue.h"
+#include "../src/render/renderstate.h"
+#include "../src/render/shaders.h"
+#include "../src/render/texture.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::render;
+
+static const int kItemCount = 20000;
+static const int kMeshCount = 64;
+static const int kTextureCount = 32;
+static const int kLightCount = 8;
+static const int kFrameCount = 200;
+
+/**
+ * Fills uniforms the way scene nodes do, transforming lights into shader
+ * lights and copying transforms.
+ */
+class BenchmarkDrawable : public IDrawable {
+public:
+    BenchmarkDrawable(const Mesh *mesh, const glm::mat4 &transform, const vector<glm::vec3> &lights) :
+        _mesh(mesh),
+        _transform(transform),
+        _lights(lights) {
+    }
+
+    void getUniforms(LocalUniforms &locals, bool instanced) const override {
+        if (instanced) {
+            locals.features.instancingEnabled = true;
+        } else {
+            locals.model = _transform;
+        }
+        locals.features.lightingEnabled = true;
+        locals.lighting.ambientColor = glm::vec3(0.2f);
+
+        glm::vec3 position(_transform[3]);
+        for (auto &light : _lights) {
+            ShaderLight shaderLight;
+            shaderLight.position = glm::vec4(light, 1.0f);
+            shaderLight.radius = glm::distance(light, position);
+            shaderLight.color = glm::normalize(light);
+            locals.lighting.lights.push_back(move(shaderLight));
+        }
+    }
+
+    void draw() const override {
+        _mesh->drawTriangles();
+    }
+
+    void drawInstanced(int count) const override {
+        _mesh->drawTrianglesInstanced(count);
+    }
+
+private:
+    const Mesh *_mesh;
+    glm::mat4 _transform;
+    const vector<glm::vec3> &_lights;
+};
+
+struct PrepareReport {
+    double averagePrepareTime { 0.0 }; // milliseconds
+    double maxPrepareTime { 0.0 }; // milliseconds
+    double buildTime { 0.0 }; // milliseconds per frame
+    double submitTime { 0.0 }; // milliseconds per frame
+    int threads { 0 };
+};
+
+int main(int argc, char **argv) {
+    setGraphicsDevice(make_unique<NullGraphicsDevice>(800, 600));
+    RenderState::instance().initGL();
+    Shaders::instance().initGL();
+    InstanceBuffer::instance().initGL();
+
+    vector<unique_ptr<ModelMesh>> meshes;
+    for (int i = 0; i < kMeshCount; ++i) {
+        meshes.push_back(make_unique<ModelMesh>(true, 0));
+    }
+    vector<unique_ptr<Texture>> textures;
+    for (int i = 0; i < kTextureCount; ++i) {
+        textures.push_back(make_unique<Texture>("texture" + to_string(i), TextureType::Diffuse));
+    }
+    vector<glm::vec3> lights;
+    for (int i = 0; i < kLightCount; ++i) {
+        lights.push_back(glm::vec3(10.0f * i, 5.0f, 1.0f));
+    }
+    vector<unique_ptr<BenchmarkDrawable>> drawables;
+    for (int i = 0; i < kItemCount; ++i) {
+        glm::mat4 transform(glm::translate(glm::mat4(1.0f), glm::vec3(i % 100, i / 100, 0.0f)));
+        drawables.push_back(make_unique<BenchmarkDrawable>(meshes[i % kMeshCount].get(), transform, lights));
+    }
+
+    cout << boost::format("%d draw items, %d meshes, %d textures, %d frames") % kItemCount % kMeshCount % kTextureCount % kFrameCount << endl;
+
+    RenderQueue queue;
+    double serialPrepareTime = 0.0;
+
+    for (int threadCount : { 1, 2, 4, 8 }) {
+        PrepareReport report;
+
+        for (int frame = 0; frame < kFrameCount; ++frame) {
+            queue.clear();
+            for (int i = 0; i < kItemCount; ++i) {
+                DrawItem item;
+                item.program = ShaderProgram::ModelModel;
+                item.textures[0] = textures[i % kTextureCount].get();
+                item.mesh = meshes[i % kMeshCount].get();
+                item.drawable = drawables[i].get();
+                item.instanceState = i % 3 == 0 ? 1 : 0;
+                queue.add(i % 10 == 0 ? RenderPass::Transparent : RenderPass::Opaque, item, static_cast<float>(i % 100));
+            }
+            queue.prepare(threadCount);
+            queue.render();
+            getGraphicsDevice().endFrame();
+
+            const RenderQueueStats &stats = queue.stats();
+            report.averagePrepareTime += stats.prepareTime / kFrameCount;
+            report.maxPrepareTime = max(report.maxPrepareTime, static_cast<double>(stats.prepareTime));
+            report.buildTime += stats.buildTime / kFrameCount;
+            report.submitTime += stats.submitTime / kFrameCount;
+            report.threads = stats.threads;
+        }
+        if (threadCount == 1) {
+            serialPrepareTime = report.averagePrepareTime;
+        }
+
+        cout << boost::format("%d thread(s): prepare: avg %.3f ms, max %.3f ms, build: %.3f ms, throughput: %.1f items/ms, speedup: %.2fx, submit: %.3f ms")
+            % report.threads % report.averagePrepareTime % report.maxPrepareTime % report.buildTime
+            % (kItemCount / report.averagePrepareTime) % (serialPrepareTime / report.averagePrepareTime) % report.submitTime << endl;
+    }
+
+    InstanceBuffer::instance().deinitGL();
+    Shaders::instance().deinitGL();
+    JobExecutor::instance().deinit();
+
+    return 0;
+}
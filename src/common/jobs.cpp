@@ -17,6 +17,11 @@
 
 #include "jobs.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
 #include <thread>
 
 #include <boost/asio/post.hpp>
@@ -59,4 +64,65 @@ void JobExecutor::await() {
     }
 }
 
+struct JobExecutor::ParallelForState {
+    mutex lock;
+    condition_variable finished;
+    int jobsRemaining { 0 };
+    exception_ptr error;
+
+    void run(const function<void(int, int, int)> &fn, int batch, int begin, int end) {
+        try {
+            fn(batch, begin, end);
+        } catch (...) {
+            lock_guard<mutex> guard(lock);
+            if (!error) {
+                error = current_exception();
+            }
+        }
+    }
+};
+
+int JobExecutor::parallelFor(int itemCount, int threadCount, const function<void(int, int, int)> &fn) {
+    int batchCount = min(max(threadCount, 1), itemCount);
+    if (batchCount <= 1) {
+        fn(0, 0, itemCount);
+        return 1;
+    }
+    int batchSize = (itemCount + batchCount - 1) / batchCount;
+
+    // Jobs share ownership of the state, and fn outlives them, as this
+    // function does not return before all jobs are finished
+    auto state = make_shared<ParallelForState>();
+
+    int batch = 1;
+    for (int begin = batchSize; begin < itemCount; begin += batchSize) {
+        int end = min(begin + batchSize, itemCount);
+        {
+            lock_guard<mutex> guard(state->lock);
+            ++state->jobsRemaining;
+        }
+        enqueue([state, &fn, batch, begin, end](const atomic_bool &cancel) {
+            state->run(fn, batch, begin, end);
+
+            lock_guard<mutex> guard(state->lock);
+            if (--state->jobsRemaining == 0) {
+                state->finished.notify_all();
+            }
+        });
+        ++batch;
+    }
+    state->run(fn, 0, 0, batchSize);
+
+    // Sync point
+
+    unique_lock<mutex> guard(state->lock);
+    state->finished.wait(guard, [&state]() { return state->jobsRemaining == 0; });
+
+    if (state->error) {
+        rethrow_exception(state->error);
+    }
+
+    return batch;
+}
+
 } // namespace reone
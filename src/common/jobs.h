@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
+
 #include <boost/asio/thread_pool.hpp>
 
 namespace reone {
@@ -32,7 +35,20 @@ public:
     void cancel();
     void await();
 
+    /**
+     * Splits items into at most threadCount batches of consecutive items,
+     * runs all but the first batch on workers and the first one on the
+     * calling thread, and blocks until all of them are finished. If any
+     * batch throws, the first exception is rethrown after that.
+     *
+     * @param fn function of batch index, first and last item of the batch
+     * @return number of batches
+     */
+    int parallelFor(int itemCount, int threadCount, const std::function<void(int, int, int)> &fn);
+
 private:
+    struct ParallelForState;
+
     boost::asio::thread_pool _pool;
     std::atomic_bool _cancel { false };
     std::atomic_int _jobsActive { 0 };
@@ -88,6 +88,7 @@ void CreatureBlueprint::loadSkills(const GffStruct &utc) {
 void CreatureBlueprint::loadScripts(const GffStruct &utc) {
     _onSpawn = utc.getString("ScriptSpawn");
     _onUserDefined = utc.getString("ScriptUserDefine");
+    _onHeartbeat = utc.getString("ScriptHeartbeat");
 }
 
 const string &CreatureBlueprint::tag() const {
@@ -130,6 +131,10 @@ const string &CreatureBlueprint::onUserDefined() const {
     return _onUserDefined;
 }
 
+const string &CreatureBlueprint::onHeartbeat() const {
+    return _onHeartbeat;
+}
+
 } // namespace game
 
 } // namespace reone
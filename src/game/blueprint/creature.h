@@ -45,6 +45,7 @@ public:
     const CreatureAttributes &attributes() const;
     const std::string &onSpawn() const;
     const std::string &onUserDefined() const;
+    const std::string &onHeartbeat() const;
 
 private:
     std::string _tag;
@@ -60,6 +61,7 @@ private:
 
     std::string _onSpawn;
     std::string _onUserDefined;
+    std::string _onHeartbeat;
 
     // END Scripts
 
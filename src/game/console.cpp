@@ -17,6 +17,10 @@
 
 #include "console.h"
 
+#include <sstream>
+
+#include <boost/algorithm/string.hpp>
+
 #include "glm/ext.hpp"
 
 #include "../render/font.h"
@@ -24,18 +28,21 @@
 #include "../render/mesh/quad.h"
 #include "../render/shaders.h"
 #include "../resource/resources.h"
+#include "../script/profiler.h"
 #include "../common/log.h"
 
 using namespace std;
 
 using namespace reone::gui;
 using namespace reone::render;
+using namespace reone::script;
 
 namespace reone {
 
 namespace game {
 
 static const int kLineCount = 10;
+static const int kProfileReportScriptCount = 10;
 
 Console::Console(const GraphicsOptions &opts) : _opts(opts), _input(kTextInputConsole) {
 }
@@ -87,6 +94,41 @@ bool Console::handleKeyUp(const SDL_KeyboardEvent &event) {
 
 void Console::executeInputText() {
     debug(boost::format("Console: execute \"%s\"") % _input.text());
+
+    vector<string> tokens;
+    string text(boost::trim_copy(_input.text()));
+    boost::split(tokens, text, boost::is_space(), boost::token_compress_on);
+
+    if (tokens[0] == "profile") {
+        executeProfile(tokens);
+    } else {
+        warn("Console: unknown command: " + tokens[0]);
+    }
+}
+
+void Console::executeProfile(const vector<string> &tokens) {
+    ScriptProfiler &profiler = ScriptProfiler::instance();
+    string arg(tokens.size() > 1 ? tokens[1] : "report");
+
+    if (arg == "on") {
+        profiler.setEnabled(true);
+        info("Console: script profiler enabled");
+    } else if (arg == "off") {
+        profiler.setEnabled(false);
+        info("Console: script profiler disabled");
+    } else if (arg == "reset") {
+        profiler.reset();
+    } else if (arg == "dump") {
+        profiler.dump();
+    } else if (arg == "report") {
+        istringstream report(profiler.getReport(kProfileReportScriptCount));
+        string line;
+        while (getline(report, line)) {
+            info(line);
+        }
+    } else {
+        warn("Console: usage: profile [on|off|reset|dump|report]");
+    }
 }
 
 void Console::render() const {
@@ -20,6 +20,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "SDL2/SDL_events.h"
 
@@ -53,6 +54,7 @@ private:
     bool handleKeyDown(const SDL_KeyboardEvent &event);
     bool handleKeyUp(const SDL_KeyboardEvent &event);
     void executeInputText();
+    void executeProfile(const std::vector<std::string> &tokens);
 };
 
 } // namespace game
@@ -26,6 +26,7 @@
 #include "../render/textures.h"
 #include "../render/walkmeshes.h"
 #include "../resource/resources.h"
+#include "../script/profiler.h"
 #include "../script/scripts.h"
 #include "../common/jobs.h"
 #include "../common/log.h"
@@ -36,6 +37,7 @@
 #include "blueprint/blueprints.h"
 #include "cursors.h"
 #include "script/routines.h"
+#include "script/scheduler.h"
 
 using namespace std;
 
@@ -94,10 +96,12 @@ void Game::init() {
 
     Resources::instance().init(_version, _path);
     Cursors::instance().init(_version);
-    Models::instance().init(_version);
+    Models::instance().init(_version, _options.graphics.compressAnimations);
     Textures::instance().init(_version);
     AudioPlayer::instance().init(_options.audio);
     Routines::instance().init(_version, this);
+    Scripts::instance().setRoutines(&Routines::instance());
+    ScriptScheduler::instance().setFrameBudget(_options.scripts.frameBudget);
 
     setCursorType(CursorType::Default);
 
@@ -431,11 +435,15 @@ void Game::update() {
     }
 
     _window.update(dt);
+
+    ScriptScheduler::instance().update();
+    ScriptProfiler::instance().update(dt);
 }
 
 void Game::loadNextModule() {
     JobExecutor::instance().cancel();
     JobExecutor::instance().await();
+    ScriptScheduler::instance().clear();
 
     loadModule(_nextModule, _nextEntry);
 
@@ -463,6 +471,7 @@ void Game::loadCharacterGeneration() {
 
 void Game::deinit() {
     JobExecutor::instance().deinit();
+    Scripts::instance().setRoutines(nullptr);
     Routines::instance().deinit();
     AudioPlayer::instance().deinit();
     Cursors::instance().deinit();
@@ -29,6 +29,7 @@
 #include "../../resource/lytfile.h"
 #include "../../resource/visfile.h"
 #include "../../resource/resources.h"
+#include "../../script/scripts.h"
 #include "../../scene/cubenode.h"
 #include "../../common/log.h"
 #include "../../common/streamutil.h"
@@ -37,6 +38,7 @@
 #include "../blueprint/sound.h"
 #include "../game.h"
 #include "../room.h"
+#include "../script/routines.h"
 #include "../script/util.h"
 
 #include "objectfactory.h"
@@ -62,13 +64,15 @@ static const float kMaxDistanceToTestCollision = 64.0f;
 static const float kElevationTestZ = 1024.0f;
 static const float kCreatureObstacleTestZ = 0.1f;
 static const int kMaxSoundCount = 4;
+static const float kHeartbeatInterval = 6.0f;
 
 Area::Area(uint32_t id, Game *game) :
     Object(id, ObjectType::Area),
     _game(game),
     _collisionDetector(this),
     _objectSelector(this, &game->party()),
-    _actionExecutor(game) {
+    _actionExecutor(game),
+    _heartbeats(&Routines::instance(), bind(&Routines::isParallelSafe, &Routines::instance(), _1)) {
 
     if (!game) {
         throw invalid_argument("Game must not be null");
@@ -81,6 +85,7 @@ void Area::load(const string &name, const GffStruct &are, const GffStruct &git)
     _name = name;
 
     loadLYT();
+    loadStaticGeometry();
     loadVIS();
     loadPTH();
     loadARE(are);
@@ -105,6 +110,22 @@ void Area::loadLYT() {
     }
 }
 
+void Area::loadStaticGeometry() {
+    vector<ModelSceneNode *> models;
+    for (auto &room : _rooms) {
+        shared_ptr<ModelSceneNode> model(room.second->model());
+        if (model) {
+            models.push_back(model.get());
+        }
+    }
+    _staticGeometry = make_shared<StaticGeometry>();
+    _staticGeometry->build(models);
+    _staticGeometry->initGL();
+
+    const StaticGeometryStats &stats = _staticGeometry->stats();
+    debug(boost::format("Area: %d room meshes merged into %d batches") % stats.batchedMeshes % stats.batches, 2);
+}
+
 void Area::loadVIS() {
     VisFile vis;
     vis.load(wrap(Resources::instance().get(_name, ResourceType::Vis)));
@@ -520,13 +541,11 @@ bool Area::getElevationAt(const glm::vec2 &position, const SpatialObject *except
 
 void Area::update(float dt) {
     doDestroyObjects();
+    updateHeartbeats(dt);
 
     Object::update(dt);
     _actionExecutor.executeActions(*this, dt);
 
-    for (auto &room : _rooms) {
-        room.second->update(dt);
-    }
     updateVisibility();
     updateSounds();
 
@@ -534,9 +553,58 @@ void Area::update(float dt) {
         object->update(dt);
         _actionExecutor.executeActions(*object, dt);
     }
+    updateAnimations(dt);
     _objectSelector.update();
 }
 
+void Area::updateAnimations(float dt) {
+    _animations.clear();
+
+    for (auto &room : _rooms) {
+        shared_ptr<ModelSceneNode> model(room.second->model());
+        if (model) {
+            _animations.add(model.get());
+        }
+    }
+    for (auto &object : _objects) {
+        shared_ptr<ModelSceneNode> model(object->model());
+        if (model) {
+            _animations.add(model.get());
+        }
+    }
+    _animations.run(dt, _game->options().graphics.animationThreads);
+}
+
+void Area::updateHeartbeats(float dt) {
+    _heartbeatTimer += dt;
+    if (_heartbeatTimer < kHeartbeatInterval) return;
+
+    _heartbeatTimer = 0.0f;
+    runHeartbeatScripts();
+}
+
+void Area::runHeartbeatScripts() {
+    _heartbeats.clear();
+
+    if (!_onHeartbeat.empty()) {
+        shared_ptr<ScriptProgram> program(Scripts::instance().get(_onHeartbeat));
+        if (program) {
+            _heartbeats.add(program, _id);
+        }
+    }
+    for (auto &object : _objects) {
+        if (object->onHeartbeat().empty()) continue;
+
+        shared_ptr<ScriptProgram> program(Scripts::instance().get(object->onHeartbeat()));
+        if (program) {
+            _heartbeats.add(program, object->id());
+        }
+    }
+    _heartbeats.run(_game->options().scripts.parallelHeartbeats);
+
+    debug(boost::format("Area: heartbeats: %d parallel, %d serial") % _heartbeats.parallelCount() % _heartbeats.serialCount(), 2);
+}
+
 bool Area::moveCreatureTowards(Creature &creature, const glm::vec2 &dest, bool run, float dt) {
     glm::vec3 position(creature.position());
     glm::vec2 delta(dest - glm::vec2(position));
@@ -612,17 +680,19 @@ void Area::destroyObject(const SpatialObject &object) {
 
 void Area::fill(SceneGraph &sceneGraph) {
     sceneGraph.clear();
+    sceneGraph.setStaticGeometry(_staticGeometry);
 
     for (auto &room : _rooms) {
         shared_ptr<ModelSceneNode> sceneNode(room.second->model());
         if (sceneNode) {
-            sceneGraph.addRoot(sceneNode);
+            sceneGraph.addRoot(sceneNode, true);
         }
     }
     for (auto &object : _objects) {
         shared_ptr<ModelSceneNode> sceneNode(object->model());
         if (sceneNode) {
-            sceneGraph.addRoot(sceneNode);
+            bool isStatic = object->type() == ObjectType::Placeable || object->type() == ObjectType::Door;
+            sceneGraph.addRoot(sceneNode, isStatic);
         }
     }
     sceneGraph.build();
@@ -704,6 +774,11 @@ void Area::updateVisibility() {
 
     shared_ptr<CameraSceneNode> cameraNode(camera->sceneNode());
     glm::vec4 viewport(-1.0f, -1.0f, 1.0f, 1.0f);
+    const AnimationLODOptions &lodOptions = _game->options().graphics.animationLOD;
+
+    // Bounding boxes of all objects are transformed and tested against the frustum at once
+    _visibleObjects.clear();
+    _objectBoxes.clear();
 
     for (auto &object : _objects) {
         if (!object->visible()) continue;
@@ -711,12 +786,21 @@ void Area::updateVisibility() {
         shared_ptr<ModelSceneNode> model(object->model());
         if (!model) continue;
 
-        AABB aabb(model->aabb() * model->absoluteTransform());
+        _visibleObjects.push_back(object.get());
+        _objectBoxes.add(model->aabb(), model->absoluteTransform());
+    }
+    _objectBoxes.testPlanes(cameraNode->frustum(), kFrustumPlaneCount, _objectsInFrustum);
+
+    glm::vec3 cameraPosition(cameraNode->absoluteTransform()[3]);
+
+    for (size_t i = 0; i < _visibleObjects.size(); ++i) {
+        SpatialObject *object = _visibleObjects[i];
+        shared_ptr<ModelSceneNode> model(object->model());
+
         glm::vec3 objectCenter(model->getCenterOfAABB());
-        glm::vec3 cameraPosition(cameraNode->absoluteTransform()[3]);
         float distanceToCamera = glm::distance2(objectCenter, cameraPosition);
         float drawDistance = object->drawDistance();
-        bool onScreen = distanceToCamera < drawDistance && cameraNode->isInFrustum(aabb);
+        bool onScreen = distanceToCamera < drawDistance && _objectsInFrustum[i];
         float fadeDistance = object->fadeDistance();
         float alpha = 1.0f;
 
@@ -725,6 +809,15 @@ void Area::updateVisibility() {
         }
         model->setOnScreen(onScreen);
         model->setAlpha(alpha);
+
+        if (onScreen) {
+            // Projected height of the bounding sphere as a fraction of the viewport height
+            float distance = glm::sqrt(distanceToCamera);
+            float radius = 0.5f * glm::length(_objectBoxes.max(i) - _objectBoxes.min(i));
+            float screenSize = distance > 0.0f ? radius * cameraNode->projection()[1][1] / distance : 1.0f;
+
+            model->setAnimationLOD(getAnimationLOD(lodOptions, distance, screenSize), lodOptions.skipNodes);
+        }
     }
 }
 
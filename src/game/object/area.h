@@ -25,9 +25,12 @@
 
 #include "SDL2/SDL_events.h"
 
+#include "../../render/aabbbatch.h"
 #include "../../render/types.h"
 #include "../../resource/gfffile.h"
 #include "../../resource/types.h"
+#include "../../scene/animationbatch.h"
+#include "../../scene/staticgeometry.h"
 
 #include "../actionexecutor.h"
 #include "../camera/animatedcamera.h"
@@ -39,6 +42,7 @@
 #include "../collisiondetect.h"
 #include "../objectselect.h"
 #include "../pathfinder.h"
+#include "../script/batch.h"
 
 #include "object.h"
 
@@ -120,12 +124,15 @@ private:
     std::unique_ptr<resource::Visibility> _visibility;
     CameraStyle _cameraStyle;
     std::string _music;
+    scene::AnimationBatch _animations;
+    std::shared_ptr<scene::StaticGeometry> _staticGeometry;
 
     // Scripts
 
     std::string _onEnter;
     std::string _onExit;
-    std::string _onHeartbeat;
+    ScriptBatch _heartbeats;
+    float _heartbeatTimer { 0.0f };
 
     // END Scripts
 
@@ -150,6 +157,14 @@ private:
 
     // END Objects
 
+    // Visibility
+
+    std::vector<SpatialObject *> _visibleObjects;
+    render::AABBBatch _objectBoxes;
+    std::vector<uint8_t> _objectsInFrustum;
+
+    // END Visibility
+
     void add(const std::shared_ptr<SpatialObject> &object);
     void determineObjectRoom(SpatialObject &object);
     void doDestroyObject(uint32_t objectId);
@@ -157,7 +172,10 @@ private:
     void landObject(SpatialObject &object);
     void checkTriggersIntersection(SpatialObject &triggerrer);
     void updateVisibility();
+    void updateAnimations(float dt);
     void updateSounds();
+    void updateHeartbeats(float dt);
+    void runHeartbeatScripts();
 
     void printDebugInfo(const SpatialObject &object);
 
@@ -168,6 +186,7 @@ private:
     // Loading
 
     void loadLYT();
+    void loadStaticGeometry();
     void loadVIS();
     void loadPTH();
     void loadARE(const resource::GffStruct &are);
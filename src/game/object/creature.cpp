@@ -110,6 +110,7 @@ void Creature::load(const shared_ptr<CreatureBlueprint> &blueprint) {
     _attributes = blueprint->attributes();
     _onSpawn = blueprint->onSpawn();
     _onUserDefined = blueprint->onUserDefined();
+    _onHeartbeat = blueprint->onHeartbeat();
 }
 
 void Creature::loadAppearance(const TwoDaTable &table, int row) {
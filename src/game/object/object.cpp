@@ -38,7 +38,7 @@ void Object::update(float dt) {
 
 void Object::runUserDefinedEvent(int eventNumber) {
     if (!_onUserDefined.empty()) {
-        runScript(_onUserDefined, _id, kObjectInvalid, eventNumber);
+        queueScript(_onUserDefined, _id, kObjectInvalid, eventNumber);
     }
 }
 
@@ -58,6 +58,10 @@ const string &Object::title() const {
     return _title;
 }
 
+const string &Object::onHeartbeat() const {
+    return _onHeartbeat;
+}
+
 string Object::conversation() const {
     return "";
 }
@@ -35,12 +35,16 @@ public:
 
     virtual void update(float dt);
 
+    /**
+     * Queues the OnUserDefined script of this object for execution by ScriptScheduler.
+     */
     void runUserDefinedEvent(int eventNumber);
 
     uint32_t id() const;
     ObjectType type() const;
     const std::string &tag() const;
     const std::string &title() const;
+    const std::string &onHeartbeat() const;
     virtual std::string conversation() const;
     ActionQueue &actionQueue();
 
@@ -51,6 +55,7 @@ protected:
     std::string _title;
     ActionQueue _actionQueue;
     std::string _onUserDefined;
+    std::string _onHeartbeat;
 
     Object(uint32_t id, ObjectType type);
 
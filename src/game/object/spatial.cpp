@@ -65,13 +65,6 @@ void SpatialObject::moveItemsTo(SpatialObject &other) {
     _items.clear();
 }
 
-void SpatialObject::update(float dt) {
-    Object::update(dt);
-    if (_model) {
-        _model->update(dt);
-    }
-}
-
 void SpatialObject::playAnimation(const string &name, int flags, float speed) {
     if (_model) {
         _model->playAnimation(name, flags, speed);
@@ -40,8 +40,6 @@ class Room;
 
 class SpatialObject : public Object {
 public:
-    void update(float dt) override;
-
     virtual void playAnimation(const std::string &name, int flags = 0, float speed = 1.0f);
 
     float distanceTo(const glm::vec2 &point) const;
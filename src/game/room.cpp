@@ -45,12 +45,6 @@ void Room::removeTenant(SpatialObject *object) {
     _tenants.erase(object);
 }
 
-void Room::update(float dt) {
-    if (_model) {
-        _model->update(dt);
-    }
-}
-
 const string &Room::name() const {
     return _name;
 }
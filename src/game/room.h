@@ -41,7 +41,6 @@ public:
 
     void addTenant(SpatialObject *object);
     void removeTenant(SpatialObject *object);
-    void update(float dt);
 
     const std::string &name() const;
     const glm::vec3 &position() const;
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "batch.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "../../common/jobs.h"
+#include "../../common/log.h"
+#include "../../script/execution.h"
+
+using namespace std;
+
+using namespace reone::script;
+
+namespace reone {
+
+namespace game {
+
+ScriptBatch::ScriptBatch(IRoutineProvider *routines, const function<bool(int)> &isRoutineParallelSafe) :
+    _routines(routines),
+    _isRoutineParallelSafe(isRoutineParallelSafe) {
+}
+
+void ScriptBatch::add(const shared_ptr<ScriptProgram> &program, uint32_t callerId) {
+    Invocation invocation;
+    invocation.program = program;
+    invocation.callerId = callerId;
+    invocation.parallelSafe = isParallelSafe(*program);
+
+    _invocations.push_back(move(invocation));
+}
+
+bool ScriptBatch::isParallelSafe(const ScriptProgram &program) {
+    auto maybeSafe = _parallelSafeByProgram.find(program.name());
+    if (maybeSafe != _parallelSafeByProgram.end()) {
+        return maybeSafe->second;
+    }
+    bool safe = true;
+    for (auto &ins : program.instructions()) {
+        if (ins.second.byteCode == ByteCode::CallRoutine && !_isRoutineParallelSafe(ins.second.routine)) {
+            safe = false;
+            break;
+        }
+    }
+    _parallelSafeByProgram.insert(make_pair(program.name(), safe));
+
+    return safe;
+}
+
+void ScriptBatch::clear() {
+    _invocations.clear();
+}
+
+void ScriptBatch::run(bool parallel) {
+    vector<Invocation *> parallelSafe;
+    for (auto &invocation : _invocations) {
+        if (invocation.parallelSafe) {
+            parallelSafe.push_back(&invocation);
+        }
+    }
+    if (parallel && parallelSafe.size() > 1) {
+        int threadCount = max(1, static_cast<int>(thread::hardware_concurrency()));
+        JobExecutor::instance().parallelFor(static_cast<int>(parallelSafe.size()), threadCount, [this, &parallelSafe](int batch, int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                runInvocation(*parallelSafe[i], true);
+            }
+        });
+    } else {
+        for (auto &invocation : parallelSafe) {
+            runInvocation(*invocation, true);
+        }
+    }
+
+    // Sync point
+
+    for (auto &invocation : parallelSafe) {
+        for (auto &command : invocation->commands.commands) {
+            command();
+        }
+        invocation->commands = CommandBuffer();
+    }
+    for (auto &invocation : _invocations) {
+        if (!invocation.parallelSafe) {
+            runInvocation(invocation, false);
+        }
+    }
+}
+
+void ScriptBatch::runInvocation(Invocation &invocation, bool deferCommands) {
+    ExecutionContext ctx;
+    ctx.routines = _routines;
+    ctx.callerId = invocation.callerId;
+    ctx.commands = deferCommands ? &invocation.commands : nullptr;
+
+    try {
+        ScriptExecution(invocation.program, move(ctx)).run();
+    }
+    catch (const exception &ex) {
+        error(boost::format("ScriptBatch: script \"%s\" failed: %s") % invocation.program->name() % ex.what());
+    }
+    catch (...) {
+        error(boost::format("ScriptBatch: script \"%s\" failed") % invocation.program->name());
+    }
+}
+
+int ScriptBatch::parallelCount() const {
+    int count = 0;
+    for (auto &invocation : _invocations) {
+        if (invocation.parallelSafe) ++count;
+    }
+    return count;
+}
+
+int ScriptBatch::serialCount() const {
+    return static_cast<int>(_invocations.size()) - parallelCount();
+}
+
+} // namespace game
+
+} // namespace reone
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../script/program.h"
+#include "../../script/types.h"
+
+namespace reone {
+
+namespace game {
+
+/**
+ * Runs a batch of scripts, e.g. heartbeats of all objects in an area.
+ *
+ * Scripts that only call parallel-safe routines run concurrently on
+ * JobExecutor workers, each with its own stack and command buffer. At the
+ * sync point, after all of them are finished, command buffers are applied
+ * in the order scripts were added. Remaining scripts then run serially.
+ *
+ * Parallel-safe routines must only read game state and defer their side
+ * effects to ExecutionContext::commands. Consequently, the outcome of the
+ * batch does not depend on whether it is run in parallel.
+ */
+class ScriptBatch {
+public:
+    ScriptBatch(script::IRoutineProvider *routines, const std::function<bool(int)> &isRoutineParallelSafe);
+
+    void add(const std::shared_ptr<script::ScriptProgram> &program, uint32_t callerId);
+    void clear();
+
+    /**
+     * @param parallel whether to run parallel-safe scripts on JobExecutor workers, or serially on the calling thread
+     */
+    void run(bool parallel);
+
+    int parallelCount() const;
+    int serialCount() const;
+
+private:
+    struct Invocation {
+        std::shared_ptr<script::ScriptProgram> program;
+        uint32_t callerId { 0 };
+        bool parallelSafe { false };
+        script::CommandBuffer commands;
+    };
+
+    script::IRoutineProvider *_routines { nullptr };
+    std::function<bool(int)> _isRoutineParallelSafe;
+    std::vector<Invocation> _invocations;
+    std::unordered_map<std::string, bool> _parallelSafeByProgram;
+
+    ScriptBatch(const ScriptBatch &) = delete;
+    ScriptBatch &operator=(const ScriptBatch &) = delete;
+
+    void runInvocation(Invocation &invocation, bool deferCommands);
+
+    bool isParallelSafe(const script::ScriptProgram &program);
+};
+
+} // namespace game
+
+} // namespace reone
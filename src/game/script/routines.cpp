@@ -17,6 +17,8 @@
 
 #include "routines.h"
 
+#include <unordered_set>
+
 #include "../../common/log.h"
 
 #include "../game.h"
@@ -30,6 +32,43 @@ namespace reone {
 
 namespace game {
 
+static const unordered_set<string> kParallelSafeRoutines = {
+    "ActionCloseDoor",
+    "ActionDoCommand",
+    "ActionMoveToObject",
+    "ActionOpenDoor",
+    "ActionPauseConversation",
+    "ActionResumeConversation",
+    "ActionStartConversation",
+    "AssignCommand",
+    "DelayCommand",
+    "DestroyObject",
+    "GetArea",
+    "GetEnteringObject",
+    "GetFirstPC",
+    "GetGender",
+    "GetGlobalBoolean",
+    "GetGlobalNumber",
+    "GetIsObjectValid",
+    "GetIsPC",
+    "GetItemInSlot",
+    "GetLevelByClass",
+    "GetLoadFromSaveGame",
+    "GetLocalBoolean",
+    "GetLocalNumber",
+    "GetLocked",
+    "GetNextPC",
+    "GetObjectByTag",
+    "GetPartyMemberByIndex",
+    "GetUserDefinedEventNumber",
+    "GetWaypointByTag",
+    "IntToFloat",
+    "IsAvailableCreature",
+    "IsObjectPartyMember",
+    "SetLocalBoolean",
+    "SetLocalNumber"
+};
+
 Routines &Routines::instance() {
     static Routines instance;
     return instance;
@@ -46,6 +85,14 @@ void Routines::init(GameVersion version, Game *game) {
             addTslRoutines();
             break;
     }
+    initParallelSafe();
+}
+
+void Routines::initParallelSafe() {
+    _parallelSafe.clear();
+    for (auto &routine : _routines) {
+        _parallelSafe.push_back(kParallelSafeRoutines.count(routine.name()) > 0);
+    }
 }
 
 Routines::~Routines() {
@@ -54,6 +101,7 @@ Routines::~Routines() {
 
 void Routines::deinit() {
     _routines.clear();
+    _parallelSafe.clear();
 }
 
 void Routines::add(const std::string &name, VariableType retType, const std::vector<VariableType> &argTypes) {
@@ -73,6 +121,18 @@ const Routine &Routines::get(int index) {
     return _routines[index];
 }
 
+bool Routines::isParallelSafe(int index) const {
+    return index >= 0 && index < static_cast<int>(_parallelSafe.size()) && _parallelSafe[index];
+}
+
+void Routines::defer(ExecutionContext &ctx, const function<void()> &command) const {
+    if (ctx.commands) {
+        ctx.commands->commands.push_back(command);
+    } else {
+        command();
+    }
+}
+
 shared_ptr<Object> Routines::getObjectById(uint32_t id, const ExecutionContext &ctx) const {
     uint32_t objectId = 0;
     switch (id) {
@@ -86,6 +146,9 @@ shared_ptr<Object> Routines::getObjectById(uint32_t id, const ExecutionContext &
             objectId = id;
             break;
     }
+    if (ctx.commands && ctx.commands->destroyedObjects.count(objectId) > 0) {
+        return nullptr;
+    }
 
     shared_ptr<Module> module(_game->module());
     if (module->id() == objectId) {
@@ -43,9 +43,15 @@ public:
 
     const script::Routine &get(int index) override;
 
+    /**
+     * @return true if routine only reads game state, or defers its side effects to ExecutionContext::commands
+     */
+    bool isParallelSafe(int index) const;
+
 private:
     Game *_game { nullptr };
     std::vector<script::Routine> _routines;
+    std::vector<bool> _parallelSafe;
 
     Routines() = default;
     Routines(const Routines &) = delete;
@@ -63,6 +69,12 @@ private:
 
     void addKotorRoutines();
     void addTslRoutines();
+    void initParallelSafe();
+
+    /**
+     * Executes the command immediately, or records it to the command buffer of the execution context, if any.
+     */
+    void defer(script::ExecutionContext &ctx, const std::function<void()> &command) const;
 
     std::shared_ptr<Object> getObjectById(uint32_t id, const script::ExecutionContext &ctx) const;
     script::Variable random(const std::vector<script::Variable> &args, script::ExecutionContext &ctx);
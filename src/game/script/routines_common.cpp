@@ -54,7 +54,12 @@ Variable Routines::destroyObject(const vector<Variable> &args, ExecutionContext
     if (object) {
         shared_ptr<SpatialObject> spatial(dynamic_pointer_cast<SpatialObject>(object));
         if (spatial) {
-            _game->module()->area()->destroyObject(*spatial);
+            if (ctx.commands) {
+                ctx.commands->destroyedObjects.insert(spatial->id());
+            }
+            defer(ctx, [this, spatial]() {
+                _game->module()->area()->destroyObject(*spatial);
+            });
         }
     } else {
         warn("Routine: object not found by id: " + to_string(objectId));
@@ -215,12 +220,30 @@ Variable Routines::getGlobalNumber(const vector<Variable> &args, ExecutionContex
 
 Variable Routines::getLocalBoolean(const vector<Variable> &args, ExecutionContext &ctx) {
     shared_ptr<Object> object(getObjectById(args[0].objectId, ctx));
-    return object ? _game->getLocalBoolean(object->id(), args[1].intValue) : false;
+    if (!object) return false;
+
+    if (ctx.commands) {
+        auto maybePending = ctx.commands->localBooleans.find(make_pair(object->id(), args[1].intValue));
+        if (maybePending != ctx.commands->localBooleans.end()) {
+            return maybePending->second;
+        }
+    }
+
+    return _game->getLocalBoolean(object->id(), args[1].intValue);
 }
 
 Variable Routines::getLocalNumber(const vector<Variable> &args, ExecutionContext &ctx) {
     shared_ptr<Object> object(getObjectById(args[0].objectId, ctx));
-    return object ? _game->getLocalNumber(object->id(), args[1].intValue) : false;
+    if (!object) return false;
+
+    if (ctx.commands) {
+        auto maybePending = ctx.commands->localNumbers.find(make_pair(object->id(), args[1].intValue));
+        if (maybePending != ctx.commands->localNumbers.end()) {
+            return maybePending->second;
+        }
+    }
+
+    return _game->getLocalNumber(object->id(), args[1].intValue);
 }
 
 Variable Routines::setGlobalBoolean(const vector<Variable> &args, ExecutionContext &ctx) {
@@ -236,7 +259,16 @@ Variable Routines::setGlobalNumber(const vector<Variable> &args, ExecutionContex
 Variable Routines::setLocalBoolean(const vector<Variable> &args, ExecutionContext &ctx) {
     shared_ptr<Object> object(getObjectById(args[0].objectId, ctx));
     if (object) {
-        _game->setLocalBoolean(object->id(), args[1].intValue, args[2].intValue);
+        uint32_t objectId = object->id();
+        int index = args[1].intValue;
+        bool value = args[2].intValue;
+
+        if (ctx.commands) {
+            ctx.commands->localBooleans[make_pair(objectId, index)] = value;
+        }
+        defer(ctx, [this, objectId, index, value]() {
+            _game->setLocalBoolean(objectId, index, value);
+        });
     }
     return Variable();
 }
@@ -244,26 +276,42 @@ Variable Routines::setLocalBoolean(const vector<Variable> &args, ExecutionContex
 Variable Routines::setLocalNumber(const vector<Variable> &args, ExecutionContext &ctx) {
     shared_ptr<Object> object(getObjectById(args[0].objectId, ctx));
     if (object) {
-        _game->setLocalNumber(object->id(), args[1].intValue, args[2].intValue);
+        uint32_t objectId = object->id();
+        int index = args[1].intValue;
+        int value = args[2].intValue;
+
+        if (ctx.commands) {
+            ctx.commands->localNumbers[make_pair(objectId, index)] = value;
+        }
+        defer(ctx, [this, objectId, index, value]() {
+            _game->setLocalNumber(objectId, index, value);
+        });
     }
     return Variable();
 }
 
 Variable Routines::delayCommand(const vector<Variable> &args, ExecutionContext &ctx) {
-    unique_ptr<CommandAction> action(new CommandAction(args[1].context));
-
     shared_ptr<Object> object(getObjectById(ctx.callerId, ctx));
-    object->actionQueue().delay(move(action), args[0].floatValue);
+    ExecutionContext actionCtx(args[1].context);
+    float delay = args[0].floatValue;
+
+    defer(ctx, [object, actionCtx, delay]() {
+        unique_ptr<CommandAction> action(new CommandAction(actionCtx));
+        object->actionQueue().delay(move(action), delay);
+    });
 
     return Variable();
 }
 
 Variable Routines::assignCommand(const vector<Variable> &args, ExecutionContext &ctx) {
-    unique_ptr<CommandAction> action(new CommandAction(args[1].context));
-
     shared_ptr<Object> object(getObjectById(args[0].objectId, ctx));
     if (object) {
-        object->actionQueue().add(move(action));
+        ExecutionContext actionCtx(args[1].context);
+
+        defer(ctx, [object, actionCtx]() {
+            unique_ptr<CommandAction> action(new CommandAction(actionCtx));
+            object->actionQueue().add(move(action));
+        });
     }
 
     return Variable();
@@ -302,8 +350,12 @@ Variable Routines::getUserDefinedEventNumber(const vector<Variable> &args, Execu
 Variable Routines::actionDoCommand(const vector<Variable> &args, ExecutionContext &ctx) {
     shared_ptr<Object> actor(getObjectById(ctx.callerId, ctx));
     if (actor) {
-        unique_ptr<CommandAction> action(new CommandAction(args[0].context));
-        actor->actionQueue().add(move(action));
+        ExecutionContext actionCtx(args[0].context);
+
+        defer(ctx, [actor, actionCtx]() {
+            unique_ptr<CommandAction> action(new CommandAction(actionCtx));
+            actor->actionQueue().add(move(action));
+        });
     }
 
     return Variable();
@@ -316,8 +368,11 @@ Variable Routines::actionMoveToObject(const vector<Variable> &args, ExecutionCon
     shared_ptr<Object> actor(getObjectById(ctx.callerId, ctx));
     if (actor) {
         shared_ptr<Object> object(getObjectById(objectId, ctx));
-        unique_ptr<MoveToObjectAction> action(new MoveToObjectAction(object, distance));
-        actor->actionQueue().add(move(action));
+
+        defer(ctx, [actor, object, distance]() {
+            unique_ptr<MoveToObjectAction> action(new MoveToObjectAction(object, distance));
+            actor->actionQueue().add(move(action));
+        });
     } else {
         warn("Routine: object not found: " + to_string(objectId));
     }
@@ -334,8 +389,10 @@ Variable Routines::actionStartConversation(const vector<Variable> &args, Executi
         string dialogResRef((args.size() >= 2 && !args[1].strValue.empty()) ? args[1].strValue : actor->conversation());
         bool ignoreStartRange = args.size() >= 4 ? (args[4].intValue != 0) : false;
 
-        unique_ptr<StartConversationAction> action(new StartConversationAction(object, dialogResRef, ignoreStartRange));
-        actor->actionQueue().add(move(action));
+        defer(ctx, [actor, object, dialogResRef, ignoreStartRange]() {
+            unique_ptr<StartConversationAction> action(new StartConversationAction(object, dialogResRef, ignoreStartRange));
+            actor->actionQueue().add(move(action));
+        });
     } else {
         warn("Routine: creature not found: " + to_string(ctx.callerId));
     }
@@ -346,8 +403,10 @@ Variable Routines::actionStartConversation(const vector<Variable> &args, Executi
 Variable Routines::actionPauseConversation(const vector<Variable> &args, ExecutionContext &ctx) {
     shared_ptr<Object> actor(getObjectById(ctx.callerId, ctx));
     if (actor) {
-        unique_ptr<Action> action(new Action(ActionType::PauseConversation));
-        actor->actionQueue().add(move(action));
+        defer(ctx, [actor]() {
+            unique_ptr<Action> action(new Action(ActionType::PauseConversation));
+            actor->actionQueue().add(move(action));
+        });
     } else {
         warn("Routine: creature not found: " + to_string(ctx.callerId));
     }
@@ -358,8 +417,10 @@ Variable Routines::actionPauseConversation(const vector<Variable> &args, Executi
 Variable Routines::actionResumeConversation(const vector<Variable> &args, ExecutionContext &ctx) {
     shared_ptr<Object> actor(getObjectById(ctx.callerId, ctx));
     if (actor) {
-        unique_ptr<Action> action(new Action(ActionType::ResumeConversation));
-        actor->actionQueue().add(move(action));
+        defer(ctx, [actor]() {
+            unique_ptr<Action> action(new Action(ActionType::ResumeConversation));
+            actor->actionQueue().add(move(action));
+        });
     } else {
         warn("Routine: creature not found: " + to_string(ctx.callerId));
     }
@@ -372,8 +433,11 @@ Variable Routines::actionOpenDoor(const vector<Variable> &args, ExecutionContext
     shared_ptr<Object> actor(getObjectById(ctx.callerId, ctx));
     if (actor) {
         shared_ptr<Object> object(getObjectById(objectId, ctx));
-        unique_ptr<ObjectAction> action(new ObjectAction(ActionType::OpenDoor, object));
-        actor->actionQueue().add(move(action));
+
+        defer(ctx, [actor, object]() {
+            unique_ptr<ObjectAction> action(new ObjectAction(ActionType::OpenDoor, object));
+            actor->actionQueue().add(move(action));
+        });
     } else {
         warn("Routine: object not found: " + to_string(objectId));
     }
@@ -386,8 +450,11 @@ Variable Routines::actionCloseDoor(const vector<Variable> &args, ExecutionContex
     shared_ptr<Object> actor(getObjectById(ctx.callerId, ctx));
     if (actor) {
         shared_ptr<Object> object(getObjectById(objectId, ctx));
-        unique_ptr<ObjectAction> action(new ObjectAction(ActionType::CloseDoor, object));
-        actor->actionQueue().add(move(action));
+
+        defer(ctx, [actor, object]() {
+            unique_ptr<ObjectAction> action(new ObjectAction(ActionType::CloseDoor, object));
+            actor->actionQueue().add(move(action));
+        });
     } else {
         warn("Routine: object not found: " + to_string(objectId));
     }
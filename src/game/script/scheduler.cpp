@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "scheduler.h"
+
+#include <chrono>
+#include <stdexcept>
+
+#include <boost/format.hpp>
+
+#include "../../common/log.h"
+
+using namespace std;
+
+using namespace reone::script;
+
+namespace reone {
+
+namespace game {
+
+ScriptScheduler &ScriptScheduler::instance() {
+    static ScriptScheduler instance;
+    return instance;
+}
+
+void ScriptScheduler::enqueue(const shared_ptr<ScriptProgram> &program, const ExecutionContext &ctx) {
+    unique_ptr<ScriptExecution> execution(new ScriptExecution(program, ctx));
+    execution->setInstructionBudget(_sliceInstructionCount);
+
+    _queue.push_back(move(execution));
+}
+
+void ScriptScheduler::update() {
+    if (_queue.empty()) return;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    chrono::steady_clock::time_point deadline = start + chrono::microseconds(static_cast<int64_t>(1000.0f * _frameBudget));
+    int slices = 0;
+
+    // The first slice runs regardless of the budget, so that the queue always progresses
+    do {
+        unique_ptr<ScriptExecution> execution(move(_queue.front()));
+        _queue.pop_front();
+
+        int64_t remaining = chrono::duration_cast<chrono::microseconds>(deadline - chrono::steady_clock::now()).count();
+        execution->setTimeBudget(static_cast<uint32_t>(max<int64_t>(remaining, 1)));
+
+        try {
+            execution->run();
+        }
+        catch (const exception &ex) {
+            error("ScriptScheduler: script failed: " + string(ex.what()));
+            continue;
+        }
+        if (execution->isSuspended()) {
+            _queue.push_back(move(execution));
+        }
+        ++slices;
+
+    } while (!_queue.empty() && chrono::steady_clock::now() < deadline);
+
+    if (!_queue.empty()) {
+        debug(boost::format("ScriptScheduler: %d slices executed, %d scripts postponed") % slices % _queue.size(), 2);
+    }
+}
+
+void ScriptScheduler::clear() {
+    _queue.clear();
+}
+
+int ScriptScheduler::queueSize() const {
+    return static_cast<int>(_queue.size());
+}
+
+void ScriptScheduler::setFrameBudget(float millis) {
+    _frameBudget = millis;
+}
+
+void ScriptScheduler::setSliceInstructionCount(uint32_t count) {
+    _sliceInstructionCount = count;
+}
+
+} // namespace game
+
+} // namespace reone
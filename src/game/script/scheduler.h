@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+
+#include "../../script/execution.h"
+
+namespace reone {
+
+namespace game {
+
+/**
+ * Spreads queued script executions across frames. Every frame, executions
+ * are run in round-robin fashion, each for at most a slice of instructions,
+ * until the queue is empty or the frame budget is exhausted.
+ */
+class ScriptScheduler {
+public:
+    static ScriptScheduler &instance();
+
+    void enqueue(const std::shared_ptr<script::ScriptProgram> &program, const script::ExecutionContext &ctx);
+    void update();
+    void clear();
+
+    int queueSize() const;
+
+    /**
+     * @param millis maximum time spent executing queued scripts per frame
+     */
+    void setFrameBudget(float millis);
+
+    /**
+     * @param count maximum number of instructions executed before moving on to the next script
+     */
+    void setSliceInstructionCount(uint32_t count);
+
+private:
+    std::deque<std::unique_ptr<script::ScriptExecution>> _queue;
+    float _frameBudget { 2.0f };
+    uint32_t _sliceInstructionCount { 10000 };
+
+    ScriptScheduler() = default;
+    ScriptScheduler(const ScriptScheduler &) = delete;
+    ScriptScheduler &operator=(const ScriptScheduler &) = delete;
+};
+
+} // namespace game
+
+} // namespace reone
@@ -19,10 +19,12 @@
 
 #include "../../resource/resources.h"
 #include "../../script/execution.h"
+#include "../../script/profiler.h"
 #include "../../script/scripts.h"
 #include "../../script/types.h"
 
 #include "routines.h"
+#include "scheduler.h"
 
 using namespace std;
 
@@ -48,9 +50,32 @@ int runScript(const std::shared_ptr<ScriptProgram> &program, uint32_t callerId,
     ctx.triggererId = triggererId;
     ctx.userDefinedEventNumber = userDefinedEventNumber;
 
+    ScriptProfiler &profiler = ScriptProfiler::instance();
+    if (profiler.isEnabled()) {
+        profiler.recordInvocation(program->name());
+    }
+
     return ScriptExecution(program, move(ctx)).run();
 }
 
+void queueScript(const string &resRef, uint32_t callerId, uint32_t triggererId, int userDefinedEventNumber) {
+    shared_ptr<ScriptProgram> program(Scripts::instance().get(resRef));
+    if (!program) return;
+
+    ExecutionContext ctx;
+    ctx.routines = &Routines::instance();
+    ctx.callerId = callerId;
+    ctx.triggererId = triggererId;
+    ctx.userDefinedEventNumber = userDefinedEventNumber;
+
+    ScriptProfiler &profiler = ScriptProfiler::instance();
+    if (profiler.isEnabled()) {
+        profiler.recordInvocation(program->name());
+    }
+
+    ScriptScheduler::instance().enqueue(program, ctx);
+}
+
 } // namespace game
 
 } // namespace reone
@@ -30,6 +30,11 @@ namespace game {
 int runScript(const std::string &resRef, uint32_t callerId, uint32_t triggererId, int userDefinedEventNumber);
 int runScript(const std::shared_ptr<script::ScriptProgram> &program, uint32_t callerId, uint32_t triggererId, int userDefinedEventNumber);
 
+/**
+ * Queues a script for execution by ScriptScheduler. Use when the result of the script is not needed.
+ */
+void queueScript(const std::string &resRef, uint32_t callerId, uint32_t triggererId, int userDefinedEventNumber);
+
 } // namespace game
 
 } // namespace reone
@@ -64,11 +64,17 @@ enum InventorySlot {
 
 class CreatureBlueprint;
 
+struct ScriptOptions {
+    bool parallelHeartbeats { false };
+    float frameBudget { 2.0f };
+};
+
 struct Options {
     std::string module;
     render::GraphicsOptions graphics;
     audio::AudioOptions audio;
     net::NetworkOptions network;
+    ScriptOptions scripts;
 };
 
 struct CreatureConfiguration {
@@ -18,10 +18,14 @@
 #include "program.h"
 
 #include <iostream>
+#include <stdexcept>
 
 #include <boost/program_options.hpp>
 
 #include "mp/game.h"
+#include "script/execution.h"
+#include "script/profiler.h"
+#include "script/scripts.h"
 #include "common/log.h"
 
 using namespace std;
@@ -29,7 +33,9 @@ using namespace std;
 using namespace reone::game;
 using namespace reone::net;
 using namespace reone::mp;
+using namespace reone::render;
 using namespace reone::resource;
+using namespace reone::script;
 
 namespace fs = boost::filesystem;
 namespace po = boost::program_options;
@@ -45,6 +51,13 @@ static const int kDefaultMultiplayerPort = 2003;
 Program::Program(int argc, char **argv) : _argc(argc), _argv(argv) {
 }
 
+static RendererType parseRendererType(const string &name) {
+    if (name == "gl") return RendererType::OpenGL;
+    if (name == "null") return RendererType::Null;
+
+    throw invalid_argument("Unsupported renderer: " + name);
+}
+
 int Program::run() {
     initOptions();
     loadOptions();
@@ -64,11 +77,26 @@ void Program::initOptions() {
         ("width", po::value<int>()->default_value(800), "window width")
         ("height", po::value<int>()->default_value(600), "window height")
         ("fullscreen", po::value<bool>()->default_value(false), "enable fullscreen")
+        ("renderer", po::value<string>()->default_value("gl"), "graphics backend: gl, or null to record graphics commands without a window")
+        ("animthreads", po::value<int>()->default_value(1), "number of threads to update animations on")
+        ("renderthreads", po::value<int>()->default_value(1), "number of threads to build render commands on")
+        ("animcompress", po::value<bool>()->default_value(false), "store animation keyframes in compressed form")
+        ("animlod", po::value<bool>()->default_value(true), "update animations of distant and small models less often")
+        ("animlodhalf", po::value<float>()->default_value(16.0f), "distance at which animations are updated every 2nd frame")
+        ("animlodquarter", po::value<float>()->default_value(32.0f), "distance at which animations are updated every 4th frame")
+        ("animlodhalfsize", po::value<float>()->default_value(0.2f), "screen height fraction below which animations are updated every 2nd frame")
+        ("animlodquartersize", po::value<float>()->default_value(0.1f), "screen height fraction below which animations are updated every 4th frame")
+        ("animlodskipnodes", po::value<bool>()->default_value(true), "do not animate nodes without meshes or bones at the lowest LOD")
         ("musicvol", po::value<int>()->default_value(kDefaultMusicVolume), "music volume in percents")
         ("soundvol", po::value<int>()->default_value(kDefaultSoundVolume), "sound volume in percents")
         ("movievol", po::value<int>()->default_value(kDefaultMovieVolume), "movie volume in percents")
         ("port", po::value<int>()->default_value(kDefaultMultiplayerPort), "multiplayer port number")
-        ("debug", po::value<int>()->default_value(0), "debug log level (0-3)");
+        ("debug", po::value<int>()->default_value(0), "debug log level (0-3)")
+        ("scriptprofile", po::value<float>()->default_value(0.0f), "script profiler dump interval in seconds (0 to disable)")
+        ("scriptlib", po::value<string>(), "path to a library of natively compiled scripts")
+        ("scriptchecks", po::value<bool>()->default_value(false), "type-check verified scripts at runtime")
+        ("scriptbudget", po::value<float>()->default_value(2.0f), "time in milliseconds spent executing queued scripts per frame")
+        ("parallelheartbeats", po::value<bool>()->default_value(false), "run parallel-safe heartbeat scripts on worker threads");
 
     _cmdLineOpts.add(_commonOpts).add_options()
         ("help", "print this message")
@@ -95,14 +123,38 @@ void Program::loadOptions() {
     _gameOpts.graphics.width = vars["width"].as<int>();
     _gameOpts.graphics.height = vars["height"].as<int>();
     _gameOpts.graphics.fullscreen = vars["fullscreen"].as<bool>();
+    _gameOpts.graphics.renderer = parseRendererType(vars["renderer"].as<string>());
+    _gameOpts.graphics.animationThreads = vars["animthreads"].as<int>();
+    _gameOpts.graphics.renderThreads = vars["renderthreads"].as<int>();
+    _gameOpts.graphics.compressAnimations = vars["animcompress"].as<bool>();
+    _gameOpts.graphics.animationLOD.enabled = vars["animlod"].as<bool>();
+    _gameOpts.graphics.animationLOD.halfRateDistance = vars["animlodhalf"].as<float>();
+    _gameOpts.graphics.animationLOD.quarterRateDistance = vars["animlodquarter"].as<float>();
+    _gameOpts.graphics.animationLOD.halfRateScreenSize = vars["animlodhalfsize"].as<float>();
+    _gameOpts.graphics.animationLOD.quarterRateScreenSize = vars["animlodquartersize"].as<float>();
+    _gameOpts.graphics.animationLOD.skipNodes = vars["animlodskipnodes"].as<bool>();
     _gameOpts.audio.musicVolume = vars["musicvol"].as<int>();
     _gameOpts.audio.soundVolume = vars["soundvol"].as<int>();
     _gameOpts.audio.movieVolume = vars["movievol"].as<int>();
     _gameOpts.network.host = vars.count("join") > 0 ? vars["join"].as<string>() : "";
     _gameOpts.network.port = vars["port"].as<int>();
+    _gameOpts.scripts.parallelHeartbeats = vars["parallelheartbeats"].as<bool>();
+    _gameOpts.scripts.frameBudget = vars["scriptbudget"].as<float>();
 
     setDebugLogLevel(vars["debug"].as<int>());
 
+    float scriptProfileInterval = vars["scriptprofile"].as<float>();
+    if (scriptProfileInterval > 0.0f) {
+        ScriptProfiler &profiler = ScriptProfiler::instance();
+        profiler.setDumpInterval(scriptProfileInterval);
+        profiler.setEnabled(true);
+    }
+    ScriptExecution::setRuntimeChecks(vars["scriptchecks"].as<bool>());
+
+    if (vars.count("scriptlib") > 0) {
+        Scripts::instance().loadNativeLibrary(vars["scriptlib"].as<string>());
+    }
+
     if (vars.count("serve") > 0) {
         _multiplayerMode = MultiplayerMode::Server;
     } else if (vars.count("join") > 0) {
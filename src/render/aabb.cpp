@@ -34,18 +34,20 @@ AABB::AABB(const glm::vec3 &min, const glm::vec3 &max) : _empty(false), _min(min
 AABB AABB::operator*(const glm::mat4 &m) const {
     AABB aabb;
     if (!_empty) {
-        glm::vec3 a(m * glm::vec4(_min, 1.0f));
-        glm::vec3 b(m * glm::vec4(_max, 1.0f));
-
-        glm::vec3 min(
-            glm::min(a.x, b.x),
-            glm::min(a.y, b.y),
-            glm::min(a.z, b.z));
-
-        glm::vec3 max(
-            glm::max(a.x, b.x),
-            glm::max(a.y, b.y),
-            glm::max(a.z, b.z));
+        // Arvo's method: every column of the rotation and scale part
+        // contributes the smaller of its products with min and max to the
+        // new min, and the larger one to the new max
+        glm::vec3 min(m[3]);
+        glm::vec3 max(m[3]);
+
+        for (int j = 0; j < 3; ++j) {
+            for (int i = 0; i < 3; ++i) {
+                float a = m[j][i] * _min[j];
+                float b = m[j][i] * _max[j];
+                min[i] += glm::min(a, b);
+                max[i] += glm::max(a, b);
+            }
+        }
 
         aabb = AABB(min, max);
     }
@@ -148,6 +150,10 @@ bool AABB::intersectLine(const glm::vec3 &origin, const glm::vec3 &dir, float &d
     return true;
 }
 
+bool AABB::isEmpty() const {
+    return _empty;
+}
+
 glm::vec3 AABB::size() const {
     return _max - _min;
 }
@@ -29,6 +29,9 @@ public:
     AABB() = default;
     AABB(const glm::vec3 &min, const glm::vec3 &max);
 
+    /**
+     * @return smallest box that contains this box transformed by m
+     */
     AABB operator*(const glm::mat4 &m) const;
 
     void reset();
@@ -40,6 +43,8 @@ public:
     bool intersect(const AABB &other) const;
     bool intersectLine(const glm::vec3 &origin, const glm::vec3 &dir, float &distance) const;
 
+    bool isEmpty() const;
+
     glm::vec3 size() const;
 
     const glm::vec3 &min() const;
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "aabbbatch.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define REONE_AABBBATCH_SSE
+#include <xmmintrin.h>
+#endif
+
+using namespace std;
+
+namespace reone {
+
+namespace render {
+
+void AABBBatch::clear() {
+    _count = 0;
+    _minX.clear();
+    _minY.clear();
+    _minZ.clear();
+    _maxX.clear();
+    _maxY.clear();
+    _maxZ.clear();
+}
+
+void AABBBatch::add(const AABB &aabb) {
+    append(&aabb.min()[0], &aabb.max()[0]);
+}
+
+void AABBBatch::add(const AABB &aabb, const glm::mat4 &m) {
+    if (aabb.isEmpty()) {
+        add(aabb);
+        return;
+    }
+
+    // Arvo's method, in the order of operations of AABB::operator*
+    const glm::vec3 &min = aabb.min();
+    const glm::vec3 &max = aabb.max();
+
+#ifdef REONE_AABBBATCH_SSE
+    __m128 newMin = _mm_loadu_ps(&m[3][0]);
+    __m128 newMax = newMin;
+
+    for (int j = 0; j < 3; ++j) {
+        __m128 column = _mm_loadu_ps(&m[j][0]);
+        __m128 a = _mm_mul_ps(column, _mm_set1_ps(min[j]));
+        __m128 b = _mm_mul_ps(column, _mm_set1_ps(max[j]));
+        newMin = _mm_add_ps(newMin, _mm_min_ps(b, a));
+        newMax = _mm_add_ps(newMax, _mm_max_ps(b, a));
+    }
+    float outMin[4], outMax[4];
+    _mm_storeu_ps(outMin, newMin);
+    _mm_storeu_ps(outMax, newMax);
+
+    append(outMin, outMax);
+#else
+    AABB transformed(aabb * m);
+    append(&transformed.min()[0], &transformed.max()[0]);
+#endif
+}
+
+void AABBBatch::append(const float *min, const float *max) {
+    if (_count % 4 == 0) {
+        size_t size = _count + 4;
+        _minX.resize(size, 0.0f);
+        _minY.resize(size, 0.0f);
+        _minZ.resize(size, 0.0f);
+        _maxX.resize(size, 0.0f);
+        _maxY.resize(size, 0.0f);
+        _maxZ.resize(size, 0.0f);
+    }
+    _minX[_count] = min[0];
+    _minY[_count] = min[1];
+    _minZ[_count] = min[2];
+    _maxX[_count] = max[0];
+    _maxY[_count] = max[1];
+    _maxZ[_count] = max[2];
+    ++_count;
+}
+
+void AABBBatch::testPlanes(const glm::vec4 *planes, int planeCount, vector<uint8_t> &inside) const {
+    inside.resize(_count);
+
+    // Only the corner farthest along the normal of a plane has to be tested.
+    // Coordinates of that corner are chosen per plane rather than per box.
+
+#ifdef REONE_AABBBATCH_SSE
+    __m128 zero = _mm_setzero_ps();
+
+    for (int i = 0; i < _count; i += 4) {
+        __m128 passed = _mm_cmpeq_ps(zero, zero);
+
+        for (int p = 0; p < planeCount; ++p) {
+            const glm::vec4 &plane = planes[p];
+            __m128 x = _mm_loadu_ps(plane.x >= 0.0f ? &_maxX[i] : &_minX[i]);
+            __m128 y = _mm_loadu_ps(plane.y >= 0.0f ? &_maxY[i] : &_minY[i]);
+            __m128 z = _mm_loadu_ps(plane.z >= 0.0f ? &_maxZ[i] : &_minZ[i]);
+
+            // Summed as (x + y) + (z + w), like glm::dot
+            __m128 distance = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.x), x), _mm_mul_ps(_mm_set1_ps(plane.y), y)),
+                _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.z), z), _mm_set1_ps(plane.w)));
+
+            passed = _mm_and_ps(passed, _mm_cmpge_ps(distance, zero));
+            if (_mm_movemask_ps(passed) == 0) break;
+        }
+        int mask = _mm_movemask_ps(passed);
+        int end = _count - i < 4 ? _count - i : 4;
+        for (int k = 0; k < end; ++k) {
+            inside[i + k] = (mask >> k) & 1;
+        }
+    }
+#else
+    for (int i = 0; i < _count; ++i) {
+        uint8_t passed = 1;
+
+        for (int p = 0; p < planeCount; ++p) {
+            const glm::vec4 &plane = planes[p];
+            float x = plane.x >= 0.0f ? _maxX[i] : _minX[i];
+            float y = plane.y >= 0.0f ? _maxY[i] : _minY[i];
+            float z = plane.z >= 0.0f ? _maxZ[i] : _minZ[i];
+
+            if ((plane.x * x + plane.y * y) + (plane.z * z + plane.w) < 0.0f) {
+                passed = 0;
+                break;
+            }
+        }
+        inside[i] = passed;
+    }
+#endif
+}
+
+int AABBBatch::count() const {
+    return _count;
+}
+
+glm::vec3 AABBBatch::min(int index) const {
+    return glm::vec3(_minX[index], _minY[index], _minZ[index]);
+}
+
+glm::vec3 AABBBatch::max(int index) const {
+    return glm::vec3(_maxX[index], _maxY[index], _maxZ[index]);
+}
+
+} // namespace render
+
+} // namespace reone
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "glm/mat4x4.hpp"
+#include "glm/vec3.hpp"
+#include "glm/vec4.hpp"
+
+#include "aabb.h"
+
+namespace reone {
+
+namespace render {
+
+/**
+ * Bounding boxes stored as arrays of coordinates rather than as an array of
+ * boxes. Where SSE is available, boxes are transformed one per instruction
+ * and tested against planes four at a time. Results match AABB::operator*
+ * and CameraSceneNode::isInFrustum exactly.
+ */
+class AABBBatch {
+public:
+    void clear();
+
+    void add(const AABB &aabb);
+
+    /**
+     * Adds the bounding box of aabb transformed by m, i.e. aabb * m.
+     */
+    void add(const AABB &aabb, const glm::mat4 &m);
+
+    /**
+     * Tests boxes against planes. A box passes if for every plane at least
+     * one of its corners is on the non-negative side of it.
+     *
+     * @param[out] inside one element per box, 1 if the box passes and 0 otherwise
+     */
+    void testPlanes(const glm::vec4 *planes, int planeCount, std::vector<uint8_t> &inside) const;
+
+    int count() const;
+    glm::vec3 min(int index) const;
+    glm::vec3 max(int index) const;
+
+private:
+    int _count { 0 };
+
+    // Padded to a multiple of four boxes
+
+    std::vector<float> _minX;
+    std::vector<float> _minY;
+    std::vector<float> _minZ;
+    std::vector<float> _maxX;
+    std::vector<float> _maxY;
+    std::vector<float> _maxZ;
+
+    // END Padded to a multiple of four boxes
+
+    void append(const float *min, const float *max);
+};
+
+} // namespace render
+
+} // namespace reone
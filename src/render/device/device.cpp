@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "device.h"
+
+#include "gl.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace render {
+
+static unique_ptr<IGraphicsDevice> g_device;
+
+IGraphicsDevice &getGraphicsDevice() {
+    if (!g_device) {
+        g_device = make_unique<GLGraphicsDevice>();
+    }
+    return *g_device;
+}
+
+void setGraphicsDevice(unique_ptr<IGraphicsDevice> device) {
+    g_device = move(device);
+}
+
+} // namespace render
+
+} // namespace reone
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "glm/mat4x4.hpp"
+#include "glm/vec2.hpp"
+#include "glm/vec3.hpp"
+#include "glm/vec4.hpp"
+
+namespace reone {
+
+namespace render {
+
+/**
+ * Executes graphics commands on behalf of the renderer. Commands mirror GL
+ * functions and take GL enums, but objects are created and deleted one at a
+ * time. Implementations need not be backed by a GPU.
+ */
+class IGraphicsDevice {
+public:
+    virtual ~IGraphicsDevice() = default;
+
+    /**
+     * Marks the end of a frame, after buffers are swapped.
+     */
+    virtual void endFrame() = 0;
+
+    // State
+
+    virtual void enable(uint32_t capability) = 0;
+    virtual void disable(uint32_t capability) = 0;
+    virtual void blendFunc(uint32_t source, uint32_t destination) = 0;
+    virtual void viewport(const glm::ivec4 &viewport) = 0;
+    virtual glm::ivec4 getViewport() = 0;
+    virtual void clear(uint32_t mask) = 0;
+
+    // END State
+
+    // Shaders
+
+    virtual uint32_t createShader(uint32_t type) = 0;
+    virtual void deleteShader(uint32_t shader) = 0;
+    virtual void shaderSource(uint32_t shader, int count, const char *const *sources) = 0;
+
+    /**
+     * @param log receives the info log if compilation fails
+     * @return true if the shader was compiled successfully
+     */
+    virtual bool compileShader(uint32_t shader, std::string &log) = 0;
+
+    virtual uint32_t createProgram() = 0;
+    virtual void deleteProgram(uint32_t program) = 0;
+    virtual void attachShader(uint32_t program, uint32_t shader) = 0;
+
+    /**
+     * @param log receives the info log if linking fails
+     * @return true if the program was linked successfully
+     */
+    virtual bool linkProgram(uint32_t program, std::string &log) = 0;
+
+    virtual void useProgram(uint32_t program) = 0;
+
+    /**
+     * @return index of the block, GL_INVALID_INDEX if the program does not use it
+     */
+    virtual uint32_t getUniformBlockIndex(uint32_t program, const char *name) = 0;
+
+    virtual void uniformBlockBinding(uint32_t program, uint32_t blockIndex, uint32_t binding) = 0;
+
+    /**
+     * @return location of the uniform, -1 if the program does not use it
+     */
+    virtual int getUniformLocation(uint32_t program, const char *name) = 0;
+
+    virtual void uniform1i(int location, int value) = 0;
+    virtual void uniform1f(int location, float value) = 0;
+    virtual void uniform2f(int location, const glm::vec2 &value) = 0;
+    virtual void uniform3f(int location, const glm::vec3 &value) = 0;
+    virtual void uniformMatrix4fv(int location, int count, const glm::mat4 *values) = 0;
+
+    // END Shaders
+
+    // Buffers
+
+    virtual uint32_t createBuffer() = 0;
+    virtual void deleteBuffer(uint32_t buffer) = 0;
+    virtual void bindBuffer(uint32_t target, uint32_t buffer) = 0;
+    virtual void bindBufferBase(uint32_t target, uint32_t index, uint32_t buffer) = 0;
+    virtual void bufferData(uint32_t target, size_t size, const void *data, uint32_t usage) = 0;
+    virtual void bufferSubData(uint32_t target, size_t offset, size_t size, const void *data) = 0;
+
+    // END Buffers
+
+    // Vertex arrays
+
+    virtual uint32_t createVertexArray() = 0;
+    virtual void deleteVertexArray(uint32_t vertexArray) = 0;
+    virtual void bindVertexArray(uint32_t vertexArray) = 0;
+    virtual void enableVertexAttribArray(uint32_t index) = 0;
+    virtual void vertexAttribPointer(uint32_t index, int size, uint32_t type, int stride, size_t offset) = 0;
+    virtual void vertexAttribDivisor(uint32_t index, uint32_t divisor) = 0;
+
+    // END Vertex arrays
+
+    // Textures
+
+    virtual uint32_t createTexture() = 0;
+    virtual void deleteTexture(uint32_t texture) = 0;
+    virtual void activeTexture(int unit) = 0;
+    virtual void bindTexture(uint32_t target, uint32_t texture) = 0;
+    virtual void texParameteri(uint32_t target, uint32_t name, int value) = 0;
+
+    /**
+     * @param size size of data in bytes, zero if data is null
+     */
+    virtual void texImage2D(uint32_t target, int level, int internalFormat, int width, int height, uint32_t format, uint32_t type, const void *data, size_t size) = 0;
+
+    virtual void compressedTexImage2D(uint32_t target, int level, uint32_t internalFormat, int width, int height, const void *data, size_t size) = 0;
+    virtual void generateMipmap(uint32_t target) = 0;
+
+    // END Textures
+
+    // Framebuffers
+
+    virtual uint32_t createFramebuffer() = 0;
+    virtual void deleteFramebuffer(uint32_t framebuffer) = 0;
+    virtual void bindFramebuffer(uint32_t framebuffer) = 0;
+    virtual void framebufferTexture2D(uint32_t attachment, uint32_t target, uint32_t texture, int level) = 0;
+    virtual void framebufferRenderbuffer(uint32_t attachment, uint32_t renderbuffer) = 0;
+    virtual bool isFramebufferComplete() = 0;
+    virtual void drawBuffers(int count, const uint32_t *buffers) = 0;
+
+    virtual uint32_t createRenderbuffer() = 0;
+    virtual void deleteRenderbuffer(uint32_t renderbuffer) = 0;
+    virtual void bindRenderbuffer(uint32_t renderbuffer) = 0;
+    virtual void renderbufferStorage(uint32_t internalFormat, int width, int height) = 0;
+
+    // END Framebuffers
+
+    // Drawing
+
+    /**
+     * @param offset offset into the element buffer in bytes
+     */
+    virtual void drawElements(uint32_t mode, int count, uint32_t type, size_t offset) = 0;
+
+    virtual void drawElementsInstanced(uint32_t mode, int count, uint32_t type, size_t offset, int instanceCount) = 0;
+
+    // END Drawing
+};
+
+/**
+ * @return device used by all rendering code, the GL device unless set otherwise
+ */
+IGraphicsDevice &getGraphicsDevice();
+
+/**
+ * Replaces the graphics device. Must be called before any graphics objects
+ * are created.
+ */
+void setGraphicsDevice(std::unique_ptr<IGraphicsDevice> device);
+
+} // namespace render
+
+} // namespace reone
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "gl.h"
+
+#include "GL/glew.h"
+
+#include "SDL2/SDL_opengl.h"
+
+#include "glm/gtc/type_ptr.hpp"
+
+using namespace std;
+
+namespace reone {
+
+namespace render {
+
+void GLGraphicsDevice::endFrame() {
+}
+
+void GLGraphicsDevice::enable(uint32_t capability) {
+    glEnable(capability);
+}
+
+void GLGraphicsDevice::disable(uint32_t capability) {
+    glDisable(capability);
+}
+
+void GLGraphicsDevice::blendFunc(uint32_t source, uint32_t destination) {
+    glBlendFunc(source, destination);
+}
+
+void GLGraphicsDevice::viewport(const glm::ivec4 &viewport) {
+    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+}
+
+glm::ivec4 GLGraphicsDevice::getViewport() {
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    return glm::ivec4(viewport[0], viewport[1], viewport[2], viewport[3]);
+}
+
+void GLGraphicsDevice::clear(uint32_t mask) {
+    glClear(mask);
+}
+
+uint32_t GLGraphicsDevice::createShader(uint32_t type) {
+    return glCreateShader(type);
+}
+
+void GLGraphicsDevice::deleteShader(uint32_t shader) {
+    glDeleteShader(shader);
+}
+
+void GLGraphicsDevice::shaderSource(uint32_t shader, int count, const char *const *sources) {
+    glShaderSource(shader, count, sources, nullptr);
+}
+
+bool GLGraphicsDevice::compileShader(uint32_t shader, string &log) {
+    glCompileShader(shader);
+
+    GLint success;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (success) return true;
+
+    char buf[512];
+    GLsizei logSize;
+    glGetShaderInfoLog(shader, sizeof(buf), &logSize, buf);
+    log = string(buf, logSize);
+
+    return false;
+}
+
+uint32_t GLGraphicsDevice::createProgram() {
+    return glCreateProgram();
+}
+
+void GLGraphicsDevice::deleteProgram(uint32_t program) {
+    glDeleteProgram(program);
+}
+
+void GLGraphicsDevice::attachShader(uint32_t program, uint32_t shader) {
+    glAttachShader(program, shader);
+}
+
+bool GLGraphicsDevice::linkProgram(uint32_t program, string &log) {
+    glLinkProgram(program);
+
+    GLint success;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (success) return true;
+
+    char buf[512];
+    GLsizei logSize;
+    glGetProgramInfoLog(program, sizeof(buf), &logSize, buf);
+    log = string(buf, logSize);
+
+    return false;
+}
+
+void GLGraphicsDevice::useProgram(uint32_t program) {
+    glUseProgram(program);
+}
+
+uint32_t GLGraphicsDevice::getUniformBlockIndex(uint32_t program, const char *name) {
+    return glGetUniformBlockIndex(program, name);
+}
+
+void GLGraphicsDevice::uniformBlockBinding(uint32_t program, uint32_t blockIndex, uint32_t binding) {
+    glUniformBlockBinding(program, blockIndex, binding);
+}
+
+int GLGraphicsDevice::getUniformLocation(uint32_t program, const char *name) {
+    return glGetUniformLocation(program, name);
+}
+
+void GLGraphicsDevice::uniform1i(int location, int value) {
+    glUniform1i(location, value);
+}
+
+void GLGraphicsDevice::uniform1f(int location, float value) {
+    glUniform1f(location, value);
+}
+
+void GLGraphicsDevice::uniform2f(int location, const glm::vec2 &value) {
+    glUniform2f(location, value.x, value.y);
+}
+
+void GLGraphicsDevice::uniform3f(int location, const glm::vec3 &value) {
+    glUniform3f(location, value.x, value.y, value.z);
+}
+
+void GLGraphicsDevice::uniformMatrix4fv(int location, int count, const glm::mat4 *values) {
+    glUniformMatrix4fv(location, count, GL_FALSE, glm::value_ptr(values[0]));
+}
+
+uint32_t GLGraphicsDevice::createBuffer() {
+    GLuint buffer;
+    glGenBuffers(1, &buffer);
+    return buffer;
+}
+
+void GLGraphicsDevice::deleteBuffer(uint32_t buffer) {
+    glDeleteBuffers(1, &buffer);
+}
+
+void GLGraphicsDevice::bindBuffer(uint32_t target, uint32_t buffer) {
+    glBindBuffer(target, buffer);
+}
+
+void GLGraphicsDevice::bindBufferBase(uint32_t target, uint32_t index, uint32_t buffer) {
+    glBindBufferBase(target, index, buffer);
+}
+
+void GLGraphicsDevice::bufferData(uint32_t target, size_t size, const void *data, uint32_t usage) {
+    glBufferData(target, size, data, usage);
+}
+
+void GLGraphicsDevice::bufferSubData(uint32_t target, size_t offset, size_t size, const void *data) {
+    glBufferSubData(target, offset, size, data);
+}
+
+uint32_t GLGraphicsDevice::createVertexArray() {
+    GLuint vertexArray;
+    glGenVertexArrays(1, &vertexArray);
+    return vertexArray;
+}
+
+void GLGraphicsDevice::deleteVertexArray(uint32_t vertexArray) {
+    glDeleteVertexArrays(1, &vertexArray);
+}
+
+void GLGraphicsDevice::bindVertexArray(uint32_t vertexArray) {
+    glBindVertexArray(vertexArray);
+}
+
+void GLGraphicsDevice::enableVertexAttribArray(uint32_t index) {
+    glEnableVertexAttribArray(index);
+}
+
+void GLGraphicsDevice::vertexAttribPointer(uint32_t index, int size, uint32_t type, int stride, size_t offset) {
+    glVertexAttribPointer(index, size, type, GL_FALSE, stride, reinterpret_cast<void *>(offset));
+}
+
+void GLGraphicsDevice::vertexAttribDivisor(uint32_t index, uint32_t divisor) {
+    glVertexAttribDivisor(index, divisor);
+}
+
+uint32_t GLGraphicsDevice::createTexture() {
+    GLuint texture;
+    glGenTextures(1, &texture);
+    return texture;
+}
+
+void GLGraphicsDevice::deleteTexture(uint32_t texture) {
+    glDeleteTextures(1, &texture);
+}
+
+void GLGraphicsDevice::activeTexture(int unit) {
+    glActiveTexture(GL_TEXTURE0 + unit);
+}
+
+void GLGraphicsDevice::bindTexture(uint32_t target, uint32_t texture) {
+    glBindTexture(target, texture);
+}
+
+void GLGraphicsDevice::texParameteri(uint32_t target, uint32_t name, int value) {
+    glTexParameteri(target, name, value);
+}
+
+void GLGraphicsDevice::texImage2D(uint32_t target, int level, int internalFormat, int width, int height, uint32_t format, uint32_t type, const void *data, size_t size) {
+    glTexImage2D(target, level, internalFormat, width, height, 0, format, type, data);
+}
+
+void GLGraphicsDevice::compressedTexImage2D(uint32_t target, int level, uint32_t internalFormat, int width, int height, const void *data, size_t size) {
+    glCompressedTexImage2D(target, level, internalFormat, width, height, 0, static_cast<GLsizei>(size), data);
+}
+
+void GLGraphicsDevice::generateMipmap(uint32_t target) {
+    glGenerateMipmap(target);
+}
+
+uint32_t GLGraphicsDevice::createFramebuffer() {
+    GLuint framebuffer;
+    glGenFramebuffers(1, &framebuffer);
+    return framebuffer;
+}
+
+void GLGraphicsDevice::deleteFramebuffer(uint32_t framebuffer) {
+    glDeleteFramebuffers(1, &framebuffer);
+}
+
+void GLGraphicsDevice::bindFramebuffer(uint32_t framebuffer) {
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+}
+
+void GLGraphicsDevice::framebufferTexture2D(uint32_t attachment, uint32_t target, uint32_t texture, int level) {
+    glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, target, texture, level);
+}
+
+void GLGraphicsDevice::framebufferRenderbuffer(uint32_t attachment, uint32_t renderbuffer) {
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, attachment, GL_RENDERBUFFER, renderbuffer);
+}
+
+bool GLGraphicsDevice::isFramebufferComplete() {
+    return glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+}
+
+void GLGraphicsDevice::drawBuffers(int count, const uint32_t *buffers) {
+    glDrawBuffers(count, buffers);
+}
+
+uint32_t GLGraphicsDevice::createRenderbuffer() {
+    GLuint renderbuffer;
+    glGenRenderbuffers(1, &renderbuffer);
+    return renderbuffer;
+}
+
+void GLGraphicsDevice::deleteRenderbuffer(uint32_t renderbuffer) {
+    glDeleteRenderbuffers(1, &renderbuffer);
+}
+
+void GLGraphicsDevice::bindRenderbuffer(uint32_t renderbuffer) {
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+}
+
+void GLGraphicsDevice::renderbufferStorage(uint32_t internalFormat, int width, int height) {
+    glRenderbufferStorage(GL_RENDERBUFFER, internalFormat, width, height);
+}
+
+void GLGraphicsDevice::drawElements(uint32_t mode, int count, uint32_t type, size_t offset) {
+    glDrawElements(mode, count, type, reinterpret_cast<void *>(offset));
+}
+
+void GLGraphicsDevice::drawElementsInstanced(uint32_t mode, int count, uint32_t type, size_t offset, int instanceCount) {
+    glDrawElementsInstanced(mode, count, type, reinterpret_cast<void *>(offset), instanceCount);
+}
+
+} // namespace render
+
+} // namespace reone
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "device.h"
+
+namespace reone {
+
+namespace render {
+
+/**
+ * Graphics device that executes commands in the current GL context.
+ */
+class GLGraphicsDevice : public IGraphicsDevice {
+public:
+    GLGraphicsDevice() = default;
+
+    void endFrame() override;
+
+    // State
+
+    void enable(uint32_t capability) override;
+    void disable(uint32_t capability) override;
+    void blendFunc(uint32_t source, uint32_t destination) override;
+    void viewport(const glm::ivec4 &viewport) override;
+    glm::ivec4 getViewport() override;
+    void clear(uint32_t mask) override;
+
+    // END State
+
+    // Shaders
+
+    uint32_t createShader(uint32_t type) override;
+    void deleteShader(uint32_t shader) override;
+    void shaderSource(uint32_t shader, int count, const char *const *sources) override;
+    bool compileShader(uint32_t shader, std::string &log) override;
+    uint32_t createProgram() override;
+    void deleteProgram(uint32_t program) override;
+    void attachShader(uint32_t program, uint32_t shader) override;
+    bool linkProgram(uint32_t program, std::string &log) override;
+    void useProgram(uint32_t program) override;
+    uint32_t getUniformBlockIndex(uint32_t program, const char *name) override;
+    void uniformBlockBinding(uint32_t program, uint32_t blockIndex, uint32_t binding) override;
+    int getUniformLocation(uint32_t program, const char *name) override;
+    void uniform1i(int location, int value) override;
+    void uniform1f(int location, float value) override;
+    void uniform2f(int location, const glm::vec2 &value) override;
+    void uniform3f(int location, const glm::vec3 &value) override;
+    void uniformMatrix4fv(int location, int count, const glm::mat4 *values) override;
+
+    // END Shaders
+
+    // Buffers
+
+    uint32_t createBuffer() override;
+    void deleteBuffer(uint32_t buffer) override;
+    void bindBuffer(uint32_t target, uint32_t buffer) override;
+    void bindBufferBase(uint32_t target, uint32_t index, uint32_t buffer) override;
+    void bufferData(uint32_t target, size_t size, const void *data, uint32_t usage) override;
+    void bufferSubData(uint32_t target, size_t offset, size_t size, const void *data) override;
+
+    // END Buffers
+
+    // Vertex arrays
+
+    uint32_t createVertexArray() override;
+    void deleteVertexArray(uint32_t vertexArray) override;
+    void bindVertexArray(uint32_t vertexArray) override;
+    void enableVertexAttribArray(uint32_t index) override;
+    void vertexAttribPointer(uint32_t index, int size, uint32_t type, int stride, size_t offset) override;
+    void vertexAttribDivisor(uint32_t index, uint32_t divisor) override;
+
+    // END Vertex arrays
+
+    // Textures
+
+    uint32_t createTexture() override;
+    void deleteTexture(uint32_t texture) override;
+    void activeTexture(int unit) override;
+    void bindTexture(uint32_t target, uint32_t texture) override;
+    void texParameteri(uint32_t target, uint32_t name, int value) override;
+    void texImage2D(uint32_t target, int level, int internalFormat, int width, int height, uint32_t format, uint32_t type, const void *data, size_t size) override;
+    void compressedTexImage2D(uint32_t target, int level, uint32_t internalFormat, int width, int height, const void *data, size_t size) override;
+    void generateMipmap(uint32_t target) override;
+
+    // END Textures
+
+    // Framebuffers
+
+    uint32_t createFramebuffer() override;
+    void deleteFramebuffer(uint32_t framebuffer) override;
+    void bindFramebuffer(uint32_t framebuffer) override;
+    void framebufferTexture2D(uint32_t attachment, uint32_t target, uint32_t texture, int level) override;
+    void framebufferRenderbuffer(uint32_t attachment, uint32_t renderbuffer) override;
+    bool isFramebufferComplete() override;
+    void drawBuffers(int count, const uint32_t *buffers) override;
+    uint32_t createRenderbuffer() override;
+    void deleteRenderbuffer(uint32_t renderbuffer) override;
+    void bindRenderbuffer(uint32_t renderbuffer) override;
+    void renderbufferStorage(uint32_t internalFormat, int width, int height) override;
+
+    // END Framebuffers
+
+    // Drawing
+
+    void drawElements(uint32_t mode, int count, uint32_t type, size_t offset) override;
+    void drawElementsInstanced(uint32_t mode, int count, uint32_t type, size_t offset, int instanceCount) override;
+
+    // END Drawing
+
+private:
+    GLGraphicsDevice(const GLGraphicsDevice &) = delete;
+    GLGraphicsDevice &operator=(const GLGraphicsDevice &) = delete;
+};
+
+} // namespace render
+
+} // namespace reone
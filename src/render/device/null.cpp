@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "null.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace render {
+
+NullGraphicsDevice::NullGraphicsDevice(int width, int height) : _viewport(0, 0, width, height) {
+}
+
+void NullGraphicsDevice::endFrame() {
+    // Swap, rather than copy, to keep capacity of both logs between frames
+    _lastFrameCommands.swap(_commands);
+    _commands.clear();
+    ++_frameCount;
+}
+
+GraphicsCommand &NullGraphicsDevice::record(GraphicsCommandType type, uint32_t target, uint32_t object, size_t bytes) {
+    GraphicsCommand command;
+    command.type = type;
+    command.target = target;
+    command.object = object;
+    command.bytes = bytes;
+    _commands.push_back(move(command));
+
+    return _commands.back();
+}
+
+uint32_t NullGraphicsDevice::create() {
+    uint32_t object = _nextObject++;
+    record(GraphicsCommandType::Create, 0, object);
+    return object;
+}
+
+void NullGraphicsDevice::clearCommands() {
+    _commands.clear();
+}
+
+void NullGraphicsDevice::enable(uint32_t capability) {
+    record(GraphicsCommandType::SetState, capability);
+}
+
+void NullGraphicsDevice::disable(uint32_t capability) {
+    record(GraphicsCommandType::SetState, capability);
+}
+
+void NullGraphicsDevice::blendFunc(uint32_t source, uint32_t destination) {
+    record(GraphicsCommandType::SetState);
+}
+
+void NullGraphicsDevice::viewport(const glm::ivec4 &viewport) {
+    record(GraphicsCommandType::SetState);
+    _viewport = viewport;
+}
+
+glm::ivec4 NullGraphicsDevice::getViewport() {
+    return _viewport;
+}
+
+void NullGraphicsDevice::clear(uint32_t mask) {
+    record(GraphicsCommandType::Clear, mask);
+}
+
+uint32_t NullGraphicsDevice::createShader(uint32_t type) {
+    return create();
+}
+
+void NullGraphicsDevice::deleteShader(uint32_t shader) {
+    record(GraphicsCommandType::Delete, 0, shader);
+}
+
+void NullGraphicsDevice::shaderSource(uint32_t shader, int count, const char *const *sources) {
+}
+
+bool NullGraphicsDevice::compileShader(uint32_t shader, string &log) {
+    return true;
+}
+
+uint32_t NullGraphicsDevice::createProgram() {
+    return create();
+}
+
+void NullGraphicsDevice::deleteProgram(uint32_t program) {
+    record(GraphicsCommandType::Delete, 0, program);
+}
+
+void NullGraphicsDevice::attachShader(uint32_t program, uint32_t shader) {
+}
+
+bool NullGraphicsDevice::linkProgram(uint32_t program, string &log) {
+    return true;
+}
+
+void NullGraphicsDevice::useProgram(uint32_t program) {
+    record(GraphicsCommandType::UseProgram, 0, program);
+}
+
+uint32_t NullGraphicsDevice::getUniformBlockIndex(uint32_t program, const char *name) {
+    return 0;
+}
+
+void NullGraphicsDevice::uniformBlockBinding(uint32_t program, uint32_t blockIndex, uint32_t binding) {
+    record(GraphicsCommandType::SetState, 0, program);
+}
+
+int NullGraphicsDevice::getUniformLocation(uint32_t program, const char *name) {
+    // Locations only need to be unique within a program, but sharing them is simpler
+    auto maybeLocation = _uniformLocations.find(name);
+    if (maybeLocation != _uniformLocations.end()) return maybeLocation->second;
+
+    int location = static_cast<int>(_uniformLocations.size());
+    _uniformLocations.insert(make_pair(name, location));
+
+    return location;
+}
+
+void NullGraphicsDevice::uniform1i(int location, int value) {
+    record(GraphicsCommandType::SetUniform, 0, location, sizeof(value)).count = 1;
+}
+
+void NullGraphicsDevice::uniform1f(int location, float value) {
+    record(GraphicsCommandType::SetUniform, 0, location, sizeof(value)).count = 1;
+}
+
+void NullGraphicsDevice::uniform2f(int location, const glm::vec2 &value) {
+    record(GraphicsCommandType::SetUniform, 0, location, sizeof(value)).count = 1;
+}
+
+void NullGraphicsDevice::uniform3f(int location, const glm::vec3 &value) {
+    record(GraphicsCommandType::SetUniform, 0, location, sizeof(value)).count = 1;
+}
+
+void NullGraphicsDevice::uniformMatrix4fv(int location, int count, const glm::mat4 *values) {
+    record(GraphicsCommandType::SetUniform, 0, location, count * sizeof(glm::mat4)).count = count;
+}
+
+uint32_t NullGraphicsDevice::createBuffer() {
+    return create();
+}
+
+void NullGraphicsDevice::deleteBuffer(uint32_t buffer) {
+    record(GraphicsCommandType::Delete, 0, buffer);
+}
+
+void NullGraphicsDevice::bindBuffer(uint32_t target, uint32_t buffer) {
+    record(GraphicsCommandType::BindBuffer, target, buffer);
+}
+
+void NullGraphicsDevice::bindBufferBase(uint32_t target, uint32_t index, uint32_t buffer) {
+    record(GraphicsCommandType::BindBuffer, target, buffer);
+}
+
+void NullGraphicsDevice::bufferData(uint32_t target, size_t size, const void *data, uint32_t usage) {
+    record(GraphicsCommandType::UploadBuffer, target, 0, data ? size : 0);
+}
+
+void NullGraphicsDevice::bufferSubData(uint32_t target, size_t offset, size_t size, const void *data) {
+    record(GraphicsCommandType::UploadBuffer, target, 0, size);
+}
+
+uint32_t NullGraphicsDevice::createVertexArray() {
+    return create();
+}
+
+void NullGraphicsDevice::deleteVertexArray(uint32_t vertexArray) {
+    record(GraphicsCommandType::Delete, 0, vertexArray);
+}
+
+void NullGraphicsDevice::bindVertexArray(uint32_t vertexArray) {
+    record(GraphicsCommandType::BindVertexArray, 0, vertexArray);
+}
+
+void NullGraphicsDevice::enableVertexAttribArray(uint32_t index) {
+    record(GraphicsCommandType::SetState);
+}
+
+void NullGraphicsDevice::vertexAttribPointer(uint32_t index, int size, uint32_t type, int stride, size_t offset) {
+    record(GraphicsCommandType::SetState);
+}
+
+void NullGraphicsDevice::vertexAttribDivisor(uint32_t index, uint32_t divisor) {
+    record(GraphicsCommandType::SetState);
+}
+
+uint32_t NullGraphicsDevice::createTexture() {
+    return create();
+}
+
+void NullGraphicsDevice::deleteTexture(uint32_t texture) {
+    record(GraphicsCommandType::Delete, 0, texture);
+}
+
+void NullGraphicsDevice::activeTexture(int unit) {
+    record(GraphicsCommandType::SetState);
+}
+
+void NullGraphicsDevice::bindTexture(uint32_t target, uint32_t texture) {
+    record(GraphicsCommandType::BindTexture, target, texture);
+}
+
+void NullGraphicsDevice::texParameteri(uint32_t target, uint32_t name, int value) {
+    record(GraphicsCommandType::SetState, target);
+}
+
+void NullGraphicsDevice::texImage2D(uint32_t target, int level, int internalFormat, int width, int height, uint32_t format, uint32_t type, const void *data, size_t size) {
+    record(GraphicsCommandType::UploadTexture, target, 0, size);
+}
+
+void NullGraphicsDevice::compressedTexImage2D(uint32_t target, int level, uint32_t internalFormat, int width, int height, const void *data, size_t size) {
+    record(GraphicsCommandType::UploadTexture, target, 0, size);
+}
+
+void NullGraphicsDevice::generateMipmap(uint32_t target) {
+    record(GraphicsCommandType::SetState, target);
+}
+
+uint32_t NullGraphicsDevice::createFramebuffer() {
+    return create();
+}
+
+void NullGraphicsDevice::deleteFramebuffer(uint32_t framebuffer) {
+    record(GraphicsCommandType::Delete, 0, framebuffer);
+}
+
+void NullGraphicsDevice::bindFramebuffer(uint32_t framebuffer) {
+    record(GraphicsCommandType::BindFramebuffer, 0, framebuffer);
+}
+
+void NullGraphicsDevice::framebufferTexture2D(uint32_t attachment, uint32_t target, uint32_t texture, int level) {
+    record(GraphicsCommandType::SetState, attachment, texture);
+}
+
+void NullGraphicsDevice::framebufferRenderbuffer(uint32_t attachment, uint32_t renderbuffer) {
+    record(GraphicsCommandType::SetState, attachment, renderbuffer);
+}
+
+bool NullGraphicsDevice::isFramebufferComplete() {
+    return true;
+}
+
+void NullGraphicsDevice::drawBuffers(int count, const uint32_t *buffers) {
+    record(GraphicsCommandType::SetState).count = count;
+}
+
+uint32_t NullGraphicsDevice::createRenderbuffer() {
+    return create();
+}
+
+void NullGraphicsDevice::deleteRenderbuffer(uint32_t renderbuffer) {
+    record(GraphicsCommandType::Delete, 0, renderbuffer);
+}
+
+void NullGraphicsDevice::bindRenderbuffer(uint32_t renderbuffer) {
+    record(GraphicsCommandType::BindRenderbuffer, 0, renderbuffer);
+}
+
+void NullGraphicsDevice::renderbufferStorage(uint32_t internalFormat, int width, int height) {
+    record(GraphicsCommandType::SetState, internalFormat);
+}
+
+void NullGraphicsDevice::drawElements(uint32_t mode, int count, uint32_t type, size_t offset) {
+    GraphicsCommand &command = record(GraphicsCommandType::Draw, mode);
+    command.count = count;
+    command.instanceCount = 1;
+}
+
+void NullGraphicsDevice::drawElementsInstanced(uint32_t mode, int count, uint32_t type, size_t offset, int instanceCount) {
+    GraphicsCommand &command = record(GraphicsCommandType::Draw, mode);
+    command.count = count;
+    command.instanceCount = instanceCount;
+}
+
+const vector<GraphicsCommand> &NullGraphicsDevice::commands() const {
+    return _commands;
+}
+
+const vector<GraphicsCommand> &NullGraphicsDevice::lastFrameCommands() const {
+    return _lastFrameCommands;
+}
+
+int NullGraphicsDevice::frameCount() const {
+    return _frameCount;
+}
+
+} // namespace render
+
+} // namespace reone
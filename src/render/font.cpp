@@ -17,6 +17,7 @@
 
 #include "font.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 #include "GL/glew.h"
@@ -25,6 +26,8 @@
 
 #include "glm/ext.hpp"
 
+#include "device/device.h"
+#include "renderstate.h"
 #include "shaders.h"
 
 using namespace std;
@@ -35,6 +38,12 @@ namespace render {
 
 static const int kVertexValuesPerGlyph = 20;
 static const int kIndicesPerGlyph = 6;
+static const int kMaxGlyphsPerText = 0x10000 / 4;
+static const int kMaxTextMeshCount = 256;
+
+Font::~Font() {
+    deinitGL();
+}
 
 void Font::load(const shared_ptr<Texture> &texture) {
     if (!texture) {
@@ -48,7 +57,6 @@ void Font::load(const shared_ptr<Texture> &texture) {
     _height = features.fontHeight * 100.0f;
 
     _vertices.resize(kVertexValuesPerGlyph * _glyphCount);
-    _indices.resize(kIndicesPerGlyph * _glyphCount);
     _glyphWidths.resize(_glyphCount);
 
     for (int i = 0; i < _glyphCount; ++i) {
@@ -66,94 +74,177 @@ void Font::load(const shared_ptr<Texture> &texture) {
         pv[10] = width; pv[11] = 0.0f; pv[12] = 0.0f; pv[13] = lr.x; pv[14] = ul.y;
         pv[15] = 0.0f; pv[16] = 0.0f; pv[17] = 0.0f; pv[18] = ul.x; pv[19] = ul.y;
 
-        uint16_t *iv = &_indices[kIndicesPerGlyph * i];
-        int off = 4 * i;
-        iv[0] = off + 0; iv[1] = off + 1; iv[2] = off + 2;
-        iv[3] = off + 2; iv[4] = off + 3; iv[5] = off + 0;
-
         _glyphWidths[i] = width;
     }
 }
 
-void Font::initGL() {
-    if (_glInited) return;
+void Font::deinitGL() {
+    for (auto &pair : _textMeshes) {
+        const TextMesh &mesh = pair.second;
+        IGraphicsDevice &device = getGraphicsDevice();
+        RenderState::instance().invalidateVertexArray(mesh.vertexArrayId);
+        device.deleteVertexArray(mesh.vertexArrayId);
+        device.deleteBuffer(mesh.indexBufferId);
+        device.deleteBuffer(mesh.vertexBufferId);
+    }
+    _textMeshes.clear();
+}
 
-    glGenBuffers(1, &_vertexBufferId);
-    glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
-    glBufferData(GL_ARRAY_BUFFER, _vertices.size() * sizeof(float), &_vertices[0], GL_STATIC_DRAW);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+bool Font::TextKey::operator==(const TextKey &other) const {
+    return gravity == other.gravity && text == other.text;
+}
 
-    glGenBuffers(1, &_indexBufferId);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, _indices.size() * sizeof(uint16_t), &_indices[0], GL_STATIC_DRAW);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+size_t Font::TextKeyHash::operator()(const TextKey &key) const {
+    return hash<string>()(key.text) ^ static_cast<size_t>(key.gravity);
+}
 
-    glGenVertexArrays(1, &_vertexArrayId);
-    glBindVertexArray(_vertexArrayId);
-    glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
+void Font::render(const string &text, const glm::mat4 &transform, const glm::vec3 &color, TextGravity gravity) const {
+    if (text.empty()) return;
 
-    int stride = 5 * sizeof(float);
+    const TextMesh &mesh = getTextMesh(text, gravity);
+    if (mesh.indexCount == 0) return;
 
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void *>(0));
+    LocalUniforms locals;
+    locals.model = transform;
+    locals.color = color;
 
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void *>(12));
+    Shaders::instance().activate(ShaderProgram::GUIGUI, locals);
+
+    _texture->bind(0);
 
-    glBindVertexArray(0);
+    RenderState::instance().bindVertexArray(mesh.vertexArrayId);
+    getGraphicsDevice().drawElements(GL_TRIANGLES, mesh.indexCount, GL_UNSIGNED_SHORT, 0);
 
-    _glInited = true;
+    _texture->unbind(0);
 }
 
-void Font::render(const string &text, const glm::mat4 &transform, const glm::vec3 &color, TextGravity gravity) const {
-    if (text.empty()) return;
+const Font::TextMesh &Font::getTextMesh(const string &text, TextGravity gravity) const {
+    TextKey key;
+    key.text = text;
+    key.gravity = gravity;
 
-    _texture->bind(0);
+    auto maybeMesh = _textMeshes.find(key);
+    if (maybeMesh != _textMeshes.end()) {
+        maybeMesh->second.lastUsed = ++_useCounter;
+        return maybeMesh->second;
+    }
+    if (_textMeshes.size() >= kMaxTextMeshCount) {
+        evictTextMesh();
+    }
+
+    vector<float> vertices;
+    vector<uint16_t> indices;
+    layout(text, gravity, vertices, indices);
+
+    TextMesh mesh;
+    mesh.indexCount = static_cast<int>(indices.size());
+    mesh.lastUsed = ++_useCounter;
+
+    if (!indices.empty()) {
+        IGraphicsDevice &device = getGraphicsDevice();
+
+        mesh.vertexArrayId = device.createVertexArray();
+        RenderState::instance().bindVertexArray(mesh.vertexArrayId);
 
-    glBindVertexArray(_vertexArrayId);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
+        mesh.vertexBufferId = device.createBuffer();
+        device.bindBuffer(GL_ARRAY_BUFFER, mesh.vertexBufferId);
+        device.bufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), &vertices[0], GL_STATIC_DRAW);
+
+        mesh.indexBufferId = device.createBuffer();
+        device.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.indexBufferId);
+        device.bufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint16_t), &indices[0], GL_STATIC_DRAW);
+
+        int stride = 5 * sizeof(float);
+
+        device.enableVertexAttribArray(0);
+        device.vertexAttribPointer(0, 3, GL_FLOAT, stride, 0);
+
+        device.enableVertexAttribArray(2);
+        device.vertexAttribPointer(2, 2, GL_FLOAT, stride, 12);
+
+        device.bindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    auto pair = _textMeshes.insert(make_pair(move(key), mesh));
+
+    return pair.first->second;
+}
+
+void Font::evictTextMesh() const {
+    auto leastRecent = min_element(_textMeshes.begin(), _textMeshes.end(), [](auto &left, auto &right) {
+        return left.second.lastUsed < right.second.lastUsed;
+    });
+    const TextMesh &mesh = leastRecent->second;
+    IGraphicsDevice &device = getGraphicsDevice();
+    RenderState::instance().invalidateVertexArray(mesh.vertexArrayId);
+    device.deleteVertexArray(mesh.vertexArrayId);
+    device.deleteBuffer(mesh.indexBufferId);
+    device.deleteBuffer(mesh.vertexBufferId);
+
+    _textMeshes.erase(leastRecent);
+}
+
+void Font::layout(const string &text, TextGravity gravity, vector<float> &vertices, vector<uint16_t> &indices) const {
+    vertices.clear();
+    indices.clear();
+    ++_layoutCount;
 
     float textWidth = measure(text);
-    glm::vec3 textOffset;
+    glm::vec2 offset;
 
     switch (gravity) {
         case TextGravity::Left:
-            textOffset = glm::vec3(-textWidth, -0.5f * _height, 0.0f);
+            offset = glm::vec2(-textWidth, -0.5f * _height);
             break;
         case TextGravity::Center:
-            textOffset = glm::vec3(-0.5f * textWidth, -0.5f * _height, 0.0f);
+            offset = glm::vec2(-0.5f * textWidth, -0.5f * _height);
             break;
         case TextGravity::Right:
-            textOffset = glm::vec3(0.0f, -0.5f * _height, 0.0f);
+            offset = glm::vec2(0.0f, -0.5f * _height);
             break;
     }
 
-    glm::mat4 textTransform(glm::translate(transform, textOffset));
-
-    for (auto &glyph : text) {
-        LocalUniforms locals;
-        locals.model = textTransform;
-        locals.color = color;
-
-        Shaders::instance().activate(ShaderProgram::GUIGUI, locals);
-
-        int off = kIndicesPerGlyph * glyph * sizeof(uint16_t);
-        glDrawElements(GL_TRIANGLES, kIndicesPerGlyph, GL_UNSIGNED_SHORT, reinterpret_cast<void *>(off));
-
-        float w = _glyphWidths[glyph];
-        textTransform = glm::translate(textTransform, glm::vec3(w, 0.0f, 0.0f));
+    int glyphCount = min(static_cast<int>(text.size()), kMaxGlyphsPerText);
+    vertices.reserve(kVertexValuesPerGlyph * glyphCount);
+    indices.reserve(kIndicesPerGlyph * glyphCount);
+
+    for (int i = 0; i < glyphCount; ++i) {
+        int glyph = getGlyphIndex(text[i]);
+        if (glyph == -1) continue;
+
+        uint16_t off = static_cast<uint16_t>(vertices.size() / 5);
+        const float *pv = &_vertices[kVertexValuesPerGlyph * glyph];
+
+        for (int j = 0; j < 4; ++j) {
+            vertices.push_back(pv[5 * j + 0] + offset.x);
+            vertices.push_back(pv[5 * j + 1] + offset.y);
+            vertices.push_back(pv[5 * j + 2]);
+            vertices.push_back(pv[5 * j + 3]);
+            vertices.push_back(pv[5 * j + 4]);
+        }
+        indices.push_back(off + 0);
+        indices.push_back(off + 1);
+        indices.push_back(off + 2);
+        indices.push_back(off + 2);
+        indices.push_back(off + 3);
+        indices.push_back(off + 0);
+
+        offset.x += _glyphWidths[glyph];
     }
+}
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
-
-    _texture->unbind(0);
+int Font::getGlyphIndex(char c) const {
+    int glyph = static_cast<unsigned char>(c);
+    return glyph < _glyphCount ? glyph : -1;
 }
 
 float Font::measure(const string &text) const {
     float w = 0.0f;
-    for (auto &glyph : text) {
-        w += _glyphWidths[glyph];
+    for (auto &c : text) {
+        int glyph = getGlyphIndex(c);
+        if (glyph != -1) {
+            w += _glyphWidths[glyph];
+        }
     }
 
     return w;
@@ -163,6 +254,10 @@ float Font::height() const {
     return _height;
 }
 
+int Font::layoutCount() const {
+    return _layoutCount;
+}
+
 } // namespace render
 
 } // namespace reone
@@ -18,6 +18,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "glm/mat4x4.hpp"
 
@@ -36,30 +39,70 @@ enum class TextGravity {
 class Font {
 public:
     Font() = default;
+    ~Font();
 
     void load(const std::shared_ptr<Texture> &texture);
-    void initGL();
+    void deinitGL();
 
+    /**
+     * Renders the text in a single draw call. Text is laid out once and
+     * kept in a cache of vertex buffers until it is evicted by other text.
+     */
     void render(
         const std::string &text,
         const glm::mat4 &transform,
         const glm::vec3 &color = glm::vec3(1.0f, 1.0f, 1.0f),
         TextGravity align = TextGravity::Center) const;
 
+    /**
+     * Lays out the text into quads of glyphs, offset according to gravity.
+     * Vertices consist of position and texture coordinates.
+     */
+    void layout(const std::string &text, TextGravity gravity, std::vector<float> &vertices, std::vector<uint16_t> &indices) const;
+
     float measure(const std::string &text) const;
     float height() const;
 
+    /**
+     * @return number of texts laid out since the font was loaded
+     */
+    int layoutCount() const;
+
 private:
-    bool _glInited { false };
+    struct TextKey {
+        std::string text;
+        TextGravity gravity { TextGravity::Center };
+
+        bool operator==(const TextKey &other) const;
+    };
+
+    struct TextKeyHash {
+        size_t operator()(const TextKey &key) const;
+    };
+
+    struct TextMesh {
+        int indexCount { 0 };
+        uint32_t lastUsed { 0 };
+        uint32_t vertexBufferId { 0 };
+        uint32_t indexBufferId { 0 };
+        uint32_t vertexArrayId { 0 };
+    };
+
     std::vector<float> _vertices;
-    std::vector<uint16_t> _indices;
     int _glyphCount { 0 };
     float _height { 0.0f };
     std::vector<float> _glyphWidths;
     std::shared_ptr<Texture> _texture;
-    uint32_t _vertexBufferId { 0 };
-    uint32_t _indexBufferId { 0 };
-    uint32_t _vertexArrayId { 0 };
+    mutable std::unordered_map<TextKey, TextMesh, TextKeyHash> _textMeshes;
+    mutable uint32_t _useCounter { 0 };
+    mutable int _layoutCount { 0 };
+
+    Font(const Font &) = delete;
+    Font &operator=(const Font &) = delete;
+
+    const TextMesh &getTextMesh(const std::string &text, TextGravity gravity) const;
+    void evictTextMesh() const;
+    int getGlyphIndex(char c) const;
 };
 
 } // namespace render
@@ -62,9 +62,6 @@ shared_ptr<Font> Fonts::doGet(const string &resRef) {
     if (texture) {
         font.reset(new Font());
         font->load(texture);
-        if (font) {
-            font->initGL();
-        }
     }
 
     return move(font);
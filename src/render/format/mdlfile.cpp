@@ -17,6 +17,8 @@
 
 #include "mdlfile.h"
 
+#include <stack>
+
 #include <boost/algorithm/string.hpp>
 
 #include "glm/ext.hpp"
@@ -25,6 +27,7 @@
 #include "../../resource/resources.h"
 
 #include "../models.h"
+#include "../shaders.h"
 #include "../textures.h"
 
 using namespace std;
@@ -64,7 +67,10 @@ enum class ControllerType {
     Multiplier = 140
 };
 
-MdlFile::MdlFile(GameVersion version) : BinaryFile(kSignatureSize, kSignature), _version(version) {
+MdlFile::MdlFile(GameVersion version, bool compressKeyframes) :
+    BinaryFile(kSignatureSize, kSignature),
+    _version(version),
+    _compressKeyframes(compressKeyframes) {
 }
 
 void MdlFile::load(const shared_ptr<istream> &mdl, const shared_ptr<istream> &mdx) {
@@ -122,6 +128,8 @@ void MdlFile::doLoad() {
     readNodeNames(nameOffsets);
 
     unique_ptr<ModelNode> rootNode(readNode(kMdlDataOffset + rootNodeOffset, nullptr));
+    mergeSkins(*rootNode);
+
     vector<unique_ptr<Animation>> anims(readAnimations(animOffsets));
     shared_ptr<Model> superModel;
 
@@ -132,6 +140,17 @@ void MdlFile::doLoad() {
     _model = make_unique<Model>(_name, move(rootNode), anims, superModel);
     _model->setClassification(getClassification(classification));
     _model->setAnimationScale(scale);
+    _model->setKeyframeStats(_keyframeStats);
+
+    if (_compressKeyframes) {
+        debug(boost::format("MDL: \"%s\": keyframes compressed from %d to %d bytes, max errors: time %.6f, position %.6f, orientation %.6f")
+            % _name
+            % _keyframeStats.uncompressedSize
+            % _keyframeStats.size
+            % _keyframeStats.maxTimeError
+            % _keyframeStats.maxPositionError
+            % _keyframeStats.maxOrientationError, 2);
+    }
 }
 
 void MdlFile::openMDX() {
@@ -298,11 +317,18 @@ void MdlFile::readControllers(uint32_t keyCount, uint32_t keyOffset, const vecto
     }
 
     seek(pos);
+
+    _keyframeStats.uncompressedSize += node.keyframesSize();
+    if (_compressKeyframes) {
+        node.compressKeyframes(_keyframeStats);
+    }
+    _keyframeStats.size += node.keyframesSize();
 }
 
 void MdlFile::readPositionController(uint16_t rowCount, uint8_t columnCount, uint16_t timeIndex, uint16_t dataIndex, const vector<float> &data, ModelNode &node) {
     bool bezier = columnCount & 16;
-    node._positionFrames.reserve(rowCount);
+    node._positionTimes.reserve(rowCount);
+    node._positions.reserve(rowCount);
 
     switch (columnCount) {
         case 3:
@@ -311,11 +337,7 @@ void MdlFile::readPositionController(uint16_t rowCount, uint8_t columnCount, uin
                 int rowTimeIdx = timeIndex + i;
                 int rowDataIdx = dataIndex + i * (bezier ? 9 : 3);
 
-                ModelNode::PositionKeyframe frame;
-                frame.time = data[rowTimeIdx];
-                frame.position = glm::make_vec3(&data[rowDataIdx]);
-
-                node._positionFrames.push_back(move(frame));
+                node.addPositionKeyframe(data[rowTimeIdx], glm::make_vec3(&data[rowDataIdx]));
             }
             break;
         default:
@@ -324,7 +346,8 @@ void MdlFile::readPositionController(uint16_t rowCount, uint8_t columnCount, uin
 }
 
 void MdlFile::readOrientationController(uint16_t rowCount, uint8_t columnCount, uint16_t timeIndex, uint16_t dataIndex, const vector<float> &data, ModelNode &node) {
-    node._orientationFrames.reserve(rowCount);
+    node._orientationTimes.reserve(rowCount);
+    node._orientations.reserve(rowCount);
 
     switch (columnCount) {
         case 2:
@@ -349,11 +372,7 @@ void MdlFile::readOrientationController(uint16_t rowCount, uint8_t columnCount,
                     w = -glm::sqrt(1.0f - dot);
                 }
 
-                ModelNode::OrientationKeyframe frame;
-                frame.time = data[rowTimeIdx];
-                frame.orientation = glm::quat(w, x, y, z);
-
-                node._orientationFrames.push_back(move(frame));
+                node.addOrientationKeyframe(data[rowTimeIdx], glm::quat(w, x, y, z));
             }
             break;
 
@@ -362,14 +381,13 @@ void MdlFile::readOrientationController(uint16_t rowCount, uint8_t columnCount,
                 int rowTimeIdx = timeIndex + i;
                 int rowDataIdx = dataIndex + i * 4;
 
-                ModelNode::OrientationKeyframe frame;
-                frame.time = data[rowTimeIdx];
-                frame.orientation.x = data[rowDataIdx + 0];
-                frame.orientation.y = data[rowDataIdx + 1];
-                frame.orientation.z = data[rowDataIdx + 2];
-                frame.orientation.w = data[rowDataIdx + 3];
+                glm::quat orientation;
+                orientation.x = data[rowDataIdx + 0];
+                orientation.y = data[rowDataIdx + 1];
+                orientation.z = data[rowDataIdx + 2];
+                orientation.w = data[rowDataIdx + 3];
 
-                node._orientationFrames.push_back(move(frame));
+                node.addOrientationKeyframe(data[rowTimeIdx], orientation);
             }
             break;
         default:
@@ -537,21 +555,78 @@ void MdlFile::readSkin(ModelNode &node) {
     node._mesh->_offsets.boneWeights = boneWeightsOffset;
     node._mesh->_offsets.boneIndices = boneIndicesOffset;
 
-    unordered_map<uint16_t, uint16_t> nodeIdxByBoneIdx;
+    vector<uint16_t> nodeIdxByBoneIdx;
     seek(kMdlDataOffset + bonesOffset);
 
     for (uint32_t i = 0; i < boneCount; ++i) {
         uint16_t boneIdx = static_cast<uint16_t>(readFloat());
         if (boneIdx == 0xffff) continue;
 
-        uint16_t nodeIdx = i;
-        nodeIdxByBoneIdx.insert(make_pair(boneIdx, nodeIdx));
+        if (nodeIdxByBoneIdx.size() <= boneIdx) {
+            nodeIdxByBoneIdx.resize(boneIdx + 1, kNoBoneNode);
+        }
+        nodeIdxByBoneIdx[boneIdx] = static_cast<uint16_t>(i);
     }
 
     node._skin = make_unique<ModelNode::Skin>();
     node._skin->nodeIdxByBoneIdx = move(nodeIdxByBoneIdx);
 }
 
+void MdlFile::mergeSkins(ModelNode &rootNode) {
+    vector<ModelNode *> skinned;
+    stack<ModelNode *> nodes;
+    nodes.push(&rootNode);
+
+    while (!nodes.empty()) {
+        ModelNode *node = nodes.top();
+        nodes.pop();
+
+        if (node->_skin && node->_mesh) {
+            skinned.push_back(node);
+        }
+        for (auto &child : node->_children) {
+            nodes.push(child.get());
+        }
+    }
+    if (skinned.size() < 2) return;
+
+    // Number bones of all skins consistently
+    auto merged = make_shared<ModelNode::Skin>();
+    vector<uint16_t> boneIdxByNodeIdx(_nodeIndex, 0xffff);
+
+    for (auto &node : skinned) {
+        for (uint16_t nodeIdx : node->_skin->nodeIdxByBoneIdx) {
+            if (nodeIdx == kNoBoneNode || nodeIdx >= _nodeIndex || boneIdxByNodeIdx[nodeIdx] != 0xffff) continue;
+
+            boneIdxByNodeIdx[nodeIdx] = static_cast<uint16_t>(merged->nodeIdxByBoneIdx.size());
+            merged->nodeIdxByBoneIdx.push_back(nodeIdx);
+        }
+    }
+    if (merged->nodeIdxByBoneIdx.size() > kMaxBoneCount) return;
+
+    for (auto &node : skinned) {
+        const vector<uint16_t> &nodeIdxByBoneIdx = node->_skin->nodeIdxByBoneIdx;
+        ModelMesh &mesh = *node->_mesh;
+        int stride = mesh._offsets.stride / sizeof(float);
+        float *boneIndices = &mesh._vertices[mesh._offsets.boneIndices / sizeof(float)];
+        size_t vertexCount = mesh._vertices.size() / stride;
+
+        for (size_t i = 0; i < vertexCount; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                int boneIdx = static_cast<int>(boneIndices[j]);
+                if (boneIdx < 0 || boneIdx >= static_cast<int>(nodeIdxByBoneIdx.size())) continue;
+
+                uint16_t nodeIdx = nodeIdxByBoneIdx[boneIdx];
+                if (nodeIdx == kNoBoneNode || nodeIdx >= _nodeIndex) continue;
+
+                boneIndices[j] = static_cast<float>(boneIdxByNodeIdx[nodeIdx]);
+            }
+            boneIndices += stride;
+        }
+        node->_skin = merged;
+    }
+}
+
 vector<unique_ptr<Animation>> MdlFile::readAnimations(const vector<uint32_t> &offsets) {
     vector<unique_ptr<Animation>> anims;
     anims.reserve(offsets.size());
@@ -28,19 +28,24 @@ namespace render {
 
 class MdlFile : public resource::BinaryFile {
 public:
-    MdlFile(resource::GameVersion version);
+    /**
+     * @param compressKeyframes whether to store position and orientation keyframes in compressed form
+     */
+    MdlFile(resource::GameVersion version, bool compressKeyframes = false);
 
     void load(const std::shared_ptr<std::istream> &mdl, const std::shared_ptr<std::istream> &mdx);
     std::shared_ptr<render::Model> model() const;
 
 private:
     resource::GameVersion _version { resource::GameVersion::KotOR };
+    bool _compressKeyframes { false };
     std::shared_ptr<std::istream> _mdx;
     std::unique_ptr<StreamReader> _mdxReader;
     std::string _name;
     int _nodeIndex { 0 };
     std::vector<std::string> _nodeNames;
     std::shared_ptr<render::Model> _model;
+    render::KeyframeStats _keyframeStats;
 
     void doLoad() override;
     void openMDX();
@@ -58,6 +63,15 @@ private:
     void readLight(render::ModelNode &node);
     std::unique_ptr<render::ModelMesh> readMesh();
     void readSkin(render::ModelNode &node);
+
+    /**
+     * Makes skinned meshes of the model share a single skin, so that they
+     * can share a bone palette. Bone indices of vertices are renumbered
+     * accordingly. Skins are left intact if the merged skin would have too
+     * many bones.
+     */
+    void mergeSkins(render::ModelNode &rootNode);
+
     std::vector<std::unique_ptr<render::Animation>> readAnimations(const std::vector<uint32_t> &offsets);
     std::unique_ptr<render::Animation> readAnimation(uint32_t offset);
     Model::Classification getClassification(int value) const;
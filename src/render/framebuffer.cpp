@@ -21,6 +21,9 @@
 
 #include "GL/glew.h"
 
+#include "device/device.h"
+#include "renderstate.h"
+
 using namespace std;
 
 namespace reone {
@@ -37,35 +40,38 @@ Framebuffer::~Framebuffer() {
 void Framebuffer::init() {
     if (_inited) return;
 
+    IGraphicsDevice &device = getGraphicsDevice();
+    RenderState &state = RenderState::instance();
+
     _colorBuffers.resize(_colorBufferCount);
-    glGenTextures(_colorBufferCount, &_colorBuffers[0]);
 
     for (int i = 0; i < _colorBufferCount; ++i) {
-        glBindTexture(GL_TEXTURE_2D, _colorBuffers[i]);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, _width, _height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
-        glBindTexture(GL_TEXTURE_2D, 0);
+        _colorBuffers[i] = device.createTexture();
+        state.bindTexture(0, GL_TEXTURE_2D, _colorBuffers[i]);
+        device.texImage2D(GL_TEXTURE_2D, 0, GL_RGBA, _width, _height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr, 0);
+        device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+        device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+        state.bindTexture(0, GL_TEXTURE_2D, 0);
     }
-    glGenRenderbuffers(1, &_depthBuffer);
-    glBindRenderbuffer(GL_RENDERBUFFER, _depthBuffer);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, _width, _height);
-    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    _depthBuffer = device.createRenderbuffer();
+    device.bindRenderbuffer(_depthBuffer);
+    device.renderbufferStorage(GL_DEPTH24_STENCIL8, _width, _height);
+    device.bindRenderbuffer(0);
 
-    glGenFramebuffers(1, &_framebuffer);
-    glBindFramebuffer(GL_FRAMEBUFFER, _framebuffer);
+    _framebuffer = device.createFramebuffer();
+    state.bindFramebuffer(_framebuffer);
 
     for (int i = 0; i < _colorBufferCount; ++i) {
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, GL_TEXTURE_2D, _colorBuffers[i], 0);
+        device.framebufferTexture2D(GL_COLOR_ATTACHMENT0 + i, GL_TEXTURE_2D, _colorBuffers[i], 0);
     }
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, _depthBuffer);
+    device.framebufferRenderbuffer(GL_DEPTH_STENCIL_ATTACHMENT, _depthBuffer);
 
-    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+    if (!device.isFramebufferComplete()) {
         throw runtime_error("Control: framebuffer is not complete");
     }
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    state.bindFramebuffer(0);
 
     _inited = true;
 }
@@ -73,27 +79,35 @@ void Framebuffer::init() {
 void Framebuffer::deinit() {
     if (!_inited) return;
 
-    glDeleteFramebuffers(1, &_framebuffer);
-    glDeleteTextures(_colorBufferCount, &_colorBuffers[0]);
-    glDeleteRenderbuffers(1, &_depthBuffer);
+    RenderState &state = RenderState::instance();
+    state.invalidateFramebuffer(_framebuffer);
+    for (auto &colorBuffer : _colorBuffers) {
+        state.invalidateTexture(colorBuffer);
+    }
+    IGraphicsDevice &device = getGraphicsDevice();
+    device.deleteFramebuffer(_framebuffer);
+    for (auto &colorBuffer : _colorBuffers) {
+        device.deleteTexture(colorBuffer);
+    }
+    device.deleteRenderbuffer(_depthBuffer);
 
     _inited = false;
 }
 
 void Framebuffer::bind() const {
-    glBindFramebuffer(GL_FRAMEBUFFER, _framebuffer);
+    RenderState::instance().bindFramebuffer(_framebuffer);
 }
 
 void Framebuffer::unbind() const {
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    RenderState::instance().bindFramebuffer(0);
 }
 
-void Framebuffer::bindColorBuffer(int n) const {
-    glBindTexture(GL_TEXTURE_2D, _colorBuffers[n]);
+void Framebuffer::bindColorBuffer(int n, int unit) const {
+    RenderState::instance().bindTexture(unit, GL_TEXTURE_2D, _colorBuffers[n]);
 }
 
-void Framebuffer::unbindColorBuffer() const {
-    glBindTexture(GL_TEXTURE_2D, 0);
+void Framebuffer::unbindColorBuffer(int unit) const {
+    RenderState::instance().bindTexture(unit, GL_TEXTURE_2D, 0);
 }
 
 int Framebuffer::width() const {
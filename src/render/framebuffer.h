@@ -33,8 +33,8 @@ public:
     void deinit();
     void bind() const;
     void unbind() const;
-    void bindColorBuffer(int n) const;
-    void unbindColorBuffer() const;
+    void bindColorBuffer(int n, int unit = 0) const;
+    void unbindColorBuffer(int unit = 0) const;
 
     int width() const;
     int height() const;
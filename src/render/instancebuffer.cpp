@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "instancebuffer.h"
+
+#include <cstddef>
+
+#include "GL/glew.h"
+
+#include "SDL2/SDL_opengl.h"
+
+#include "device/device.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace render {
+
+// Attribute locations of the model vertex shader. A matrix attribute takes
+// one location per column.
+static const int kTransformAttrib = 6;
+static const int kAlphaAttrib = 10;
+
+static const int kInitialCapacity = 256;
+
+InstanceBuffer &InstanceBuffer::instance() {
+    static InstanceBuffer instance;
+    return instance;
+}
+
+void InstanceBuffer::initGL() {
+    if (_bufferId) return;
+
+    // Non-instanced draws read the first instance, so the buffer is never empty
+    IGraphicsDevice &device = getGraphicsDevice();
+    _bufferId = device.createBuffer();
+    device.bindBuffer(GL_ARRAY_BUFFER, _bufferId);
+    device.bufferData(GL_ARRAY_BUFFER, kInitialCapacity * sizeof(InstanceData), nullptr, GL_STREAM_DRAW);
+    device.bindBuffer(GL_ARRAY_BUFFER, 0);
+
+    _capacity = kInitialCapacity;
+}
+
+void InstanceBuffer::deinitGL() {
+    if (!_bufferId) return;
+
+    getGraphicsDevice().deleteBuffer(_bufferId);
+    _bufferId = 0;
+    _capacity = 0;
+}
+
+void InstanceBuffer::bindAttributes() const {
+    if (!_bufferId) return;
+
+    IGraphicsDevice &device = getGraphicsDevice();
+    device.bindBuffer(GL_ARRAY_BUFFER, _bufferId);
+
+    for (int i = 0; i < 4; ++i) {
+        device.enableVertexAttribArray(kTransformAttrib + i);
+        device.vertexAttribPointer(kTransformAttrib + i, 4, GL_FLOAT, sizeof(InstanceData), offsetof(InstanceData, transform) + i * sizeof(glm::vec4));
+        device.vertexAttribDivisor(kTransformAttrib + i, 1);
+    }
+    device.enableVertexAttribArray(kAlphaAttrib);
+    device.vertexAttribPointer(kAlphaAttrib, 1, GL_FLOAT, sizeof(InstanceData), offsetof(InstanceData, alpha));
+    device.vertexAttribDivisor(kAlphaAttrib, 1);
+
+    device.bindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void InstanceBuffer::upload(const InstanceData *instances, int count) {
+    IGraphicsDevice &device = getGraphicsDevice();
+    device.bindBuffer(GL_ARRAY_BUFFER, _bufferId);
+
+    // Orphan the previous contents, which may still be in use by the GPU
+    if (count > _capacity) {
+        _capacity = count;
+    }
+    device.bufferData(GL_ARRAY_BUFFER, _capacity * sizeof(InstanceData), nullptr, GL_STREAM_DRAW);
+    device.bufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(InstanceData), instances);
+
+    device.bindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+} // namespace render
+
+} // namespace reone
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "glm/mat4x4.hpp"
+
+namespace reone {
+
+namespace render {
+
+struct InstanceData {
+    glm::mat4 transform { 1.0f };
+    float alpha { 1.0f };
+};
+
+/**
+ * Buffer of per-instance data for instanced draw calls, shared by all
+ * vertex arrays.
+ */
+class InstanceBuffer {
+public:
+    static InstanceBuffer &instance();
+
+    void initGL();
+    void deinitGL();
+
+    /**
+     * Binds per-instance attributes of the bound vertex array to this buffer.
+     * Does nothing if this buffer is not initialized.
+     */
+    void bindAttributes() const;
+
+    /**
+     * Replaces contents of this buffer with the instances.
+     */
+    void upload(const InstanceData *instances, int count);
+
+private:
+    uint32_t _bufferId { 0 };
+    int _capacity { 0 };
+
+    InstanceBuffer() = default;
+    InstanceBuffer(const InstanceBuffer &) = delete;
+    InstanceBuffer &operator=(const InstanceBuffer &) = delete;
+};
+
+} // namespace render
+
+} // namespace reone
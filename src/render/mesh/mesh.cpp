@@ -23,6 +23,10 @@
 
 #include "glm/ext.hpp"
 
+#include "../device/device.h"
+#include "../instancebuffer.h"
+#include "../renderstate.h"
+
 namespace reone {
 
 namespace render {
@@ -43,45 +47,50 @@ void Mesh::computeAABB() {
 void Mesh::initGL() {
     if (_glInited) return;
 
-    glGenBuffers(1, &_vertexBufferId);
-    glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
-    glBufferData(GL_ARRAY_BUFFER, _vertices.size() * sizeof(float), &_vertices[0], GL_STATIC_DRAW);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    IGraphicsDevice &device = getGraphicsDevice();
+
+    _vertexArrayId = device.createVertexArray();
+    RenderState::instance().bindVertexArray(_vertexArrayId);
 
-    glGenBuffers(1, &_indexBufferId);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, _indices.size() * sizeof(uint16_t), &_indices[0], GL_STATIC_DRAW);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    _vertexBufferId = device.createBuffer();
+    device.bindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
+    device.bufferData(GL_ARRAY_BUFFER, _vertices.size() * sizeof(float), &_vertices[0], GL_STATIC_DRAW);
 
-    glGenVertexArrays(1, &_vertexArrayId);
-    glBindVertexArray(_vertexArrayId);
-    glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferId);
+    // Element buffer binding is part of the vertex array state
+    _indexBufferId = device.createBuffer();
+    device.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
+    if (_indices32.empty()) {
+        device.bufferData(GL_ELEMENT_ARRAY_BUFFER, _indices.size() * sizeof(uint16_t), &_indices[0], GL_STATIC_DRAW);
+    } else {
+        device.bufferData(GL_ELEMENT_ARRAY_BUFFER, _indices32.size() * sizeof(uint32_t), &_indices32[0], GL_STATIC_DRAW);
+    }
 
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, _offsets.stride, reinterpret_cast<void *>(_offsets.vertexCoords));
+    device.enableVertexAttribArray(0);
+    device.vertexAttribPointer(0, 3, GL_FLOAT, _offsets.stride, _offsets.vertexCoords);
 
     if (_offsets.normals != -1) {
-        glEnableVertexAttribArray(1);
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, _offsets.stride, reinterpret_cast<void *>(_offsets.normals));
+        device.enableVertexAttribArray(1);
+        device.vertexAttribPointer(1, 3, GL_FLOAT, _offsets.stride, _offsets.normals);
     }
     if (_offsets.texCoords1 != -1) {
-        glEnableVertexAttribArray(2);
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, _offsets.stride, reinterpret_cast<void *>(_offsets.texCoords1));
+        device.enableVertexAttribArray(2);
+        device.vertexAttribPointer(2, 2, GL_FLOAT, _offsets.stride, _offsets.texCoords1);
     }
     if (_offsets.texCoords2 != -1) {
-        glEnableVertexAttribArray(3);
-        glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, _offsets.stride, reinterpret_cast<void *>(_offsets.texCoords2));
+        device.enableVertexAttribArray(3);
+        device.vertexAttribPointer(3, 2, GL_FLOAT, _offsets.stride, _offsets.texCoords2);
     }
     if (_offsets.boneWeights != -1) {
-        glEnableVertexAttribArray(4);
-        glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, _offsets.stride, reinterpret_cast<void *>(_offsets.boneWeights));
+        device.enableVertexAttribArray(4);
+        device.vertexAttribPointer(4, 4, GL_FLOAT, _offsets.stride, _offsets.boneWeights);
     }
     if (_offsets.boneIndices != -1) {
-        glEnableVertexAttribArray(5);
-        glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, _offsets.stride, reinterpret_cast<void *>(_offsets.boneIndices));
+        device.enableVertexAttribArray(5);
+        device.vertexAttribPointer(5, 4, GL_FLOAT, _offsets.stride, _offsets.boneIndices);
     }
+    device.bindBuffer(GL_ARRAY_BUFFER, 0);
 
-    glBindVertexArray(0);
+    InstanceBuffer::instance().bindAttributes();
 
     _glInited = true;
 }
@@ -93,35 +102,72 @@ Mesh::~Mesh() {
 void Mesh::deinitGL() {
     if (!_glInited) return;
 
-    glDeleteVertexArrays(1, &_vertexArrayId);
-    glDeleteBuffers(1, &_indexBufferId);
-    glDeleteBuffers(1, &_vertexBufferId);
+    IGraphicsDevice &device = getGraphicsDevice();
+    RenderState::instance().invalidateVertexArray(_vertexArrayId);
+    device.deleteVertexArray(_vertexArrayId);
+    device.deleteBuffer(_indexBufferId);
+    device.deleteBuffer(_vertexBufferId);
 
     _glInited = false;
 }
 
 void Mesh::renderLines() const {
-    render(GL_LINES, static_cast<int>(_indices.size()), 0);
+    render(GL_LINES, indexCount(), 0);
 }
 
 void Mesh::renderTriangles() const {
-    render(GL_TRIANGLES, static_cast<int>(_indices.size()), 0);
+    render(GL_TRIANGLES, indexCount(), 0);
 }
 
 void Mesh::render(uint32_t mode, int count, int offset) const {
-    glBindVertexArray(_vertexArrayId);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
+    RenderState::instance().bindVertexArray(_vertexArrayId);
+    getGraphicsDevice().drawElements(mode, count, indexType(), static_cast<size_t>(offset) * indexSize());
+}
+
+void Mesh::bind() const {
+    RenderState::instance().bindVertexArray(_vertexArrayId);
+}
 
-    glDrawElements(mode, count, GL_UNSIGNED_SHORT, reinterpret_cast<void *>(offset));
+void Mesh::unbind() const {
+    RenderState::instance().bindVertexArray(0);
+}
+
+void Mesh::drawTriangles() const {
+    getGraphicsDevice().drawElements(GL_TRIANGLES, indexCount(), indexType(), 0);
+}
+
+void Mesh::drawTrianglesInstanced(int count) const {
+    getGraphicsDevice().drawElementsInstanced(GL_TRIANGLES, indexCount(), indexType(), 0, count);
+}
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+uint32_t Mesh::indexType() const {
+    return _indices32.empty() ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+}
+
+int Mesh::indexSize() const {
+    return _indices32.empty() ? sizeof(uint16_t) : sizeof(uint32_t);
+}
+
+int Mesh::indexCount() const {
+    return static_cast<int>(_indices32.empty() ? _indices.size() : _indices32.size());
 }
 
 const AABB &Mesh::aabb() const {
     return _aabb;
 }
 
+const std::vector<float> &Mesh::vertices() const {
+    return _vertices;
+}
+
+const std::vector<uint16_t> &Mesh::indices() const {
+    return _indices;
+}
+
+const Mesh::VertexOffsets &Mesh::offsets() const {
+    return _offsets;
+}
+
 } // namespace render
 
 } // namespace reone
@@ -49,12 +49,30 @@ public:
     void renderLines() const;
     void renderTriangles() const;
 
+    /**
+     * Binds the vertex array and index buffer of this mesh, so that it can
+     * be drawn repeatedly with drawTriangles.
+     */
+    void bind() const;
+    void unbind() const;
+    void drawTriangles() const;
+
+    /**
+     * Same as drawTriangles, but draws instances from the instance buffer.
+     */
+    void drawTrianglesInstanced(int count) const;
+
+    int indexCount() const;
     const AABB &aabb() const;
+    const std::vector<float> &vertices() const;
+    const std::vector<uint16_t> &indices() const;
+    const VertexOffsets &offsets() const;
 
 protected:
     bool _glInited { false };
     std::vector<float> _vertices;
     std::vector<uint16_t> _indices;
+    std::vector<uint32_t> _indices32; /**< used instead of indices by meshes with more than 65536 vertices */
     VertexOffsets _offsets;
     uint32_t _indexBufferId { 0 };
     uint32_t _vertexArrayId { 0 };
@@ -63,12 +81,19 @@ protected:
     virtual ~Mesh();
 
     void computeAABB();
+
+    /**
+     * @param offset index of the first index to render
+     */
     void render(uint32_t mode, int count, int offset) const;
 
 private:
     uint32_t _vertexBufferId { 0 };
     AABB _aabb;
 
+    uint32_t indexType() const;
+    int indexSize() const;
+
     Mesh(const Mesh &) = delete;
     Mesh &operator=(const Mesh &) = delete;
 
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "meshbatch.h"
+
+#include <stdexcept>
+
+#include "GL/glew.h"
+
+#include "SDL2/SDL_opengl.h"
+
+#include "glm/ext.hpp"
+
+using namespace std;
+
+namespace reone {
+
+namespace render {
+
+static const int kValuesPerVertex = 10;
+static const uint32_t kMaxIndex16 = 0xffff;
+
+static Mesh::VertexOffsets g_offsets = { 0, 3 * sizeof(float), 6 * sizeof(float), 8 * sizeof(float), -1, -1, kValuesPerVertex * sizeof(float) };
+
+MeshBatch::MeshBatch() {
+    _offsets = g_offsets;
+}
+
+void MeshBatch::add(int group, const Mesh &mesh, const glm::mat4 &transform) {
+    if (_glInited) {
+        throw logic_error("MeshBatch: meshes must not be added after initGL");
+    }
+    if (!_groups.empty() && group < _groups.back().group) {
+        throw invalid_argument("MeshBatch: groups must be added in increasing order");
+    }
+    if (_groups.empty() || _groups.back().group != group) {
+        Group newGroup;
+        newGroup.group = group;
+        newGroup.range.offset = static_cast<int>(_indices32.size());
+        _groups.push_back(move(newGroup));
+    }
+    const vector<float> &vertices = mesh.vertices();
+    const VertexOffsets &offsets = mesh.offsets();
+    int stride = offsets.stride / sizeof(float);
+    size_t vertexCount = vertices.size() / stride;
+    uint32_t baseVertex = static_cast<uint32_t>(_vertices.size() / kValuesPerVertex);
+    glm::mat3 normalTransform(glm::transpose(glm::inverse(transform)));
+
+    _vertices.reserve(_vertices.size() + kValuesPerVertex * vertexCount);
+
+    for (size_t i = 0; i < vertexCount; ++i) {
+        const float *pv = &vertices[i * stride];
+
+        glm::vec3 position(transform * glm::vec4(glm::make_vec3(pv + offsets.vertexCoords / sizeof(float)), 1.0f));
+        glm::vec3 normal(0.0f);
+        glm::vec2 texCoords1(0.0f);
+        glm::vec2 texCoords2(0.0f);
+
+        if (offsets.normals != -1) {
+            normal = glm::normalize(normalTransform * glm::make_vec3(pv + offsets.normals / sizeof(float)));
+        }
+        if (offsets.texCoords1 != -1) {
+            texCoords1 = glm::make_vec2(pv + offsets.texCoords1 / sizeof(float));
+        }
+        if (offsets.texCoords2 != -1) {
+            texCoords2 = glm::make_vec2(pv + offsets.texCoords2 / sizeof(float));
+        }
+        _vertices.insert(_vertices.end(), {
+            position.x, position.y, position.z,
+            normal.x, normal.y, normal.z,
+            texCoords1.x, texCoords1.y,
+            texCoords2.x, texCoords2.y
+        });
+    }
+
+    // Indices are accumulated as 32-bit and narrowed by end, if possible
+    const vector<uint16_t> &indices = mesh.indices();
+    _indices32.reserve(_indices32.size() + indices.size());
+    for (auto &index : indices) {
+        _indices32.push_back(baseVertex + index);
+    }
+
+    Group &lastGroup = _groups.back();
+    lastGroup.range.count = static_cast<int>(_indices32.size()) - lastGroup.range.offset;
+    ++lastGroup.meshCount;
+    ++_meshCount;
+}
+
+void MeshBatch::end() {
+    if (vertexCount() <= static_cast<int>(kMaxIndex16) + 1) {
+        _indices.assign(_indices32.begin(), _indices32.end());
+        _indices32.clear();
+        _indices32.shrink_to_fit();
+    }
+    computeAABB();
+}
+
+void MeshBatch::getRanges(const vector<bool> &visible, vector<Range> &ranges) const {
+    bool merge = false;
+
+    for (auto &group : _groups) {
+        if (static_cast<size_t>(group.group) >= visible.size() || !visible[group.group]) {
+            merge = false;
+            continue;
+        }
+        if (merge) {
+            ranges.back().count += group.range.count;
+        } else {
+            ranges.push_back(group.range);
+            merge = true;
+        }
+    }
+}
+
+void MeshBatch::drawRanges(const vector<Range> &ranges) const {
+    for (auto &range : ranges) {
+        render(GL_TRIANGLES, range.count, range.offset);
+    }
+}
+
+int MeshBatch::getMeshCount(const vector<bool> &visible) const {
+    int result = 0;
+    for (auto &group : _groups) {
+        if (static_cast<size_t>(group.group) < visible.size() && visible[group.group]) {
+            result += group.meshCount;
+        }
+    }
+    return result;
+}
+
+int MeshBatch::meshCount() const {
+    return _meshCount;
+}
+
+int MeshBatch::vertexCount() const {
+    return static_cast<int>(_vertices.size() / kValuesPerVertex);
+}
+
+bool MeshBatch::hasIndices32() const {
+    return !_indices32.empty();
+}
+
+} // namespace render
+
+} // namespace reone
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "glm/mat4x4.hpp"
+
+#include "mesh.h"
+
+namespace reone {
+
+namespace render {
+
+/**
+ * Mesh merged from several static meshes, which are transformed into a common
+ * space. Merged meshes are added in groups, e.g. rooms, and the index range
+ * of every group can be drawn separately. Indices are 32-bit only when the
+ * batch has more vertices than 16-bit indices can address.
+ */
+class MeshBatch : public Mesh {
+public:
+    struct Range {
+        int offset { 0 }; /**< index of the first index */
+        int count { 0 };
+    };
+
+    MeshBatch();
+
+    /**
+     * Appends the mesh to the group. Groups must be appended in increasing
+     * order, and all meshes of a group must be appended at once.
+     *
+     * @param transform transforms vertices of the mesh into the batch space
+     */
+    void add(int group, const Mesh &mesh, const glm::mat4 &transform);
+
+    /**
+     * Completes the batch, must be called before initGL.
+     */
+    void end();
+
+    /**
+     * Appends index ranges of the visible groups to ranges, merging ranges
+     * of groups that are adjacent in the index buffer.
+     *
+     * @param visible visibility of groups, indexed by group
+     */
+    void getRanges(const std::vector<bool> &visible, std::vector<Range> &ranges) const;
+
+    /**
+     * Draws the index ranges, assuming that the vertex array is bound.
+     */
+    void drawRanges(const std::vector<Range> &ranges) const;
+
+    /**
+     * @return number of merged meshes in the visible groups
+     */
+    int getMeshCount(const std::vector<bool> &visible) const;
+
+    int meshCount() const;
+    int vertexCount() const;
+    bool hasIndices32() const;
+
+private:
+    struct Group {
+        int group { 0 };
+        Range range;
+        int meshCount { 0 };
+    };
+
+    std::vector<Group> _groups;
+    int _meshCount { 0 };
+};
+
+} // namespace render
+
+} // namespace reone
@@ -21,6 +21,8 @@
 
 #include "SDL2/SDL_opengl.h"
 
+#include "../renderstate.h"
+
 using namespace std;
 
 namespace reone {
@@ -30,56 +32,30 @@ namespace render {
 ModelMesh::ModelMesh(bool render, int transparency) : _render(render), _transparency(transparency) {
 }
 
-void ModelMesh::render(const shared_ptr<Texture> &diffuseOverride) const {
-    const shared_ptr<Texture> &diffuse = diffuseOverride ? diffuseOverride : _diffuse;
-    bool additive = false;
-
-    if (diffuse) {
-        diffuse->bind(0);
-        additive = diffuse->isAdditive();
-    }
-    if (_envmap) {
-        _envmap->bind(1);
-    }
-    if (_lightmap) {
-        _lightmap->bind(2);
-    }
-    if (_bumpyShiny) {
-        _bumpyShiny->bind(3);
-    }
-    if (_bumpmap) {
-        _bumpmap->bind(4);
-    }
+void ModelMesh::draw(const shared_ptr<Texture> &diffuseOverride) const {
+    drawWithBlending(0, diffuseOverride);
+}
 
-    GLint blendSrcRgb, blendSrcAlpha, blendDstRgb, blendDstAlpha;
-    if (additive) {
-        glGetIntegerv(GL_BLEND_SRC_RGB, &blendSrcRgb);
-        glGetIntegerv(GL_BLEND_SRC_ALPHA, &blendSrcAlpha);
-        glGetIntegerv(GL_BLEND_DST_RGB, &blendDstRgb);
-        glGetIntegerv(GL_BLEND_DST_ALPHA, &blendDstAlpha);
-        glBlendFunc(GL_ONE, GL_ONE);
-    }
+void ModelMesh::drawInstanced(int count, const shared_ptr<Texture> &diffuseOverride) const {
+    drawWithBlending(count, diffuseOverride);
+}
 
-    Mesh::renderTriangles();
+void ModelMesh::drawWithBlending(int instanceCount, const shared_ptr<Texture> &diffuseOverride) const {
+    const shared_ptr<Texture> &diffuse = diffuseOverride ? diffuseOverride : _diffuse;
+    bool additive = diffuse && diffuse->isAdditive();
 
+    RenderState &state = RenderState::instance();
+    BlendMode oldMode = state.blendMode();
     if (additive) {
-        glBlendFuncSeparate(blendSrcRgb, blendDstRgb, blendSrcAlpha, blendDstAlpha);
+        state.setBlendMode(BlendMode::Additive);
     }
-
-    if (_bumpmap) {
-        _bumpmap->unbind(4);
-    }
-    if (_bumpyShiny) {
-        _bumpyShiny->unbind(3);
-    }
-    if (_lightmap) {
-        _lightmap->unbind(2);
-    }
-    if (_envmap) {
-        _envmap->unbind(1);
+    if (instanceCount > 0) {
+        Mesh::drawTrianglesInstanced(instanceCount);
+    } else {
+        Mesh::drawTriangles();
     }
-    if (diffuse) {
-        diffuse->unbind(0);
+    if (additive) {
+        state.setBlendMode(oldMode);
     }
 }
 
@@ -129,6 +105,22 @@ const shared_ptr<Texture> &ModelMesh::diffuseTexture() const {
     return _diffuse;
 }
 
+const shared_ptr<Texture> &ModelMesh::envmapTexture() const {
+    return _envmap;
+}
+
+const shared_ptr<Texture> &ModelMesh::lightmapTexture() const {
+    return _lightmap;
+}
+
+const shared_ptr<Texture> &ModelMesh::bumpyShinyTexture() const {
+    return _bumpyShiny;
+}
+
+const shared_ptr<Texture> &ModelMesh::bumpmapTexture() const {
+    return _bumpmap;
+}
+
 } // namespace render
 
 } // namespace reone
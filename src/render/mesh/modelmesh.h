@@ -39,7 +39,15 @@ class ModelMesh : public Mesh {
 public:
     ModelMesh(bool render, int transparency);
 
-    void render(const std::shared_ptr<Texture> &diffuseOverride = nullptr) const;
+    /**
+     * Draws this mesh, assuming that its textures and vertex array are bound.
+     */
+    void draw(const std::shared_ptr<Texture> &diffuseOverride = nullptr) const;
+
+    /**
+     * Same as draw, but draws instances from the instance buffer.
+     */
+    void drawInstanced(int count, const std::shared_ptr<Texture> &diffuseOverride = nullptr) const;
 
     bool shouldRender() const;
     bool isTransparent() const;
@@ -51,6 +59,10 @@ public:
 
     int transparency() const;
     const std::shared_ptr<Texture> &diffuseTexture() const;
+    const std::shared_ptr<Texture> &envmapTexture() const;
+    const std::shared_ptr<Texture> &lightmapTexture() const;
+    const std::shared_ptr<Texture> &bumpyShinyTexture() const;
+    const std::shared_ptr<Texture> &bumpmapTexture() const;
 
 private:
     bool _render { false };
@@ -61,6 +73,11 @@ private:
     std::shared_ptr<Texture> _bumpyShiny;
     std::shared_ptr<Texture> _bumpmap;
 
+    /**
+     * @param instanceCount number of instances to draw, or zero to draw without instancing
+     */
+    void drawWithBlending(int instanceCount, const std::shared_ptr<Texture> &diffuseOverride) const;
+
     friend class MdlFile;
 };
 
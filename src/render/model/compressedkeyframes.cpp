@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "compressedkeyframes.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace render {
+
+static const float kMaxQuantized = 65535.0f;
+static const float kMaxSmallestThree = 32767.0f; // 15 bits per component
+static const float kSmallestThreeRange = 0.70710678f; // 1 / sqrt(2)
+
+static uint16_t quantize(float value, float min, float step) {
+    if (step == 0.0f) return 0;
+
+    float quantized = glm::round((value - min) / step);
+
+    return static_cast<uint16_t>(glm::clamp(quantized, 0.0f, kMaxQuantized));
+}
+
+/**
+ * Encodes a unit quaternion as its three smallest components, 15 bits each,
+ * and the index of the largest component, stored in the high bits of the
+ * first two values. The largest component is made positive by negating the
+ * quaternion, which represents the same rotation.
+ */
+static void compressOrientation(const glm::quat &orientation, uint16_t *values) {
+    glm::quat q(glm::normalize(orientation));
+
+    int largest = 0;
+    for (int i = 1; i < 4; ++i) {
+        if (glm::abs(q[i]) > glm::abs(q[largest])) {
+            largest = i;
+        }
+    }
+    float sign = q[largest] < 0.0f ? -1.0f : 1.0f;
+
+    for (int i = 0, j = 0; i < 4; ++i) {
+        if (i == largest) continue;
+
+        float normalized = (sign * q[i] / kSmallestThreeRange + 1.0f) * 0.5f;
+        values[j++] = static_cast<uint16_t>(glm::clamp(glm::round(normalized * kMaxSmallestThree), 0.0f, kMaxSmallestThree));
+    }
+    values[0] |= (largest & 1) << 15;
+    values[1] |= (largest & 2) << 14;
+}
+
+static glm::quat decompressOrientation(const uint16_t *values) {
+    int largest = (values[0] >> 15) | ((values[1] >> 14) & 2);
+
+    glm::quat q;
+    float sumOfSquares = 0.0f;
+
+    for (int i = 0, j = 0; i < 4; ++i) {
+        if (i == largest) continue;
+
+        float normalized = (values[j++] & 0x7fff) / kMaxSmallestThree;
+        q[i] = (normalized * 2.0f - 1.0f) * kSmallestThreeRange;
+        sumOfSquares += q[i] * q[i];
+    }
+    q[largest] = glm::sqrt(glm::max(0.0f, 1.0f - sumOfSquares));
+
+    return move(q);
+}
+
+float CompressedKeyframes::TimeRange::get(uint16_t value) const {
+    // The last keyframe is exact, so that sampling at the end of a track yields it
+    return value == kMaxQuantized ? end : start + value * step;
+}
+
+static void compressTimes(const vector<float> &times, float &start, float &end, float &step, uint16_t *values) {
+    if (times.empty()) return;
+
+    start = times.front();
+    end = times.back();
+    step = (end - start) / kMaxQuantized;
+
+    for (size_t i = 0; i < times.size(); ++i) {
+        values[i] = quantize(times[i], start, step);
+    }
+}
+
+CompressedKeyframes::CompressedKeyframes(
+    const vector<float> &positionTimes,
+    const vector<glm::vec3> &positions,
+    const vector<float> &orientationTimes,
+    const vector<glm::quat> &orientations) :
+    _positionCount(static_cast<int>(positionTimes.size())),
+    _orientationCount(static_cast<int>(orientationTimes.size())) {
+
+    _data.resize(4 * (_positionCount + _orientationCount));
+
+    compressTimes(positionTimes, _positionTimes.start, _positionTimes.end, _positionTimes.step, &_data[0]);
+    compressTimes(orientationTimes, _orientationTimes.start, _orientationTimes.end, _orientationTimes.step, &_data[4 * _positionCount]);
+
+    if (!positions.empty()) {
+        glm::vec3 max(positions.front());
+        _positionMin = positions.front();
+        for (auto &position : positions) {
+            _positionMin = glm::min(_positionMin, position);
+            max = glm::max(max, position);
+        }
+        _positionStep = (max - _positionMin) / kMaxQuantized;
+
+        uint16_t *values = &_data[_positionCount];
+        for (int i = 0; i < _positionCount; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                values[3 * i + j] = quantize(positions[i][j], _positionMin[j], _positionStep[j]);
+            }
+        }
+    }
+    if (!orientations.empty()) {
+        uint16_t *values = &_data[4 * _positionCount + _orientationCount];
+        for (int i = 0; i < _orientationCount; ++i) {
+            compressOrientation(orientations[i], &values[3 * i]);
+        }
+    }
+}
+
+int CompressedKeyframes::positionCount() const {
+    return _positionCount;
+}
+
+float CompressedKeyframes::positionTime(int index) const {
+    return _positionTimes.get(positionTimeData()[index]);
+}
+
+glm::vec3 CompressedKeyframes::position(int index) const {
+    const uint16_t *values = &positionData()[3 * index];
+    return _positionMin + glm::vec3(values[0], values[1], values[2]) * _positionStep;
+}
+
+int CompressedKeyframes::orientationCount() const {
+    return _orientationCount;
+}
+
+float CompressedKeyframes::orientationTime(int index) const {
+    return _orientationTimes.get(orientationTimeData()[index]);
+}
+
+glm::quat CompressedKeyframes::orientation(int index) const {
+    return decompressOrientation(&orientationData()[3 * index]);
+}
+
+size_t CompressedKeyframes::size() const {
+    return sizeof(CompressedKeyframes) + sizeof(uint16_t) * _data.capacity();
+}
+
+const uint16_t *CompressedKeyframes::positionTimeData() const {
+    return _data.data();
+}
+
+const uint16_t *CompressedKeyframes::positionData() const {
+    return _data.data() + _positionCount;
+}
+
+const uint16_t *CompressedKeyframes::orientationTimeData() const {
+    return _data.data() + 4 * _positionCount;
+}
+
+const uint16_t *CompressedKeyframes::orientationData() const {
+    return _data.data() + 4 * _positionCount + _orientationCount;
+}
+
+} // namespace render
+
+} // namespace reone
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "glm/gtc/quaternion.hpp"
+#include "glm/vec3.hpp"
+
+namespace reone {
+
+namespace render {
+
+/**
+ * Memory usage and accuracy of keyframes of a model, including its
+ * animations.
+ */
+struct KeyframeStats {
+    size_t uncompressedSize { 0 }; // bytes
+    size_t size { 0 }; // bytes, as stored
+    float maxTimeError { 0.0f };
+    float maxPositionError { 0.0f }; // per component
+    float maxOrientationError { 0.0f }; // per component
+};
+
+/**
+ * Position and orientation keyframes of a model node in compressed form.
+ * Times are quantized to 16 bits over the duration of a track, positions
+ * are quantized to 16 bits per component over their range, orientations are
+ * encoded as the three smallest components of a unit quaternion in 48 bits.
+ * Keyframes are decompressed on access.
+ */
+class CompressedKeyframes {
+public:
+    CompressedKeyframes(
+        const std::vector<float> &positionTimes,
+        const std::vector<glm::vec3> &positions,
+        const std::vector<float> &orientationTimes,
+        const std::vector<glm::quat> &orientations);
+
+    int positionCount() const;
+    float positionTime(int index) const;
+    glm::vec3 position(int index) const;
+
+    int orientationCount() const;
+    float orientationTime(int index) const;
+    glm::quat orientation(int index) const;
+
+    /**
+     * @return size of the keyframes in bytes
+     */
+    size_t size() const;
+
+private:
+    struct TimeRange {
+        float start { 0.0f };
+        float end { 0.0f };
+        float step { 0.0f };
+
+        float get(uint16_t value) const;
+    };
+
+    int _positionCount { 0 };
+    int _orientationCount { 0 };
+    TimeRange _positionTimes;
+    TimeRange _orientationTimes;
+    glm::vec3 _positionMin { 0.0f };
+    glm::vec3 _positionStep { 0.0f };
+
+    // Position times, positions (3 values each), orientation times and
+    // orientations (3 values each), in that order
+    std::vector<uint16_t> _data;
+
+    const uint16_t *positionTimeData() const;
+    const uint16_t *positionData() const;
+    const uint16_t *orientationTimeData() const;
+    const uint16_t *orientationData() const;
+
+    CompressedKeyframes(const CompressedKeyframes &) = delete;
+    CompressedKeyframes &operator=(const CompressedKeyframes &) = delete;
+};
+
+} // namespace render
+
+} // namespace reone
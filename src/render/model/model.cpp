@@ -17,6 +17,8 @@
 
 #include "model.h"
 
+#include <stack>
+
 using namespace std;
 
 namespace reone {
@@ -47,6 +49,11 @@ void Model::init(const shared_ptr<ModelNode> &node) {
     _nodeByNumber.insert(make_pair(node->nodeNumber(), node));
     _nodeByName.insert(make_pair(node->name(), node));
 
+    if (static_cast<int>(_nodes.size()) <= node->index()) {
+        _nodes.resize(node->index() + 1, nullptr);
+    }
+    _nodes[node->index()] = node.get();
+
     shared_ptr<ModelMesh> mesh(node->mesh());
     if (mesh) {
         _aabb.expand(mesh->aabb() * node->absoluteTransform());
@@ -83,6 +90,71 @@ shared_ptr<ModelNode> Model::findNodeByName(const string &name) const {
     return it != _nodeByName.end() ? it->second : nullptr;
 }
 
+bool Model::isNodeStatic(const ModelNode &node) const {
+    lock_guard<mutex> lock(_staticNodesMutex);
+
+    if (_staticNodes.empty()) {
+        _staticNodes.resize(_nodes.size(), false);
+
+        // Parents precede their children
+        for (auto &modelNode : _nodes) {
+            if (!modelNode) continue;
+
+            const ModelNode *parent = modelNode->parent();
+            bool parentStatic = !parent || _staticNodes[parent->index()];
+            _staticNodes[modelNode->index()] = parentStatic && !isNodeAnimated(modelNode->name());
+        }
+    }
+    return _staticNodes[node.index()];
+}
+
+bool Model::isNodeAnimated(const string &name) const {
+    for (auto &anim : _animations) {
+        shared_ptr<ModelNode> animNode(anim.second->findNode(name));
+        if (animNode && animNode->hasKeyframes()) return true;
+    }
+    return _superModel && _superModel->isNodeAnimated(name);
+}
+
+const AnimationBinding &Model::getAnimationBinding(const Animation &anim) const {
+    lock_guard<mutex> lock(_animBindingsMutex);
+
+    auto maybeBinding = _animBindings.find(&anim);
+    if (maybeBinding != _animBindings.end()) {
+        return *maybeBinding->second;
+    }
+    unique_ptr<AnimationBinding> binding(new AnimationBinding());
+    binding->animNodes.resize(_nodes.size(), nullptr);
+
+    stack<const ModelNode *> animNodes;
+    animNodes.push(anim.rootNode().get());
+
+    while (!animNodes.empty()) {
+        const ModelNode *animNode = animNodes.top();
+        animNodes.pop();
+
+        shared_ptr<ModelNode> modelNode(findNodeByName(animNode->name()));
+        if (modelNode && !binding->animNodes[modelNode->index()]) {
+            binding->animNodes[modelNode->index()] = animNode;
+        }
+
+        // Push children in reverse to visit nodes in pre-order
+        const vector<shared_ptr<ModelNode>> &children = animNode->children();
+        for (auto it = children.rbegin(); it != children.rend(); ++it) {
+            animNodes.push(it->get());
+        }
+    }
+
+    const AnimationBinding &result = *binding;
+    _animBindings.insert(make_pair(&anim, move(binding)));
+
+    return result;
+}
+
+const vector<ModelNode *> &Model::nodes() const {
+    return _nodes;
+}
+
 Model::Classification Model::classification() const {
     return _classification;
 }
@@ -99,6 +171,10 @@ float Model::animationScale() const {
     return _animationScale;
 }
 
+const KeyframeStats &Model::keyframeStats() const {
+    return _keyframeStats;
+}
+
 shared_ptr<Model> Model::superModel() const {
     return _superModel;
 }
@@ -119,6 +195,10 @@ void Model::setAnimationScale(float scale) {
     _animationScale = scale;
 }
 
+void Model::setKeyframeStats(const KeyframeStats &stats) {
+    _keyframeStats = stats;
+}
+
 } // namespace render
 
 } // namespace reone
@@ -17,7 +17,10 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "../aabb.h"
 
@@ -27,6 +30,18 @@ namespace reone {
 
 namespace render {
 
+/**
+ * Maps nodes of an animation onto nodes of a model, so that animating the
+ * model requires no lookups by name.
+ */
+struct AnimationBinding {
+    /**
+     * For every model node, in order of node indices, the first animation
+     * node with the same name, or nullptr if the model node is not animated.
+     */
+    std::vector<const ModelNode *> animNodes;
+};
+
 /**
  * Tree-like data structure, representing a 3D model. Contains model nodes
  * and animations. Models are cached and reused between model scene nodes.
@@ -59,6 +74,24 @@ public:
     std::shared_ptr<ModelNode> findNodeByNumber(uint16_t number) const;
     std::shared_ptr<ModelNode> findNodeByName(const std::string &name) const;
 
+    /**
+     * Binds the animation to this model once and caches the result.
+     * Thread-safe.
+     */
+    const AnimationBinding &getAnimationBinding(const Animation &anim) const;
+
+    /**
+     * @return true if no animation of this model or its supermodel moves the node or its ancestors
+     *
+     * Computed once and cached. Thread-safe.
+     */
+    bool isNodeStatic(const ModelNode &node) const;
+
+    /**
+     * @return all nodes of this model in order of their indices, which is parent-first
+     */
+    const std::vector<ModelNode *> &nodes() const;
+
     Classification classification() const;
     const std::string &name() const;
     ModelNode &rootNode() const;
@@ -67,8 +100,14 @@ public:
     const AABB &aabb() const;
     float radiusXY() const;
 
+    /**
+     * @return memory usage and accuracy of keyframes of this model and its animations
+     */
+    const KeyframeStats &keyframeStats() const;
+
     void setClassification(Classification classification);
     void setAnimationScale(float scale);
+    void setKeyframeStats(const KeyframeStats &stats);
 
 private:
     Classification _classification { Classification::Other };
@@ -78,15 +117,23 @@ private:
     std::shared_ptr<Model> _superModel;
     std::unordered_map<uint16_t, std::shared_ptr<ModelNode>> _nodeByNumber;
     std::unordered_map<std::string, std::shared_ptr<ModelNode>> _nodeByName;
+    std::vector<ModelNode *> _nodes;
+    mutable std::unordered_map<const Animation *, std::unique_ptr<AnimationBinding>> _animBindings;
+    mutable std::mutex _animBindingsMutex;
+    mutable std::vector<bool> _staticNodes;
+    mutable std::mutex _staticNodesMutex;
     AABB _aabb;
     float _radiusXY { 0.0f };
     float _animationScale { 1.0f };
+    KeyframeStats _keyframeStats;
 
     Model(const Model &) = delete;
     Model &operator=(const Model &) = delete;
 
     void init(const std::shared_ptr<ModelNode> &node);
 
+    bool isNodeAnimated(const std::string &name) const;
+
     friend class MdlFile;
 };
 
@@ -17,6 +17,8 @@
 
 #include "modelnode.h"
 
+#include "glm/gtc/matrix_transform.hpp"
+
 using namespace std;
 
 namespace reone {
@@ -26,6 +28,22 @@ namespace render {
 ModelNode::ModelNode(int index, const ModelNode *parent) : _index(index), _parent(parent) {
 }
 
+ModelNode::ModelNode(int index, const ModelNode *parent, uint16_t nodeNumber, const string &name, const glm::vec3 &position, const glm::quat &orientation) :
+    _index(index),
+    _parent(parent),
+    _nodeNumber(nodeNumber),
+    _name(name),
+    _position(position),
+    _orientation(orientation) {
+
+    _localTransform = glm::translate(glm::mat4(1.0f), position);
+    _localTransform *= glm::mat4_cast(orientation);
+
+    _absTransform = parent ? parent->_absTransform : glm::mat4(1.0f);
+    _absTransform *= _localTransform;
+    _absTransformInv = glm::inverse(_absTransform);
+}
+
 void ModelNode::initGL() {
     if (_mesh) {
         _mesh->initGL();
@@ -35,58 +53,190 @@ void ModelNode::initGL() {
     }
 }
 
-bool ModelNode::getPosition(float time, glm::vec3 &position, float scale) const {
-    if (_positionFrames.empty()) return false;
+void ModelNode::addChild(const shared_ptr<ModelNode> &child) {
+    _children.push_back(child);
+}
+
+void ModelNode::addPositionKeyframe(float time, const glm::vec3 &position) {
+    _positionTimes.push_back(time);
+    _positions.push_back(position);
+}
+
+void ModelNode::addOrientationKeyframe(float time, const glm::quat &orientation) {
+    _orientationTimes.push_back(time);
+    _orientations.push_back(orientation);
+}
+
+void ModelNode::compressKeyframes(KeyframeStats &stats) {
+    if (_compressedKeyframes) return;
 
-    const PositionKeyframe *left = &_positionFrames.front();
-    const PositionKeyframe *right = left;
+    auto compressed = make_unique<CompressedKeyframes>(_positionTimes, _positions, _orientationTimes, _orientations);
 
-    for (auto it = _positionFrames.begin(); it != _positionFrames.end(); ++it) {
-        if (it->time >= time) {
-            right = &*it;
-            if (it != _positionFrames.begin()) left = &*(it - 1);
-            break;
+    // Fixed overhead outweighs savings on very short tracks
+    if (compressed->size() >= keyframesSize()) return;
+
+    _compressedKeyframes = move(compressed);
+
+    for (size_t i = 0; i < _positionTimes.size(); ++i) {
+        glm::vec3 error(glm::abs(_compressedKeyframes->position(static_cast<int>(i)) - _positions[i]));
+        stats.maxTimeError = glm::max(stats.maxTimeError, glm::abs(_compressedKeyframes->positionTime(static_cast<int>(i)) - _positionTimes[i]));
+        stats.maxPositionError = glm::max(stats.maxPositionError, glm::max(error.x, glm::max(error.y, error.z)));
+    }
+    for (size_t i = 0; i < _orientationTimes.size(); ++i) {
+        glm::quat expected(glm::normalize(_orientations[i]));
+        glm::quat actual(_compressedKeyframes->orientation(static_cast<int>(i)));
+        if (glm::dot(expected, actual) < 0.0f) {
+            actual = -actual;
         }
+        glm::vec4 error(glm::abs(actual.x - expected.x), glm::abs(actual.y - expected.y), glm::abs(actual.z - expected.z), glm::abs(actual.w - expected.w));
+        stats.maxTimeError = glm::max(stats.maxTimeError, glm::abs(_compressedKeyframes->orientationTime(static_cast<int>(i)) - _orientationTimes[i]));
+        stats.maxOrientationError = glm::max(stats.maxOrientationError, glm::max(glm::max(error.x, error.y), glm::max(error.z, error.w)));
     }
 
-    if (left == right) {
-        position = left->position * scale;
-        return true;
+    vector<float>().swap(_positionTimes);
+    vector<glm::vec3>().swap(_positions);
+    vector<float>().swap(_orientationTimes);
+    vector<glm::quat>().swap(_orientations);
+}
+
+/**
+ * @return index of the first keyframe at or after the specified time, or count if there is none
+ */
+template <class GetTime>
+static int findKeyframe(int count, float time, int &cursor, const GetTime &getTime) {
+    // Clamped animations are sampled past their last keyframe until they are replaced
+    if (count > 0 && time > getTime(count - 1)) {
+        cursor = count;
+        return count;
     }
 
-    float factor = (time - left->time) / (right->time - left->time);
+    // During playback, the keyframe is usually either the last one found or the next one
+    for (int i = cursor; i < count && i <= cursor + 1; ++i) {
+        if (getTime(i) >= time && (i == 0 || getTime(i - 1) < time)) {
+            cursor = i;
+            return i;
+        }
+    }
 
-    position = glm::mix(left->position, right->position, factor) * scale;
+    // Binary search otherwise
+    int first = 0;
+    int last = count;
+    while (first < last) {
+        int middle = first + (last - first) / 2;
+        if (getTime(middle) < time) {
+            first = middle + 1;
+        } else {
+            last = middle;
+        }
+    }
+    cursor = first;
 
-    return true;
+    return first;
 }
 
-bool ModelNode::getOrientation(float time, glm::quat &orientation) const {
-    if (_orientationFrames.empty()) return false;
+/**
+ * @return interpolation factor between two keyframes, or 1 if they share the same time, e.g. after quantization
+ */
+static float getInterpolationFactor(float time, float leftTime, float rightTime) {
+    float duration = rightTime - leftTime;
+    return duration > 0.0f ? (time - leftTime) / duration : 1.0f;
+}
 
-    const OrientationKeyframe *left = &_orientationFrames.front();
-    const OrientationKeyframe *right = left;
+template <class GetTime, class GetPosition>
+static bool samplePosition(int count, float time, int &cursor, float scale, const GetTime &getTime, const GetPosition &getPosition, glm::vec3 &position) {
+    if (count == 0) return false;
 
-    for (auto it = _orientationFrames.begin(); it != _orientationFrames.end(); ++it) {
-        if (it->time >= time) {
-            right = &*it;
-            if (it != _orientationFrames.begin()) left = &*(it - 1);
-            break;
-        }
-    }
+    int right = findKeyframe(count, time, cursor, getTime);
 
-    if (left == right) {
-        orientation = left->orientation;
+    // Past the last keyframe, the first one is used
+    if (right == 0 || right == count) {
+        position = getPosition(0) * scale;
         return true;
     }
+    int left = right - 1;
+    float factor = getInterpolationFactor(time, getTime(left), getTime(right));
 
-    float factor = (time - left->time) / (right->time - left->time);
+    position = glm::mix(getPosition(left), getPosition(right), factor) * scale;
 
-    orientation = glm::slerp(left->orientation, right->orientation, factor);
+    return true;
+}
+
+template <class GetTime, class GetOrientation>
+static bool sampleOrientation(int count, float time, int &cursor, const GetTime &getTime, const GetOrientation &getOrientation, glm::quat &orientation) {
+    if (count == 0) return false;
+
+    int right = findKeyframe(count, time, cursor, getTime);
+
+    if (right == 0 || right == count) {
+        orientation = getOrientation(0);
+        return true;
+    }
+    int left = right - 1;
+    float factor = getInterpolationFactor(time, getTime(left), getTime(right));
+
+    orientation = glm::slerp(getOrientation(left), getOrientation(right), factor);
 
     return true;
 }
 
+bool ModelNode::getPosition(float time, glm::vec3 &position, float scale) const {
+    SampleCursor cursor;
+    return getPosition(time, cursor, position, scale);
+}
+
+bool ModelNode::getPosition(float time, SampleCursor &cursor, glm::vec3 &position, float scale) const {
+    if (_compressedKeyframes) {
+        const CompressedKeyframes &keyframes = *_compressedKeyframes;
+        return samplePosition(
+            keyframes.positionCount(), time, cursor.position, scale,
+            [&keyframes](int index) { return keyframes.positionTime(index); },
+            [&keyframes](int index) { return keyframes.position(index); },
+            position);
+    }
+    return samplePosition(
+        static_cast<int>(_positionTimes.size()), time, cursor.position, scale,
+        [this](int index) { return _positionTimes[index]; },
+        [this](int index) { return _positions[index]; },
+        position);
+}
+
+bool ModelNode::getOrientation(float time, glm::quat &orientation) const {
+    SampleCursor cursor;
+    return getOrientation(time, cursor, orientation);
+}
+
+bool ModelNode::getOrientation(float time, SampleCursor &cursor, glm::quat &orientation) const {
+    if (_compressedKeyframes) {
+        const CompressedKeyframes &keyframes = *_compressedKeyframes;
+        return sampleOrientation(
+            keyframes.orientationCount(), time, cursor.orientation,
+            [&keyframes](int index) { return keyframes.orientationTime(index); },
+            [&keyframes](int index) { return keyframes.orientation(index); },
+            orientation);
+    }
+    return sampleOrientation(
+        static_cast<int>(_orientationTimes.size()), time, cursor.orientation,
+        [this](int index) { return _orientationTimes[index]; },
+        [this](int index) { return _orientations[index]; },
+        orientation);
+}
+
+bool ModelNode::hasKeyframes() const {
+    if (_compressedKeyframes) {
+        return _compressedKeyframes->positionCount() > 0 || _compressedKeyframes->orientationCount() > 0;
+    }
+    return !_positionTimes.empty() || !_orientationTimes.empty();
+}
+
+size_t ModelNode::keyframesSize() const {
+    if (_compressedKeyframes) {
+        return _compressedKeyframes->size();
+    }
+    return sizeof(float) * (_positionTimes.capacity() + _orientationTimes.capacity()) +
+        sizeof(glm::vec3) * _positions.capacity() +
+        sizeof(glm::quat) * _orientations.capacity();
+}
+
 const glm::vec3 &ModelNode::getCenterOfAABB() const {
     return _mesh->aabb().center();
 }
@@ -167,6 +317,18 @@ const vector<shared_ptr<ModelNode>> &ModelNode::children() const {
     return _children;
 }
 
+void ModelNode::setLight(const shared_ptr<Light> &light) {
+    _light = light;
+}
+
+void ModelNode::setMesh(const shared_ptr<ModelMesh> &mesh) {
+    _mesh = mesh;
+}
+
+void ModelNode::setSkin(const shared_ptr<Skin> &skin) {
+    _skin = skin;
+}
+
 } // namespace render
 
 } // namespace reone
@@ -17,18 +17,22 @@
 
 #pragma once
 
-#include <unordered_map>
+#include <vector>
 
 #include "glm/gtx/quaternion.hpp"
 
 #include "../mesh/modelmesh.h"
 
+#include "compressedkeyframes.h"
+
 namespace reone {
 
 namespace render {
 
 class Model;
 
+const uint16_t kNoBoneNode = 0xffff;
+
 /**
  * Part of a 3D model, which is a tree-like data structure. Contains
  * position and orientation keyframes, which are used in animation.
@@ -46,17 +50,54 @@ public:
     };
 
     struct Skin {
-        std::unordered_map<uint16_t, uint16_t> nodeIdxByBoneIdx;
+        std::vector<uint16_t> nodeIdxByBoneIdx; /**< kNoBoneNode for bones without a node */
+    };
+
+    /**
+     * Keyframes last sampled by an animation channel. Sampling at increasing
+     * times with the same cursor takes constant time, seeking takes
+     * logarithmic time.
+     */
+    struct SampleCursor {
+        int position { 0 };
+        int orientation { 0 };
     };
 
     ModelNode(int index, const ModelNode *parent = nullptr);
 
+    /**
+     * Constructs a node programmatically, e.g. in tests and benchmarks.
+     * Nodes of models loaded from MDL files are constructed by MdlFile.
+     */
+    ModelNode(int index, const ModelNode *parent, uint16_t nodeNumber, const std::string &name, const glm::vec3 &position, const glm::quat &orientation);
+
     void initGL();
 
+    void addChild(const std::shared_ptr<ModelNode> &child);
+    void addPositionKeyframe(float time, const glm::vec3 &position);
+    void addOrientationKeyframe(float time, const glm::quat &orientation);
+
+    /**
+     * Replaces keyframes of this node with their compressed form. Keyframes
+     * must not be added afterwards.
+     *
+     * @param stats statistics to update with compression errors
+     */
+    void compressKeyframes(KeyframeStats &stats);
+
     bool getPosition(float time, glm::vec3 &position, float scale = 1.0f) const;
+    bool getPosition(float time, SampleCursor &cursor, glm::vec3 &position, float scale = 1.0f) const;
     bool getOrientation(float time, glm::quat &orientation) const;
+    bool getOrientation(float time, SampleCursor &cursor, glm::quat &orientation) const;
     const glm::vec3 &getCenterOfAABB() const;
 
+    /**
+     * @return size of position and orientation keyframes in bytes
+     */
+    size_t keyframesSize() const;
+
+    bool hasKeyframes() const;
+
     int index() const;
     const ModelNode *parent() const;
     uint16_t nodeNumber() const;
@@ -77,17 +118,11 @@ public:
     std::shared_ptr<Skin> skin() const;
     const std::vector<std::shared_ptr<ModelNode>> &children() const;
 
-private:
-    struct PositionKeyframe {
-        float time { 0.0f };
-        glm::vec3 position { 0.0f };
-    };
-
-    struct OrientationKeyframe {
-        float time { 0.0f };
-        glm::quat orientation { 1.0f, 0.0f, 0.0f, 0.0f };
-    };
+    void setLight(const std::shared_ptr<Light> &light);
+    void setMesh(const std::shared_ptr<ModelMesh> &mesh);
+    void setSkin(const std::shared_ptr<Skin> &skin);
 
+private:
     int _index { 0 };
     const ModelNode *_parent { nullptr };
     uint16_t _flags { 0 };
@@ -98,8 +133,11 @@ private:
     glm::mat4 _localTransform { 1.0f };
     glm::mat4 _absTransform { 1.0f };
     glm::mat4 _absTransformInv { 1.0f };
-    std::vector<PositionKeyframe> _positionFrames;
-    std::vector<OrientationKeyframe> _orientationFrames;
+    std::vector<float> _positionTimes;
+    std::vector<glm::vec3> _positions;
+    std::vector<float> _orientationTimes;
+    std::vector<glm::quat> _orientations;
+    std::unique_ptr<CompressedKeyframes> _compressedKeyframes;
     glm::vec3 _color { 0.0f };
     bool _selfIllumEnabled { false };
     glm::vec3 _selfIllumColor { 0.0f };
@@ -35,8 +35,9 @@ Models &Models::instance() {
     return instance;
 }
 
-void Models::init(GameVersion version) {
+void Models::init(GameVersion version, bool compressKeyframes) {
     _version = version;
+    _compressKeyframes = compressKeyframes;
 }
 
 void Models::invalidateCache() {
@@ -59,7 +60,7 @@ shared_ptr<Model> Models::doGet(const string &resRef) {
     shared_ptr<Model> model;
 
     if (mdlData && mdxData) {
-        MdlFile mdl(_version);
+        MdlFile mdl(_version, _compressKeyframes);
         mdl.load(wrap(mdlData), wrap(mdxData));
         model = mdl.model();
         if (model) {
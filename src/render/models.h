@@ -35,13 +35,17 @@ class Models {
 public:
     static Models &instance();
 
-    void init(resource::GameVersion version);
+    /**
+     * @param compressKeyframes whether to store keyframes of loaded models in compressed form
+     */
+    void init(resource::GameVersion version, bool compressKeyframes = false);
     void invalidateCache();
 
     std::shared_ptr<Model> get(const std::string &resRef);
 
 private:
     resource::GameVersion _version { resource::GameVersion::KotOR };
+    bool _compressKeyframes { false };
     std::unordered_map<std::string, std::shared_ptr<Model>> _cache;
 
     Models() = default;
@@ -21,7 +21,9 @@
 
 #include "GL/glew.h"
 
+#include "../device/device.h"
 #include "../mesh/quad.h"
+#include "../renderstate.h"
 #include "../shaders.h"
 #include "../util.h"
 
@@ -42,22 +44,22 @@ void ControlRenderPipeline::init() {
 }
 
 void ControlRenderPipeline::render(const glm::ivec2 &offset) const {
-    int viewport[4];
-    glGetIntegerv(GL_VIEWPORT, viewport);
+    RenderState &state = RenderState::instance();
+    glm::ivec4 viewport(state.viewport());
 
     // Render to framebuffer
     {
-        glViewport(0, 0, _extent[2], _extent[3]);
+        state.setViewport(glm::ivec4(0, 0, _extent[2], _extent[3]));
 
         _geometry.bind();
 
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        getGraphicsDevice().clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
         withDepthTest([this]() { _scene->render(); });
 
         _geometry.unbind();
 
-        glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+        state.setViewport(viewport);
     }
     // Render control
     {
@@ -80,7 +82,6 @@ void ControlRenderPipeline::render(const glm::ivec2 &offset) const {
 
         Shaders::instance().activate(ShaderProgram::GUIGUI, locals);
 
-        glActiveTexture(GL_TEXTURE0);
         _geometry.bindColorBuffer(0);
 
         Quad::getDefault().renderTriangles();
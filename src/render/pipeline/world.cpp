@@ -21,6 +21,7 @@
 
 #include "GL/glew.h"
 
+#include "../device/device.h"
 #include "../mesh/quad.h"
 #include "../shaders.h"
 #include "../util.h"
@@ -52,10 +53,10 @@ void WorldRenderPipeline::render() const {
         // Render geometry
         _geometry.bind();
 
-        static const GLenum buffers[] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
-        glDrawBuffers(2, buffers);
+        static const uint32_t buffers[] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
+        getGraphicsDevice().drawBuffers(2, buffers);
 
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        getGraphicsDevice().clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         withDepthTest([this]() { _scene->render(); });
 
         _geometry.unbind();
@@ -73,7 +74,7 @@ void WorldRenderPipeline::render() const {
             // Apply horizontal blur
             _horizontalBlur.bind();
 
-            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            getGraphicsDevice().clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
             glm::mat4 transform(1.0f);
             transform = glm::scale(transform, glm::vec3(w, h, 1.0f));
@@ -86,7 +87,6 @@ void WorldRenderPipeline::render() const {
 
             Shaders::instance().activate(ShaderProgram::GUIBlur, locals);
 
-            glActiveTexture(GL_TEXTURE0);
             if (i == 0) {
                 _geometry.bindColorBuffer(1);
             } else {
@@ -104,7 +104,7 @@ void WorldRenderPipeline::render() const {
             // Apply vertical blur
             _verticalBlur.bind();
 
-            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            getGraphicsDevice().clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
             glm::mat4 transform(1.0f);
             transform = glm::scale(transform, glm::vec3(w, h, 1.0f));
@@ -117,7 +117,6 @@ void WorldRenderPipeline::render() const {
 
             Shaders::instance().activate(ShaderProgram::GUIBlur, locals);
 
-            glActiveTexture(GL_TEXTURE0);
             _horizontalBlur.bindColorBuffer(0);
 
             withDepthTest([]() {
@@ -139,18 +138,12 @@ void WorldRenderPipeline::render() const {
 
         Shaders::instance().activate(ShaderProgram::GUIBloom, locals);
 
-        glActiveTexture(GL_TEXTURE0);
         _geometry.bindColorBuffer(0);
-
-        glActiveTexture(GL_TEXTURE1);
-        _verticalBlur.bindColorBuffer(0);
+        _verticalBlur.bindColorBuffer(0, 1);
 
         Quad::getDefault().renderTriangles();
 
-        glActiveTexture(GL_TEXTURE1);
-        _verticalBlur.unbindColorBuffer();
-
-        glActiveTexture(GL_TEXTURE0);
+        _verticalBlur.unbindColorBuffer(1);
         _geometry.unbindColorBuffer();
     }
 }
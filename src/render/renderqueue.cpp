@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "renderqueue.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+#include "GL/glew.h"
+
+#include "SDL2/SDL_opengl.h"
+
+#include "../common/jobs.h"
+
+#include "mesh/mesh.h"
+#include "renderstate.h"
+#include "texture.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace render {
+
+static const int kPassShift = 62;
+static const int kProgramShift = 58;
+static const int kTextureSetShift = 34;
+static const int kInstancedShift = 32;
+static const int kTransparencyShift = 54;
+
+static const uint32_t kMaxTextureSetId = (1 << 24) - 1;
+static const int kMaxTransparency = 0xff;
+
+static uint32_t getDepthBits(float depth) {
+    // Bits of non-negative floats compare like the floats themselves
+    uint32_t bits;
+    float clamped = depth > 0.0f ? depth : 0.0f;
+    memcpy(&bits, &clamped, sizeof(bits));
+    return bits;
+}
+
+bool RenderQueue::TextureSet::operator==(const TextureSet &other) const {
+    for (int i = 0; i < kTextureUnitCount; ++i) {
+        if (textures[i] != other.textures[i]) return false;
+    }
+    return true;
+}
+
+size_t RenderQueue::TextureSetHash::operator()(const TextureSet &set) const {
+    size_t hash = 0;
+    for (int i = 0; i < kTextureUnitCount; ++i) {
+        hash = hash * 31 + std::hash<Texture *>()(set.textures[i]);
+    }
+    return hash;
+}
+
+void IDrawable::getUniforms(LocalUniforms &locals, bool instanced) const {
+}
+
+void IDrawable::drawInstanced(int count) const {
+    throw logic_error("IDrawable: instancing is not supported");
+}
+
+bool RenderQueue::InstanceGroup::operator==(const InstanceGroup &other) const {
+    return mesh == other.mesh && state == other.state;
+}
+
+size_t RenderQueue::InstanceGroupHash::operator()(const InstanceGroup &group) const {
+    return std::hash<const Mesh *>()(group.mesh) * 31 + group.state;
+}
+
+void RenderQueue::clear() {
+    _items.clear();
+    for (auto &pass : _passes) {
+        pass.entries.clear();
+        pass.commands.clear();
+        pass.instances.clear();
+    }
+    _textureSetIds.clear();
+    _instanceGroupIds.clear();
+    _commands.clear();
+    _instances.clear();
+    _draws.clear();
+}
+
+void RenderQueue::add(RenderPass pass, const DrawItem &item, float depth) {
+    Entry entry;
+    entry.item = static_cast<int>(_items.size());
+
+    uint32_t depthBits = getDepthBits(depth);
+
+    if (pass == RenderPass::Opaque && item.instanceState != 0) {
+        // Keys of items in the same instance group are equal
+        entry.key =
+            (static_cast<uint64_t>(item.program) << kProgramShift) |
+            (static_cast<uint64_t>(getTextureSetId(item)) << kTextureSetShift) |
+            (1ull << kInstancedShift) |
+            getInstanceGroupId(item);
+    } else if (pass == RenderPass::Opaque) {
+        entry.key =
+            (static_cast<uint64_t>(item.program) << kProgramShift) |
+            (static_cast<uint64_t>(getTextureSetId(item)) << kTextureSetShift) |
+            depthBits;
+    } else {
+        uint64_t transparency = item.transparency < 0 ? 0 : (item.transparency > kMaxTransparency ? kMaxTransparency : item.transparency);
+        entry.key =
+            (static_cast<uint64_t>(pass) << kPassShift) |
+            (transparency << kTransparencyShift) |
+            static_cast<uint32_t>(~depthBits);
+    }
+
+    _items.push_back(item);
+    _passes[static_cast<int>(pass)].entries.push_back(entry);
+
+    // Keys of transparent items do not identify meshes, so items with equal
+    // keys must not be grouped into instances
+    if (pass != RenderPass::Opaque) {
+        _items.back().instanceState = 0;
+    }
+}
+
+uint32_t RenderQueue::getTextureSetId(const DrawItem &item) {
+    TextureSet set;
+    memcpy(set.textures, item.textures, sizeof(set.textures));
+
+    auto maybeId = _textureSetIds.find(set);
+    if (maybeId != _textureSetIds.end()) return maybeId->second;
+
+    uint32_t id = static_cast<uint32_t>(_textureSetIds.size());
+    if (id > kMaxTextureSetId) {
+        id = kMaxTextureSetId;
+    }
+    _textureSetIds.insert(make_pair(set, id));
+
+    return id;
+}
+
+uint32_t RenderQueue::getInstanceGroupId(const DrawItem &item) {
+    InstanceGroup group;
+    group.mesh = item.mesh;
+    group.state = item.instanceState;
+
+    auto maybeId = _instanceGroupIds.find(group);
+    if (maybeId != _instanceGroupIds.end()) return maybeId->second;
+
+    uint32_t id = static_cast<uint32_t>(_instanceGroupIds.size());
+    _instanceGroupIds.insert(make_pair(group, id));
+
+    return id;
+}
+
+void RenderQueue::prepare(int threadCount) {
+    auto start = chrono::steady_clock::now();
+
+    // Passes do not share state until they are merged
+    int threads = JobExecutor::instance().parallelFor(kPassCount, threadCount, [this](int batch, int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            buildPass(_passes[i]);
+        }
+    });
+    mergePasses();
+
+    vector<float> batchTimes(max(threadCount, 1), 0.0f);
+    threads = max(threads, JobExecutor::instance().parallelFor(static_cast<int>(_draws.size()), threadCount, [this, &batchTimes](int batch, int begin, int end) {
+        prepareUniforms(begin, end, batchTimes[batch]);
+    }));
+    for (float time : batchTimes) {
+        _stats.buildTime += time;
+    }
+
+    auto end = chrono::steady_clock::now();
+    _stats.prepareTime = chrono::duration<float, milli>(end - start).count();
+    _stats.threads = threads;
+}
+
+void RenderQueue::buildPass(PassCommands &pass) {
+    auto start = chrono::steady_clock::now();
+
+    radixSort(pass.entries, pass.sortBuffer);
+
+    auto sorted = chrono::steady_clock::now();
+
+    pass.commands.clear();
+    pass.instances.clear();
+    pass.stats = RenderQueueStats();
+
+    ShaderProgram program = ShaderProgram::None;
+    Texture *textures[kTextureUnitCount] { nullptr };
+    const Mesh *mesh = nullptr;
+
+    for (size_t i = 0; i < pass.entries.size();) {
+        const Entry &entry = pass.entries[i];
+        const DrawItem &item = _items[entry.item];
+
+        // Equal keys of instanced items mean equal program and mesh, but not
+        // necessarily equal textures once texture set ids run out
+        size_t end = i + 1;
+        if (item.instanceState != 0) {
+            while (end < pass.entries.size() &&
+                pass.entries[end].key == entry.key &&
+                memcmp(_items[pass.entries[end].item].textures, item.textures, sizeof(item.textures)) == 0) {
+
+                ++end;
+            }
+        }
+
+        if (item.program != program) {
+            RenderCommand command;
+            command.type = RenderCommandType::UseProgram;
+            command.program = item.program;
+            pass.commands.push_back(move(command));
+
+            program = item.program;
+            ++pass.stats.programChanges;
+        }
+        for (int unit = 0; unit < kTextureUnitCount; ++unit) {
+            // Units unused by an item keep their textures, as shaders ignore them
+            if (!item.textures[unit] || item.textures[unit] == textures[unit]) continue;
+
+            RenderCommand command;
+            command.type = RenderCommandType::BindTexture;
+            command.unit = unit;
+            command.texture = item.textures[unit];
+            pass.commands.push_back(move(command));
+
+            textures[unit] = item.textures[unit];
+            ++pass.stats.textureChanges;
+        }
+        if (item.mesh != mesh) {
+            RenderCommand command;
+            command.type = RenderCommandType::BindVertexArray;
+            command.mesh = item.mesh;
+            pass.commands.push_back(move(command));
+
+            mesh = item.mesh;
+            ++pass.stats.vertexArrayChanges;
+        }
+        RenderCommand command;
+        command.drawable = item.drawable;
+
+        int count = static_cast<int>(end - i);
+        if (count > 1) {
+            command.type = RenderCommandType::DrawInstanced;
+            command.firstInstance = static_cast<int>(pass.instances.size());
+            command.instanceCount = count;
+
+            for (size_t j = i; j < end; ++j) {
+                const DrawItem &instance = _items[pass.entries[j].item];
+                InstanceData data;
+                data.transform = instance.transform;
+                data.alpha = instance.alpha;
+                pass.instances.push_back(move(data));
+            }
+            ++pass.stats.instancedDrawCalls;
+            pass.stats.instances += count;
+
+        } else {
+            command.type = RenderCommandType::Draw;
+        }
+        pass.commands.push_back(move(command));
+
+        ++pass.stats.drawCalls;
+        i = end;
+    }
+
+    auto end = chrono::steady_clock::now();
+    pass.stats.sortTime = chrono::duration<float, milli>(sorted - start).count();
+    pass.stats.buildTime = chrono::duration<float, milli>(end - sorted).count();
+}
+
+void RenderQueue::mergePasses() {
+    _commands.clear();
+    _instances.clear();
+    _draws.clear();
+    _stats = RenderQueueStats();
+
+    for (auto &pass : _passes) {
+        int firstInstance = static_cast<int>(_instances.size());
+        _instances.insert(_instances.end(), pass.instances.begin(), pass.instances.end());
+
+        for (auto &command : pass.commands) {
+            _commands.push_back(command);
+
+            RenderCommand &merged = _commands.back();
+            if (merged.type == RenderCommandType::Draw || merged.type == RenderCommandType::DrawInstanced) {
+                merged.firstInstance += firstInstance;
+                merged.uniforms = static_cast<int>(_draws.size());
+                _draws.push_back(static_cast<int>(_commands.size()) - 1);
+            }
+        }
+        _stats.drawCalls += pass.stats.drawCalls;
+        _stats.instancedDrawCalls += pass.stats.instancedDrawCalls;
+        _stats.instances += pass.stats.instances;
+        _stats.programChanges += pass.stats.programChanges;
+        _stats.textureChanges += pass.stats.textureChanges;
+        _stats.vertexArrayChanges += pass.stats.vertexArrayChanges;
+        _stats.sortTime += pass.stats.sortTime;
+        _stats.buildTime += pass.stats.buildTime;
+    }
+
+    // Uniforms are reused between frames to keep their light arrays allocated
+    if (_uniforms.size() < _draws.size()) {
+        _uniforms.resize(_draws.size());
+    }
+}
+
+void RenderQueue::prepareUniforms(int begin, int end, float &time) {
+    auto start = chrono::steady_clock::now();
+
+    for (int i = begin; i < end; ++i) {
+        const RenderCommand &command = _commands[_draws[i]];
+        LocalUniforms &locals = _uniforms[command.uniforms];
+
+        vector<ShaderLight> lights(move(locals.lighting.lights));
+        lights.clear();
+        locals = LocalUniforms();
+        locals.lighting.lights = move(lights);
+
+        command.drawable->getUniforms(locals, command.type == RenderCommandType::DrawInstanced);
+    }
+
+    auto finish = chrono::steady_clock::now();
+    time = chrono::duration<float, milli>(finish - start).count();
+}
+
+void RenderQueue::render() const {
+    if (_commands.empty()) return;
+
+    auto start = chrono::steady_clock::now();
+    Shaders::instance().resetStats();
+
+    bool textureBound[kTextureUnitCount] { false };
+    const Mesh *mesh = nullptr;
+
+    for (auto &command : _commands) {
+        switch (command.type) {
+            case RenderCommandType::UseProgram:
+                Shaders::instance().activate(command.program);
+                break;
+            case RenderCommandType::BindTexture:
+                command.texture->bind(command.unit);
+                textureBound[command.unit] = true;
+                break;
+            case RenderCommandType::BindVertexArray:
+                command.mesh->bind();
+                mesh = command.mesh;
+                break;
+            case RenderCommandType::Draw:
+                Shaders::instance().setLocalUniforms(_uniforms[command.uniforms]);
+                command.drawable->draw();
+                break;
+            case RenderCommandType::DrawInstanced:
+                InstanceBuffer::instance().upload(&_instances[command.firstInstance], command.instanceCount);
+                Shaders::instance().setLocalUniforms(_uniforms[command.uniforms]);
+                command.drawable->drawInstanced(command.instanceCount);
+                break;
+        }
+    }
+
+    // Leave the state as individual draws used to, i.e. with nothing bound
+    if (mesh) {
+        mesh->unbind();
+    }
+    RenderState &state = RenderState::instance();
+    for (int i = 0; i < kTextureUnitCount; ++i) {
+        if (textureBound[i]) {
+            state.bindTexture(i, GL_TEXTURE_2D, 0);
+            state.bindTexture(i, GL_TEXTURE_CUBE_MAP, 0);
+        }
+    }
+
+    auto end = chrono::steady_clock::now();
+    _stats.submitTime = chrono::duration<float, milli>(end - start).count();
+    const ShaderStats &shaderStats = Shaders::instance().stats();
+    _stats.uniformUpdates = shaderStats.uniformUpdates;
+    _stats.uniformUpdatesSkipped = shaderStats.uniformUpdatesSkipped;
+    _stats.boneBytesUploaded = shaderStats.boneBytesUploaded;
+}
+
+const vector<RenderCommand> &RenderQueue::commands() const {
+    return _commands;
+}
+
+const vector<InstanceData> &RenderQueue::instances() const {
+    return _instances;
+}
+
+const vector<LocalUniforms> &RenderQueue::uniforms() const {
+    return _uniforms;
+}
+
+const RenderQueueStats &RenderQueue::stats() const {
+    return _stats;
+}
+
+} // namespace render
+
+} // namespace reone
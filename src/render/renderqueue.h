@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "glm/mat4x4.hpp"
+
+#include "instancebuffer.h"
+#include "shaders.h"
+
+namespace reone {
+
+namespace render {
+
+class Mesh;
+class Texture;
+
+const int kTextureUnitCount = 5;
+
+enum class RenderPass {
+    Opaque,
+    Transparent
+};
+
+/**
+ * Renders itself, assuming that its program, textures, vertex array and local
+ * uniforms are set by the render queue.
+ */
+class IDrawable {
+public:
+    /**
+     * Fills local uniforms to draw this drawable with. Called while the render
+     * queue is prepared, possibly on a worker thread, so it must neither make
+     * graphics calls nor modify shared state. Leaves defaults by default.
+     *
+     * @param instanced true if transforms and alphas are taken from the instance buffer
+     */
+    virtual void getUniforms(LocalUniforms &locals, bool instanced) const;
+
+    virtual void draw() const = 0;
+
+    /**
+     * Draws instances of this drawable, taking transforms and alphas from the
+     * instance buffer. Only called for items with an instance state.
+     */
+    virtual void drawInstanced(int count) const;
+};
+
+struct DrawItem {
+    ShaderProgram program { ShaderProgram::None };
+    Texture *textures[kTextureUnitCount] { nullptr };
+    const Mesh *mesh { nullptr };
+    const IDrawable *drawable { nullptr };
+    int transparency { 0 };
+
+    // Instancing
+
+    /**
+     * Opaque items with the same program, textures, mesh and non-zero
+     * instance state differ only in transform and alpha, and are drawn as
+     * instances of the first of them. Zero disables instancing.
+     */
+    uint32_t instanceState { 0 };
+
+    glm::mat4 transform { 1.0f };
+    float alpha { 1.0f };
+
+    // END Instancing
+};
+
+enum class RenderCommandType {
+    UseProgram,
+    BindTexture,
+    BindVertexArray,
+    Draw,
+    DrawInstanced
+};
+
+struct RenderCommand {
+    RenderCommandType type { RenderCommandType::Draw };
+    ShaderProgram program { ShaderProgram::None };
+    int unit { 0 };
+    Texture *texture { nullptr };
+    const Mesh *mesh { nullptr };
+    const IDrawable *drawable { nullptr };
+    int firstInstance { 0 }; /**< index into instances of the render queue */
+    int instanceCount { 0 };
+    int uniforms { -1 }; /**< index into uniforms of the render queue */
+};
+
+struct RenderQueueStats {
+    int drawCalls { 0 };
+    int instancedDrawCalls { 0 }; /**< included in drawCalls */
+    int instances { 0 }; /**< items drawn by instanced draw calls */
+    int programChanges { 0 };
+    int textureChanges { 0 };
+    int vertexArrayChanges { 0 };
+    float sortTime { 0.0f }; // milliseconds of CPU time spent sorting, summed over passes
+    float buildTime { 0.0f }; // milliseconds of CPU time spent building commands and uniforms, summed over threads
+    float prepareTime { 0.0f }; // milliseconds of wall time spent in prepare
+    int threads { 1 }; /**< number of threads the last prepare ran on */
+
+    // Updated by render
+
+    float submitTime { 0.0f }; // milliseconds of CPU time spent submitting commands
+    int uniformUpdates { 0 };
+    int uniformUpdatesSkipped { 0 };
+    int boneBytesUploaded { 0 };
+};
+
+/**
+ * Sorts draw items by 64-bit keys and turns them into a stream of render
+ * commands without redundant state changes.
+ *
+ * Opaque items are ordered by program, then by texture set, then front to
+ * back. Items that can be instanced follow the others of their texture set,
+ * grouped by mesh and instance state, and groups of two or more are drawn
+ * with a single instanced draw call. Transparent items are ordered by
+ * transparency, then back to front, regardless of state changes, and are
+ * never instanced.
+ *
+ * Passes are sorted and turned into command lists independently, and local
+ * uniforms of draw commands are prepared ahead of time, so that both can run
+ * on worker threads. Only render makes graphics calls, on the main thread in
+ * the same frame, as the queue references live scene state.
+ */
+class RenderQueue {
+public:
+    void clear();
+
+    /**
+     * @param depth squared distance from the camera
+     */
+    void add(RenderPass pass, const DrawItem &item, float depth);
+
+    /**
+     * Sorts items, builds the command stream and prepares local uniforms of
+     * draw commands.
+     *
+     * @param threadCount number of threads to prepare on, 1 to only use the calling thread
+     */
+    void prepare(int threadCount = 1);
+
+    /**
+     * Executes the command stream. Must be called on the thread that owns the
+     * graphics context.
+     */
+    void render() const;
+
+    const std::vector<RenderCommand> &commands() const;
+    const std::vector<InstanceData> &instances() const;
+    const std::vector<LocalUniforms> &uniforms() const;
+    const RenderQueueStats &stats() const;
+
+private:
+    static const int kPassCount = 2;
+
+    struct Entry {
+        uint64_t key { 0 };
+        int item { 0 };
+    };
+
+    /**
+     * Items and commands of one render pass. Only touched by the thread that
+     * builds the pass while the queue is prepared.
+     */
+    struct PassCommands {
+        std::vector<Entry> entries;
+        std::vector<Entry> sortBuffer;
+        std::vector<RenderCommand> commands;
+        std::vector<InstanceData> instances;
+        RenderQueueStats stats;
+    };
+
+    struct TextureSet {
+        Texture *textures[kTextureUnitCount] { nullptr };
+
+        bool operator==(const TextureSet &other) const;
+    };
+
+    struct TextureSetHash {
+        size_t operator()(const TextureSet &set) const;
+    };
+
+    struct InstanceGroup {
+        const Mesh *mesh { nullptr };
+        uint32_t state { 0 };
+
+        bool operator==(const InstanceGroup &other) const;
+    };
+
+    struct InstanceGroupHash {
+        size_t operator()(const InstanceGroup &group) const;
+    };
+
+    std::vector<DrawItem> _items;
+    PassCommands _passes[kPassCount];
+    std::unordered_map<TextureSet, uint32_t, TextureSetHash> _textureSetIds;
+    std::unordered_map<InstanceGroup, uint32_t, InstanceGroupHash> _instanceGroupIds;
+    std::vector<RenderCommand> _commands;
+    std::vector<InstanceData> _instances;
+    std::vector<int> _draws; /**< indices of draw commands */
+    std::vector<LocalUniforms> _uniforms;
+    mutable RenderQueueStats _stats;
+
+    uint32_t getTextureSetId(const DrawItem &item);
+    uint32_t getInstanceGroupId(const DrawItem &item);
+
+    void buildPass(PassCommands &pass);
+    void mergePasses();
+    void prepareUniforms(int begin, int end, float &time);
+};
+
+/**
+ * Sorts entries by key in ascending order using LSD radix sort, which
+ * is stable. Passes over bytes equal in all keys are skipped.
+ *
+ * @param buffer scratch space, resized as needed
+ */
+template <class T>
+void radixSort(std::vector<T> &entries, std::vector<T> &buffer) {
+    if (entries.size() < 2) return;
+
+    buffer.resize(entries.size());
+
+    for (int shift = 0; shift < 64; shift += 8) {
+        size_t counts[256] { 0 };
+        for (auto &entry : entries) {
+            ++counts[(entry.key >> shift) & 0xff];
+        }
+        if (counts[(entries.front().key >> shift) & 0xff] == entries.size()) continue;
+
+        size_t offset = 0;
+        for (int i = 0; i < 256; ++i) {
+            size_t count = counts[i];
+            counts[i] = offset;
+            offset += count;
+        }
+        for (auto &entry : entries) {
+            buffer[counts[(entry.key >> shift) & 0xff]++] = entry;
+        }
+        entries.swap(buffer);
+    }
+}
+
+} // namespace render
+
+} // namespace reone
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "renderstate.h"
+
+#include <stdexcept>
+#include <string>
+
+#include "GL/glew.h"
+
+#include "SDL2/SDL_opengl.h"
+
+#include "device/device.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace render {
+
+// Name that no GL object has, so that the next bind is never skipped
+static const uint32_t kUnknownName = 0xffffffff;
+
+RenderState &RenderState::instance() {
+    static RenderState instance;
+    return instance;
+}
+
+RenderState::RenderState() {
+    for (int i = 0; i < kTextureUnitCount; ++i) {
+        for (int j = 0; j < kTextureTargetCount; ++j) {
+            _textures[i][j] = kUnknownName;
+        }
+    }
+}
+
+void RenderState::initGL() {
+    IGraphicsDevice &device = getGraphicsDevice();
+
+    device.enable(GL_BLEND);
+    device.blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    _blendMode = BlendMode::Default;
+
+    device.disable(GL_DEPTH_TEST);
+    _depthTest = false;
+
+    // The initial viewport is the size of the window
+    _viewport = device.getViewport();
+
+    device.useProgram(0);
+    _program = 0;
+
+    device.bindVertexArray(0);
+    _vertexArray = 0;
+
+    device.bindFramebuffer(0);
+    _framebuffer = 0;
+
+    for (int i = 0; i < kTextureUnitCount; ++i) {
+        device.activeTexture(i);
+        device.bindTexture(GL_TEXTURE_2D, 0);
+        device.bindTexture(GL_TEXTURE_CUBE_MAP, 0);
+        _textures[i][0] = 0;
+        _textures[i][1] = 0;
+    }
+    device.activeTexture(0);
+    _activeUnit = 0;
+}
+
+void RenderState::setBlendMode(BlendMode mode) {
+    if (!update(_blendMode, mode)) return;
+
+    switch (mode) {
+        case BlendMode::Additive:
+            getGraphicsDevice().blendFunc(GL_ONE, GL_ONE);
+            break;
+        default:
+            getGraphicsDevice().blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            break;
+    }
+}
+
+void RenderState::setDepthTest(bool enabled) {
+    if (!update(_depthTest, enabled)) return;
+
+    if (enabled) {
+        getGraphicsDevice().enable(GL_DEPTH_TEST);
+    } else {
+        getGraphicsDevice().disable(GL_DEPTH_TEST);
+    }
+}
+
+void RenderState::setViewport(const glm::ivec4 &viewport) {
+    if (!update(_viewport, viewport)) return;
+
+    getGraphicsDevice().viewport(viewport);
+}
+
+void RenderState::useProgram(uint32_t program) {
+    if (!update(_program, program)) return;
+
+    getGraphicsDevice().useProgram(program);
+}
+
+void RenderState::bindVertexArray(uint32_t vertexArray) {
+    if (!update(_vertexArray, vertexArray)) return;
+
+    getGraphicsDevice().bindVertexArray(vertexArray);
+}
+
+void RenderState::bindFramebuffer(uint32_t framebuffer) {
+    if (!update(_framebuffer, framebuffer)) return;
+
+    getGraphicsDevice().bindFramebuffer(framebuffer);
+}
+
+void RenderState::setActiveUnit(int unit) {
+    if (!update(_activeUnit, unit)) return;
+
+    getGraphicsDevice().activeTexture(unit);
+}
+
+void RenderState::bindTexture(int unit, uint32_t target, uint32_t texture) {
+    if (unit < 0 || unit >= kTextureUnitCount) {
+        throw out_of_range("RenderState: texture unit out of range: " + to_string(unit));
+    }
+    int targetIdx = target == GL_TEXTURE_CUBE_MAP ? 1 : 0;
+    if (_textures[unit][targetIdx] == texture) {
+        ++_stats.callsAvoided;
+        return;
+    }
+    setActiveUnit(unit);
+
+    getGraphicsDevice().bindTexture(target, texture);
+    _textures[unit][targetIdx] = texture;
+    ++_stats.calls;
+}
+
+void RenderState::invalidateProgram(uint32_t program) {
+    if (_program == program) {
+        _program = kUnknownName;
+    }
+}
+
+void RenderState::invalidateVertexArray(uint32_t vertexArray) {
+    if (_vertexArray == vertexArray) {
+        _vertexArray = kUnknownName;
+    }
+}
+
+void RenderState::invalidateFramebuffer(uint32_t framebuffer) {
+    if (_framebuffer == framebuffer) {
+        _framebuffer = kUnknownName;
+    }
+}
+
+void RenderState::invalidateTexture(uint32_t texture) {
+    for (int i = 0; i < kTextureUnitCount; ++i) {
+        for (int j = 0; j < kTextureTargetCount; ++j) {
+            if (_textures[i][j] == texture) {
+                _textures[i][j] = kUnknownName;
+            }
+        }
+    }
+}
+
+void RenderState::resetStats() {
+    _stats = RenderStateStats();
+}
+
+BlendMode RenderState::blendMode() const {
+    return _blendMode;
+}
+
+bool RenderState::isDepthTestEnabled() const {
+    return _depthTest;
+}
+
+const glm::ivec4 &RenderState::viewport() const {
+    return _viewport;
+}
+
+const RenderStateStats &RenderState::stats() const {
+    return _stats;
+}
+
+} // namespace render
+
+} // namespace reone
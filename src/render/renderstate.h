@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "glm/vec4.hpp"
+
+namespace reone {
+
+namespace render {
+
+enum class BlendMode {
+    Default, /**< source alpha, one minus source alpha */
+    Additive
+};
+
+struct RenderStateStats {
+    int calls { 0 };
+    int callsAvoided { 0 }; /**< calls skipped because the state was already set */
+};
+
+/**
+ * Shadow copy of the GL state that changes during a frame. All changes to
+ * this state must go through RenderState, so that redundant GL calls can be
+ * skipped and the state never needs to be queried from GL.
+ */
+class RenderState {
+public:
+    static RenderState &instance();
+
+    /**
+     * Sets up the initial state. Must be called once the GL context is created.
+     */
+    void initGL();
+
+    void setBlendMode(BlendMode mode);
+    void setDepthTest(bool enabled);
+    void setViewport(const glm::ivec4 &viewport);
+
+    void useProgram(uint32_t program);
+    void bindVertexArray(uint32_t vertexArray);
+    void bindFramebuffer(uint32_t framebuffer);
+
+    /**
+     * @param target GL_TEXTURE_2D or GL_TEXTURE_CUBE_MAP
+     */
+    void bindTexture(int unit, uint32_t target, uint32_t texture);
+
+    // Deleted objects, whose names may be reused
+
+    void invalidateProgram(uint32_t program);
+    void invalidateVertexArray(uint32_t vertexArray);
+    void invalidateFramebuffer(uint32_t framebuffer);
+    void invalidateTexture(uint32_t texture);
+
+    // END Deleted objects
+
+    void resetStats();
+
+    BlendMode blendMode() const;
+    bool isDepthTestEnabled() const;
+    const glm::ivec4 &viewport() const;
+    const RenderStateStats &stats() const;
+
+private:
+    static const int kTextureUnitCount = 8;
+    static const int kTextureTargetCount = 2;
+
+    BlendMode _blendMode { BlendMode::Default };
+    bool _depthTest { false };
+    glm::ivec4 _viewport { 0 };
+    uint32_t _program { 0 };
+    uint32_t _vertexArray { 0 };
+    uint32_t _framebuffer { 0 };
+    int _activeUnit { 0 };
+    uint32_t _textures[kTextureUnitCount][kTextureTargetCount];
+    RenderStateStats _stats;
+
+    RenderState();
+    RenderState(const RenderState &) = delete;
+    RenderState &operator=(const RenderState &) = delete;
+
+    /**
+     * @return true if the value has changed and the GL call must be made
+     */
+    template <class T>
+    bool update(T &current, const T &value) {
+        if (current == value) {
+            ++_stats.callsAvoided;
+            return false;
+        }
+        current = value;
+        ++_stats.calls;
+        return true;
+    }
+
+    void setActiveUnit(int unit);
+};
+
+} // namespace render
+
+} // namespace reone
@@ -17,6 +17,8 @@
 
 #include "shaders.h"
 
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
 
 #include <boost/format.hpp>
@@ -27,17 +29,28 @@
 
 #include "glm/ext.hpp"
 
+#include "device/device.h"
+#include "renderstate.h"
+
 using namespace std;
 
 namespace reone {
 
 namespace render {
 
-static const GLchar kGUIVertexShader[] = R"END(
+static const int kGlobalsBindingPoint = 0;
+
+static const GLchar kShaderHeader[] = R"END(
 #version 330
 
-uniform mat4 uProjection;
-uniform mat4 uView;
+layout(std140) uniform Globals {
+    mat4 uProjection;
+    mat4 uView;
+    vec3 uCameraPosition;
+};
+)END";
+
+static const GLchar kGUIVertexShader[] = R"END(
 uniform mat4 uModel;
 
 layout(location = 0) in vec3 aPosition;
@@ -52,13 +65,10 @@ void main() {
 )END";
 
 static const GLchar kModelVertexShader[] = R"END(
-#version 330
-
 const int MAX_BONES = 128;
 
-uniform mat4 uProjection;
-uniform mat4 uView;
 uniform mat4 uModel;
+uniform bool uInstancingEnabled;
 
 uniform bool uSkeletalEnabled;
 uniform mat4 uAbsTransform;
@@ -71,11 +81,14 @@ layout(location = 2) in vec2 aTexCoords;
 layout(location = 3) in vec2 aLightmapCoords;
 layout(location = 4) in vec4 aBoneWeights;
 layout(location = 5) in vec4 aBoneIndices;
+layout(location = 6) in mat4 aInstanceModel;
+layout(location = 10) in float aInstanceAlpha;
 
 out vec3 fragPosition;
 out vec3 fragNormal;
 out vec2 fragTexCoords;
 out vec2 fragLightmapCoords;
+out float fragInstanceAlpha;
 
 void main() {
     vec3 newPosition = vec3(0.0);
@@ -102,18 +115,18 @@ void main() {
         newPosition = aPosition;
     }
     vec4 newPosition4 = vec4(newPosition, 1.0);
+    mat4 model = uInstancingEnabled ? aInstanceModel : uModel;
 
-    gl_Position = uProjection * uView * uModel * newPosition4;
-    fragPosition = vec3(uModel * newPosition4);
-    fragNormal = mat3(transpose(inverse(uModel))) * aNormal;
+    gl_Position = uProjection * uView * model * newPosition4;
+    fragPosition = vec3(model * newPosition4);
+    fragNormal = mat3(transpose(inverse(model))) * aNormal;
     fragTexCoords = aTexCoords;
     fragLightmapCoords = aLightmapCoords;
+    fragInstanceAlpha = uInstancingEnabled ? aInstanceAlpha : 1.0;
 }
 )END";
 
 static const GLchar kWhiteFragmentShader[] = R"END(
-#version 330
-
 uniform vec3 uColor;
 uniform float uAlpha;
 
@@ -127,8 +140,6 @@ void main() {
 )END";
 
 static const GLchar kGUIFragmentShader[] = R"END(
-#version 330
-
 uniform sampler2D uTexture;
 uniform vec3 uColor;
 uniform float uAlpha;
@@ -153,8 +164,6 @@ void main() {
 )END";
 
 static const GLchar kModelFragmentShader[] = R"END(
-#version 330
-
 const int MAX_LIGHTS = 8;
 const vec3 RGB_TO_LUMINOSITY = vec3(0.2126, 0.7152, 0.0722);
 
@@ -178,7 +187,6 @@ uniform sampler2D uBumpmap;
 uniform samplerCube uEnvmap;
 uniform samplerCube uBumpyShiny;
 
-uniform vec3 uCameraPosition;
 uniform float uAlpha;
 
 uniform int uLightCount;
@@ -190,6 +198,7 @@ in vec3 fragPosition;
 in vec3 fragNormal;
 in vec2 fragTexCoords;
 in vec2 fragLightmapCoords;
+in float fragInstanceAlpha;
 
 layout(location = 0) out vec4 fragColor;
 layout(location = 1) out vec4 fragColorBright;
@@ -252,7 +261,7 @@ void main() {
     } else {
         lightColor = vec3(1.0);
     }
-    float finalAlpha = uAlpha;
+    float finalAlpha = uAlpha * fragInstanceAlpha;
 
     if (!uEnvmapEnabled && !uBumpyShinyEnabled && !uBumpmapEnabled) {
         finalAlpha *= diffuseSample.a;
@@ -269,8 +278,6 @@ void main() {
 )END";
 
 static const GLchar kGaussianBlurFragmentShader[] = R"END(
-#version 330
-
 uniform sampler2D uTexture;
 uniform vec2 uResolution;
 uniform vec2 uDirection;
@@ -293,8 +300,6 @@ void main() {
 )END";
 
 static const GLchar kBloomFragmentShader[] = R"END(
-#version 330
-
 uniform sampler2D uGeometry;
 uniform sampler2D uBloom;
 
@@ -330,46 +335,95 @@ void Shaders::initGL() {
     initProgram(ShaderProgram::GUIWhite, ShaderName::VertexGUI, ShaderName::FragmentWhite);
     initProgram(ShaderProgram::ModelWhite, ShaderName::VertexModel, ShaderName::FragmentWhite);
     initProgram(ShaderProgram::ModelModel, ShaderName::VertexModel, ShaderName::FragmentModel);
+
+    IGraphicsDevice &device = getGraphicsDevice();
+    _globalsBuffer = device.createBuffer();
+    device.bindBuffer(GL_UNIFORM_BUFFER, _globalsBuffer);
+    device.bufferData(GL_UNIFORM_BUFFER, sizeof(GlobalsBlock), &_globals, GL_DYNAMIC_DRAW);
+    device.bindBufferBase(GL_UNIFORM_BUFFER, kGlobalsBindingPoint, _globalsBuffer);
+    device.bindBuffer(GL_UNIFORM_BUFFER, 0);
 }
 
 void Shaders::initShader(ShaderName name, unsigned int type, const char *source) {
-    GLuint shader = glCreateShader(type);
-    GLint success;
-    char log[512];
-    GLsizei logSize;
+    IGraphicsDevice &device = getGraphicsDevice();
+    uint32_t shader = device.createShader(type);
 
-    glShaderSource(shader, 1, &source, nullptr);
-    glCompileShader(shader);
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    const GLchar *sources[] { kShaderHeader, source };
+    device.shaderSource(shader, 2, sources);
 
-    if (!success) {
-        glGetShaderInfoLog(shader, sizeof(log), &logSize, log);
-        throw runtime_error(str(boost::format("Shader %d compilation failed: %s") % static_cast<int>(name) % string(log, logSize)));
+    string log;
+    if (!device.compileShader(shader, log)) {
+        throw runtime_error(str(boost::format("Shader %d compilation failed: %s") % static_cast<int>(name) % log));
     }
 
     _shaders.insert(make_pair(name, shader));
 }
 
+static const char *kUniformNames[] {
+    "uModel",
+    "uColor",
+    "uAlpha",
+    "uLightmapEnabled",
+    "uEnvmapEnabled",
+    "uBumpyShinyEnabled",
+    "uBumpmapEnabled",
+    "uSkeletalEnabled",
+    "uLightingEnabled",
+    "uSelfIllumEnabled",
+    "uDiscardEnabled",
+    "uInstancingEnabled",
+    "uLightmap",
+    "uEnvmap",
+    "uBumpyShiny",
+    "uBumpmap",
+    "uAbsTransform",
+    "uAbsTransformInv",
+    "uBones",
+    "uLightCount",
+    "uAmbientLightColor",
+    "uSelfIllumColor",
+    "uResolution",
+    "uDirection",
+    "uBloom",
+    "uDiscardColor"
+};
+
+static const char *kLightPropertyNames[] { "position", "color", "radius" };
+
 void Shaders::initProgram(ShaderProgram program, ShaderName vertexShader, ShaderName fragmentShader) {
     unsigned int vsOrdinal = _shaders.find(vertexShader)->second;
     unsigned int fsOrdinal = _shaders.find(fragmentShader)->second;
 
-    GLuint ordinal = glCreateProgram();
-    GLint success;
-    char log[512];
-    GLsizei logSize;
+    IGraphicsDevice &device = getGraphicsDevice();
+    uint32_t ordinal = device.createProgram();
+
+    device.attachShader(ordinal, vsOrdinal);
+    device.attachShader(ordinal, fsOrdinal);
 
-    glAttachShader(ordinal, vsOrdinal);
-    glAttachShader(ordinal, fsOrdinal);
-    glLinkProgram(ordinal);
-    glGetProgramiv(ordinal, GL_LINK_STATUS, &success);
+    string log;
+    if (!device.linkProgram(ordinal, log)) {
+        throw runtime_error("Shaders: program linking failed: " + log);
+    }
 
-    if (!success) {
-        glGetProgramInfoLog(ordinal, sizeof(log), &logSize, log);
-        throw runtime_error("Shaders: program linking failed: " + string(log, logSize));
+    // Blocks unused by both shaders are optimized out
+    uint32_t globalsIndex = device.getUniformBlockIndex(ordinal, "Globals");
+    if (globalsIndex != GL_INVALID_INDEX) {
+        device.uniformBlockBinding(ordinal, globalsIndex, kGlobalsBindingPoint);
     }
 
-    _programs.insert(make_pair(program, ordinal));
+    ProgramState &state = _programs[program];
+    state.ordinal = ordinal;
+
+    int lightsOffset = static_cast<int>(UniformName::Lights);
+    for (int i = 0; i < lightsOffset; ++i) {
+        state.locations[i] = device.getUniformLocation(ordinal, kUniformNames[i]);
+    }
+    for (int i = 0; i < kMaxLightCount; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            string name(str(boost::format("uLights[%d].%s") % i % kLightPropertyNames[j]));
+            state.locations[lightsOffset + 3 * i + j] = device.getUniformLocation(ordinal, name.c_str());
+        }
+    }
 }
 
 Shaders::~Shaders() {
@@ -377,29 +431,45 @@ Shaders::~Shaders() {
 }
 
 void Shaders::deinitGL() {
+    if (_programs.empty() && _shaders.empty() && !_globalsBuffer) return;
+
+    IGraphicsDevice &device = getGraphicsDevice();
+
     for (auto &pair :_programs) {
-        glDeleteProgram(pair.second);
+        RenderState::instance().invalidateProgram(pair.second.ordinal);
+        device.deleteProgram(pair.second.ordinal);
     }
     _programs.clear();
+    _activeProgram = ShaderProgram::None;
+    _activeState = nullptr;
 
     for (auto &pair : _shaders) {
-        glDeleteShader(pair.second);
+        device.deleteShader(pair.second);
     }
     _shaders.clear();
+
+    if (_globalsBuffer) {
+        device.deleteBuffer(_globalsBuffer);
+        _globalsBuffer = 0;
+    }
 }
 
-void Shaders::activate(ShaderProgram program, const LocalUniforms &locals) {
-    if (_activeProgram != program) {
-        unsigned int ordinal = getOrdinal(program);
-        glUseProgram(ordinal);
+void Shaders::activate(ShaderProgram program) {
+    if (_activeProgram == program) return;
 
-        _activeProgram = program;
-        _activeOrdinal = ordinal;
-    }
+    ProgramState &state = getProgramState(program);
+    RenderState::instance().useProgram(state.ordinal);
+
+    _activeProgram = program;
+    _activeState = &state;
+}
+
+void Shaders::activate(ShaderProgram program, const LocalUniforms &locals) {
+    activate(program);
     setLocalUniforms(locals);
 }
 
-unsigned int Shaders::getOrdinal(ShaderProgram program) const {
+Shaders::ProgramState &Shaders::getProgramState(ShaderProgram program) {
     auto it = _programs.find(program);
     if (it == _programs.end()) {
         throw invalid_argument("Shaders: program not found: " + to_string(static_cast<int>(program)));
@@ -407,153 +477,172 @@ unsigned int Shaders::getOrdinal(ShaderProgram program) const {
     return it->second;
 }
 
-static const string &getLightUniformName(int index, const char *propName) {
-    static unordered_map<int, unordered_map<const char *, string>> cache;
-    auto &cacheByIndex = cache[index];
-    auto maybeName = cacheByIndex.find(propName);
-
-    if (maybeName != cacheByIndex.end()) {
-        return maybeName->second;
-    }
-    string name(str(boost::format("uLights[%d].%s") % index % propName));
-    auto pair = cacheByIndex.insert(make_pair(propName, name));
-
-    return pair.first->second;
-}
-
 void Shaders::setLocalUniforms(const LocalUniforms &locals) {
-    setUniform("uModel", locals.model);
-    setUniform("uColor", locals.color);
-    setUniform("uAlpha", locals.alpha);
-    setUniform("uLightmapEnabled", locals.features.lightmapEnabled);
-    setUniform("uEnvmapEnabled", locals.features.envmapEnabled);
-    setUniform("uLightmapEnabled", locals.features.lightmapEnabled);
-    setUniform("uBumpyShinyEnabled", locals.features.bumpyShinyEnabled);
-    setUniform("uBumpmapEnabled", locals.features.bumpmapEnabled);
-    setUniform("uSkeletalEnabled", locals.features.skeletalEnabled);
-    setUniform("uLightingEnabled", locals.features.lightingEnabled);
-    setUniform("uSelfIllumEnabled", locals.features.selfIllumEnabled);
-    setUniform("uDiscardEnabled", locals.features.discardEnabled);
+    setUniform(UniformName::Model, locals.model);
+    setUniform(UniformName::Color, locals.color);
+    setUniform(UniformName::Alpha, locals.alpha);
+    setUniform(UniformName::LightmapEnabled, locals.features.lightmapEnabled);
+    setUniform(UniformName::EnvmapEnabled, locals.features.envmapEnabled);
+    setUniform(UniformName::BumpyShinyEnabled, locals.features.bumpyShinyEnabled);
+    setUniform(UniformName::BumpmapEnabled, locals.features.bumpmapEnabled);
+    setUniform(UniformName::SkeletalEnabled, locals.features.skeletalEnabled);
+    setUniform(UniformName::LightingEnabled, locals.features.lightingEnabled);
+    setUniform(UniformName::SelfIllumEnabled, locals.features.selfIllumEnabled);
+    setUniform(UniformName::DiscardEnabled, locals.features.discardEnabled);
+    setUniform(UniformName::InstancingEnabled, locals.features.instancingEnabled);
 
     if (locals.features.lightmapEnabled) {
-        setUniform("uLightmap", locals.textures.lightmap);
+        setUniform(UniformName::Lightmap, locals.textures.lightmap);
     }
     if (locals.features.envmapEnabled) {
-        setUniform("uEnvmap", locals.textures.envmap);
+        setUniform(UniformName::Envmap, locals.textures.envmap);
     }
     if (locals.features.bumpyShinyEnabled) {
-        setUniform("uBumpyShiny", locals.textures.bumpyShiny);
+        setUniform(UniformName::BumpyShiny, locals.textures.bumpyShiny);
     }
     if (locals.features.bumpmapEnabled) {
-        setUniform("uBumpmap", locals.textures.bumpmap);
+        setUniform(UniformName::Bumpmap, locals.textures.bumpmap);
     }
     if (locals.features.skeletalEnabled) {
-        setUniform("uAbsTransform", locals.skeletal.absTransform);
-        setUniform("uAbsTransformInv", locals.skeletal.absTransformInv);
-        setUniform("uBones", locals.skeletal.bones);
+        setUniform(UniformName::AbsTransform, locals.skeletal.absTransform);
+        setUniform(UniformName::AbsTransformInv, locals.skeletal.absTransformInv);
+        if (locals.skeletal.bones) {
+            setBones(*locals.skeletal.bones, locals.skeletal.bonesRevision);
+        }
     }
     if (locals.features.lightingEnabled) {
-        int lightCount = static_cast<int>(locals.lighting.lights.size());
-        setUniform("uLightCount", lightCount);
-        setUniform("uAmbientLightColor", locals.lighting.ambientColor);
+        int lightCount = min(static_cast<int>(locals.lighting.lights.size()), kMaxLightCount);
+        setUniform(UniformName::LightCount, lightCount);
+        setUniform(UniformName::AmbientLightColor, locals.lighting.ambientColor);
 
+        int lightsOffset = static_cast<int>(UniformName::Lights);
         for (int i = 0; i < lightCount; ++i) {
             const ShaderLight &light = locals.lighting.lights[i];
-            setUniform(getLightUniformName(i, "position"), light.position);
-            setUniform(getLightUniformName(i, "color"), light.color);
-            setUniform(getLightUniformName(i, "radius"), light.radius);
+            int index = lightsOffset + 3 * i;
+            setUniform(static_cast<UniformName>(index + 0), light.position);
+            setUniform(static_cast<UniformName>(index + 1), light.color);
+            setUniform(static_cast<UniformName>(index + 2), light.radius);
         }
     }
     if (locals.features.selfIllumEnabled) {
-        setUniform("uSelfIllumColor", locals.selfIllumColor);
+        setUniform(UniformName::SelfIllumColor, locals.selfIllumColor);
     }
     if (locals.features.blurEnabled) {
-        setUniform("uResolution", locals.blur.resolution);
-        setUniform("uDirection", locals.blur.direction);
+        setUniform(UniformName::Resolution, locals.blur.resolution);
+        setUniform(UniformName::Direction, locals.blur.direction);
     }
     if (locals.features.bloomEnabled) {
-        setUniform("uBloom", locals.textures.bloom);
+        setUniform(UniformName::Bloom, locals.textures.bloom);
     }
     if (locals.features.discardEnabled) {
-        setUniform("uDiscardColor", locals.discardColor);
+        setUniform(UniformName::DiscardColor, locals.discardColor);
     }
 }
 
-void Shaders::setUniform(const string &name, const glm::mat4 &m) {
-    setUniform(name, [this, &m](int loc) {
-        glUniformMatrix4fv(loc, 1, GL_FALSE, glm::value_ptr(m));
-    });
-}
+int Shaders::getLocationIfChanged(UniformName name, const void *data, size_t size) {
+    int index = static_cast<int>(name);
+    int location = _activeState->locations[index];
+    if (location == -1) return -1;
 
-void Shaders::setUniform(const string &name, const function<void(int)> &setter) {
-    static unordered_map<uint32_t, unordered_map<string, GLint>> locsByProgram;
+    UniformValue &value = _activeState->values[index];
+    if (value.valid && memcmp(value.data, data, size) == 0) {
+        ++_stats.uniformUpdatesSkipped;
+        return -1;
+    }
+    memcpy(value.data, data, size);
+    value.valid = true;
+    ++_stats.uniformUpdates;
 
-    unordered_map<string, GLint> &locs = locsByProgram[_activeOrdinal];
-    auto maybeLoc = locs.find(name);
-    GLint loc = 0;
+    return location;
+}
 
-    if (maybeLoc != locs.end()) {
-        loc = maybeLoc->second;
-    } else {
-        loc = glGetUniformLocation(_activeOrdinal, name.c_str());
-        locs.insert(make_pair(name, loc));
-    }
-    if (loc != -1) {
-        setter(loc);
+void Shaders::setUniform(UniformName name, int value) {
+    int location = getLocationIfChanged(name, &value, sizeof(value));
+    if (location != -1) {
+        getGraphicsDevice().uniform1i(location, value);
     }
 }
 
-void Shaders::setUniform(const string &name, int value) {
-    setUniform(name, [this, &value](int loc) {
-        glUniform1i(loc, value);
-    });
+void Shaders::setUniform(UniformName name, float value) {
+    int location = getLocationIfChanged(name, &value, sizeof(value));
+    if (location != -1) {
+        getGraphicsDevice().uniform1f(location, value);
+    }
 }
 
-void Shaders::setUniform(const string &name, float value) {
-    setUniform(name, [this, &value](int loc) {
-        glUniform1f(loc, value);
-    });
+void Shaders::setUniform(UniformName name, const glm::vec2 &v) {
+    int location = getLocationIfChanged(name, glm::value_ptr(v), sizeof(v));
+    if (location != -1) {
+        getGraphicsDevice().uniform2f(location, v);
+    }
 }
 
-void Shaders::setUniform(const string &name, const glm::vec2 &v) {
-    setUniform(name, [this, &v](int loc) {
-        glUniform2f(loc, v.x, v.y);
-    });
+void Shaders::setUniform(UniformName name, const glm::vec3 &v) {
+    int location = getLocationIfChanged(name, glm::value_ptr(v), sizeof(v));
+    if (location != -1) {
+        getGraphicsDevice().uniform3f(location, v);
+    }
 }
 
-void Shaders::setUniform(const string &name, const glm::vec3 &v) {
-    setUniform(name, [this, &v](int loc) {
-        glUniform3f(loc, v.x, v.y, v.z);
-    });
+void Shaders::setUniform(UniformName name, const glm::mat4 &m) {
+    int location = getLocationIfChanged(name, glm::value_ptr(m), sizeof(m));
+    if (location != -1) {
+        getGraphicsDevice().uniformMatrix4fv(location, 1, &m);
+    }
 }
 
-void Shaders::setUniform(const string &name, const vector<glm::mat4> &arr) {
-    setUniform(name, [this, &arr](int loc) {
-        glUniformMatrix4fv(loc, static_cast<GLsizei>(arr.size()), GL_FALSE, reinterpret_cast<const GLfloat *>(&arr[0]));
-    });
+void Shaders::setBones(const vector<glm::mat4> &bones, uint32_t revision) {
+    int location;
+
+    // Palettes are too large to compare, so their revisions are compared instead
+    if (revision != 0) {
+        location = getLocationIfChanged(UniformName::Bones, &revision, sizeof(revision));
+    } else {
+        int index = static_cast<int>(UniformName::Bones);
+        location = _activeState->locations[index];
+        _activeState->values[index].valid = false;
+        if (location != -1) {
+            ++_stats.uniformUpdates;
+        }
+    }
+    if (location == -1 || bones.empty()) return;
+
+    int count = min(static_cast<int>(bones.size()), kMaxBoneCount);
+    getGraphicsDevice().uniformMatrix4fv(location, count, &bones[0]);
+
+    _stats.boneBytesUploaded += count * sizeof(glm::mat4);
 }
 
 void Shaders::deactivate() {
     if (_activeProgram == ShaderProgram::None) return;
 
-    glUseProgram(0);
+    RenderState::instance().useProgram(0);
     _activeProgram = ShaderProgram::None;
-    _activeOrdinal = 0;
+    _activeState = nullptr;
 }
 
 void Shaders::setGlobalUniforms(const GlobalUniforms &globals) {
-    uint32_t ordinal = _activeOrdinal;
+    GlobalsBlock block;
+    block.projection = globals.projection;
+    block.view = globals.view;
+    block.cameraPosition = glm::vec4(globals.cameraPosition, 0.0f);
 
-    for (auto &program : _programs) {
-        glUseProgram(program.second);
-        _activeOrdinal = program.second;
+    if (memcmp(&block, &_globals, sizeof(GlobalsBlock)) == 0) return;
 
-        setUniform("uProjection", globals.projection);
-        setUniform("uView", globals.view);
-        setUniform("uCameraPosition", globals.cameraPosition);
-    }
-    glUseProgram(ordinal);
-    _activeOrdinal = ordinal;
+    IGraphicsDevice &device = getGraphicsDevice();
+    device.bindBuffer(GL_UNIFORM_BUFFER, _globalsBuffer);
+    device.bufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(GlobalsBlock), &block);
+    device.bindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    _globals = block;
+}
+
+void Shaders::resetStats() {
+    _stats = ShaderStats();
+}
+
+const ShaderStats &Shaders::stats() const {
+    return _stats;
 }
 
 } // namespace render
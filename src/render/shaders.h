@@ -18,8 +18,6 @@
 #pragma once
 
 #include <cstdint>
-#include <functional>
-#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -39,6 +37,9 @@ enum class ShaderProgram {
     ModelModel
 };
 
+const int kMaxBoneCount = 128;
+const int kMaxLightCount = 8;
+
 struct GlobalUniforms {
     glm::mat4 projection { 1.0f };
     glm::mat4 view { 1.0f };
@@ -56,6 +57,7 @@ struct FeatureUniforms {
     bool blurEnabled { false };
     bool bloomEnabled { false };
     bool discardEnabled { false };
+    bool instancingEnabled { false }; /**< transforms and alphas are per instance */
 };
 
 struct TextureUniforms {
@@ -69,7 +71,8 @@ struct TextureUniforms {
 struct SkeletalUniforms {
     glm::mat4 absTransform { 1.0f };
     glm::mat4 absTransformInv { 1.0f };
-    std::vector<glm::mat4> bones;
+    const std::vector<glm::mat4> *bones { nullptr };
+    uint32_t bonesRevision { 0 }; /**< changes whenever bones change, 0 if unknown */
 };
 
 struct ShaderLight {
@@ -102,17 +105,33 @@ struct LocalUniforms {
     glm::vec3 discardColor { 0.0f };
 };
 
+struct ShaderStats {
+    int uniformUpdates { 0 };
+    int uniformUpdatesSkipped { 0 }; /**< uniforms that already had the requested value */
+    int boneBytesUploaded { 0 };
+};
+
 class Shaders {
 public:
     static Shaders &instance();
 
     void initGL();
     void deinitGL();
+    void activate(ShaderProgram program);
     void activate(ShaderProgram program, const LocalUniforms &uniforms);
     void deactivate();
 
     void setGlobalUniforms(const GlobalUniforms &globals);
 
+    /**
+     * Sets local uniforms of the active program.
+     */
+    void setLocalUniforms(const LocalUniforms &locals);
+
+    void resetStats();
+
+    const ShaderStats &stats() const;
+
 private:
     enum class ShaderName {
         VertexGUI,
@@ -124,10 +143,77 @@ private:
         FragmentBloom
     };
 
+    /**
+     * Uniforms set by setLocalUniforms. Light uniforms occupy three
+     * consecutive slots per light, starting at Lights.
+     */
+    enum class UniformName {
+        Model,
+        Color,
+        Alpha,
+        LightmapEnabled,
+        EnvmapEnabled,
+        BumpyShinyEnabled,
+        BumpmapEnabled,
+        SkeletalEnabled,
+        LightingEnabled,
+        SelfIllumEnabled,
+        DiscardEnabled,
+        InstancingEnabled,
+        Lightmap,
+        Envmap,
+        BumpyShiny,
+        Bumpmap,
+        AbsTransform,
+        AbsTransformInv,
+        Bones,
+        LightCount,
+        AmbientLightColor,
+        SelfIllumColor,
+        Resolution,
+        Direction,
+        Bloom,
+        DiscardColor,
+        Lights,
+        Count = Lights + 3 * kMaxLightCount
+    };
+
+    static const int kUniformCount = static_cast<int>(UniformName::Count);
+
+    /**
+     * Last value sent to a uniform. Large enough for a 4x4 matrix.
+     */
+    struct UniformValue {
+        bool valid { false };
+        float data[16];
+    };
+
+    /**
+     * Uniform state is kept per program object by GL, and so is its shadow
+     * copy.
+     */
+    struct ProgramState {
+        uint32_t ordinal { 0 };
+        int locations[kUniformCount];
+        UniformValue values[kUniformCount];
+    };
+
+    /**
+     * Layout of the Globals uniform block (std140).
+     */
+    struct GlobalsBlock {
+        glm::mat4 projection { 1.0f };
+        glm::mat4 view { 1.0f };
+        glm::vec4 cameraPosition { 0.0f };
+    };
+
     std::unordered_map<ShaderName, uint32_t> _shaders;
-    std::unordered_map<ShaderProgram, uint32_t> _programs;
+    std::unordered_map<ShaderProgram, ProgramState> _programs;
     ShaderProgram _activeProgram { ShaderProgram::None };
-    uint32_t _activeOrdinal { 0 };
+    ProgramState *_activeState { nullptr };
+    uint32_t _globalsBuffer { 0 };
+    GlobalsBlock _globals;
+    ShaderStats _stats;
 
     Shaders() = default;
     Shaders(const Shaders &) = delete;
@@ -137,15 +223,20 @@ private:
 
     void initShader(ShaderName name, unsigned int type, const char *source);
     void initProgram(ShaderProgram program, ShaderName vertexShader, ShaderName fragmentShader);
-    unsigned int getOrdinal(ShaderProgram program) const;
-    void setLocalUniforms(const LocalUniforms &locals);
-    void setUniform(const std::string &name, int value);
-    void setUniform(const std::string &name, const std::function<void(int)> &setter);
-    void setUniform(const std::string &name, float value);
-    void setUniform(const std::string &name, const glm::vec2 &v);
-    void setUniform(const std::string &name, const glm::vec3 &v);
-    void setUniform(const std::string &name, const glm::mat4 &m);
-    void setUniform(const std::string &name, const std::vector<glm::mat4> &arr);
+    ProgramState &getProgramState(ShaderProgram program);
+
+    /**
+     * @return location of the uniform in the active program, or -1 if the
+     *         uniform is unused or already has the specified value
+     */
+    int getLocationIfChanged(UniformName name, const void *data, size_t size);
+
+    void setUniform(UniformName name, int value);
+    void setUniform(UniformName name, float value);
+    void setUniform(UniformName name, const glm::vec2 &v);
+    void setUniform(UniformName name, const glm::vec3 &v);
+    void setUniform(UniformName name, const glm::mat4 &m);
+    void setBones(const std::vector<glm::mat4> &bones, uint32_t revision);
 };
 
 } // namespace render
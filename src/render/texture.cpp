@@ -23,6 +23,9 @@
 
 #include "SDL2/SDL_opengl.h"
 
+#include "device/device.h"
+#include "renderstate.h"
+
 using namespace std;
 
 namespace reone {
@@ -35,15 +38,18 @@ Texture::Texture(const string &name, TextureType type) : _name(name), _type(type
 void Texture::initGL() {
     if (_glInited) return;
 
-    glGenTextures(1, &_textureId);
+    IGraphicsDevice &device = getGraphicsDevice();
+    _textureId = device.createTexture();
+
+    RenderState &state = RenderState::instance();
 
     if (isCubeMap()) {
-        glBindTexture(GL_TEXTURE_CUBE_MAP, _textureId);
-        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        state.bindTexture(0, GL_TEXTURE_CUBE_MAP, _textureId);
+        device.texParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        device.texParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        device.texParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+        device.texParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        device.texParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
         int i = 0;
         for (auto &layer : _layers) {
@@ -51,22 +57,22 @@ void Texture::initGL() {
             fillTextureTarget(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i++, 0, mipMap.width, mipMap.height, mipMap.data);
         }
 
-        glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+        state.bindTexture(0, GL_TEXTURE_CUBE_MAP, 0);
 
     } else {
-        glBindTexture(GL_TEXTURE_2D, _textureId);
+        state.bindTexture(0, GL_TEXTURE_2D, _textureId);
         const Layer &layer = _layers.front();
         int mipMapCount = static_cast<int>(layer.mipMaps.size());
         if (mipMapCount > 1) {
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mipMapCount - 1);
+            device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+            device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mipMapCount - 1);
         }
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (_type == TextureType::GUI || _type == TextureType::Cursor) ? GL_LINEAR : GL_LINEAR_MIPMAP_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (_type == TextureType::GUI || _type == TextureType::Cursor) ? GL_LINEAR : GL_LINEAR_MIPMAP_LINEAR);
+        device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
         if (_type == TextureType::GUI) {
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
         }
 
         int i = 0;
@@ -74,10 +80,10 @@ void Texture::initGL() {
             fillTextureTarget(GL_TEXTURE_2D, i++, mipMap.width, mipMap.height, mipMap.data);
         }
         if (mipMapCount == 1) {
-            glGenerateMipmap(GL_TEXTURE_2D);
+            device.generateMipmap(GL_TEXTURE_2D);
         }
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+        state.bindTexture(0, GL_TEXTURE_2D, 0);
     }
 
     _glInited = true;
@@ -94,12 +100,12 @@ void Texture::fillTextureTarget(uint32_t target, int level, int width, int heigh
         case PixelFormat::RGBA:
         case PixelFormat::BGR:
         case PixelFormat::BGRA:
-            glTexImage2D(target, level, glInternalPixelFormat(), width, height, 0, glPixelFormat(), GL_UNSIGNED_BYTE, &data[0]);
+            getGraphicsDevice().texImage2D(target, level, glInternalPixelFormat(), width, height, glPixelFormat(), GL_UNSIGNED_BYTE, &data[0], data.size());
             break;
 
         case PixelFormat::DXT1:
         case PixelFormat::DXT5:
-            glCompressedTexImage2D(target, level, glInternalPixelFormat(), width, height, 0, static_cast<int>(data.size()), &data[0]);
+            getGraphicsDevice().compressedTexImage2D(target, level, glInternalPixelFormat(), width, height, &data[0], data.size());
             break;
     }
 }
@@ -149,19 +155,18 @@ Texture::~Texture() {
 void Texture::deinitGL() {
     if (!_glInited) return;
 
-    glDeleteTextures(1, &_textureId);
+    RenderState::instance().invalidateTexture(_textureId);
+    getGraphicsDevice().deleteTexture(_textureId);
 
     _glInited = false;
 }
 
 void Texture::bind(int unit) {
-    glActiveTexture(GL_TEXTURE0 + unit);
-    glBindTexture(isCubeMap() ? GL_TEXTURE_CUBE_MAP : GL_TEXTURE_2D, _textureId);
+    RenderState::instance().bindTexture(unit, isCubeMap() ? GL_TEXTURE_CUBE_MAP : GL_TEXTURE_2D, _textureId);
 }
 
 void Texture::unbind(int unit) {
-    glActiveTexture(GL_TEXTURE0 + unit);
-    glBindTexture(isCubeMap() ? GL_TEXTURE_CUBE_MAP : GL_TEXTURE_2D, 0);
+    RenderState::instance().bindTexture(unit, isCubeMap() ? GL_TEXTURE_CUBE_MAP : GL_TEXTURE_2D, 0);
 }
 
 bool Texture::isAdditive() const {
@@ -188,6 +193,10 @@ const TextureFeatures &Texture::features() const {
     return _features;
 }
 
+void Texture::setFeatures(const TextureFeatures &features) {
+    _features = features;
+}
+
 } // namespace render
 
 } // namespace reone
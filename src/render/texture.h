@@ -59,6 +59,12 @@ public:
     PixelFormat pixelFormat() const;
     const TextureFeatures &features() const;
 
+    /**
+     * Sets features programmatically, e.g. in tests. Features of loaded
+     * textures come from TXI files.
+     */
+    void setFeatures(const TextureFeatures &features);
+
 private:
     struct MipMap {
         int width { 0 };
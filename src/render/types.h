@@ -42,10 +42,29 @@ enum class TextureBlending {
     Additive
 };
 
+enum class RendererType {
+    OpenGL,
+    Null /**< records graphics commands without a window or a GPU */
+};
+
+struct AnimationLODOptions {
+    bool enabled { true };
+    float halfRateDistance { 16.0f };
+    float quarterRateDistance { 32.0f };
+    float halfRateScreenSize { 0.2f }; // fraction of the viewport height
+    float quarterRateScreenSize { 0.1f }; // fraction of the viewport height
+    bool skipNodes { true }; // skip nodes without meshes or bones at the quarter rate
+};
+
 struct GraphicsOptions {
     int width { 0 };
     int height { 0 };
     bool fullscreen { false };
+    RendererType renderer { RendererType::OpenGL };
+    int animationThreads { 1 };
+    int renderThreads { 1 };
+    AnimationLODOptions animationLOD;
+    bool compressAnimations { false };
 };
 
 struct TextureFeatures {
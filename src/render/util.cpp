@@ -21,6 +21,8 @@
 
 #include "SDL2/SDL_opengl.h"
 
+#include "renderstate.h"
+
 using namespace std;
 
 namespace reone {
@@ -28,22 +30,23 @@ namespace reone {
 namespace render {
 
 void withDepthTest(const std::function<void()> &block) {
-    glEnable(GL_DEPTH_TEST);
+    RenderState &state = RenderState::instance();
+    bool oldDepthTest = state.isDepthTestEnabled();
+    state.setDepthTest(true);
+
     block();
-    glDisable(GL_DEPTH_TEST);
+
+    state.setDepthTest(oldDepthTest);
 }
 
 void withAdditiveBlending(const std::function<void()> &block) {
-    GLint blendSrcRgb, blendSrcAlpha, blendDstRgb, blendDstAlpha;
-    glGetIntegerv(GL_BLEND_SRC_RGB, &blendSrcRgb);
-    glGetIntegerv(GL_BLEND_SRC_ALPHA, &blendSrcAlpha);
-    glGetIntegerv(GL_BLEND_DST_RGB, &blendDstRgb);
-    glGetIntegerv(GL_BLEND_DST_ALPHA, &blendDstAlpha);
-    glBlendFunc(GL_ONE, GL_ONE);
+    RenderState &state = RenderState::instance();
+    BlendMode oldMode = state.blendMode();
+    state.setBlendMode(BlendMode::Additive);
 
     block();
 
-    glBlendFuncSeparate(blendSrcRgb, blendDstRgb, blendSrcAlpha, blendDstAlpha);
+    state.setBlendMode(oldMode);
 }
 
 } // namespace render
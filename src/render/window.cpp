@@ -17,6 +17,7 @@
 
 #include "window.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 #include <boost/format.hpp>
@@ -30,9 +31,12 @@
 #include "../common/log.h"
 
 #include "cursor.h"
+#include "device/null.h"
+#include "instancebuffer.h"
 #include "mesh/aabb.h"
 #include "mesh/cube.h"
 #include "mesh/quad.h"
+#include "renderstate.h"
 #include "shaders.h"
 
 using namespace std;
@@ -45,6 +49,25 @@ RenderWindow::RenderWindow(const GraphicsOptions &opts, IEventHandler *eventHand
 }
 
 void RenderWindow::init() {
+    if (_opts.renderer == RendererType::Null) {
+        SDL_Init(SDL_INIT_EVENTS);
+        setGraphicsDevice(make_unique<NullGraphicsDevice>(_opts.width, _opts.height));
+    } else {
+        initWindow();
+    }
+
+    RenderState::instance().initGL();
+    Shaders::instance().initGL();
+    InstanceBuffer::instance().initGL();
+    CubeMesh::instance().initGL();
+    AABBMesh::instance().initGL();
+    Quad::getDefault().initGL();
+    Quad::getXFlipped().initGL();
+    Quad::getYFlipped().initGL();
+    Quad::getXYFlipped().initGL();
+}
+
+void RenderWindow::initWindow() {
     SDL_Init(SDL_INIT_VIDEO);
     SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
     SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
@@ -71,17 +94,6 @@ void RenderWindow::init() {
     }
     SDL_GL_SetSwapInterval(0);
     glewInit();
-
-    Shaders::instance().initGL();
-    CubeMesh::instance().initGL();
-    AABBMesh::instance().initGL();
-    Quad::getDefault().initGL();
-    Quad::getXFlipped().initGL();
-    Quad::getYFlipped().initGL();
-    Quad::getXYFlipped().initGL();
-
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 }
 
 void RenderWindow::deinit() {
@@ -94,15 +106,20 @@ void RenderWindow::deinit() {
     Quad::getXYFlipped().deinitGL();
     AABBMesh::instance().deinitGL();
     CubeMesh::instance().deinitGL();
+    InstanceBuffer::instance().deinitGL();
     Shaders::instance().deinitGL();
 
-    SDL_GL_DeleteContext(_context);
-    SDL_DestroyWindow(_window);
+    if (_window) {
+        SDL_GL_DeleteContext(_context);
+        SDL_DestroyWindow(_window);
+    }
     SDL_Quit();
 }
 
 void RenderWindow::show() {
-    SDL_ShowWindow(_window);
+    if (_window) {
+        SDL_ShowWindow(_window);
+    }
 }
 
 void RenderWindow::processEvents(bool &quit) {
@@ -148,13 +165,29 @@ void RenderWindow::update(float dt) {
     _fpsGlobal.update(dt);
 
     if (_fpsLocal.hasAverage()) {
-        SDL_SetWindowTitle(_window, str(boost::format("reone [FPS: %d]") % static_cast<int>(_fpsLocal.average())).c_str());
+        if (_window) {
+            SDL_SetWindowTitle(_window, str(boost::format("reone [FPS: %d]") % static_cast<int>(_fpsLocal.average())).c_str());
+        }
         _fpsLocal.reset();
+
+        RenderState &state = RenderState::instance();
+        const RenderStateStats &stats = state.stats();
+        debug(boost::format("RenderState: %d GL calls, %d avoided") % stats.calls % stats.callsAvoided, 2);
+        state.resetStats();
+
+        if (_opts.renderer == RendererType::Null) {
+            auto &device = static_cast<NullGraphicsDevice &>(getGraphicsDevice());
+            const vector<GraphicsCommand> &commands = device.lastFrameCommands();
+            int drawCount = static_cast<int>(count_if(commands.begin(), commands.end(), [](auto &command) {
+                return command.type == GraphicsCommandType::Draw;
+            }));
+            debug(boost::format("NullGraphicsDevice: %d commands, %d draws in the last frame") % commands.size() % drawCount, 2);
+        }
     }
 }
 
 void RenderWindow::clear() const {
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    getGraphicsDevice().clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 }
 
 void RenderWindow::drawCursor() const {
@@ -170,7 +203,10 @@ void RenderWindow::drawCursor() const {
 }
 
 void RenderWindow::swapBuffers() const {
-    SDL_GL_SwapWindow(_window);
+    if (_window) {
+        SDL_GL_SwapWindow(_window);
+    }
+    getGraphicsDevice().endFrame();
 }
 
 void RenderWindow::setRelativeMouseMode(bool enabled) {
@@ -64,6 +64,11 @@ private:
     std::function<void()> _onRenderWorld;
     std::function<void()> _onRenderGUI;
 
+    /**
+     * Creates a window with a GL context.
+     */
+    void initWindow();
+
     bool handleEvent(const SDL_Event &event, bool &quit);
     bool handleKeyDownEvent(const SDL_KeyboardEvent &event, bool &quit);
 };
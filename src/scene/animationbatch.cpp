@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "animationbatch.h"
+
+#include <algorithm>
+
+#include "../common/jobs.h"
+
+#include "modelscenenode.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace scene {
+
+void AnimationBatch::add(ModelSceneNode *model) {
+    _models.push_back(model);
+}
+
+void AnimationBatch::clear() {
+    _models.clear();
+}
+
+void AnimationBatch::run(float dt, int threadCount) {
+    countLODs();
+
+    JobExecutor::instance().parallelFor(static_cast<int>(_models.size()), threadCount, [this, dt](int batch, int begin, int end) {
+        updateModels(begin, end, dt);
+    });
+}
+
+void AnimationBatch::updateModels(int begin, int end, float dt) {
+    for (int i = begin; i < end; ++i) {
+        _models[i]->update(dt);
+    }
+}
+
+void AnimationBatch::countLODs() {
+    fill(_lodCounts, _lodCounts + kLODCount, 0);
+
+    for (auto &model : _models) {
+        if (model->isVisible()) {
+            ++_lodCounts[static_cast<int>(model->animationLOD())];
+        }
+    }
+}
+
+int AnimationBatch::count() const {
+    return static_cast<int>(_models.size());
+}
+
+int AnimationBatch::getLODCount(AnimationLOD lod) const {
+    return _lodCounts[static_cast<int>(lod)];
+}
+
+} // namespace scene
+
+} // namespace reone
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "scenenodeanimator.h"
+
+namespace reone {
+
+namespace scene {
+
+class ModelSceneNode;
+
+/**
+ * Updates animations of many models, e.g. of all rooms and objects in an
+ * area.
+ *
+ * Models are partitioned into contiguous batches, one per thread. All but
+ * the first batch are updated on JobExecutor workers, the first one on the
+ * calling thread. Updating a model only modifies its own scene nodes and
+ * those of its attachments, so the result does not depend on the number of
+ * threads. Attached models must not be added to the batch.
+ */
+class AnimationBatch {
+public:
+    AnimationBatch() = default;
+
+    void add(ModelSceneNode *model);
+    void clear();
+
+    /**
+     * Updates all models and waits for them to finish. If updating a model
+     * throws, the exception is rethrown once all batches are finished.
+     *
+     * @param threadCount number of threads to update models on, 1 to only use the calling thread
+     */
+    void run(float dt, int threadCount = 1);
+
+    int count() const;
+
+    /**
+     * @return number of visible models updated at the specified LOD by the last run
+     */
+    int getLODCount(AnimationLOD lod) const;
+
+private:
+    static const int kLODCount = 4;
+
+    std::vector<ModelSceneNode *> _models;
+    int _lodCounts[kLODCount] { 0 };
+
+    AnimationBatch(const AnimationBatch &) = delete;
+    AnimationBatch &operator=(const AnimationBatch &) = delete;
+
+    void updateModels(int begin, int end, float dt);
+    void countLODs();
+};
+
+} // namespace scene
+
+} // namespace reone
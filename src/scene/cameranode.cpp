@@ -65,20 +65,19 @@ bool CameraSceneNode::isInFrustum(const glm::vec3 &point) const {
 }
 
 bool CameraSceneNode::isInFrustum(const AABB &aabb) const {
-    glm::vec3 center(aabb.center());
-    glm::vec3 halfSize(aabb.size() * 0.5f);
+    const glm::vec3 &min = aabb.min();
+    const glm::vec3 &max = aabb.max();
 
+    // A box is outside of a plane if its corner farthest along the normal is behind the plane
     for (int i = 0; i < kFrustumPlaneCount; ++i) {
-        if (glm::dot(_frustum[i], glm::vec4(center.x - halfSize.x, center.y - halfSize.y, center.z - halfSize.z, 1.0f)) >= 0.0f) continue;
-        if (glm::dot(_frustum[i], glm::vec4(center.x + halfSize.x, center.y - halfSize.y, center.z - halfSize.z, 1.0f)) >= 0.0f) continue;
-        if (glm::dot(_frustum[i], glm::vec4(center.x - halfSize.x, center.y + halfSize.y, center.z - halfSize.z, 1.0f)) >= 0.0f) continue;
-        if (glm::dot(_frustum[i], glm::vec4(center.x - halfSize.x, center.y - halfSize.y, center.z + halfSize.z, 1.0f)) >= 0.0f) continue;
-        if (glm::dot(_frustum[i], glm::vec4(center.x + halfSize.x, center.y + halfSize.y, center.z - halfSize.z, 1.0f)) >= 0.0f) continue;
-        if (glm::dot(_frustum[i], glm::vec4(center.x + halfSize.x, center.y - halfSize.y, center.z + halfSize.z, 1.0f)) >= 0.0f) continue;
-        if (glm::dot(_frustum[i], glm::vec4(center.x - halfSize.x, center.y + halfSize.y, center.z + halfSize.z, 1.0f)) >= 0.0f) continue;
-        if (glm::dot(_frustum[i], glm::vec4(center.x + halfSize.x, center.y + halfSize.y, center.z + halfSize.z, 1.0f)) >= 0.0f) continue;
-
-        return false;
+        const glm::vec4 &plane = _frustum[i];
+        glm::vec4 corner(
+            plane.x >= 0.0f ? max.x : min.x,
+            plane.y >= 0.0f ? max.y : min.y,
+            plane.z >= 0.0f ? max.z : min.z,
+            1.0f);
+
+        if (glm::dot(plane, corner) < 0.0f) return false;
     }
 
     return true;
@@ -92,6 +91,10 @@ const glm::mat4 &CameraSceneNode::view() const {
     return _view;
 }
 
+const glm::vec4 *CameraSceneNode::frustum() const {
+    return _frustum;
+}
+
 void CameraSceneNode::setProjection(const glm::mat4 &projection) {
     _projection = projection;
     updateFrustum();
@@ -37,6 +37,11 @@ public:
     const glm::mat4 &projection() const;
     const glm::mat4 &view() const;
 
+    /**
+     * @return kFrustumPlaneCount normalized planes, with normals pointing inside the frustum
+     */
+    const glm::vec4 *frustum() const;
+
     void setProjection(const glm::mat4 &projection);
 
 private:
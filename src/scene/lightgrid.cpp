@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "lightgrid.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "glm/gtx/norm.hpp"
+
+#include "lightnode.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace scene {
+
+static const float kMinCellSize = 4.0f;
+static const int kMaxCellsPerAxis = 128;
+
+// Guards cell assignment against rounding in distance tests
+static const float kRadiusMargin = 0.01f;
+
+void LightGrid::clear() {
+    _lights.clear();
+    _cellStarts.clear();
+    _cellLights.clear();
+    _width = 0;
+    _height = 0;
+}
+
+void LightGrid::build(const vector<LightSceneNode *> &lights) {
+    clear();
+    if (lights.empty()) return;
+
+    glm::vec2 min(numeric_limits<float>::max());
+    glm::vec2 max(numeric_limits<float>::lowest());
+    float radiusSum = 0.0f;
+
+    _lights.reserve(lights.size());
+
+    for (auto &sceneNode : lights) {
+        Light light;
+        light.sceneNode = sceneNode;
+        light.position = sceneNode->absoluteTransform()[3];
+        light.radius = sceneNode->radius();
+        light.priority = sceneNode->priority();
+        _lights.push_back(light);
+
+        float extent = light.radius + kRadiusMargin;
+        min = glm::min(min, glm::vec2(light.position) - extent);
+        max = glm::max(max, glm::vec2(light.position) + extent);
+        radiusSum += light.radius;
+    }
+
+    // Cells are about the size of an average light, unless there would be too many of them
+    glm::vec2 size(max - min);
+    _cellSize = glm::max(kMinCellSize, 2.0f * radiusSum / _lights.size());
+    _cellSize = glm::max(_cellSize, glm::max(size.x, size.y) / kMaxCellsPerAxis);
+    _min = min;
+    _width = glm::clamp(static_cast<int>(size.x / _cellSize) + 1, 1, kMaxCellsPerAxis);
+    _height = glm::clamp(static_cast<int>(size.y / _cellSize) + 1, 1, kMaxCellsPerAxis);
+
+    // Count lights per cell, then fill cells in the order of lights
+
+    _cellStarts.assign(_width * _height + 1, 0);
+
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int i = 0; i < static_cast<int>(_lights.size()); ++i) {
+            const Light &light = _lights[i];
+            float extent = light.radius + kRadiusMargin;
+            int minX = getCellX(light.position.x - extent);
+            int maxX = getCellX(light.position.x + extent);
+            int minY = getCellY(light.position.y - extent);
+            int maxY = getCellY(light.position.y + extent);
+
+            for (int y = minY; y <= maxY; ++y) {
+                for (int x = minX; x <= maxX; ++x) {
+                    int cell = y * _width + x;
+                    if (pass == 0) {
+                        ++_cellStarts[cell + 1];
+                    } else {
+                        _cellLights[_cellStarts[cell]++] = i;
+                    }
+                }
+            }
+        }
+        if (pass == 0) {
+            for (int cell = 0; cell < _width * _height; ++cell) {
+                _cellStarts[cell + 1] += _cellStarts[cell];
+            }
+            _cellLights.resize(_cellStarts.back());
+        } else {
+            // Filling advanced each start to the start of the next cell
+            for (int cell = _width * _height; cell > 0; --cell) {
+                _cellStarts[cell] = _cellStarts[cell - 1];
+            }
+            _cellStarts[0] = 0;
+        }
+    }
+}
+
+int LightGrid::getCellX(float x) const {
+    return static_cast<int>(glm::clamp((x - _min.x) / _cellSize, 0.0f, static_cast<float>(_width - 1)));
+}
+
+int LightGrid::getCellY(float y) const {
+    return static_cast<int>(glm::clamp((y - _min.y) / _cellSize, 0.0f, static_cast<float>(_height - 1)));
+}
+
+void LightGrid::getLightsAt(const glm::vec3 &point, int count, vector<LightSceneNode *> &lights) const {
+    lights.clear();
+    if (_lights.empty()) return;
+
+    int cell = getCellY(point.y) * _width + getCellX(point.x);
+    _candidates.clear();
+
+    for (int i = _cellStarts[cell]; i < _cellStarts[cell + 1]; ++i) {
+        const Light &light = _lights[_cellLights[i]];
+        float distance = glm::distance2(light.position, point);
+        if (distance > light.radius * light.radius) continue;
+
+        _candidates.push_back(make_pair(_cellLights[i], distance));
+    }
+
+    sort(_candidates.begin(), _candidates.end(), [this](auto &left, auto &right) {
+        int leftPriority = _lights[left.first].priority;
+        int rightPriority = _lights[right.first].priority;
+
+        if (leftPriority < rightPriority) return true;
+        if (leftPriority > rightPriority) return false;
+
+        return left.second < right.second;
+    });
+
+    int lightCount = min(count, static_cast<int>(_candidates.size()));
+    for (int i = 0; i < lightCount; ++i) {
+        lights.push_back(_lights[_candidates[i].first].sceneNode);
+    }
+}
+
+int LightGrid::cellCount() const {
+    return _width * _height;
+}
+
+} // namespace scene
+
+} // namespace reone
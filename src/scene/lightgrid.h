@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "glm/glm.hpp"
+
+namespace reone {
+
+namespace scene {
+
+class LightSceneNode;
+
+/**
+ * Uniform grid of light spheres in the XY plane. Each light is assigned to
+ * the cells overlapped by its bounding square, so that lights affecting a
+ * point are found by scanning a single cell.
+ */
+class LightGrid {
+public:
+    void clear();
+
+    /**
+     * Rebuilds the grid from the current positions of the specified lights.
+     */
+    void build(const std::vector<LightSceneNode *> &lights);
+
+    /**
+     * Finds lights whose radius contains the point. Lights are ordered by
+     * priority, then by distance to the point, the same way as when all
+     * lights are sorted in the order they were passed to build.
+     *
+     * @param count maximum number of lights to return
+     */
+    void getLightsAt(const glm::vec3 &point, int count, std::vector<LightSceneNode *> &lights) const;
+
+    int cellCount() const;
+
+private:
+    struct Light {
+        LightSceneNode *sceneNode { nullptr };
+        glm::vec3 position { 0.0f };
+        float radius { 0.0f };
+        int priority { 0 };
+    };
+
+    std::vector<Light> _lights;
+    glm::vec2 _min { 0.0f };
+    float _cellSize { 1.0f };
+    int _width { 0 };
+    int _height { 0 };
+    std::vector<int> _cellStarts; /**< offsets into _cellLights, one past the last cell included */
+    std::vector<int> _cellLights; /**< light indices in ascending order per cell */
+    mutable std::vector<std::pair<int, float>> _candidates; /**< light indices and squared distances */
+
+    int getCellX(float x) const;
+    int getCellY(float y) const;
+};
+
+} // namespace scene
+
+} // namespace reone
@@ -57,19 +57,45 @@ bool ModelNodeSceneNode::isTransparent() const {
     return mesh->isTransparent() || _modelNode->alpha() < 1.0f;
 }
 
-void ModelNodeSceneNode::renderSingle() const {
-    shared_ptr<ModelMesh> mesh(_modelNode->mesh());
-    if (!mesh) return;
+void ModelNodeSceneNode::getDrawItem(DrawItem &item) const {
+    const ModelMesh &mesh = *_modelNode->mesh();
+
+    item.program = ShaderProgram::ModelModel;
+    item.textures[0] = _modelSceneNode->hasTextureOverride() ? _modelSceneNode->textureOverride().get() : mesh.diffuseTexture().get();
+    item.textures[1] = mesh.envmapTexture().get();
+    item.textures[2] = mesh.lightmapTexture().get();
+    item.textures[3] = mesh.bumpyShinyTexture().get();
+    item.textures[4] = mesh.bumpmapTexture().get();
+    item.mesh = &mesh;
+    item.drawable = this;
+    item.transparency = mesh.transparency();
+    item.transform = _absoluteTransform;
+    item.alpha = _modelSceneNode->alpha() * _modelNode->alpha();
+
+    // Skinned and animated meshes are drawn one at a time
+    bool instanced = !_modelNode->skin() && _modelSceneNode->model()->isNodeStatic(*_modelNode);
+    item.instanceState = instanced ? _modelSceneNode->instanceState() : 0;
+}
 
-    bool render = mesh->shouldRender() && (mesh->hasDiffuseTexture() || _modelSceneNode->hasTextureOverride());
-    if (!render) return;
+void ModelNodeSceneNode::draw() const {
+    _modelNode->mesh()->draw(_modelSceneNode->textureOverride());
+}
+
+void ModelNodeSceneNode::drawInstanced(int count) const {
+    _modelNode->mesh()->drawInstanced(count, _modelSceneNode->textureOverride());
+}
 
+void ModelNodeSceneNode::getUniforms(LocalUniforms &locals, bool instanced) const {
+    shared_ptr<ModelMesh> mesh(_modelNode->mesh());
     shared_ptr<ModelNode::Skin> skin(_modelNode->skin());
     bool skeletal = static_cast<bool>(skin);
 
-    LocalUniforms locals;
-    locals.model = _absoluteTransform;
-    locals.alpha = _modelSceneNode->alpha() * _modelNode->alpha();
+    if (instanced) {
+        locals.features.instancingEnabled = true;
+    } else {
+        locals.model = _absoluteTransform;
+        locals.alpha = _modelSceneNode->alpha() * _modelNode->alpha();
+    }
 
     if (mesh->hasEnvmapTexture()) {
         locals.features.envmapEnabled = true;
@@ -92,20 +118,10 @@ void ModelNodeSceneNode::renderSingle() const {
         locals.skeletal.absTransform = _modelNode->absoluteTransform();
         locals.skeletal.absTransformInv = _modelNode->absoluteTransformInverse();
 
-        const unordered_map<uint16_t, uint16_t> &nodeIdxByBoneIdx = skin->nodeIdxByBoneIdx;
-        vector<glm::mat4> bones(nodeIdxByBoneIdx.size(), glm::mat4(1.0f));
-
-        for (auto &pair : nodeIdxByBoneIdx) {
-            uint16_t boneIdx = pair.first;
-            uint16_t nodeIdx = pair.second;
-
-            ModelNodeSceneNode *bone = _modelSceneNode->getModelNodeByIndex(nodeIdx);
-            if (bone) {
-                bones[boneIdx] = bone->boneTransform();
-            }
+        if (_bonePalette) {
+            locals.skeletal.bones = &_bonePalette->bones;
+            locals.skeletal.bonesRevision = _bonePalette->revision;
         }
-
-        locals.skeletal.bones = move(bones);
     }
     if (_modelNode->isSelfIllumEnabled()) {
         locals.features.selfIllumEnabled = true;
@@ -129,9 +145,10 @@ void ModelNodeSceneNode::renderSingle() const {
             locals.lighting.lights.push_back(move(shaderLight));
         }
     }
-    Shaders::instance().activate(ShaderProgram::ModelModel, locals);
+}
 
-    mesh->render(_modelSceneNode->textureOverride());
+bool ModelNodeSceneNode::isBatched() const {
+    return _batched;
 }
 
 float ModelNodeSceneNode::getDistanceFromCenter(const glm::vec3 &point) const {
@@ -151,10 +168,22 @@ const glm::mat4 &ModelNodeSceneNode::boneTransform() const {
     return _boneTransform;
 }
 
+const BonePalette *ModelNodeSceneNode::bonePalette() const {
+    return _bonePalette;
+}
+
 void ModelNodeSceneNode::setBoneTransform(const glm::mat4 &transform) {
     _boneTransform = transform;
 }
 
+void ModelNodeSceneNode::setBonePalette(const BonePalette *palette) {
+    _bonePalette = palette;
+}
+
+void ModelNodeSceneNode::setBatched(bool batched) {
+    _batched = batched;
+}
+
 } // namespace scene
 
 } // namespace reone
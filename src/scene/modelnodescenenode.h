@@ -17,9 +17,12 @@
 
 #pragma once
 
+#include <vector>
+
 #include "scenenode.h"
 
 #include "../render/model/model.h"
+#include "../render/renderqueue.h"
 
 namespace reone {
 
@@ -32,28 +35,56 @@ namespace scene {
 
 class ModelSceneNode;
 
-class ModelNodeSceneNode : public SceneNode {
+/**
+ * Bone transforms of a model for one skin, shared by all meshes of the model
+ * with that skin.
+ */
+struct BonePalette {
+    const render::ModelNode::Skin *skin { nullptr };
+    std::vector<glm::mat4> bones;
+    uint32_t revision { 0 }; /**< unique among all palettes, changes whenever bones change */
+};
+
+class ModelNodeSceneNode : public SceneNode, public render::IDrawable {
 public:
     ModelNodeSceneNode(SceneGraph *sceneGraph, const ModelSceneNode *modelSceneNode, render::ModelNode *modelNode);
 
-    void renderSingle() const;
+    void getUniforms(render::LocalUniforms &locals, bool instanced) const override;
+    void draw() const override;
+    void drawInstanced(int count) const override;
+
+    /**
+     * Fills the draw item of this node for the render queue. Must only be
+     * called when this node should render.
+     */
+    void getDrawItem(render::DrawItem &item) const;
 
     float getDistanceFromCenter(const glm::vec3 &point) const;
 
     bool shouldRender() const;
     bool isTransparent() const;
 
+    /**
+     * @return true if the mesh of this node is merged into static geometry
+     */
+    bool isBatched() const;
+
     const ModelSceneNode *modelSceneNode() const;
     render::ModelNode *modelNode() const;
     const glm::mat4 &boneTransform() const;
+    const BonePalette *bonePalette() const;
 
     void setBoneTransform(const glm::mat4 &transform);
+    void setBonePalette(const BonePalette *palette);
+    void setBatched(bool batched);
 
 private:
     const ModelSceneNode *_modelSceneNode { nullptr };
     render::ModelNode *_modelNode { nullptr };
     glm::mat4 _animTransform { 1.0f };
     glm::mat4 _boneTransform { 1.0f };
+    const BonePalette *_bonePalette { nullptr };
+    bool _batched { false };
 };
 
 } // namespace scene
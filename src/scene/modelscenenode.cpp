@@ -15,6 +15,8 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <atomic>
 #include <stack>
 #include <stdexcept>
 
@@ -57,7 +59,10 @@ void ModelSceneNode::initModelNodes() {
         nodes.pop();
 
         ModelNode *modelNode = sceneNode->modelNode();
-        _modelNodeByIndex.insert(make_pair(modelNode->index(), sceneNode));
+        if (static_cast<int>(_modelNodeByIndex.size()) <= modelNode->index()) {
+            _modelNodeByIndex.resize(modelNode->index() + 1, nullptr);
+        }
+        _modelNodeByIndex[modelNode->index()] = sceneNode;
         _modelNodeByNumber.insert(make_pair(modelNode->nodeNumber(), sceneNode));
 
         for (auto &child : modelNode->children()) {
@@ -69,9 +74,100 @@ void ModelSceneNode::initModelNodes() {
             if (light) {
                 shared_ptr<LightSceneNode> lightNode(new LightSceneNode(_sceneGraph, light->priority, child->color(), child->radius()));
                 childNode->addChild(lightNode);
+                _lights.push_back(lightNode.get());
             }
         }
     }
+
+    refreshMeshes();
+    initBonePalettes();
+}
+
+void ModelSceneNode::initBonePalettes() {
+    _bonePalettes.clear();
+
+    for (auto &node : _modelNodeByIndex) {
+        if (!node) continue;
+
+        const ModelNode::Skin *skin = node->modelNode()->skin().get();
+        if (!skin) continue;
+
+        auto maybePalette = find_if(_bonePalettes.begin(), _bonePalettes.end(), [&skin](auto &palette) { return palette.skin == skin; });
+        if (maybePalette == _bonePalettes.end()) {
+            BonePalette palette;
+            palette.skin = skin;
+            palette.bones.resize(skin->nodeIdxByBoneIdx.size(), glm::mat4(1.0f));
+            _bonePalettes.push_back(move(palette));
+        }
+    }
+
+    // Palettes are not reallocated past this point
+    for (auto &node : _modelNodeByIndex) {
+        if (!node) continue;
+
+        const ModelNode::Skin *skin = node->modelNode()->skin().get();
+        if (!skin) continue;
+
+        auto palette = find_if(_bonePalettes.begin(), _bonePalettes.end(), [&skin](auto &palette) { return palette.skin == skin; });
+        node->setBonePalette(&*palette);
+    }
+
+    updateBonePalettes();
+}
+
+static uint32_t getNextBonePaletteRevision() {
+    // Models are updated concurrently by AnimationBatch
+    static atomic<uint32_t> nextRevision { 1 };
+
+    // Zero means unknown revision to Shaders
+    uint32_t revision = nextRevision.fetch_add(1);
+    if (revision == 0) {
+        revision = nextRevision.fetch_add(1);
+    }
+    return revision;
+}
+
+void ModelSceneNode::updateBonePalettes() {
+    for (auto &palette : _bonePalettes) {
+        const vector<uint16_t> &nodeIdxByBoneIdx = palette.skin->nodeIdxByBoneIdx;
+
+        for (size_t i = 0; i < nodeIdxByBoneIdx.size(); ++i) {
+            ModelNodeSceneNode *bone = nodeIdxByBoneIdx[i] != kNoBoneNode ? getModelNodeByIndex(nodeIdxByBoneIdx[i]) : nullptr;
+            palette.bones[i] = bone ? bone->boneTransform() : glm::mat4(1.0f);
+        }
+        palette.revision = getNextBonePaletteRevision();
+        ++_bonePalettesBuilt;
+    }
+}
+
+void ModelSceneNode::refreshMeshes() {
+    _opaqueMeshes.clear();
+    _transparentMeshes.clear();
+
+    for (auto &node : _modelNodeByIndex) {
+        if (!node || !node->shouldRender() || node->isBatched()) continue;
+
+        if (node->isTransparent()) {
+            _transparentMeshes.push_back(node);
+        } else {
+            _opaqueMeshes.push_back(node);
+        }
+    }
+}
+
+void ModelSceneNode::setMeshesBatched(const vector<ModelNodeSceneNode *> &meshes) {
+    for (auto &mesh : meshes) {
+        mesh->setBatched(true);
+    }
+    refreshMeshes();
+}
+
+void ModelSceneNode::refreshAttachedModels() {
+    _attachedModelList.clear();
+
+    for (auto &attached : _attachedModels) {
+        _attachedModelList.push_back(attached.second.get());
+    }
 }
 
 unique_ptr<ModelNodeSceneNode> ModelSceneNode::getModelNodeSceneNode(ModelNode &node) const {
@@ -81,9 +177,13 @@ unique_ptr<ModelNodeSceneNode> ModelSceneNode::getModelNodeSceneNode(ModelNode &
 }
 
 void ModelSceneNode::update(float dt) {
-    if (!_visible || !_onScreen) return;
+    _bonePalettesBuilt = 0;
 
-    _animator.update(dt);
+    if (!_visible) return;
+
+    if (_animator.update(dt, animationLOD(), _animationSkipNodes)) {
+        updateBonePalettes();
+    }
 
     for (auto &attached : _attachedModels) {
         attached.second->update(dt);
@@ -133,8 +233,11 @@ shared_ptr<ModelSceneNode> ModelSceneNode::attach(const string &parent, const sh
         parentNode->addChild(modelNode);
 
         auto inserted = _attachedModels.insert(make_pair(parentNumber, move(modelNode)));
+        refreshAttachedModels();
+
         return inserted.first->second;
     }
+    refreshAttachedModels();
 
     return nullptr;
 }
@@ -150,10 +253,9 @@ ModelNodeSceneNode *ModelSceneNode::getModelNode(const string &name) const {
 }
 
 ModelNodeSceneNode *ModelSceneNode::getModelNodeByIndex(int index) const {
-    auto maybeNode = _modelNodeByIndex.find(index);
-    if (maybeNode == _modelNodeByIndex.end()) return nullptr;
+    if (index < 0 || index >= static_cast<int>(_modelNodeByIndex.size())) return nullptr;
 
-    return maybeNode->second;
+    return _modelNodeByIndex[index];
 }
 
 void ModelSceneNode::attach(const string &parent, const shared_ptr<SceneNode> &node) {
@@ -244,6 +346,26 @@ const AABB &ModelSceneNode::aabb() const {
     return _model->aabb();
 }
 
+const vector<ModelNodeSceneNode *> &ModelSceneNode::opaqueMeshes() const {
+    return _opaqueMeshes;
+}
+
+const vector<ModelNodeSceneNode *> &ModelSceneNode::transparentMeshes() const {
+    return _transparentMeshes;
+}
+
+const vector<LightSceneNode *> &ModelSceneNode::lights() const {
+    return _lights;
+}
+
+const vector<ModelSceneNode *> &ModelSceneNode::attachedModels() const {
+    return _attachedModelList;
+}
+
+int ModelSceneNode::bonePalettesBuilt() const {
+    return _bonePalettesBuilt;
+}
+
 bool ModelSceneNode::isLightingEnabled() const {
     return _lightingEnabled;
 }
@@ -265,12 +387,16 @@ void ModelSceneNode::setModel(const shared_ptr<Model> &model) {
     _modelNodeByIndex.clear();
     _modelNodeByNumber.clear();
     _attachedModels.clear();
+    _attachedModelList.clear();
+    _lights.clear();
+    _bonePalettes.clear();
 
     initModelNodes();
 }
 
 void ModelSceneNode::setTextureOverride(const shared_ptr<Texture> &texture) {
     _textureOverride = texture;
+    refreshMeshes();
 }
 
 void ModelSceneNode::setVisible(bool visible) {
@@ -306,6 +432,10 @@ bool ModelSceneNode::isAnimationFinished() const {
     return _model ? _animator.isAnimationFinished() : false;
 }
 
+AnimationLOD ModelSceneNode::animationLOD() const {
+    return _onScreen ? _animationLOD : AnimationLOD::TimeOnly;
+}
+
 void ModelSceneNode::setDefaultAnimation(const string &name) {
     _animator.setDefaultAnimation(name);
 
@@ -314,6 +444,15 @@ void ModelSceneNode::setDefaultAnimation(const string &name) {
     }
 }
 
+void ModelSceneNode::setAnimationLOD(AnimationLOD lod, bool skipNodes) {
+    _animationLOD = lod;
+    _animationSkipNodes = skipNodes;
+
+    for (auto &attached : _attachedModels) {
+        attached.second->setAnimationLOD(lod, skipNodes);
+    }
+}
+
 void ModelSceneNode::setLightingEnabled(bool enabled) {
     _lightingEnabled = enabled;
 }
@@ -322,6 +461,14 @@ void ModelSceneNode::setLightsAffectedBy(const vector<LightSceneNode *> &lights)
     _lightsAffectedBy = lights;
 }
 
+uint32_t ModelSceneNode::instanceState() const {
+    return _instanceState;
+}
+
+void ModelSceneNode::setInstanceState(uint32_t state) {
+    _instanceState = state;
+}
+
 } // namespace scene
 
 } // namespace reone
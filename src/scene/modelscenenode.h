@@ -24,6 +24,7 @@
 #include "../render/model/model.h"
 #include "../render/shaders.h"
 
+#include "modelnodescenenode.h"
 #include "scenenode.h"
 #include "scenenodeanimator.h"
 
@@ -71,10 +72,43 @@ public:
 
     bool isAnimationFinished() const;
 
+    /**
+     * @return LOD at which the animation is updated, TimeOnly if the model is off-screen
+     */
+    AnimationLOD animationLOD() const;
+
     void setDefaultAnimation(const std::string &name);
+    void setAnimationLOD(AnimationLOD lod, bool skipNodes = false);
 
     // END Animation
 
+    // Render lists
+
+    /**
+     * @return opaque meshes of this model that should be rendered, excluding attached models
+     */
+    const std::vector<ModelNodeSceneNode *> &opaqueMeshes() const;
+
+    /**
+     * @return transparent meshes of this model that should be rendered, excluding attached models
+     */
+    const std::vector<ModelNodeSceneNode *> &transparentMeshes() const;
+
+    const std::vector<LightSceneNode *> &lights() const;
+    const std::vector<ModelSceneNode *> &attachedModels() const;
+
+    /**
+     * Excludes meshes, merged into static geometry, from the render lists.
+     */
+    void setMeshesBatched(const std::vector<ModelNodeSceneNode *> &meshes);
+
+    // END Render lists
+
+    /**
+     * @return number of bone palettes built during the last update
+     */
+    int bonePalettesBuilt() const;
+
     // Dynamic lighting
 
     void updateLighting();
@@ -88,22 +122,42 @@ public:
 
     // END Dynamic lighting
 
+    /**
+     * @return state shared by models whose meshes can be drawn as instances of one another, zero if none
+     */
+    uint32_t instanceState() const;
+
+    void setInstanceState(uint32_t state);
+
 private:
     std::shared_ptr<render::Model> _model;
     SceneNodeAnimator _animator;
-    std::unordered_map<uint16_t, ModelNodeSceneNode *> _modelNodeByIndex;
+    std::vector<ModelNodeSceneNode *> _modelNodeByIndex;
     std::unordered_map<uint16_t, ModelNodeSceneNode *> _modelNodeByNumber;
     std::unordered_map<uint16_t, std::shared_ptr<ModelSceneNode>> _attachedModels;
+    std::vector<ModelNodeSceneNode *> _opaqueMeshes;
+    std::vector<ModelNodeSceneNode *> _transparentMeshes;
+    std::vector<LightSceneNode *> _lights;
+    std::vector<ModelSceneNode *> _attachedModelList;
+    std::vector<BonePalette> _bonePalettes;
+    int _bonePalettesBuilt { 0 };
     std::shared_ptr<render::Texture> _textureOverride;
     bool _visible { true };
     bool _onScreen { true };
     float _alpha { 1.0f };
+    AnimationLOD _animationLOD { AnimationLOD::Full };
+    bool _animationSkipNodes { false };
     bool _drawAABB { false };
     bool _lightingEnabled { false };
     std::vector<LightSceneNode *> _lightsAffectedBy;
     bool _lightingDirty { true };
+    uint32_t _instanceState { 0 };
 
     void initModelNodes();
+    void refreshMeshes();
+    void initBonePalettes();
+    void updateBonePalettes();
+    void refreshAttachedModels();
     std::unique_ptr<ModelNodeSceneNode> getModelNodeSceneNode(render::ModelNode &node) const;
     void updateAbsoluteTransform() override;
 };
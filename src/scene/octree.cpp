@@ -18,7 +18,6 @@
 #include "octree.h"
 
 #include <algorithm>
-#include <stdexcept>
 #include <stack>
 
 #include "cameranode.h"
@@ -32,158 +31,218 @@ namespace reone {
 namespace scene {
 
 static const float kMinNodeSize = 8.0f;
+static const float kBoundsMargin = 8.0f;
 
-OctreeNode::OctreeNode(OctreeNode *parent, AABB aabb) : _parent(parent), _aabb(move(aabb)) {
-    computeQuadrantsAABB();
+static bool contains(const AABB &outer, const AABB &inner) {
+    return outer.contains(inner.min()) && outer.contains(inner.max());
 }
 
-void OctreeNode::computeQuadrantsAABB() {
-    _bottomLeftAabb = AABB(
-        glm::vec3(_aabb.min().x, _aabb.center().y, _aabb.min().z),
-        glm::vec3(_aabb.center().x, _aabb.max().y, _aabb.max().z));
-
-    _bottomRightAabb = AABB(
-        glm::vec3(_aabb.center().x, _aabb.center().y, _aabb.min().z),
-        glm::vec3(_aabb.max().x, _aabb.max().y, _aabb.max().z));
+OctreeNode::OctreeNode(OctreeNode *parent, AABB aabb) : _parent(parent), _aabb(move(aabb)) {
+    computeChildrenAABB();
+}
 
-    _topLeftAabb = AABB(
-        glm::vec3(_aabb.min().x, _aabb.min().y, _aabb.min().z),
-        glm::vec3(_aabb.center().x, _aabb.center().y, _aabb.max().z));
+void OctreeNode::computeChildrenAABB() {
+    const glm::vec3 &min = _aabb.min();
+    const glm::vec3 &max = _aabb.max();
+    const glm::vec3 &center = _aabb.center();
 
-    _topRightAabb = AABB(
-        glm::vec3(_aabb.center().x, _aabb.min().y, _aabb.min().z),
-        glm::vec3(_aabb.max().x, _aabb.center().y, _aabb.max().z));
+    _childAabbs[0] = AABB(glm::vec3(min.x, min.y, min.z), glm::vec3(center.x, center.y, max.z));
+    _childAabbs[1] = AABB(glm::vec3(center.x, min.y, min.z), glm::vec3(max.x, center.y, max.z));
+    _childAabbs[2] = AABB(glm::vec3(min.x, center.y, min.z), glm::vec3(center.x, max.y, max.z));
+    _childAabbs[3] = AABB(glm::vec3(center.x, center.y, min.z), glm::vec3(max.x, max.y, max.z));
 }
 
 void OctreeNode::add(OctreeObject *object) {
-    if (isLeaf()) {
-        object->nodes.insert(this);
-        _objects.insert(object);
-        return;
-    }
-    if (isObjectIn(object, Quadrant::BottomLeft)) {
-        if (!_bottomLeft) {
-            _bottomLeft = make_unique<OctreeNode>(this, _bottomLeftAabb);
-        }
-        _bottomLeft->add(object);
-    }
-    if (isObjectIn(object, Quadrant::BottomRight)) {
-        if (!_bottomRight) {
-            _bottomRight = make_unique<OctreeNode>(this, _bottomRightAabb);
+    ++_objectCount;
+
+    if (!isLeaf()) {
+        for (int i = 0; i < kChildCount; ++i) {
+            if (!contains(_childAabbs[i], object->aabb)) continue;
+
+            if (!_children[i]) {
+                _children[i] = make_unique<OctreeNode>(this, _childAabbs[i]);
+            }
+            _children[i]->add(object);
+            return;
         }
-        _bottomRight->add(object);
     }
-    if (isObjectIn(object, Quadrant::TopLeft)) {
-        if (!_topLeft) {
-            _topLeft = make_unique<OctreeNode>(this, _topLeftAabb);
-        }
-        _topLeft->add(object);
+    object->node = this;
+    _objects.push_back(object);
+}
+
+void OctreeNode::remove(OctreeObject *object) {
+    auto maybeObject = find(_objects.begin(), _objects.end(), object);
+    if (maybeObject == _objects.end()) return;
+
+    *maybeObject = _objects.back();
+    _objects.pop_back();
+    object->node = nullptr;
+
+    for (OctreeNode *node = this; node; node = node->_parent) {
+        --node->_objectCount;
     }
-    if (isObjectIn(object, Quadrant::TopRight)) {
-        if (!_topRight) {
-            _topRight = make_unique<OctreeNode>(this, _topRightAabb);
-        }
-        _topRight->add(object);
+}
+
+bool OctreeNode::isBestFit(const AABB &aabb) const {
+    if (!contains(_aabb, aabb)) return false;
+    if (isLeaf()) return true;
+
+    for (int i = 0; i < kChildCount; ++i) {
+        if (contains(_childAabbs[i], aabb)) return false;
     }
+
+    return true;
 }
 
 bool OctreeNode::isLeaf() const {
     return glm::length(glm::vec2(_aabb.max() - _aabb.min())) < kMinNodeSize;
 }
 
-bool OctreeNode::isObjectIn(OctreeObject *object, Quadrant quadrant) const {
-    const AABB *aabb;
-    switch (quadrant) {
-        case Quadrant::BottomLeft:
-            aabb = &_bottomLeftAabb;
-            break;
-        case Quadrant::BottomRight:
-            aabb = &_bottomRightAabb;
-            break;
-        case Quadrant::TopLeft:
-            aabb = &_topLeftAabb;
-            break;
-        case Quadrant::TopRight:
-            aabb = &_topRightAabb;
-            break;
-        default:
-            throw invalid_argument("Invalid quadrant");
-    }
-    return aabb->intersect(object->aabb);
-}
-
 void Octree::clear() {
     _root.reset();
     _objects.clear();
-}
-
-void Octree::registerObject(OctreeObject object) {
-    _objects.insert(make_pair(object.sceneNode, move(object)));
+    _rebuild = false;
 }
 
 void Octree::build() {
     AABB aabb;
     for (auto &object : _objects) {
-        aabb.expand(object.second.aabb);
+        object.second->node = nullptr;
+        aabb.expand(object.second->aabb);
+    }
+    _rebuild = false;
+
+    if (_objects.empty()) {
+        _root.reset();
+        return;
     }
-    _root = make_unique<OctreeNode>(nullptr, aabb);
+
+    // Leave room for moving objects, so that they can be updated incrementally
+    glm::vec3 margin(kBoundsMargin);
+    _root = make_unique<OctreeNode>(nullptr, AABB(aabb.min() - margin, aabb.max() + margin));
 
     for (auto &object : _objects) {
-        _root->add(&object.second);
+        _root->add(object.second.get());
     }
 }
 
-vector<SceneNode *> Octree::getNodesInFrustum(const CameraSceneNode *camera) const {
-    stack<OctreeNode *> nodes;
+void Octree::registerObject(SceneNode *sceneNode, const AABB &aabb) {
+    if (_objects.count(sceneNode) > 0) {
+        updateObject(sceneNode, aabb);
+        return;
+    }
+    auto object = make_unique<OctreeObject>();
+    object->sceneNode = sceneNode;
+    object->aabb = aabb;
+
+    if (isInBounds(aabb)) {
+        _root->add(object.get());
+    } else {
+        _rebuild = true;
+    }
+    _objects.insert(make_pair(sceneNode, move(object)));
+}
+
+bool Octree::isInBounds(const AABB &aabb) const {
+    return _root && contains(_root->_aabb, aabb);
+}
+
+void Octree::updateObject(SceneNode *sceneNode, const AABB &aabb) {
+    auto maybeObject = _objects.find(sceneNode);
+    if (maybeObject == _objects.end()) return;
+
+    OctreeObject &object = *maybeObject->second;
+    if (object.aabb.min() == aabb.min() && object.aabb.max() == aabb.max()) return;
+
+    object.aabb = aabb;
+
+    // Most movements keep an object in the same node
+    if (object.node && object.node->isBestFit(aabb)) return;
+
+    if (object.node) {
+        object.node->remove(&object);
+    }
+    if (isInBounds(aabb)) {
+        _root->add(&object);
+    } else {
+        _rebuild = true;
+    }
+}
+
+void Octree::unregisterObject(SceneNode *sceneNode) {
+    auto maybeObject = _objects.find(sceneNode);
+    if (maybeObject == _objects.end()) return;
+
+    OctreeObject &object = *maybeObject->second;
+    if (object.node) {
+        object.node->remove(&object);
+    }
+    _objects.erase(maybeObject);
+}
+
+void Octree::getNodesInFrustum(const CameraSceneNode &camera, vector<SceneNode *> &sceneNodes, CullingStats &stats) const {
+    sceneNodes.clear();
+    _distances.clear();
+
+    if (!_root) return;
+
+    glm::vec3 cameraPosition(camera.absoluteTransform()[3]);
+
+    stack<const OctreeNode *> nodes;
     nodes.push(_root.get());
 
-    unordered_map<SceneNode *, float> cameraDistByNode;
     while (!nodes.empty()) {
-        OctreeNode *node = nodes.top();
+        const OctreeNode *node = nodes.top();
         nodes.pop();
 
-        if (!camera->isInFrustum(node->_aabb)) continue;
-
-        float dist = camera->distanceTo(node->_aabb.center());
-        if (!node->_objects.empty()) {
-            for (auto &object : node->_objects) {
-                auto maybeDistance = cameraDistByNode.find(object->sceneNode);
-                if (maybeDistance != cameraDistByNode.end()) {
-                    if (dist > maybeDistance->second) {
-                        cameraDistByNode[object->sceneNode] = dist;
-                    }
-                    continue;
-                }
-                cameraDistByNode.insert(make_pair(object->sceneNode, dist));
-            }
-        }
-        if (node->_bottomLeft) {
-            nodes.push(node->_bottomLeft.get());
+        ++stats.visitedNodes;
+
+        if (!camera.isInFrustum(node->_aabb)) {
+            ++stats.culledNodes;
+            stats.culledObjects += node->_objectCount;
+            continue;
         }
-        if (node->_bottomRight) {
-            nodes.push(node->_bottomRight.get());
+        // Objects of a node are tested against the frustum all at once
+        _objectBoxes.clear();
+        for (auto &object : node->_objects) {
+            _objectBoxes.add(object->aabb);
         }
-        if (node->_topLeft) {
-            nodes.push(node->_topLeft.get());
+        _objectBoxes.testPlanes(camera.frustum(), kFrustumPlaneCount, _objectsInFrustum);
+
+        for (size_t i = 0; i < node->_objects.size(); ++i) {
+            const OctreeObject *object = node->_objects[i];
+            ++stats.visitedObjects;
+
+            if (!_objectsInFrustum[i]) {
+                ++stats.culledObjects;
+                continue;
+            }
+            glm::vec3 closest(glm::clamp(cameraPosition, object->aabb.min(), object->aabb.max()));
+            glm::vec3 delta(closest - cameraPosition);
+            _distances.push_back(make_pair(object->sceneNode, glm::dot(delta, delta)));
         }
-        if (node->_topRight) {
-            nodes.push(node->_topRight.get());
+        for (int i = 0; i < OctreeNode::kChildCount; ++i) {
+            const OctreeNode *child = node->_children[i].get();
+            if (child && child->_objectCount > 0) {
+                nodes.push(child);
+            }
         }
     }
 
-    vector<pair<SceneNode *, float>> cameraDistances;
-    for (auto &pair : cameraDistByNode) {
-        cameraDistances.push_back(pair);
-    }
-    sort(cameraDistances.begin(), cameraDistances.end(), [](auto &left, auto &right) {
-        return left.second > right.second;
+    sort(_distances.begin(), _distances.end(), [](auto &left, auto &right) {
+        return left.second < right.second;
     });
-    vector<SceneNode *> result;
-    for (auto &pair : cameraDistances) {
-        result.push_back(pair.first);
+    for (auto &pair : _distances) {
+        sceneNodes.push_back(pair.first);
     }
+}
+
+bool Octree::needsRebuild() const {
+    return _rebuild;
+}
 
-    return move(result);
+int Octree::objectCount() const {
+    return static_cast<int>(_objects.size());
 }
 
 } // namespace scene
@@ -17,13 +17,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
-#include <string>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 #include "../render/aabb.h"
+#include "../render/aabbbatch.h"
 
 namespace reone {
 
@@ -36,7 +36,18 @@ class SceneNode;
 struct OctreeObject {
     SceneNode *sceneNode { nullptr };
     render::AABB aabb;
-    std::unordered_set<OctreeNode *> nodes;
+    OctreeNode *node { nullptr };
+};
+
+/**
+ * Per-query culling statistics.
+ */
+struct CullingStats {
+    int visitedNodes { 0 };
+    int visitedObjects { 0 };
+    int culledNodes { 0 };
+    int culledObjects { 0 };
+    int visitedModels { 0 }; // while collecting meshes and lights
 };
 
 class OctreeNode {
@@ -44,52 +55,71 @@ public:
     OctreeNode(OctreeNode *parent, render::AABB aabb);
 
     void add(OctreeObject *object);
+    void remove(OctreeObject *object);
 
 private:
-    enum class Quadrant {
-        BottomLeft,
-        BottomRight,
-        TopLeft,
-        TopRight
-    };
+    static const int kChildCount = 4;
 
     OctreeNode *_parent { nullptr };
 
     render::AABB _aabb;
-    render::AABB _bottomLeftAabb;
-    render::AABB _bottomRightAabb;
-    render::AABB _topLeftAabb;
-    render::AABB _topRightAabb;
-
-    std::unique_ptr<OctreeNode> _bottomLeft;
-    std::unique_ptr<OctreeNode> _bottomRight;
-    std::unique_ptr<OctreeNode> _topLeft;
-    std::unique_ptr<OctreeNode> _topRight;
+    render::AABB _childAabbs[kChildCount];
+    std::unique_ptr<OctreeNode> _children[kChildCount];
+    std::vector<OctreeObject *> _objects;
+    int _objectCount { 0 }; // including children
 
-    std::unordered_set<OctreeObject *> _objects;
+    void computeChildrenAABB();
 
-    void computeQuadrantsAABB();
+    /**
+     * @return true if this is the smallest node that contains the bounding box
+     */
+    bool isBestFit(const render::AABB &aabb) const;
 
     bool isLeaf() const;
-    bool isObjectIn(OctreeObject *object, Quadrant quadrant) const;
 
     friend class Octree;
 };
 
 /**
  * This is actually a quadtree. Used to optimize rendering and ray casting.
+ *
+ * Every object is stored in the smallest node that fully contains it. Moving
+ * objects are updated incrementally, unless they leave the bounds of the
+ * tree, in which case it must be rebuilt.
  */
 class Octree {
 public:
     void clear();
-    void registerObject(OctreeObject object);
     void build();
 
-    std::vector<SceneNode *> getNodesInFrustum(const CameraSceneNode *camera) const;
+    void registerObject(SceneNode *sceneNode, const render::AABB &aabb);
+    void updateObject(SceneNode *sceneNode, const render::AABB &aabb);
+    void unregisterObject(SceneNode *sceneNode);
+
+    /**
+     * @param[out] sceneNodes scene nodes whose bounding boxes are in the
+     *                        camera frustum, ordered front to back
+     * @param[out] stats accumulated culling statistics
+     */
+    void getNodesInFrustum(const CameraSceneNode &camera, std::vector<SceneNode *> &sceneNodes, CullingStats &stats) const;
+
+    /**
+     * @return true if objects have been registered or moved outside of the
+     *         bounds of the tree since the last build
+     */
+    bool needsRebuild() const;
+
+    int objectCount() const;
 
 private:
-    std::unordered_map<SceneNode *, OctreeObject> _objects;
+    std::unordered_map<SceneNode *, std::unique_ptr<OctreeObject>> _objects;
     std::unique_ptr<OctreeNode> _root;
+    bool _rebuild { false };
+    mutable std::vector<std::pair<SceneNode *, float>> _distances;
+    mutable render::AABBBatch _objectBoxes;
+    mutable std::vector<uint8_t> _objectsInFrustum;
+
+    bool isInBounds(const render::AABB &aabb) const;
 };
 
 } // namespace scene
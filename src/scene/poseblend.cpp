@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "poseblend.h"
+
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define REONE_POSEBLEND_SSE
+#include <xmmintrin.h>
+#endif
+
+using namespace std;
+
+namespace reone {
+
+namespace scene {
+
+static const float kLinearThreshold = 1.0f - numeric_limits<float>::epsilon();
+
+#ifndef REONE_POSEBLEND_SSE
+
+// Scalar kernels mirror glm::slerp, including the order of operations
+
+static float dot(const float *a, const float *b) {
+    // Components are summed as (w + x) + (y + z) in glm
+    return (a[3] * b[3] + a[0] * b[0]) + (a[1] * b[1] + a[2] * b[2]);
+}
+
+static void slerp(const float *a, const float *b, float t, float *out) {
+    float cosTheta = dot(a, b);
+    float sign = 1.0f;
+    if (cosTheta < 0.0f) {
+        sign = -1.0f;
+        cosTheta = -cosTheta;
+    }
+    if (cosTheta > kLinearThreshold) {
+        for (int i = 0; i < 4; ++i) {
+            out[i] = a[i] * (1.0f - t) + sign * b[i] * t;
+        }
+        return;
+    }
+    float angle = acos(cosTheta);
+    float weightA = sin((1.0f - t) * angle);
+    float weightB = sin(t * angle);
+    float sinAngle = sin(angle);
+
+    for (int i = 0; i < 4; ++i) {
+        out[i] = (weightA * a[i] + weightB * (sign * b[i])) / sinAngle;
+    }
+}
+
+static void nlerp(const float *a, const float *b, float t, float *out) {
+    float sign = dot(a, b) < 0.0f ? -1.0f : 1.0f;
+    float q[4];
+    for (int i = 0; i < 4; ++i) {
+        q[i] = a[i] * (1.0f - t) + sign * b[i] * t;
+    }
+    float length = sqrt(dot(q, q));
+    for (int i = 0; i < 4; ++i) {
+        out[i] = q[i] / length;
+    }
+}
+
+#else
+
+struct Quats4 {
+    __m128 x, y, z, w;
+};
+
+static inline Quats4 loadQuats4(const glm::quat *q) {
+    Quats4 result;
+    result.x = _mm_loadu_ps(reinterpret_cast<const float *>(&q[0]));
+    result.y = _mm_loadu_ps(reinterpret_cast<const float *>(&q[1]));
+    result.z = _mm_loadu_ps(reinterpret_cast<const float *>(&q[2]));
+    result.w = _mm_loadu_ps(reinterpret_cast<const float *>(&q[3]));
+    _MM_TRANSPOSE4_PS(result.x, result.y, result.z, result.w);
+    return result;
+}
+
+static inline void storeQuats4(Quats4 q, glm::quat *out) {
+    _MM_TRANSPOSE4_PS(q.x, q.y, q.z, q.w);
+    _mm_storeu_ps(reinterpret_cast<float *>(&out[0]), q.x);
+    _mm_storeu_ps(reinterpret_cast<float *>(&out[1]), q.y);
+    _mm_storeu_ps(reinterpret_cast<float *>(&out[2]), q.z);
+    _mm_storeu_ps(reinterpret_cast<float *>(&out[3]), q.w);
+}
+
+static inline __m128 dot4(const Quats4 &a, const Quats4 &b) {
+    return _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(a.w, b.w), _mm_mul_ps(a.x, b.x)),
+        _mm_add_ps(_mm_mul_ps(a.y, b.y), _mm_mul_ps(a.z, b.z)));
+}
+
+static inline __m128 select4(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+/**
+ * Negates quaternions in b, whose dot product with the corresponding
+ * quaternions in a is negative.
+ *
+ * @return absolute values of the dot products
+ */
+static inline __m128 alignQuats4(const Quats4 &a, Quats4 &b) {
+    __m128 cosTheta = dot4(a, b);
+    __m128 signBits = _mm_and_ps(_mm_cmplt_ps(cosTheta, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+    b.x = _mm_xor_ps(b.x, signBits);
+    b.y = _mm_xor_ps(b.y, signBits);
+    b.z = _mm_xor_ps(b.z, signBits);
+    b.w = _mm_xor_ps(b.w, signBits);
+    return _mm_xor_ps(cosTheta, signBits);
+}
+
+static inline Quats4 mix4(const Quats4 &a, const Quats4 &b, __m128 weightA, __m128 weightB) {
+    Quats4 result;
+    result.x = _mm_add_ps(_mm_mul_ps(a.x, weightA), _mm_mul_ps(b.x, weightB));
+    result.y = _mm_add_ps(_mm_mul_ps(a.y, weightA), _mm_mul_ps(b.y, weightB));
+    result.z = _mm_add_ps(_mm_mul_ps(a.z, weightA), _mm_mul_ps(b.z, weightB));
+    result.w = _mm_add_ps(_mm_mul_ps(a.w, weightA), _mm_mul_ps(b.w, weightB));
+    return result;
+}
+
+/**
+ * @param x cosine in [0, 1]
+ * @return arc cosine with an absolute error below 2e-8, before rounding (Abramowitz and Stegun, 4.4.46)
+ */
+static inline __m128 acos4(__m128 x) {
+    __m128 p = _mm_set1_ps(-0.0012624911f);
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(0.0066700901f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-0.0170881256f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(0.0308918810f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-0.0501743046f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(0.0889789874f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-0.2145988016f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(1.5707963050f));
+    return _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.0f), x)), p);
+}
+
+/**
+ * @param x angle in [-pi/2, pi/2]
+ * @return sine, using the Taylor series up to the 11th power
+ */
+static inline __m128 sin4(__m128 x) {
+    __m128 x2 = _mm_mul_ps(x, x);
+    __m128 p = _mm_set1_ps(-1.0f / 39916800.0f);
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f / 362880.0f));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(-1.0f / 5040.0f));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f / 120.0f));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(-1.0f / 6.0f));
+    p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f));
+    return _mm_mul_ps(x, p);
+}
+
+static void slerp4(const glm::quat *a, const glm::quat *b, float t, glm::quat *out) {
+    Quats4 qa(loadQuats4(a));
+    Quats4 qb(loadQuats4(b));
+    __m128 cosTheta = alignQuats4(qa, qb);
+    __m128 linear = _mm_cmpgt_ps(cosTheta, _mm_set1_ps(kLinearThreshold));
+
+    __m128 angle = acos4(_mm_min_ps(cosTheta, _mm_set1_ps(1.0f)));
+    __m128 weightA = sin4(_mm_mul_ps(_mm_set1_ps(1.0f - t), angle));
+    __m128 weightB = sin4(_mm_mul_ps(_mm_set1_ps(t), angle));
+    __m128 sinAngle = sin4(angle);
+
+    Quats4 spherical(mix4(qa, qb, weightA, weightB));
+    spherical.x = _mm_div_ps(spherical.x, sinAngle);
+    spherical.y = _mm_div_ps(spherical.y, sinAngle);
+    spherical.z = _mm_div_ps(spherical.z, sinAngle);
+    spherical.w = _mm_div_ps(spherical.w, sinAngle);
+
+    Quats4 lerped(mix4(qa, qb, _mm_set1_ps(1.0f - t), _mm_set1_ps(t)));
+
+    Quats4 result;
+    result.x = select4(linear, lerped.x, spherical.x);
+    result.y = select4(linear, lerped.y, spherical.y);
+    result.z = select4(linear, lerped.z, spherical.z);
+    result.w = select4(linear, lerped.w, spherical.w);
+    storeQuats4(result, out);
+}
+
+static void nlerp4(const glm::quat *a, const glm::quat *b, float t, glm::quat *out) {
+    Quats4 qa(loadQuats4(a));
+    Quats4 qb(loadQuats4(b));
+    alignQuats4(qa, qb);
+
+    Quats4 result(mix4(qa, qb, _mm_set1_ps(1.0f - t), _mm_set1_ps(t)));
+    __m128 length = _mm_sqrt_ps(dot4(result, result));
+    result.x = _mm_div_ps(result.x, length);
+    result.y = _mm_div_ps(result.y, length);
+    result.z = _mm_div_ps(result.z, length);
+    result.w = _mm_div_ps(result.w, length);
+    storeQuats4(result, out);
+}
+
+/**
+ * Applies a four-wide kernel to the last count % 4 quaternions, padding them
+ * with identities, so that every quaternion is interpolated the same way.
+ */
+static void applyToTail(void (*kernel)(const glm::quat *, const glm::quat *, float, glm::quat *), const glm::quat *a, const glm::quat *b, float t, int count, glm::quat *out) {
+    glm::quat identity(1.0f, 0.0f, 0.0f, 0.0f);
+    glm::quat paddedA[4] { identity, identity, identity, identity };
+    glm::quat paddedB[4] { identity, identity, identity, identity };
+    glm::quat paddedOut[4];
+    for (int i = 0; i < count; ++i) {
+        paddedA[i] = a[i];
+        paddedB[i] = b[i];
+    }
+    kernel(paddedA, paddedB, t, paddedOut);
+    for (int i = 0; i < count; ++i) {
+        out[i] = paddedOut[i];
+    }
+}
+
+#endif // REONE_POSEBLEND_SSE
+
+void slerpQuats(const glm::quat *a, const glm::quat *b, float t, int count, glm::quat *out) {
+#ifdef REONE_POSEBLEND_SSE
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        slerp4(&a[i], &b[i], t, &out[i]);
+    }
+    if (i < count) {
+        applyToTail(slerp4, &a[i], &b[i], t, count - i, &out[i]);
+    }
+#else
+    for (int i = 0; i < count; ++i) {
+        slerp(reinterpret_cast<const float *>(&a[i]), reinterpret_cast<const float *>(&b[i]), t, reinterpret_cast<float *>(&out[i]));
+    }
+#endif
+}
+
+void nlerpQuats(const glm::quat *a, const glm::quat *b, float t, int count, glm::quat *out) {
+#ifdef REONE_POSEBLEND_SSE
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        nlerp4(&a[i], &b[i], t, &out[i]);
+    }
+    if (i < count) {
+        applyToTail(nlerp4, &a[i], &b[i], t, count - i, &out[i]);
+    }
+#else
+    for (int i = 0; i < count; ++i) {
+        nlerp(reinterpret_cast<const float *>(&a[i]), reinterpret_cast<const float *>(&b[i]), t, reinterpret_cast<float *>(&out[i]));
+    }
+#endif
+}
+
+} // namespace scene
+
+} // namespace reone
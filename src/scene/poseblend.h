@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "glm/gtc/quaternion.hpp"
+
+namespace reone {
+
+namespace scene {
+
+/**
+ * Spherically interpolates between two arrays of unit quaternions, so that
+ * out[i] matches glm::slerp(a[i], b[i], t) to within 1e-6 for t in [0, 1].
+ * Where SSE is available, processes four quaternions per iteration, using
+ * polynomial approximations of acos and sin. out may alias a or b.
+ */
+void slerpQuats(const glm::quat *a, const glm::quat *b, float t, int count, glm::quat *out);
+
+/**
+ * Normalized linear interpolation between two arrays of unit quaternions,
+ * taking the shortest path. Cheaper but less accurate than slerpQuats for
+ * large angles. out may alias a or b.
+ */
+void nlerpQuats(const glm::quat *a, const glm::quat *b, float t, int count, glm::quat *out);
+
+} // namespace scene
+
+} // namespace reone
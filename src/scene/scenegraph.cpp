@@ -18,7 +18,6 @@
 #include "scenegraph.h"
 
 #include <algorithm>
-#include <stack>
 
 #include "../render/mesh/quad.h"
 
@@ -35,17 +34,30 @@ namespace reone {
 
 namespace scene {
 
-static const int kMaxLightCount = 8;
-
 SceneGraph::SceneGraph(const GraphicsOptions &opts) : _opts(opts) {
 }
 
 void SceneGraph::clear() {
     _roots.clear();
+    _octree.clear();
+    _models.clear();
+    _dynamicModels.clear();
+    _lightGrid.clear();
+    _staticGeometry.reset();
 }
 
-void SceneGraph::addRoot(const shared_ptr<SceneNode> &node) {
+void SceneGraph::addRoot(const shared_ptr<SceneNode> &node, bool isStatic) {
     _roots.push_back(node);
+
+    ModelSceneNode *model = dynamic_cast<ModelSceneNode *>(node.get());
+    if (!model) return;
+
+    _octree.registerObject(model, model->aabb() * model->absoluteTransform());
+    _models.push_back(model);
+
+    if (!isStatic) {
+        _dynamicModels.push_back(model);
+    }
 }
 
 void SceneGraph::removeRoot(const shared_ptr<SceneNode> &node) {
@@ -53,9 +65,28 @@ void SceneGraph::removeRoot(const shared_ptr<SceneNode> &node) {
     if (maybeRoot != _roots.end()) {
         _roots.erase(maybeRoot);
     }
+    _octree.unregisterObject(node.get());
+
+    auto maybeModel = find(_models.begin(), _models.end(), node.get());
+    if (maybeModel != _models.end()) {
+        _models.erase(maybeModel);
+    }
+    auto maybeDynamicModel = find(_dynamicModels.begin(), _dynamicModels.end(), node.get());
+    if (maybeDynamicModel != _dynamicModels.end()) {
+        _dynamicModels.erase(maybeDynamicModel);
+    }
 }
 
 void SceneGraph::build() {
+    _octree.build();
+}
+
+static int countBonePalettesBuilt(const ModelSceneNode &model) {
+    int result = model.bonePalettesBuilt();
+    for (auto &attached : model.attachedModels()) {
+        result += countBonePalettesBuilt(*attached);
+    }
+    return result;
 }
 
 void SceneGraph::prepareFrame() {
@@ -63,68 +94,125 @@ void SceneGraph::prepareFrame() {
 
     refreshMeshesAndLights();
 
-    for (auto &root : _roots) {
-        ModelSceneNode *modelNode = dynamic_cast<ModelSceneNode *>(root.get());
-        if (modelNode) {
-            modelNode->updateLighting();
+    _bonePalettesBuilt = 0;
+
+    for (auto &model : _models) {
+        model->updateLighting();
+        _bonePalettesBuilt += countBonePalettesBuilt(*model);
+    }
+
+    _lightSetIds.clear();
+
+    for (auto &model : _models) {
+        updateInstanceState(*model);
+    }
+    refreshRenderQueue();
+}
+
+void SceneGraph::updateInstanceState(ModelSceneNode &model) {
+    // Zero disables instancing, one is reserved for unlit models
+    uint32_t state = 1;
+
+    if (model.isLightingEnabled()) {
+        auto maybeId = _lightSetIds.find(model.lightsAffectedBy());
+        if (maybeId != _lightSetIds.end()) {
+            state = maybeId->second;
+        } else {
+            state = static_cast<uint32_t>(_lightSetIds.size()) + 2;
+            _lightSetIds.insert(make_pair(model.lightsAffectedBy(), state));
         }
     }
-    unordered_map<ModelNodeSceneNode *, float> cameraDistances;
-    glm::vec3 cameraPosition(_activeCamera->absoluteTransform()[3]);
+    model.setInstanceState(state);
 
-    for (auto &mesh : _transparentMeshes) {
-        cameraDistances.insert(make_pair(mesh, mesh->distanceTo(cameraPosition)));
+    for (auto &attached : model.attachedModels()) {
+        updateInstanceState(*attached);
     }
-    sort(_transparentMeshes.begin(), _transparentMeshes.end(), [&cameraDistances](auto &left, auto &right) {
-        int leftTransparency = left->modelNode()->mesh()->transparency();
-        int rightTransparency = right->modelNode()->mesh()->transparency();
-        if (leftTransparency < rightTransparency) return true;
+}
 
-        float leftDistance = cameraDistances.find(left)->second;
-        float rightDistance = cameraDistances.find(right)->second;
+void SceneGraph::refreshRenderQueue() {
+    _renderQueue.clear();
 
-        return leftDistance > rightDistance;
-    });
+    glm::vec3 cameraPosition(_activeCamera->absoluteTransform()[3]);
+    DrawItem item;
+
+    for (auto &mesh : _opaqueMeshes) {
+        mesh->getDrawItem(item);
+        _renderQueue.add(RenderPass::Opaque, item, mesh->distanceTo(cameraPosition));
+    }
+    for (auto &mesh : _transparentMeshes) {
+        mesh->getDrawItem(item);
+        _renderQueue.add(RenderPass::Transparent, item, mesh->distanceTo(cameraPosition));
+    }
+    if (_staticGeometry) {
+        _staticGeometry->prepareFrame(cameraPosition, _renderQueue);
+    }
+    _renderQueue.prepare(_opts.renderThreads);
 }
 
 void SceneGraph::refreshMeshesAndLights() {
     _opaqueMeshes.clear();
     _transparentMeshes.clear();
     _lights.clear();
+    _cullingStats = CullingStats();
 
-    for (auto &root : _roots) {
-        stack<SceneNode *> nodes;
-        nodes.push(root.get());
-
-        while (!nodes.empty()) {
-            SceneNode *node = nodes.top();
-            nodes.pop();
-
-            ModelSceneNode *model = dynamic_cast<ModelSceneNode *>(node);
-            if (model) {
-                if (!model->isVisible() || !model->isOnScreen()) continue;
-
-            } else {
-                ModelNodeSceneNode *modelNode = dynamic_cast<ModelNodeSceneNode *>(node);
-                if (modelNode) {
-                    if (modelNode->shouldRender()) {
-                        if (modelNode->isTransparent()) {
-                            _transparentMeshes.push_back(modelNode);
-                        } else {
-                            _opaqueMeshes.push_back(modelNode);
-                        }
-                    }
-                } else {
-                    LightSceneNode *light = dynamic_cast<LightSceneNode *>(node);
-                    if (light) {
-                        _lights.push_back(light);
-                    }
-                }
-            }
-            for (auto &child : node->children()) {
-                nodes.push(child.get());
-            }
+    _dynamicBoxes.clear();
+    for (auto &model : _dynamicModels) {
+        _dynamicBoxes.add(model->aabb(), model->absoluteTransform());
+    }
+    for (size_t i = 0; i < _dynamicModels.size(); ++i) {
+        ModelSceneNode *model = _dynamicModels[i];
+        AABB aabb;
+        if (!model->aabb().isEmpty()) {
+            aabb = AABB(_dynamicBoxes.min(static_cast<int>(i)), _dynamicBoxes.max(static_cast<int>(i)));
         }
+        _octree.updateObject(model, aabb);
+    }
+
+    // As before the octree, lights of hidden and off-screen models are skipped
+    for (auto &model : _models) {
+        appendLights(*model);
+    }
+    _lightGrid.build(_lights);
+
+    if (_octree.needsRebuild()) {
+        _octree.build();
+    }
+    _octree.getNodesInFrustum(*_activeCamera, _visibleRoots, _cullingStats);
+
+    if (_staticGeometry) {
+        _staticGeometry->resetVisibility();
+    }
+
+    // Visible roots are ordered front to back, and so are opaque meshes
+    for (auto &root : _visibleRoots) {
+        appendMeshes(*static_cast<ModelSceneNode *>(root));
+    }
+}
+
+void SceneGraph::appendMeshes(const ModelSceneNode &model) {
+    if (!model.isVisible() || !model.isOnScreen()) return;
+
+    ++_cullingStats.visitedModels;
+
+    if (_staticGeometry) {
+        _staticGeometry->setVisible(model);
+    }
+
+    _opaqueMeshes.insert(_opaqueMeshes.end(), model.opaqueMeshes().begin(), model.opaqueMeshes().end());
+    _transparentMeshes.insert(_transparentMeshes.end(), model.transparentMeshes().begin(), model.transparentMeshes().end());
+
+    for (auto &attached : model.attachedModels()) {
+        appendMeshes(*attached);
+    }
+}
+
+void SceneGraph::appendLights(const ModelSceneNode &model) {
+    if (!model.isVisible() || !model.isOnScreen()) return;
+
+    _lights.insert(_lights.end(), model.lights().begin(), model.lights().end());
+
+    for (auto &attached : model.attachedModels()) {
+        appendLights(*attached);
     }
 }
 
@@ -141,43 +229,23 @@ void SceneGraph::render() const {
     for (auto &root : _roots) {
         root->render();
     }
-    for (auto &mesh : _opaqueMeshes) {
-        mesh->renderSingle();
-    }
-    for (auto &mesh : _transparentMeshes) {
-        mesh->renderSingle();
-    }
+    _renderQueue.render();
 }
 
 void SceneGraph::getLightsAt(const glm::vec3 &position, vector<LightSceneNode *> &lights) const {
-    unordered_map<LightSceneNode *, float> distances;
-    lights.clear();
-
-    for (auto &light : _lights) {
-        float distance = light->distanceTo(position);
-        float radius = light->radius();
-        if (distance > radius * radius) continue;
-
-        distances.insert(make_pair(light, distance));
-        lights.push_back(light);
-    }
-
-    sort(lights.begin(), lights.end(), [&distances](LightSceneNode *left, LightSceneNode *right) {
-        int leftPriority = left->priority();
-        int rightPriority = right->priority();
-
-        if (leftPriority < rightPriority) return true;
-        if (leftPriority > rightPriority) return false;
+    _lightGrid.getLightsAt(position, kMaxLightCount, lights);
+}
 
-        float leftDistance = distances.find(left)->second;
-        float rightDistance = distances.find(right)->second;
+const CullingStats &SceneGraph::cullingStats() const {
+    return _cullingStats;
+}
 
-        return leftDistance < rightDistance;
-    });
+const RenderQueueStats &SceneGraph::renderQueueStats() const {
+    return _renderQueue.stats();
+}
 
-    if (lights.size() > kMaxLightCount) {
-        lights.erase(lights.begin() + kMaxLightCount, lights.end());
-    }
+int SceneGraph::bonePalettesBuilt() const {
+    return _bonePalettesBuilt;
 }
 
 const glm::vec3 &SceneGraph::ambientLightColor() const {
@@ -188,6 +256,10 @@ void SceneGraph::setActiveCamera(const shared_ptr<CameraSceneNode> &camera) {
     _activeCamera = camera;
 }
 
+void SceneGraph::setStaticGeometry(const shared_ptr<StaticGeometry> &geometry) {
+    _staticGeometry = geometry;
+}
+
 void SceneGraph::setAmbientLightColor(const glm::vec3 &color) {
     _ambientLightColor = color;
 }
@@ -23,9 +23,13 @@
 
 #include "glm/vec3.hpp"
 
+#include "../render/aabbbatch.h"
+#include "../render/renderqueue.h"
 #include "../render/types.h"
 
+#include "lightgrid.h"
 #include "octree.h"
+#include "staticgeometry.h"
 
 namespace reone {
 
@@ -34,6 +38,7 @@ namespace scene {
 class CameraSceneNode;
 class LightSceneNode;
 class ModelNodeSceneNode;
+class ModelSceneNode;
 class SceneNode;
 
 class SceneGraph : public render::IRenderable {
@@ -44,14 +49,38 @@ public:
 
     void clear();
 
-    void addRoot(const std::shared_ptr<SceneNode> &node);
+    /**
+     * @param isStatic true if the node will never move, e.g. room geometry
+     */
+    void addRoot(const std::shared_ptr<SceneNode> &node, bool isStatic = false);
     void removeRoot(const std::shared_ptr<SceneNode> &node);
 
     void build();
     void prepareFrame();
 
+    /**
+     * @return culling statistics of the last prepared frame
+     */
+    const CullingStats &cullingStats() const;
+
+    /**
+     * @return render queue statistics of the last prepared frame
+     */
+    const render::RenderQueueStats &renderQueueStats() const;
+
+    /**
+     * @return number of bone palettes built by models since the last prepared frame
+     */
+    int bonePalettesBuilt() const;
+
     void setActiveCamera(const std::shared_ptr<CameraSceneNode> &camera);
 
+    /**
+     * Sets geometry, merged from meshes of root models, to render along with
+     * the remaining meshes of these models. Reset by clear.
+     */
+    void setStaticGeometry(const std::shared_ptr<StaticGeometry> &geometry);
+
     // Lights
 
     void getLightsAt(const glm::vec3 &position, std::vector<LightSceneNode *> &lights) const;
@@ -67,15 +96,34 @@ private:
     std::vector<ModelNodeSceneNode *> _opaqueMeshes;
     std::vector<ModelNodeSceneNode *> _transparentMeshes;
     std::vector<LightSceneNode *> _lights;
+    LightGrid _lightGrid;
     std::shared_ptr<CameraSceneNode> _activeCamera;
     glm::vec3 _ambientLightColor { 0.5f };
     uint32_t _textureId { 0 };
     Octree _octree;
+    std::vector<ModelSceneNode *> _models;
+    std::vector<ModelSceneNode *> _dynamicModels;
+    render::AABBBatch _dynamicBoxes;
+    std::vector<SceneNode *> _visibleRoots;
+    CullingStats _cullingStats;
+    render::RenderQueue _renderQueue;
+    int _bonePalettesBuilt { 0 };
+    std::shared_ptr<StaticGeometry> _staticGeometry;
+    std::map<std::vector<LightSceneNode *>, uint32_t> _lightSetIds;
 
     SceneGraph(const SceneGraph &) = delete;
     SceneGraph &operator=(const SceneGraph &) = delete;
 
     void refreshMeshesAndLights();
+    void appendMeshes(const ModelSceneNode &model);
+    void appendLights(const ModelSceneNode &model);
+    void refreshRenderQueue();
+
+    /**
+     * Assigns equal instance states to models lit by the same lights, so that
+     * their meshes can be drawn with instancing.
+     */
+    void updateInstanceState(ModelSceneNode &model);
 };
 
 } // namespace scene
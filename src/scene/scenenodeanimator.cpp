@@ -17,11 +17,13 @@
 
 #include "scenenodeanimator.h"
 
+#include <atomic>
 #include <stack>
 #include <stdexcept>
 
 #include "modelnodescenenode.h"
 #include "modelscenenode.h"
+#include "poseblend.h"
 
 using namespace std;
 
@@ -33,6 +35,22 @@ namespace scene {
 
 static const float kTransitionDuration = 0.25f;
 
+// Animators may be constructed concurrently, e.g. for models attached during AnimationBatch::run
+static atomic<uint32_t> g_nextLODFrame { 0 };
+
+AnimationLOD getAnimationLOD(const AnimationLODOptions &options, float distance, float screenSize) {
+    if (!options.enabled) return AnimationLOD::Full;
+
+    if (distance >= options.quarterRateDistance || screenSize < options.quarterRateScreenSize) {
+        return AnimationLOD::Quarter;
+    }
+    if (distance >= options.halfRateDistance || screenSize < options.halfRateScreenSize) {
+        return AnimationLOD::Half;
+    }
+
+    return AnimationLOD::Full;
+}
+
 bool SceneNodeAnimator::AnimationChannel::isActive() const {
     return animation && !finished;
 }
@@ -51,6 +69,7 @@ void SceneNodeAnimator::AnimationChannel::setAnimation(Animation *animation, int
     this->speed = speed;
     this->time = 0.0f;
     this->animation = animation;
+    this->binding = nullptr;
     this->finished = false;
     this->transition = false;
     this->freeze = false;
@@ -67,129 +86,202 @@ SceneNodeAnimator::SceneNodeAnimator(ModelSceneNode *modelSceneNode, const set<s
     if (!_modelSceneNode) {
         throw invalid_argument("modelSceneNode must not be null");
     }
+
+    // Stagger updates of animators at reduced LOD across frames
+    _lodFrame = static_cast<int>(g_nextLODFrame.fetch_add(1) % 4);
 }
 
-void SceneNodeAnimator::update(float dt) {
+bool SceneNodeAnimator::update(float dt, AnimationLOD lod, bool skipNodes) {
     if (!_channels[0].isActive()) {
         playDefaultAnimation();
-        return;
+        return false;
     }
     if (_channels[0].transition && _channels[0].time >= _channels[0].animation->transitionTime()) {
         _channels[0].transition = false;
         _channels[1].stopAnimation();
     }
+    bindModel();
+
+    bool updateTransforms = isUpdateDue(lod);
+    skipNodes = skipNodes && lod == AnimationLOD::Quarter;
+
+    for (int i = 0; i < kChannelCount; ++i) {
+        updateChannel(i, dt, updateTransforms, skipNodes);
+    }
+    if (updateTransforms) {
+        updateAbsoluteTransforms();
+        updateNodeTransforms();
+    }
+
+    return updateTransforms;
+}
+
+bool SceneNodeAnimator::isUpdateDue(AnimationLOD lod) {
+    int interval;
+    switch (lod) {
+        case AnimationLOD::Full:
+            interval = 1;
+            break;
+        case AnimationLOD::Half:
+            interval = 2;
+            break;
+        case AnimationLOD::Quarter:
+            interval = 4;
+            break;
+        default:
+            _poseStale = true;
+            return false;
+    }
+    bool due = _poseStale || _lodFrame % interval == 0;
+    _lodFrame = (_lodFrame + 1) % 4;
+    _poseStale = false;
+
+    return due;
+}
+
+void SceneNodeAnimator::bindModel() {
+    shared_ptr<Model> model(_modelSceneNode->model());
+    if (_model == model) return;
+
+    _model = model;
+
+    const vector<ModelNode *> &nodes = _model->nodes();
+    _parentIndices.resize(nodes.size());
+    _skipped.resize(nodes.size());
+    _essential.assign(nodes.size(), false);
+    _untransformed.resize(nodes.size());
+    _absTransforms.resize(nodes.size());
+
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const ModelNode *parent = nodes[i]->parent();
+        _parentIndices[i] = parent ? parent->index() : -1;
+        _skipped[i] = _skipNodes.count(nodes[i]->name()) > 0;
+        _untransformed[i] = nodes[i]->skin() || (parent && _untransformed[parent->index()]);
+
+        shared_ptr<ModelNode::Skin> skin(nodes[i]->skin());
+        if (skin) {
+            for (uint16_t nodeIdx : skin->nodeIdxByBoneIdx) {
+                if (nodeIdx < nodes.size()) {
+                    _essential[nodeIdx] = true;
+                }
+            }
+        }
+    }
+    for (int i = static_cast<int>(nodes.size()) - 1; i >= 0; --i) {
+        if (nodes[i]->mesh()) {
+            _essential[i] = true;
+        }
+        if (_essential[i] && _parentIndices[i] != -1) {
+            _essential[_parentIndices[i]] = true;
+        }
+    }
+    _poseStale = true;
     for (int i = 0; i < kChannelCount; ++i) {
-        updateChannel(i, dt);
+        _channels[i].binding = nullptr;
     }
-    _absTransforms.clear();
-    updateAbsoluteTransforms(_modelSceneNode->model()->rootNode());
-    updateNodeTransforms(_modelSceneNode->model()->rootNode());
 }
 
-void SceneNodeAnimator::updateChannel(int channel, float dt) {
+void SceneNodeAnimator::updateChannel(int channel, float dt, bool updateTransforms, bool skipNodes) {
     AnimationChannel &animChannel = _channels[channel];
     if (!animChannel.isActive()) return;
 
-    animChannel.localTransforms.clear();
-    updateLocalTransforms(animChannel, *animChannel.animation->rootNode());
+    if (!animChannel.binding) {
+        animChannel.binding = &_model->getAnimationBinding(*animChannel.animation);
+        animChannel.cursors.assign(_model->nodes().size(), ModelNode::SampleCursor());
+    }
+    if (updateTransforms) {
+        updateLocalPoses(animChannel, skipNodes);
+    }
     advanceTime(animChannel, dt);
 }
 
-void SceneNodeAnimator::updateLocalTransforms(AnimationChannel &channel, ModelNode &animNode) {
-    ModelNodeSceneNode *sceneNode = _modelSceneNode->getModelNode(animNode.name());
-    if (sceneNode) {
-        ModelNode *modelNode = sceneNode->modelNode();
-        glm::vec3 position(modelNode->position());
-        glm::quat orientation(modelNode->orientation());
+void SceneNodeAnimator::updateLocalPoses(AnimationChannel &channel, bool skipNodes) {
+    const vector<ModelNode *> &nodes = _model->nodes();
+    float time = channel.transition ? channel.animation->transitionTime() : channel.time;
+    float scale = _model->animationScale();
+
+    channel.positions.resize(nodes.size());
+    channel.orientations.resize(nodes.size());
+    channel.hasPoses.assign(nodes.size(), false);
 
-        bool skip = _skipNodes.count(modelNode->name()) > 0;
-        if (!skip) {
-            float time = channel.transition ? channel.animation->transitionTime() : channel.time;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const ModelNode *modelNode = nodes[i];
+        glm::vec3 &position = channel.positions[i];
+        glm::quat &orientation = channel.orientations[i];
+        position = modelNode->position();
+        orientation = modelNode->orientation();
+
+        const ModelNode *animNode = channel.binding->animNodes[i];
+        if (!animNode) continue;
+
+        if (!_skipped[i] && (!skipNodes || _essential[i])) {
             glm::vec3 animPosition(0.0f);
-            if (animNode.getPosition(time, animPosition, _modelSceneNode->model()->animationScale())) {
+            if (animNode->getPosition(time, channel.cursors[i], animPosition, scale)) {
                 position += animPosition;
             }
             glm::quat animOrientation(0.0f, 0.0f, 0.0f, 1.0f);
-            if (animNode.getOrientation(time, animOrientation)) {
+            if (animNode->getOrientation(time, channel.cursors[i], animOrientation)) {
                 orientation = animOrientation;
             }
         }
-
-        glm::mat4 transform(1.0f);
-        transform = glm::translate(transform, position);
-        transform *= glm::mat4_cast(orientation);
-        channel.localTransforms.insert(make_pair(modelNode->nodeNumber(), transform));
+        channel.hasPoses[i] = true;
     }
+}
 
-    for (auto &child : animNode.children()) {
-        updateLocalTransforms(channel, *child);
-    }
+static glm::mat4 getPoseTransform(const glm::vec3 &position, const glm::quat &orientation) {
+    glm::mat4 transform(glm::mat4_cast(orientation));
+    transform[3] = glm::vec4(position, 1.0f);
+    return move(transform);
 }
 
-void SceneNodeAnimator::updateAbsoluteTransforms(ModelNode &modelNode, const glm::mat4 &parentTransform) {
-    if (modelNode.skin()) return;
-
-    glm::mat4 transform(parentTransform);
-    glm::mat4 localTransform;
-
-    if (_channels[0].transition) {
-        auto maybeTransform0 = _channels[0].localTransforms.find(modelNode.nodeNumber());
-        bool hasTransform0 = maybeTransform0 != _channels[0].localTransforms.end();
-        auto maybeTransform1 = _channels[1].localTransforms.find(modelNode.nodeNumber());
-        bool hasTransform1 = maybeTransform1 != _channels[1].localTransforms.end();
-        if (hasTransform0 && hasTransform1) {
-            float delta = 1.0f - (_channels[0].animation->transitionTime() - _channels[0].time) / _channels[0].animation->transitionTime();
-            glm::quat orientation0(glm::toQuat(maybeTransform0->second));
-            glm::quat orientation1(glm::toQuat(maybeTransform1->second));
-            localTransform = glm::translate(glm::mat4(1.0f), glm::vec3(maybeTransform0->second[3]));
-            localTransform *= glm::mat4_cast(glm::slerp(orientation1, orientation0, delta));
-        } else if (hasTransform0) {
-            localTransform = maybeTransform0->second;
-        } else if (hasTransform1) {
-            localTransform = maybeTransform1->second;
-        } else {
-            localTransform = modelNode.localTransform();
-        }
-    } else if (_channels[0].flags & kAnimationOverlay) {
-        auto maybeTransform0 = _channels[0].localTransforms.find(modelNode.nodeNumber());
-        bool hasTransform0 = maybeTransform0 != _channels[0].localTransforms.end();
-        auto maybeTransform1 = _channels[1].localTransforms.find(modelNode.nodeNumber());
-        bool hasTransform1 = maybeTransform1 != _channels[1].localTransforms.end();
-        if (hasTransform0) {
-            localTransform = maybeTransform0->second;
-        } else if (hasTransform1) {
-            localTransform = maybeTransform1->second;
-        } else {
-            localTransform = modelNode.localTransform();
-        }
-    } else {
-        auto maybeTransform = _channels[0].localTransforms.find(modelNode.nodeNumber());
-        if (maybeTransform != _channels[0].localTransforms.end()) {
-            localTransform = maybeTransform->second;
-        } else {
-            localTransform = modelNode.localTransform();
-        }
+void SceneNodeAnimator::updateAbsoluteTransforms() {
+    const vector<ModelNode *> &nodes = _model->nodes();
+    int nodeCount = static_cast<int>(nodes.size());
+    const AnimationChannel &channel0 = _channels[0];
+    const AnimationChannel &channel1 = _channels[1];
+
+    // During a transition, blend orientations of both channels at once
+    bool blend = channel0.transition &&
+        channel0.hasPoses.size() == nodes.size() &&
+        channel1.hasPoses.size() == nodes.size();
+
+    if (blend) {
+        float transitionDelta = 1.0f - (channel0.animation->transitionTime() - channel0.time) / channel0.animation->transitionTime();
+        _blendedOrientations.resize(nodeCount);
+        slerpQuats(&channel1.orientations[0], &channel0.orientations[0], transitionDelta, nodeCount, &_blendedOrientations[0]);
     }
+    bool fallback = channel0.transition || (channel0.flags & kAnimationOverlay);
 
-    transform *= localTransform;
-    _absTransforms.insert(make_pair(modelNode.nodeNumber(), transform));
+    for (int i = 0; i < nodeCount; ++i) {
+        if (_untransformed[i]) continue;
 
-    for (auto &child : modelNode.children()) {
-        updateAbsoluteTransforms(*child, transform);
+        bool hasPose0 = i < static_cast<int>(channel0.hasPoses.size()) && channel0.hasPoses[i];
+        bool hasPose1 = i < static_cast<int>(channel1.hasPoses.size()) && channel1.hasPoses[i];
+        int parentIdx = _parentIndices[i];
+
+        _absTransforms[i] = parentIdx == -1 ? glm::mat4(1.0f) : _absTransforms[parentIdx];
+
+        if (blend && hasPose0 && hasPose1) {
+            _absTransforms[i] *= getPoseTransform(channel0.positions[i], _blendedOrientations[i]);
+        } else if (hasPose0) {
+            _absTransforms[i] *= getPoseTransform(channel0.positions[i], channel0.orientations[i]);
+        } else if (fallback && hasPose1) {
+            _absTransforms[i] *= getPoseTransform(channel1.positions[i], channel1.orientations[i]);
+        } else {
+            _absTransforms[i] *= nodes[i]->localTransform();
+        }
     }
 }
 
-void SceneNodeAnimator::updateNodeTransforms(ModelNode &modelNode) {
-    if (modelNode.skin()) return;
-
-    glm::mat4 transform(_absTransforms.find(modelNode.nodeNumber())->second);
+void SceneNodeAnimator::updateNodeTransforms() {
+    const vector<ModelNode *> &nodes = _model->nodes();
 
-    ModelNodeSceneNode *sceneNode = _modelSceneNode->getModelNodeByIndex(modelNode.index());
-    sceneNode->setLocalTransform(transform);
-    sceneNode->setBoneTransform(transform * modelNode.absoluteTransformInverse());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (_untransformed[i]) continue;
 
-    for (auto &child : modelNode.children()) {
-        updateNodeTransforms(*child);
+        ModelNodeSceneNode *sceneNode = _modelSceneNode->getModelNodeByIndex(static_cast<int>(i));
+        sceneNode->setLocalTransform(_absTransforms[i]);
+        sceneNode->setBoneTransform(_absTransforms[i] * nodes[i]->absoluteTransformInverse());
     }
 }
 
@@ -244,6 +336,7 @@ void SceneNodeAnimator::playAnimation(const string &name, int flags, float speed
     if (!set) {
         _channels[0].setAnimation(animation, flags, speed);
     }
+    _poseStale = true;
 }
 
 bool SceneNodeAnimator::isAnimationFinished() const {
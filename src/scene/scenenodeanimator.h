@@ -18,18 +18,25 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <set>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
+#include "glm/gtc/quaternion.hpp"
 #include "glm/mat4x4.hpp"
+#include "glm/vec3.hpp"
+
+#include "../render/model/modelnode.h"
+#include "../render/types.h"
 
 namespace reone {
 
 namespace render {
 
 class Animation;
-class ModelNode;
+class Model;
+struct AnimationBinding;
 
 }
 
@@ -42,13 +49,34 @@ enum AnimationFlags {
     kAnimationOverlay = 8 // overlay next animation on top of the previous one
 };
 
+/**
+ * Animation level of detail, i.e. how often transforms of a model are
+ * updated. Animation time advances every frame regardless.
+ */
+enum class AnimationLOD {
+    Full, // every frame
+    Half, // every 2nd frame
+    Quarter, // every 4th frame
+    TimeOnly // never, e.g. when a model is off-screen
+};
+
+/**
+ * @param distance distance from the camera to the model
+ * @param screenSize height of the model on screen, as a fraction of the viewport height
+ */
+AnimationLOD getAnimationLOD(const render::AnimationLODOptions &options, float distance, float screenSize);
+
 class ModelSceneNode;
 
 class SceneNodeAnimator {
 public:
     SceneNodeAnimator(ModelSceneNode *modelSceneNode, const std::set<std::string> &skipNodes);
 
-    void update(float dt);
+    /**
+     * @param skipNodes whether to skip animating nodes without meshes or bones at the quarter rate
+     * @return true if transforms of model nodes were updated
+     */
+    bool update(float dt, AnimationLOD lod = AnimationLOD::Full, bool skipNodes = false);
 
     void playDefaultAnimation();
     void playAnimation(const std::string &name, int flags = 0, float speed = 1.0f);
@@ -66,10 +94,16 @@ private:
         float speed { 1.0f };
         float time { 0.0f };
         render::Animation *animation { nullptr };
+        const render::AnimationBinding *binding { nullptr };
         bool finished { false };
         bool transition { false };
         bool freeze { false };
-        std::unordered_map<uint16_t, glm::mat4> localTransforms;
+
+        // Local poses and cursors, indexed by model node index
+        std::vector<glm::vec3> positions;
+        std::vector<glm::quat> orientations;
+        std::vector<bool> hasPoses;
+        std::vector<render::ModelNode::SampleCursor> cursors;
 
         bool isActive() const;
         bool isSameAnimation(const std::string &name, int flags, float speed) const;
@@ -82,13 +116,28 @@ private:
     std::set<std::string> _skipNodes;
     AnimationChannel _channels[kChannelCount];
     std::string _defaultAnim;
-    std::unordered_map<uint16_t, glm::mat4> _absTransforms;
-
-    void updateChannel(int channel, float dt);
+    int _lodFrame { 0 };
+    bool _poseStale { true }; // transforms must be updated regardless of LOD
+
+    // Model, that the following arrays are built for. Arrays are indexed by
+    // model node index, so that parents precede their children.
+
+    std::shared_ptr<render::Model> _model;
+    std::vector<int> _parentIndices;
+    std::vector<bool> _skipped;
+    std::vector<bool> _essential; // nodes with meshes or bones, and their ancestors
+    std::vector<bool> _untransformed; // skinned nodes and their descendants
+    std::vector<glm::quat> _blendedOrientations;
+    std::vector<glm::mat4> _absTransforms;
+
+    void bindModel();
+    void updateChannel(int channel, float dt, bool updateTransforms, bool skipNodes);
     void advanceTime(AnimationChannel &channel, float dt);
-    void updateLocalTransforms(AnimationChannel &channel, render::ModelNode &animNode);
-    void updateAbsoluteTransforms(render::ModelNode &modelNode, const glm::mat4 &parentTransform = glm::mat4(1.0f));
-    void updateNodeTransforms(render::ModelNode &modelNode);
+    void updateLocalPoses(AnimationChannel &channel, bool skipNodes);
+    void updateAbsoluteTransforms();
+    void updateNodeTransforms();
+
+    bool isUpdateDue(AnimationLOD lod);
 };
 
 } // namespace scene
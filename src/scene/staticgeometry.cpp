@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "staticgeometry.h"
+
+#include <algorithm>
+
+#include "glm/gtx/norm.hpp"
+
+#include "modelnodescenenode.h"
+#include "modelscenenode.h"
+
+using namespace std;
+
+using namespace reone::render;
+
+namespace reone {
+
+namespace scene {
+
+bool StaticGeometry::Material::operator==(const Material &other) const {
+    for (int i = 0; i < kTextureUnitCount; ++i) {
+        if (textures[i] != other.textures[i]) return false;
+    }
+    return selfIllumEnabled == other.selfIllumEnabled && selfIllumColor == other.selfIllumColor;
+}
+
+static bool isBatchable(const ModelSceneNode &model, const ModelNodeSceneNode &node) {
+    const ModelNode &modelNode = *node.modelNode();
+    return
+        !modelNode.skin() &&
+        !modelNode.mesh()->vertices().empty() &&
+        model.model()->isNodeStatic(modelNode);
+}
+
+void StaticGeometry::build(const vector<ModelSceneNode *> &models) {
+    clear();
+
+    for (int i = 0; i < static_cast<int>(models.size()); ++i) {
+        ModelSceneNode &model = *models[i];
+        _groupByModel.insert(make_pair(&model, i));
+
+        if (model.isLightingEnabled() || model.hasTextureOverride() || model.alpha() < 1.0f) continue;
+
+        vector<ModelNodeSceneNode *> batched;
+
+        for (auto &node : model.opaqueMeshes()) {
+            if (!isBatchable(model, *node)) continue;
+
+            const ModelNode &modelNode = *node->modelNode();
+            DrawItem item;
+            node->getDrawItem(item);
+
+            Material material;
+            copy(begin(item.textures), end(item.textures), material.textures);
+            material.selfIllumEnabled = modelNode.isSelfIllumEnabled();
+            if (material.selfIllumEnabled) {
+                material.selfIllumColor = modelNode.selfIllumColor();
+            }
+            getBatch(material).mesh.add(i, *modelNode.mesh(), node->absoluteTransform());
+            batched.push_back(node);
+        }
+        if (!batched.empty()) {
+            model.setMeshesBatched(batched);
+            _stats.batchedMeshes += static_cast<int>(batched.size());
+        }
+    }
+    for (auto &batch : _batches) {
+        batch->mesh.end();
+    }
+    _visible.resize(models.size(), false);
+    _stats.batches = static_cast<int>(_batches.size());
+}
+
+StaticGeometry::Batch &StaticGeometry::getBatch(const Material &material) {
+    auto maybeBatch = find_if(_batches.begin(), _batches.end(), [&material](auto &batch) { return batch->material == material; });
+    if (maybeBatch != _batches.end()) return **maybeBatch;
+
+    unique_ptr<Batch> batch(new Batch());
+    batch->material = material;
+    _batches.push_back(move(batch));
+
+    return *_batches.back();
+}
+
+void StaticGeometry::initGL() {
+    for (auto &batch : _batches) {
+        batch->mesh.initGL();
+    }
+}
+
+void StaticGeometry::clear() {
+    _batches.clear();
+    _groupByModel.clear();
+    _visible.clear();
+    _stats = StaticGeometryStats();
+}
+
+void StaticGeometry::resetVisibility() {
+    _visible.assign(_visible.size(), false);
+}
+
+void StaticGeometry::setVisible(const ModelSceneNode &model) {
+    auto maybeGroup = _groupByModel.find(&model);
+    if (maybeGroup != _groupByModel.end()) {
+        _visible[maybeGroup->second] = true;
+    }
+}
+
+void StaticGeometry::prepareFrame(const glm::vec3 &cameraPosition, RenderQueue &queue) {
+    _stats.drawCalls = 0;
+    _stats.meshesDrawn = 0;
+
+    DrawItem item;
+    item.program = ShaderProgram::ModelModel;
+
+    for (auto &batch : _batches) {
+        batch->ranges.clear();
+        batch->mesh.getRanges(_visible, batch->ranges);
+        if (batch->ranges.empty()) continue;
+
+        copy(begin(batch->material.textures), end(batch->material.textures), item.textures);
+        item.mesh = &batch->mesh;
+        item.drawable = batch.get();
+
+        queue.add(RenderPass::Opaque, item, glm::distance2(batch->mesh.aabb().center(), cameraPosition));
+
+        _stats.drawCalls += static_cast<int>(batch->ranges.size());
+        _stats.meshesDrawn += batch->mesh.getMeshCount(_visible);
+    }
+}
+
+void StaticGeometry::Batch::getUniforms(LocalUniforms &locals, bool instanced) const {
+    // Vertices of the batch are in world space, so the model matrix is left as is
+    if (material.textures[1]) {
+        locals.features.envmapEnabled = true;
+        locals.textures.envmap = 1;
+    }
+    if (material.textures[2]) {
+        locals.features.lightmapEnabled = true;
+        locals.textures.lightmap = 2;
+    }
+    if (material.textures[3]) {
+        locals.features.bumpyShinyEnabled = true;
+        locals.textures.bumpyShiny = 3;
+    }
+    if (material.textures[4]) {
+        locals.features.bumpmapEnabled = true;
+        locals.textures.bumpmap = 4;
+    }
+    if (material.selfIllumEnabled) {
+        locals.features.selfIllumEnabled = true;
+        locals.selfIllumColor = material.selfIllumColor;
+    }
+}
+
+void StaticGeometry::Batch::draw() const {
+    mesh.drawRanges(ranges);
+}
+
+const StaticGeometryStats &StaticGeometry::stats() const {
+    return _stats;
+}
+
+} // namespace scene
+
+} // namespace reone
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "glm/vec3.hpp"
+
+#include "../render/mesh/meshbatch.h"
+#include "../render/renderqueue.h"
+
+namespace reone {
+
+namespace scene {
+
+class ModelNodeSceneNode;
+class ModelSceneNode;
+
+struct StaticGeometryStats {
+    int batchedMeshes { 0 };
+    int batches { 0 };
+
+    // Updated by prepareFrame
+
+    int drawCalls { 0 };
+    int meshesDrawn { 0 }; /**< merged meshes drawn by these draw calls */
+};
+
+/**
+ * Static geometry of several models, e.g. rooms of an area, merged into one
+ * mesh batch per material. Every model is a group in these batches, so that
+ * only meshes of visible models are drawn.
+ */
+class StaticGeometry {
+public:
+    StaticGeometry() = default;
+
+    /**
+     * Merges meshes of the models that are static, opaque and not skinned,
+     * and excludes them from render lists of the models. Models with dynamic
+     * lighting are skipped.
+     */
+    void build(const std::vector<ModelSceneNode *> &models);
+
+    void initGL();
+    void clear();
+
+    /**
+     * Makes all models invisible until they are marked visible.
+     */
+    void resetVisibility();
+
+    void setVisible(const ModelSceneNode &model);
+
+    /**
+     * Adds draw items of batches, that have visible models, to the render queue.
+     */
+    void prepareFrame(const glm::vec3 &cameraPosition, render::RenderQueue &queue);
+
+    const StaticGeometryStats &stats() const;
+
+private:
+    struct Material {
+        render::Texture *textures[render::kTextureUnitCount] { nullptr };
+        bool selfIllumEnabled { false };
+        glm::vec3 selfIllumColor { 0.0f };
+
+        bool operator==(const Material &other) const;
+    };
+
+    class Batch : public render::IDrawable {
+    public:
+        Material material;
+        render::MeshBatch mesh;
+        std::vector<render::MeshBatch::Range> ranges;
+
+        void getUniforms(render::LocalUniforms &locals, bool instanced) const override;
+        void draw() const override;
+    };
+
+    std::vector<std::unique_ptr<Batch>> _batches;
+    std::unordered_map<const ModelSceneNode *, int> _groupByModel;
+    std::vector<bool> _visible;
+    StaticGeometryStats _stats;
+
+    StaticGeometry(const StaticGeometry &) = delete;
+    StaticGeometry &operator=(const StaticGeometry &) = delete;
+
+    Batch &getBatch(const Material &material);
+};
+
+} // namespace scene
+
+} // namespace reone
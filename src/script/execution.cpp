@@ -17,101 +17,88 @@
 
 #include "execution.h"
 
+#include <atomic>
+#include <chrono>
 #include <stdexcept>
 
 #include <boost/format.hpp>
 
 #include "../common/log.h"
 
+#include "profiler.h"
 #include "routine.h"
+#include "statepool.h"
 #include "util.h"
 
 using namespace std;
-using namespace std::placeholders;
 
 namespace reone {
 
 namespace script {
 
 static const int kStartInstructionOffset = 13;
+static const int kTimeBudgetCheckInterval = 64;
 
-ScriptExecution::ScriptExecution(const shared_ptr<ScriptProgram> &program, const ExecutionContext &ctx) : _context(ctx), _program(program) {
-    _handlers.insert(make_pair(ByteCode::CopyDownSP, bind(&ScriptExecution::executeCopyDownSP, this, _1)));
-    _handlers.insert(make_pair(ByteCode::Reserve, bind(&ScriptExecution::executeReserve, this, _1)));
-    _handlers.insert(make_pair(ByteCode::CopyTopSP, bind(&ScriptExecution::executeCopyTopSP, this, _1)));
-    _handlers.insert(make_pair(ByteCode::PushConstant, bind(&ScriptExecution::executePushConstant, this, _1)));
-    _handlers.insert(make_pair(ByteCode::CallRoutine, bind(&ScriptExecution::executeCallRoutine, this, _1)));
-    _handlers.insert(make_pair(ByteCode::LogicalAnd, bind(&ScriptExecution::executeLogicalAnd, this, _1)));
-    _handlers.insert(make_pair(ByteCode::LogicalOr, bind(&ScriptExecution::executeLogicalOr, this, _1)));
-    _handlers.insert(make_pair(ByteCode::InclusiveBitwiseOr, bind(&ScriptExecution::executeInclusiveBitwiseOr, this, _1)));
-    _handlers.insert(make_pair(ByteCode::ExclusiveBitwiseOr, bind(&ScriptExecution::executeExclusiveBitwiseOr, this, _1)));
-    _handlers.insert(make_pair(ByteCode::BitwiseAnd, bind(&ScriptExecution::executeBitwiseAnd, this, _1)));
-    _handlers.insert(make_pair(ByteCode::Equal, bind(&ScriptExecution::executeEqual, this, _1)));
-    _handlers.insert(make_pair(ByteCode::NotEqual, bind(&ScriptExecution::executeNotEqual, this, _1)));
-    _handlers.insert(make_pair(ByteCode::GreaterThanOrEqual, bind(&ScriptExecution::executeGreaterThanOrEqual, this, _1)));
-    _handlers.insert(make_pair(ByteCode::GreaterThan, bind(&ScriptExecution::executeGreaterThan, this, _1)));
-    _handlers.insert(make_pair(ByteCode::LessThan, bind(&ScriptExecution::executeLessThan, this, _1)));
-    _handlers.insert(make_pair(ByteCode::LessThanOrEqual, bind(&ScriptExecution::executeLessThanOrEqual, this, _1)));
-    _handlers.insert(make_pair(ByteCode::ShiftLeft, bind(&ScriptExecution::executeShiftLeft, this, _1)));
-    _handlers.insert(make_pair(ByteCode::ShiftRight, bind(&ScriptExecution::executeShiftRight, this, _1)));
-    _handlers.insert(make_pair(ByteCode::UnsignedShiftRight, bind(&ScriptExecution::executeUnsignedShiftRight, this, _1)));
-    _handlers.insert(make_pair(ByteCode::Add, bind(&ScriptExecution::executeAdd, this, _1)));
-    _handlers.insert(make_pair(ByteCode::Subtract, bind(&ScriptExecution::executeSubtract, this, _1)));
-    _handlers.insert(make_pair(ByteCode::Multiply, bind(&ScriptExecution::executeMultiply, this, _1)));
-    _handlers.insert(make_pair(ByteCode::Divide, bind(&ScriptExecution::executeDivide, this, _1)));
-    _handlers.insert(make_pair(ByteCode::Mod, bind(&ScriptExecution::executeMod, this, _1)));
-    _handlers.insert(make_pair(ByteCode::Negate, bind(&ScriptExecution::executeNegate, this, _1)));
-    _handlers.insert(make_pair(ByteCode::AdjustSP, bind(&ScriptExecution::executeAdjustSP, this, _1)));
-    _handlers.insert(make_pair(ByteCode::Jump, bind(&ScriptExecution::executeJump, this, _1)));
-    _handlers.insert(make_pair(ByteCode::JumpToSubroutine, bind(&ScriptExecution::executeJumpToSubroutine, this, _1)));
-    _handlers.insert(make_pair(ByteCode::JumpIfZero, bind(&ScriptExecution::executeJumpIfZero, this, _1)));
-    _handlers.insert(make_pair(ByteCode::Return, bind(&ScriptExecution::executeReturn, this, _1)));
-    _handlers.insert(make_pair(ByteCode::Destruct, bind(&ScriptExecution::executeDestruct, this, _1)));
-    _handlers.insert(make_pair(ByteCode::LogicalNot, bind(&ScriptExecution::executeLogicalNot, this, _1)));
-    _handlers.insert(make_pair(ByteCode::DecRelToSP, bind(&ScriptExecution::executeDecRelToSP, this, _1)));
-    _handlers.insert(make_pair(ByteCode::IncRelToSP, bind(&ScriptExecution::executeIncRelToSP, this, _1)));
-    _handlers.insert(make_pair(ByteCode::JumpIfNonZero, bind(&ScriptExecution::executeJumpIfNonZero, this, _1)));
-    _handlers.insert(make_pair(ByteCode::CopyDownBP, bind(&ScriptExecution::executeCopyDownBP, this, _1)));
-    _handlers.insert(make_pair(ByteCode::CopyTopBP, bind(&ScriptExecution::executeCopyTopBP, this, _1)));
-    _handlers.insert(make_pair(ByteCode::DecRelToBP, bind(&ScriptExecution::executeDecRelToBP, this, _1)));
-    _handlers.insert(make_pair(ByteCode::IncRelToBP, bind(&ScriptExecution::executeIncRelToBP, this, _1)));
-    _handlers.insert(make_pair(ByteCode::SaveBP, bind(&ScriptExecution::executeSaveBP, this, _1)));
-    _handlers.insert(make_pair(ByteCode::RestoreBP, bind(&ScriptExecution::executeRestoreBP, this, _1)));
-    _handlers.insert(make_pair(ByteCode::StoreState, bind(&ScriptExecution::executeStoreState, this, _1)));
-    _handlers.insert(make_pair(ByteCode::Noop, [](const Instruction &) {}));
+static atomic_bool g_runtimeChecks { false };
+
+ScriptExecution::ScriptExecution(const shared_ptr<ScriptProgram> &program, const ExecutionContext &ctx) :
+    _context(ctx),
+    _program(program),
+    _checked(g_runtimeChecks || !program->isVerified()) {
+}
+
+void ScriptExecution::setRuntimeChecks(bool enabled) {
+    g_runtimeChecks = enabled;
 }
 
 int ScriptExecution::run() {
-    debug("Script: " + _program->name());
-    uint32_t insOff = kStartInstructionOffset;
+    if (_suspended) {
+        debug("Script: resume " + _program->name(), 2);
+        _suspended = false;
+    } else {
+        debug("Script: " + _program->name());
+        _insOffset = kStartInstructionOffset;
+
+        if (_context.savedState) {
+            const ExecutionState &state = *_context.savedState;
+            size_t globalCount = state.globals ? state.globals->size() : 0;
+            _stack.reserve(globalCount + state.locals.size());
 
-    if (_context.savedState) {
-        vector<Variable> globals(_context.savedState->globals);
-        copy(globals.begin(), globals.end(), back_inserter(_stack));
-        _globalCount = static_cast<int>(_stack.size());
+            if (state.globals) {
+                copy(state.globals->begin(), state.globals->end(), back_inserter(_stack));
+            }
+            _globalCount = static_cast<int>(_stack.size());
+            _savedGlobals = state.globals;
 
-        vector<Variable> locals(_context.savedState->locals);
-        copy(locals.begin(), locals.end(), back_inserter(_stack));
+            copy(state.locals.begin(), state.locals.end(), back_inserter(_stack));
 
-        insOff = _context.savedState->insOffset;
+            _insOffset = state.insOffset;
+        }
     }
 
-    while (insOff < _program->length()) {
-        const Instruction &ins = _program->getInstruction(insOff);
-        auto handler = _handlers.find(ins.byteCode);
+    bool profile = ScriptProfiler::instance().isEnabled();
+    chrono::steady_clock::time_point startTime;
+    if (profile) {
+        startTime = chrono::steady_clock::now();
+    }
 
-        if (handler == _handlers.end()) {
-            warn("Script: not implemented: " + describeByteCode(ins.byteCode));
+    NativeScriptFunction nativeFunc = _program->nativeFunction();
+    if (nativeFunc) {
+        if (!nativeFunc(*this, _insOffset)) {
             return -1;
         }
-        _nextInstruction = ins.nextOffset;
+    } else if (!interpret()) {
+        return -1;
+    }
 
-        if (getDebugLogLevel() >= 2) {
-            debug("Script: " + describeInstruction(ins), 3);
+    if (profile) {
+        _executionMicros += chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - startTime).count();
+        if (!_suspended) {
+            ScriptProfiler::instance().recordExecution(_program->name(), _instructionCount, _routineCallCount, _executionMicros);
         }
-        handler->second(ins);
-
-        insOff = _nextInstruction;
+    }
+    if (_suspended) {
+        return -1;
     }
 
     if (!_stack.empty() && _stack.back().type == VariableType::Int) {
@@ -121,10 +108,206 @@ int ScriptExecution::run() {
     return -1;
 }
 
+bool ScriptExecution::interpret() {
+    chrono::steady_clock::time_point deadline;
+    if (_timeBudget > 0) {
+        deadline = chrono::steady_clock::now() + chrono::microseconds(_timeBudget);
+    }
+    uint64_t startCount = _instructionCount;
+
+    while (_insOffset < _program->length()) {
+        uint64_t executed = _instructionCount - startCount;
+        if (executed > 0) {
+            bool outOfInstructions = executed == _instructionBudget;
+            bool outOfTime = _timeBudget > 0 && executed % kTimeBudgetCheckInterval == 0 && chrono::steady_clock::now() >= deadline;
+            if (outOfInstructions || outOfTime) {
+                _suspended = true;
+                return true;
+            }
+        }
+        const Instruction &ins = _program->getInstruction(_insOffset);
+        if (getDebugLogLevel() >= 2) {
+            debug("Script: " + describeInstruction(ins), 3);
+        }
+        if (!executeInstruction(ins)) {
+            return false;
+        }
+        _insOffset = _nextInstruction;
+    }
+
+    return true;
+}
+
+bool ScriptExecution::executeInstruction(const Instruction &ins) {
+    _nextInstruction = ins.nextOffset;
+    ++_instructionCount;
+
+    switch (ins.byteCode) {
+        case ByteCode::CopyDownSP:
+            executeCopyDownSP(ins);
+            break;
+        case ByteCode::Reserve:
+            executeReserve(ins);
+            break;
+        case ByteCode::CopyTopSP:
+            executeCopyTopSP(ins);
+            break;
+        case ByteCode::PushConstant:
+            executePushConstant(ins);
+            break;
+        case ByteCode::CallRoutine:
+            executeCallRoutine(ins);
+            break;
+        case ByteCode::LogicalAnd:
+            executeLogicalAnd(ins);
+            break;
+        case ByteCode::LogicalOr:
+            executeLogicalOr(ins);
+            break;
+        case ByteCode::InclusiveBitwiseOr:
+            executeInclusiveBitwiseOr(ins);
+            break;
+        case ByteCode::ExclusiveBitwiseOr:
+            executeExclusiveBitwiseOr(ins);
+            break;
+        case ByteCode::BitwiseAnd:
+            executeBitwiseAnd(ins);
+            break;
+        case ByteCode::Equal:
+            executeEqual(ins);
+            break;
+        case ByteCode::NotEqual:
+            executeNotEqual(ins);
+            break;
+        case ByteCode::GreaterThanOrEqual:
+            executeGreaterThanOrEqual(ins);
+            break;
+        case ByteCode::GreaterThan:
+            executeGreaterThan(ins);
+            break;
+        case ByteCode::LessThan:
+            executeLessThan(ins);
+            break;
+        case ByteCode::LessThanOrEqual:
+            executeLessThanOrEqual(ins);
+            break;
+        case ByteCode::ShiftLeft:
+            executeShiftLeft(ins);
+            break;
+        case ByteCode::ShiftRight:
+            executeShiftRight(ins);
+            break;
+        case ByteCode::UnsignedShiftRight:
+            executeUnsignedShiftRight(ins);
+            break;
+        case ByteCode::Add:
+            executeAdd(ins);
+            break;
+        case ByteCode::Subtract:
+            executeSubtract(ins);
+            break;
+        case ByteCode::Multiply:
+            executeMultiply(ins);
+            break;
+        case ByteCode::Divide:
+            executeDivide(ins);
+            break;
+        case ByteCode::Mod:
+            executeMod(ins);
+            break;
+        case ByteCode::Negate:
+            executeNegate(ins);
+            break;
+        case ByteCode::AdjustSP:
+            executeAdjustSP(ins);
+            break;
+        case ByteCode::Jump:
+            executeJump(ins);
+            break;
+        case ByteCode::JumpToSubroutine:
+            executeJumpToSubroutine(ins);
+            break;
+        case ByteCode::JumpIfZero:
+            executeJumpIfZero(ins);
+            break;
+        case ByteCode::Return:
+            executeReturn(ins);
+            break;
+        case ByteCode::Destruct:
+            executeDestruct(ins);
+            break;
+        case ByteCode::LogicalNot:
+            executeLogicalNot(ins);
+            break;
+        case ByteCode::DecRelToSP:
+            executeDecRelToSP(ins);
+            break;
+        case ByteCode::IncRelToSP:
+            executeIncRelToSP(ins);
+            break;
+        case ByteCode::JumpIfNonZero:
+            executeJumpIfNonZero(ins);
+            break;
+        case ByteCode::CopyDownBP:
+            executeCopyDownBP(ins);
+            break;
+        case ByteCode::CopyTopBP:
+            executeCopyTopBP(ins);
+            break;
+        case ByteCode::DecRelToBP:
+            executeDecRelToBP(ins);
+            break;
+        case ByteCode::IncRelToBP:
+            executeIncRelToBP(ins);
+            break;
+        case ByteCode::SaveBP:
+            executeSaveBP(ins);
+            break;
+        case ByteCode::RestoreBP:
+            executeRestoreBP(ins);
+            break;
+        case ByteCode::StoreState:
+            executeStoreState(ins);
+            break;
+        case ByteCode::Noop:
+            break;
+        default:
+            warn("Script: not implemented: " + describeByteCode(ins.byteCode));
+            return false;
+    }
+
+    return true;
+}
+
+uint32_t ScriptExecution::nextInstruction() const {
+    return _nextInstruction;
+}
+
+vector<Variable> &ScriptExecution::stack() {
+    return _stack;
+}
+
+void ScriptExecution::countInstructions(uint32_t count) {
+    _instructionCount += count;
+}
+
+void ScriptExecution::setInstructionBudget(uint32_t count) {
+    _instructionBudget = count;
+}
+
+void ScriptExecution::setTimeBudget(uint32_t micros) {
+    _timeBudget = micros;
+}
+
+bool ScriptExecution::isSuspended() const {
+    return _suspended;
+}
+
 void ScriptExecution::executeCopyDownSP(const Instruction &ins) {
     int count = ins.size / 4;
     int srcIdx = static_cast<int>(_stack.size()) - count;
     int dstIdx = static_cast<int>(_stack.size()) + ins.stackOffset / 4;
+    invalidateSavedGlobals(dstIdx);
 
     for (int i = 0; i < count; ++i) {
         _stack[dstIdx++] = _stack[srcIdx++];
@@ -199,7 +382,7 @@ void ScriptExecution::executePushConstant(const Instruction &ins) {
 void ScriptExecution::executeCallRoutine(const Instruction &ins) {
     const Routine &routine = _context.routines->get(ins.routine);
 
-    if (ins.argCount > routine.argumentCount()) {
+    if (_checked && ins.argCount > routine.argumentCount()) {
         throw runtime_error("Script: too many routine arguments");
     }
     vector<Variable> args;
@@ -213,15 +396,19 @@ void ScriptExecution::executeCallRoutine(const Instruction &ins) {
                 break;
 
             case VariableType::Action: {
+                if (_checked && !_savedState) {
+                    throw runtime_error("Script: action argument without a stored state");
+                }
                 ExecutionContext ctx(_context);
-                ctx.savedState = make_shared<ExecutionState>(_savedState);
-                args.push_back(ctx);
+                ctx.savedState = _savedState;
+                ctx.commands = nullptr;
+                args.push_back(move(ctx));
                 break;
             }
             default:
                 Variable var(_stack.back());
 
-                if (var.type != type) {
+                if (_checked && var.type != type) {
                     throw runtime_error("Script: invalid argument variable type");
                 }
                 args.push_back(move(var));
@@ -230,6 +417,7 @@ void ScriptExecution::executeCallRoutine(const Instruction &ins) {
         }
     }
     Variable retValue = routine.invoke(args, _context);
+    ++_routineCallCount;
 
     if (getDebugLogLevel() >= 2) {
         debug(boost::format("Script: %s -> %s") % routine.name() % retValue.toString(), 2);
@@ -259,7 +447,7 @@ Variable ScriptExecution::getVectorFromStack() {
 Variable ScriptExecution::getFloatFromStack() {
     Variable var(_stack.back());
 
-    if (var.type != VariableType::Float) {
+    if (_checked && var.type != VariableType::Float) {
         throw runtime_error("Script: invalid variable type for a vector component");
     }
     _stack.pop_back();
@@ -447,6 +635,7 @@ void ScriptExecution::executeAdjustSP(const Instruction &ins) {
     for (int i = 0; i < count; ++i) {
         _stack.pop_back();
     }
+    invalidateSavedGlobals(static_cast<int>(_stack.size()));
 }
 
 void ScriptExecution::executeJump(const Instruction &ins) {
@@ -480,6 +669,7 @@ void ScriptExecution::executeDestruct(const Instruction &ins) {
     int startIdx = static_cast<int>(_stack.size()) - ins.size / 4;
     int startIdxNoDestroy = startIdx + ins.stackOffset / 4;
     int countNoDestroy = ins.sizeNoDestroy / 4;
+    invalidateSavedGlobals(startIdx);
 
     for (int i = 0; i < countNoDestroy; ++i) {
         _stack[startIdx + i] = _stack[startIdxNoDestroy + i];
@@ -489,11 +679,13 @@ void ScriptExecution::executeDestruct(const Instruction &ins) {
 
 void ScriptExecution::executeDecRelToSP(const Instruction &ins) {
     int dstIdx = static_cast<int>(_stack.size()) + ins.stackOffset / 4;
+    invalidateSavedGlobals(dstIdx);
     _stack[dstIdx].intValue--;
 }
 
 void ScriptExecution::executeIncRelToSP(const Instruction &ins) {
     int dstIdx = static_cast<int>(_stack.size()) + ins.stackOffset / 4;
+    invalidateSavedGlobals(dstIdx);
     _stack[dstIdx].intValue++;
 }
 
@@ -517,6 +709,7 @@ void ScriptExecution::executeCopyDownBP(const Instruction &ins) {
     int count = ins.size / 4;
     int srcIdx = static_cast<int>(_stack.size()) - count;
     int dstIdx = _globalCount + ins.stackOffset / 4;
+    invalidateSavedGlobals(dstIdx);
 
     for (int i = 0; i < count; ++i) {
         _stack[dstIdx++] = _stack[srcIdx++];
@@ -534,43 +727,53 @@ void ScriptExecution::executeCopyTopBP(const Instruction &ins) {
 
 void ScriptExecution::executeDecRelToBP(const Instruction &ins) {
     int dstIdx = _globalCount + ins.stackOffset / 4;
+    invalidateSavedGlobals(dstIdx);
     _stack[dstIdx].intValue--;
 }
 
 void ScriptExecution::executeIncRelToBP(const Instruction &ins) {
     int dstIdx = _globalCount + ins.stackOffset / 4;
+    invalidateSavedGlobals(dstIdx);
     _stack[dstIdx].intValue++;
 }
 
 void ScriptExecution::executeSaveBP(const Instruction &ins) {
     _globalCount = static_cast<int>(_stack.size());
     _stack.push_back(_globalCount);
+    _savedGlobals.reset();
 }
 
 void ScriptExecution::executeRestoreBP(const Instruction &ins) {
     _globalCount = _stack.back().intValue;
     _stack.pop_back();
+    _savedGlobals.reset();
 }
 
 void ScriptExecution::executeStoreState(const Instruction &ins) {
     int count = ins.size / 4;
-    int srcIdx = _globalCount - count;
-
-    _savedState.globals.clear();
-    for (int i = 0; i < count; ++i) {
-        _savedState.globals.push_back(_stack[srcIdx++]);
+    if (!_savedGlobals || static_cast<int>(_savedGlobals->size()) != count) {
+        auto begin = _stack.begin() + (_globalCount - count);
+        _savedGlobals = make_shared<const vector<Variable>>(begin, begin + count);
     }
 
-    count = ins.sizeLocals / 4;
-    srcIdx = static_cast<int>(_stack.size()) - count;
+    int localCount = ins.sizeLocals / 4;
+    auto localsBegin = _stack.end() - localCount;
 
-    _savedState.locals.clear();
-    for (int i = 0; i < count; ++i) {
-        _savedState.locals.push_back(_stack[srcIdx++]);
+    _savedState = ExecutionStatePool::instance().acquire();
+    _savedState->program = _program;
+    _savedState->globals = _savedGlobals;
+    _savedState->locals.assign(localsBegin, _stack.end());
+    _savedState->insOffset = ins.offset + static_cast<int>(ins.type);
+}
+
+void ScriptExecution::invalidateSavedGlobals(int stackIdx) {
+    if (stackIdx < _globalCount) {
+        _savedGlobals.reset();
     }
+}
 
-    _savedState.program = _program;
-    _savedState.insOffset = ins.offset + static_cast<int>(ins.type);
+uint64_t ScriptExecution::instructionCount() const {
+    return _instructionCount;
 }
 
 int ScriptExecution::stackSize() const {
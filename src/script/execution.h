@@ -17,10 +17,8 @@
 
 #pragma once
 
-#include <functional>
 #include <memory>
 #include <vector>
-#include <unordered_map>
 
 #include "program.h"
 #include "types.h"
@@ -30,24 +28,70 @@ namespace reone {
 
 namespace script {
 
-class ScriptExecution {
+class ScriptExecution : public IInstructionExecutor {
 public:
     ScriptExecution(const std::shared_ptr<ScriptProgram> &program, const ExecutionContext &ctx);
 
+    /**
+     * Executes the program until it ends or the instruction/time budget is
+     * exhausted. In the latter case, execution is suspended and can be
+     * resumed by calling run again. Natively compiled scripts are not
+     * subject to budgets.
+     *
+     * @return integer on top of the stack if the program has ended, -1 otherwise
+     */
     int run();
 
+    /**
+     * @param count maximum number of instructions per call to run, 0 for no limit
+     */
+    void setInstructionBudget(uint32_t count);
+
+    /**
+     * @param micros maximum duration of a call to run, 0 for no limit
+     */
+    void setTimeBudget(uint32_t micros);
+
+    bool isSuspended() const;
+
+    /**
+     * @param enabled whether to type-check verified programs at runtime, as if they were not verified
+     */
+    static void setRuntimeChecks(bool enabled);
+
+    bool executeInstruction(const Instruction &ins) override;
+    uint32_t nextInstruction() const override;
+    std::vector<Variable> &stack() override;
+
+    /**
+     * Stops sharing saved globals with subsequent saved states, if the stack
+     * element at the specified index is a global variable.
+     */
+    void invalidateSavedGlobals(int stackIdx) override;
+
+    void countInstructions(uint32_t count) override;
+
+    uint64_t instructionCount() const;
     int stackSize() const;
     const Variable &getStackVariable(int index) const;
 
 private:
     std::shared_ptr<ScriptProgram> _program;
     ExecutionContext _context;
-    std::unordered_map<ByteCode, std::function<void(const Instruction &)>> _handlers;
     std::vector<Variable> _stack;
     std::vector<uint32_t> _returnOffsets;
+    uint32_t _insOffset { 0 };
     uint32_t _nextInstruction { 0 };
+    bool _suspended { false };
+    bool _checked { true };
+    uint32_t _instructionBudget { 0 };
+    uint32_t _timeBudget { 0 };
+    uint64_t _executionMicros { 0 };
     int _globalCount { 0 };
-    ExecutionState _savedState;
+    uint64_t _instructionCount { 0 };
+    uint64_t _routineCallCount { 0 };
+    std::shared_ptr<ExecutionState> _savedState;
+    std::shared_ptr<const std::vector<Variable>> _savedGlobals;
 
     ScriptExecution(const ScriptExecution &) = delete;
     ScriptExecution &operator=(const ScriptExecution &) = delete;
@@ -97,6 +141,11 @@ private:
     void executeSaveBP(const Instruction &ins);
     void executeRestoreBP(const Instruction &ins);
     void executeStoreState(const Instruction &ins);
+
+    /**
+     * @return false if an instruction could not be executed, true otherwise
+     */
+    bool interpret();
 };
 
 } // namespace script
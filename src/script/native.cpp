@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "native.h"
+
+#include <cctype>
+
+using namespace std;
+
+namespace reone {
+
+namespace script {
+
+static const char kNativeScriptSymbolPrefix[] = "reone_ncs_";
+
+string getNativeScriptSymbol(const string &resRef) {
+    string result(kNativeScriptSymbolPrefix);
+    for (auto &ch : resRef) {
+        result.push_back(isalnum(static_cast<unsigned char>(ch)) ? tolower(ch) : '_');
+    }
+    return move(result);
+}
+
+} // namespace script
+
+} // namespace reone
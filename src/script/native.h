@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "program.h"
+#include "types.h"
+#include "variable.h"
+
+#ifdef _WIN32
+#define REONE_NATIVE_SCRIPT_EXPORT __declspec(dllexport)
+#else
+#define REONE_NATIVE_SCRIPT_EXPORT __attribute__((visibility("default")))
+#endif
+
+namespace reone {
+
+namespace script {
+
+/**
+ * Used by scripts compiled ahead of time to construct their instructions.
+ *
+ * @param size argument count if byteCode is CallRoutine, instruction size otherwise
+ * @param value raw value of the routine/constant/size union
+ */
+inline Instruction makeInstruction(uint32_t offset, ByteCode byteCode, InstructionType type, uint32_t nextOffset, int stackOffset, int size, int value, const char *strValue = "") {
+    Instruction ins;
+    ins.offset = offset;
+    ins.byteCode = byteCode;
+    ins.type = type;
+    ins.nextOffset = nextOffset;
+    ins.strValue = strValue;
+    ins.stackOffset = stackOffset;
+    if (byteCode == ByteCode::CallRoutine) {
+        ins.argCount = size;
+    } else {
+        ins.size = size;
+    }
+    ins.intValue = value;
+
+    return ins;
+}
+
+/**
+ * @return name of the symbol, exported by a native script library for the specified script
+ */
+std::string getNativeScriptSymbol(const std::string &resRef);
+
+} // namespace script
+
+} // namespace reone
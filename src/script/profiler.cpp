@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "profiler.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+#include <boost/format.hpp>
+
+#include "../common/log.h"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace reone {
+
+namespace script {
+
+static const char kDefaultDumpFilename[] = "scriptprofile.txt";
+static const int kDumpScriptCount = 50;
+
+ScriptProfiler &ScriptProfiler::instance() {
+    static ScriptProfiler profiler;
+    return profiler;
+}
+
+ScriptProfiler::ScriptProfiler() : _dumpPath(kDefaultDumpFilename) {
+}
+
+void ScriptProfiler::reset() {
+    lock_guard<mutex> lock(_profilesMutex);
+    _profiles.clear();
+    _dumpTimer = 0.0f;
+}
+
+void ScriptProfiler::update(float dt) {
+    if (!_enabled || _dumpInterval <= 0.0f) return;
+
+    _dumpTimer += dt;
+    if (_dumpTimer >= _dumpInterval) {
+        _dumpTimer = 0.0f;
+        dump();
+    }
+}
+
+void ScriptProfiler::recordExecution(const string &programName, uint64_t instructionCount, uint64_t routineCallCount, uint64_t timeMicros) {
+    lock_guard<mutex> lock(_profilesMutex);
+
+    ScriptProfile &profile = _profiles[programName];
+    profile.name = programName;
+    profile.executionCount++;
+    profile.instructionCount += instructionCount;
+    profile.routineCallCount += routineCallCount;
+    profile.timeMicros += timeMicros;
+}
+
+void ScriptProfiler::recordInvocation(const string &programName) {
+    lock_guard<mutex> lock(_profilesMutex);
+
+    ScriptProfile &profile = _profiles[programName];
+    profile.name = programName;
+    profile.invocationCount++;
+}
+
+vector<ScriptProfile> ScriptProfiler::getHotScripts(int count) const {
+    vector<ScriptProfile> result;
+    {
+        lock_guard<mutex> lock(_profilesMutex);
+        result.reserve(_profiles.size());
+        for (auto &profile : _profiles) {
+            result.push_back(profile.second);
+        }
+    }
+    sort(result.begin(), result.end(), [](const ScriptProfile &left, const ScriptProfile &right) {
+        if (left.timeMicros != right.timeMicros) return left.timeMicros > right.timeMicros;
+        return left.instructionCount > right.instructionCount;
+    });
+    if (count >= 0 && static_cast<int>(result.size()) > count) {
+        result.resize(count);
+    }
+
+    return move(result);
+}
+
+string ScriptProfiler::getReport(int count) const {
+    ostringstream ss;
+    ss << boost::format("%-20s %8s %8s %12s %10s %12s") % "script" % "invoked" % "executed" % "instructions" % "routines" % "time (us)" << endl;
+
+    for (auto &profile : getHotScripts(count)) {
+        ss << boost::format("%-20s %8d %8d %12d %10d %12d")
+            % profile.name
+            % profile.invocationCount
+            % profile.executionCount
+            % profile.instructionCount
+            % profile.routineCallCount
+            % profile.timeMicros << endl;
+    }
+
+    return ss.str();
+}
+
+void ScriptProfiler::dump() const {
+    fs::ofstream out(_dumpPath);
+    if (!out) {
+        warn("ScriptProfiler: unable to open dump file: " + _dumpPath.string());
+        return;
+    }
+    out << getReport(kDumpScriptCount);
+}
+
+void ScriptProfiler::setEnabled(bool enabled) {
+    _enabled = enabled;
+}
+
+void ScriptProfiler::setDumpPath(const fs::path &path) {
+    _dumpPath = path;
+}
+
+void ScriptProfiler::setDumpInterval(float interval) {
+    _dumpInterval = interval;
+}
+
+} // namespace script
+
+} // namespace reone
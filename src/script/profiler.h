@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/filesystem/path.hpp>
+
+namespace reone {
+
+namespace script {
+
+struct ScriptProfile {
+    std::string name;
+    uint32_t invocationCount { 0 };
+    uint32_t executionCount { 0 };
+    uint64_t instructionCount { 0 };
+    uint64_t routineCallCount { 0 };
+    uint64_t timeMicros { 0 };
+};
+
+/**
+ * Collects per-program statistics of script execution. Disabled by default,
+ * in which case instrumented code pays a single branch per execution.
+ */
+class ScriptProfiler {
+public:
+    static ScriptProfiler &instance();
+
+    void reset();
+
+    /**
+     * Writes a report to the dump file every `interval` seconds while enabled.
+     */
+    void update(float dt);
+
+    void recordExecution(const std::string &programName, uint64_t instructionCount, uint64_t routineCallCount, uint64_t timeMicros);
+
+    void recordInvocation(const std::string &programName);
+
+    /**
+     * @return top `count` profiles, ordered by descending wall time
+     */
+    std::vector<ScriptProfile> getHotScripts(int count) const;
+
+    std::string getReport(int count) const;
+    void dump() const;
+
+    bool isEnabled() const { return _enabled; }
+
+    void setEnabled(bool enabled);
+    void setDumpPath(const boost::filesystem::path &path);
+    void setDumpInterval(float interval);
+
+private:
+    std::atomic_bool _enabled { false };
+    std::unordered_map<std::string, ScriptProfile> _profiles;
+    mutable std::mutex _profilesMutex;
+    boost::filesystem::path _dumpPath;
+    float _dumpInterval { 0.0f };
+    float _dumpTimer { 0.0f };
+
+    ScriptProfiler();
+    ScriptProfiler(const ScriptProfiler &) = delete;
+    ScriptProfiler &operator=(const ScriptProfiler &) = delete;
+};
+
+} // namespace script
+
+} // namespace reone
@@ -46,10 +46,30 @@ const Instruction &ScriptProgram::getInstruction(uint32_t offset) const {
     return _instructions.find(offset)->second;
 }
 
+const unordered_map<uint32_t, Instruction> &ScriptProgram::instructions() const {
+    return _instructions;
+}
+
+NativeScriptFunction ScriptProgram::nativeFunction() const {
+    return _nativeFunction;
+}
+
+bool ScriptProgram::isVerified() const {
+    return _verified;
+}
+
 void ScriptProgram::setLength(uint32_t length) {
     _length = length;
 }
 
+void ScriptProgram::setNativeFunction(NativeScriptFunction function) {
+    _nativeFunction = function;
+}
+
+void ScriptProgram::setVerified(bool verified) {
+    _verified = verified;
+}
+
 } // namespace script
 
 } // namespace reone
@@ -20,6 +20,8 @@
 #include <string>
 #include <unordered_map>
 
+#include "types.h"
+
 namespace reone {
 
 namespace script {
@@ -137,13 +139,24 @@ public:
     const std::string &name() const;
     uint32_t length() const;
     const Instruction &getInstruction(uint32_t offset) const;
+    const std::unordered_map<uint32_t, Instruction> &instructions() const;
+    NativeScriptFunction nativeFunction() const;
+
+    /**
+     * @return true if program has passed ScriptVerifier, false otherwise
+     */
+    bool isVerified() const;
 
     void setLength(uint32_t length);
+    void setNativeFunction(NativeScriptFunction function);
+    void setVerified(bool verified);
 
 private:
     std::string _name;
     uint32_t _length { 0 };
     std::unordered_map<uint32_t, Instruction> _instructions;
+    NativeScriptFunction _nativeFunction { nullptr };
+    bool _verified { false };
 
     ScriptProgram(const ScriptProgram &) = delete;
     ScriptProgram &operator=(const ScriptProgram &) = delete;
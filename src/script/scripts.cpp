@@ -17,15 +17,22 @@
 
 #include "scripts.h"
 
+#include <boost/format.hpp>
+
 #include "../resource/resources.h"
+#include "../common/log.h"
 #include "../common/streamutil.h"
 
+#include "native.h"
 #include "ncsfile.h"
+#include "verifier.h"
 
 using namespace std;
 
 using namespace reone::resource;
 
+namespace fs = boost::filesystem;
+
 namespace reone {
 
 namespace script {
@@ -39,6 +46,19 @@ void Scripts::invalidateCache() {
     _cache.clear();
 }
 
+void Scripts::loadNativeLibrary(const fs::path &path) {
+    boost::system::error_code ec;
+    _nativeLibrary.load(path, ec);
+
+    if (ec) {
+        warn(boost::format("Scripts: unable to load native library \"%s\": %s") % path.string() % ec.message());
+        return;
+    }
+    info("Scripts: native library loaded: " + path.string());
+
+    invalidateCache();
+}
+
 shared_ptr<ScriptProgram> Scripts::get(const string &resRef) {
     auto maybeModel = _cache.find(resRef);
     if (maybeModel != _cache.end()) {
@@ -57,11 +77,30 @@ shared_ptr<ScriptProgram> Scripts::doGet(const string &resRef) {
         NcsFile ncs(resRef);
         ncs.load(wrap(data));
         program = ncs.program();
+
+        if (_routines) {
+            ScriptVerifier verifier(*program, *_routines);
+            if (verifier.verify()) {
+                program->setVerified(true);
+            } else {
+                warn(boost::format("Scripts: \"%s\" failed verification at %08x: %s") % resRef % verifier.errorOffset() % verifier.errorMessage());
+            }
+        }
+
+        string symbol(getNativeScriptSymbol(resRef));
+        if (_nativeLibrary.is_loaded() && _nativeLibrary.has(symbol)) {
+            program->setNativeFunction(_nativeLibrary.get<bool(IInstructionExecutor &, uint32_t)>(symbol));
+        }
     }
 
     return move(program);
 }
 
+void Scripts::setRoutines(IRoutineProvider *routines) {
+    _routines = routines;
+    invalidateCache();
+}
+
 } // namespace script
 
 } // namespace reone
@@ -21,12 +21,16 @@
 #include <memory>
 #include <unordered_map>
 
+#include <boost/dll/shared_library.hpp>
+#include <boost/filesystem/path.hpp>
+
 #include "../resource/types.h"
 
 namespace reone {
 
 namespace script {
 
+class IRoutineProvider;
 class ScriptProgram;
 
 class Scripts {
@@ -35,10 +39,24 @@ public:
 
     void invalidateCache();
 
+    /**
+     * Loads a shared library of scripts, compiled ahead of time by reone-tools.
+     * Programs that have a native counterpart in this library are executed natively.
+     */
+    void loadNativeLibrary(const boost::filesystem::path &path);
+
     std::shared_ptr<ScriptProgram> get(const std::string &resRef);
 
+    /**
+     * Sets routines, against which programs are verified on load. Without
+     * routines, programs are not verified and always run with runtime checks.
+     */
+    void setRoutines(IRoutineProvider *routines);
+
 private:
     std::unordered_map<std::string, std::shared_ptr<ScriptProgram>> _cache;
+    boost::dll::shared_library _nativeLibrary;
+    IRoutineProvider *_routines { nullptr };
 
     Scripts() = default;
     Scripts(const Scripts &) = delete;
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "statepool.h"
+
+#include "variable.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace script {
+
+static const int kMaxFreeStateCount = 256;
+
+ExecutionStatePool &ExecutionStatePool::instance() {
+    static ExecutionStatePool pool;
+    return pool;
+}
+
+ExecutionStatePool::~ExecutionStatePool() {
+    for (auto &state : _free) {
+        delete state;
+    }
+}
+
+shared_ptr<ExecutionState> ExecutionStatePool::acquire() {
+    ExecutionState *state = nullptr;
+    {
+        lock_guard<mutex> lock(_freeMutex);
+        if (!_free.empty()) {
+            state = _free.back();
+            _free.pop_back();
+        }
+    }
+    if (state) {
+        ++_reusedCount;
+    } else {
+        state = new ExecutionState();
+        ++_allocatedCount;
+    }
+
+    return shared_ptr<ExecutionState>(state, [this](ExecutionState *state) { release(state); });
+}
+
+void ExecutionStatePool::release(ExecutionState *state) {
+    state->program.reset();
+    state->globals.reset();
+    state->locals.clear();
+    state->insOffset = 0;
+
+    lock_guard<mutex> lock(_freeMutex);
+    if (_free.size() < kMaxFreeStateCount) {
+        _free.push_back(state);
+    } else {
+        delete state;
+    }
+}
+
+} // namespace script
+
+} // namespace reone
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "types.h"
+
+namespace reone {
+
+namespace script {
+
+/**
+ * Recycles execution states, saved by STORE_STATE instructions. Released
+ * states keep the capacity of their locals, so that delayed actions, which
+ * are stored over and over again, do not reallocate them.
+ */
+class ExecutionStatePool {
+public:
+    static ExecutionStatePool &instance();
+
+    ~ExecutionStatePool();
+
+    /**
+     * @return an empty execution state, which returns to the pool when its last reference is released
+     */
+    std::shared_ptr<ExecutionState> acquire();
+
+    int allocatedCount() const { return _allocatedCount; }
+    int reusedCount() const { return _reusedCount; }
+
+private:
+    std::vector<ExecutionState *> _free;
+    std::mutex _freeMutex;
+    std::atomic_int _allocatedCount { 0 };
+    std::atomic_int _reusedCount { 0 };
+
+    ExecutionStatePool() = default;
+    ExecutionStatePool(const ExecutionStatePool &) = delete;
+    ExecutionStatePool &operator=(const ExecutionStatePool &) = delete;
+
+    void release(ExecutionState *state);
+};
+
+} // namespace script
+
+} // namespace reone
@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "transpiler.h"
+
+#include <algorithm>
+
+#include <boost/format.hpp>
+
+#include "native.h"
+#include "util.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace script {
+
+static string escapeString(const string &s) {
+    string result;
+    for (auto &ch : s) {
+        unsigned char uch = static_cast<unsigned char>(ch);
+        if (ch == '"' || ch == '\\') {
+            result.push_back('\\');
+            result.push_back(ch);
+        } else if (uch < 0x20 || uch >= 0x7f) {
+            result += str(boost::format("\\%03o") % static_cast<int>(uch));
+        } else {
+            result.push_back(ch);
+        }
+    }
+    return move(result);
+}
+
+NcsTranspiler::NcsTranspiler(const shared_ptr<ScriptProgram> &program) : _program(program) {
+    if (!program) {
+        throw invalid_argument("program must not be null");
+    }
+}
+
+void NcsTranspiler::transpile(ostream &out) {
+    _instructions.clear();
+    _offsets.clear();
+
+    for (auto &pair : _program->instructions()) {
+        _instructions.push_back(&pair.second);
+        _offsets.insert(pair.first);
+    }
+    sort(_instructions.begin(), _instructions.end(), [](const Instruction *left, const Instruction *right) {
+        return left->offset < right->offset;
+    });
+
+    out << "// Generated by reone-tools from " << _program->name() << ". Do not edit." << endl
+        << endl
+        << "#include \"script/native.h\"" << endl
+        << endl
+        << "using namespace reone::script;" << endl
+        << endl;
+
+    writeInstructions(out);
+    writeFunction(out);
+}
+
+void NcsTranspiler::writeInstructions(ostream &out) const {
+    out << "static const uint32_t kLength = " << _program->length() << ";" << endl
+        << endl
+        << "static const Instruction g_instructions[] = {" << endl;
+
+    for (size_t i = 0; i < _instructions.size(); ++i) {
+        const Instruction &ins = *_instructions[i];
+        int size = ins.byteCode == ByteCode::CallRoutine ? ins.argCount : ins.size;
+
+        out << boost::format("    makeInstruction(%d, static_cast<ByteCode>(0x%02x), static_cast<InstructionType>(0x%02x), %d, %d, %d, %d")
+            % ins.offset
+            % static_cast<int>(ins.byteCode)
+            % static_cast<int>(ins.type)
+            % ins.nextOffset
+            % ins.stackOffset
+            % size
+            % ins.intValue;
+
+        if (!ins.strValue.empty()) {
+            out << ", \"" << escapeString(ins.strValue) << "\"";
+        }
+        out << ")" << (i + 1 < _instructions.size() ? "," : "") << " // " << escapeString(describeInstruction(ins)) << endl;
+    }
+
+    out << "};" << endl
+        << endl;
+}
+
+void NcsTranspiler::writeFunction(ostream &out) const {
+    out << "extern \"C\" REONE_NATIVE_SCRIPT_EXPORT bool " << getNativeScriptSymbol(_program->name()) << "(IInstructionExecutor &exec, uint32_t offset) {" << endl
+        << "    std::vector<Variable> &stack = exec.stack();" << endl
+        << "    uint32_t instructionCount = 0;" << endl
+        << endl
+        << "dispatch:" << endl
+        << "    switch (offset) {" << endl;
+
+    for (auto &ins : _instructions) {
+        out << boost::format("        case %d: goto ins_%d;") % ins->offset % ins->offset << endl;
+    }
+    out << "        default:" << endl
+        << "            exec.countInstructions(instructionCount);" << endl
+        << "            return offset >= kLength;" << endl
+        << "    }" << endl;
+
+    for (size_t i = 0; i < _instructions.size(); ++i) {
+        const Instruction &ins = *_instructions[i];
+        uint32_t fallthroughOffset = i + 1 < _instructions.size() ? _instructions[i + 1]->offset : _program->length();
+
+        out << endl
+            << "ins_" << ins.offset << ":" << endl;
+
+        string call(str(boost::format("exec.executeInstruction(g_instructions[%d])") % i));
+
+        switch (ins.byteCode) {
+            case ByteCode::Jump:
+                out << "    ++instructionCount;" << endl;
+                writeJump(out, ins.jumpOffset);
+                break;
+
+            case ByteCode::JumpToSubroutine:
+                out << "    " << call << ";" << endl;
+                writeJump(out, ins.jumpOffset);
+                break;
+
+            case ByteCode::JumpIfZero:
+            case ByteCode::JumpIfNonZero:
+                out << "    ++instructionCount;" << endl
+                    << "    {" << endl
+                    << "        bool zero = stack.back().intValue == 0;" << endl
+                    << "        stack.pop_back();" << endl
+                    << "        if (" << (ins.byteCode == ByteCode::JumpIfZero ? "zero" : "!zero") << ") {" << endl;
+                writeJump(out, ins.jumpOffset, 3);
+                out << "        }" << endl
+                    << "    }" << endl;
+                if (ins.nextOffset != fallthroughOffset) {
+                    writeJump(out, ins.nextOffset);
+                }
+                break;
+
+            case ByteCode::Return:
+                out << "    " << call << ";" << endl
+                    << "    offset = exec.nextInstruction();" << endl
+                    << "    goto dispatch;" << endl;
+                break;
+
+            case ByteCode::OnesComplement:
+            case ByteCode::Invalid:
+                out << "    exec.countInstructions(instructionCount);" << endl
+                    << "    return " << call << ";" << endl;
+                break;
+
+            default:
+                if (writeInlineInstruction(out, ins, static_cast<int>(i))) {
+                    out << "    ++instructionCount;" << endl;
+                } else {
+                    out << "    " << call << ";" << endl;
+                }
+                if (ins.nextOffset != fallthroughOffset) {
+                    writeJump(out, ins.nextOffset);
+                }
+                break;
+        }
+    }
+
+    out << endl
+        << "    exec.countInstructions(instructionCount);" << endl
+        << "    return true;" << endl
+        << "}" << endl;
+}
+
+static const char *getBinaryOperator(ByteCode byteCode) {
+    switch (byteCode) {
+        case ByteCode::Add:
+            return "+";
+        case ByteCode::Subtract:
+            return "-";
+        case ByteCode::Multiply:
+            return "*";
+        case ByteCode::Divide:
+            return "/";
+        case ByteCode::Mod:
+            return "%";
+        case ByteCode::LogicalAnd:
+            return "&&";
+        case ByteCode::LogicalOr:
+            return "||";
+        case ByteCode::InclusiveBitwiseOr:
+            return "|";
+        case ByteCode::ExclusiveBitwiseOr:
+            return "^";
+        case ByteCode::BitwiseAnd:
+            return "&";
+        case ByteCode::ShiftLeft:
+            return "<<";
+        case ByteCode::ShiftRight:
+            return ">>";
+        case ByteCode::Equal:
+            return "==";
+        case ByteCode::NotEqual:
+            return "!=";
+        case ByteCode::GreaterThanOrEqual:
+            return ">=";
+        case ByteCode::GreaterThan:
+            return ">";
+        case ByteCode::LessThan:
+            return "<";
+        case ByteCode::LessThanOrEqual:
+            return "<=";
+        default:
+            return nullptr;
+    }
+}
+
+static bool isArithmeticOperator(ByteCode byteCode) {
+    switch (byteCode) {
+        case ByteCode::Add:
+        case ByteCode::Subtract:
+        case ByteCode::Multiply:
+        case ByteCode::Divide:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool isComparisonOperator(ByteCode byteCode) {
+    switch (byteCode) {
+        case ByteCode::Equal:
+        case ByteCode::NotEqual:
+        case ByteCode::GreaterThanOrEqual:
+        case ByteCode::GreaterThan:
+        case ByteCode::LessThan:
+        case ByteCode::LessThanOrEqual:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool NcsTranspiler::writeInlineInstruction(ostream &out, const Instruction &ins, int index) const {
+    int count = ins.size / 4;
+    int distance = -ins.stackOffset / 4;
+
+    switch (ins.byteCode) {
+        case ByteCode::PushConstant:
+            switch (ins.type) {
+                case InstructionType::Int:
+                    out << "    stack.push_back(Variable(" << ins.intValue << "));" << endl;
+                    return true;
+                case InstructionType::Float:
+                    out << "    stack.push_back(Variable(g_instructions[" << index << "].floatValue));" << endl;
+                    return true;
+                case InstructionType::String:
+                    out << "    stack.push_back(Variable(g_instructions[" << index << "].strValue));" << endl;
+                    return true;
+                default:
+                    return false;
+            }
+
+        case ByteCode::CopyTopSP:
+            if (distance < count) return false;
+            if (count == 1) {
+                out << "    stack.push_back(stack[stack.size() - " << distance << "]);" << endl;
+            } else {
+                out << "    for (size_t src = stack.size() - " << distance << ", end = src + " << count << "; src < end; ++src) {" << endl
+                    << "        stack.push_back(stack[src]);" << endl
+                    << "    }" << endl;
+            }
+            return true;
+
+        case ByteCode::CopyDownSP:
+            if (distance < count) return false;
+            out << "    {" << endl
+                << "        size_t dst = stack.size() - " << distance << ";" << endl
+                << "        exec.invalidateSavedGlobals(static_cast<int>(dst));" << endl;
+            if (count == 1) {
+                out << "        stack[dst] = stack.back();" << endl;
+            } else {
+                out << "        for (size_t src = stack.size() - " << count << ", end = stack.size(); src < end; ++src) {" << endl
+                    << "            stack[dst++] = stack[src];" << endl
+                    << "        }" << endl;
+            }
+            out << "    }" << endl;
+            return true;
+
+        case ByteCode::AdjustSP:
+            if (distance <= 0) return false;
+            out << "    stack.erase(stack.end() - " << distance << ", stack.end());" << endl
+                << "    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));" << endl;
+            return true;
+
+        case ByteCode::IncRelToSP:
+        case ByteCode::DecRelToSP:
+            if (distance <= 0) return false;
+            out << "    {" << endl
+                << "        size_t dst = stack.size() - " << distance << ";" << endl
+                << "        exec.invalidateSavedGlobals(static_cast<int>(dst));" << endl
+                << "        stack[dst].intValue" << (ins.byteCode == ByteCode::IncRelToSP ? "++" : "--") << ";" << endl
+                << "    }" << endl;
+            return true;
+
+        case ByteCode::LogicalNot:
+            out << "    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);" << endl;
+            return true;
+
+        case ByteCode::Negate:
+            switch (ins.type) {
+                case InstructionType::Int:
+                    out << "    stack.back() = Variable(-stack.back().intValue);" << endl;
+                    return true;
+                case InstructionType::Float:
+                    out << "    stack.back() = Variable(-stack.back().floatValue);" << endl;
+                    return true;
+                default:
+                    return false;
+            }
+
+        case ByteCode::Noop:
+            return true;
+
+        default: {
+            const char *op = getBinaryOperator(ins.byteCode);
+            if (!op) return false;
+
+            string member;
+            if (ins.type == InstructionType::IntInt) {
+                member = "intValue";
+            } else if (ins.type == InstructionType::FloatFloat && (isArithmeticOperator(ins.byteCode) || isComparisonOperator(ins.byteCode))) {
+                member = "floatValue";
+            } else {
+                return false;
+            }
+            bool boolean = isComparisonOperator(ins.byteCode) || ins.byteCode == ByteCode::LogicalAnd || ins.byteCode == ByteCode::LogicalOr;
+
+            out << "    stack[stack.size() - 2] = Variable(stack[stack.size() - 2]." << member << " " << op << " stack.back()." << member << (boolean ? " ? 1 : 0" : "") << ");" << endl
+                << "    stack.pop_back();" << endl;
+            return true;
+        }
+    }
+}
+
+void NcsTranspiler::writeJump(ostream &out, uint32_t offset, int indent) const {
+    string spaces(4 * indent, ' ');
+
+    if (_offsets.count(offset) > 0) {
+        out << spaces << "goto ins_" << offset << ";" << endl;
+    } else {
+        out << spaces << "offset = " << offset << ";" << endl
+            << spaces << "goto dispatch;" << endl;
+    }
+}
+
+} // namespace script
+
+} // namespace reone
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <memory>
+#include <ostream>
+#include <set>
+#include <vector>
+
+#include "program.h"
+
+namespace reone {
+
+namespace script {
+
+/**
+ * Translates a script program into a C++ function, that executes the same
+ * instructions on the VM stack, but without decoding and dispatching them
+ * at runtime. Control flow is resolved statically, wherever possible.
+ *
+ * Constants, stack copies and integer/float arithmetic are translated into
+ * inline operations on the stack. Remaining instructions, e.g. routine
+ * calls, are passed to the executor. Instructions executed inline are
+ * counted in a local variable, which is reported to the executor before
+ * returning, so that profiler instruction counts match the interpreter.
+ *
+ * Generated sources are meant to be compiled into a shared library, which
+ * is then loaded by Scripts::loadNativeLibrary.
+ */
+class NcsTranspiler {
+public:
+    NcsTranspiler(const std::shared_ptr<ScriptProgram> &program);
+
+    void transpile(std::ostream &out);
+
+private:
+    std::shared_ptr<ScriptProgram> _program;
+    std::vector<const Instruction *> _instructions;
+    std::set<uint32_t> _offsets;
+
+    NcsTranspiler(const NcsTranspiler &) = delete;
+    NcsTranspiler &operator=(const NcsTranspiler &) = delete;
+
+    void writeInstructions(std::ostream &out) const;
+    void writeFunction(std::ostream &out) const;
+
+    /**
+     * @return false if instruction cannot be translated into inline stack operations, true otherwise
+     */
+    bool writeInlineInstruction(std::ostream &out, const Instruction &ins, int index) const;
+
+    void writeJump(std::ostream &out, uint32_t offset, int indent = 1) const;
+};
+
+} // namespace script
+
+} // namespace reone
@@ -18,7 +18,10 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -29,13 +32,19 @@ namespace script {
 const uint32_t kObjectSelf = 0;
 const uint32_t kObjectInvalid = 1;
 
+struct Instruction;
 struct Variable;
 class ScriptProgram;
 class Routine;
 
+/**
+ * Script state, saved for a delayed action. Global variables are shared
+ * between states, saved while they remain unchanged. Saved states must not
+ * be modified.
+ */
 struct ExecutionState {
     std::shared_ptr<ScriptProgram> program;
-    std::vector<Variable> globals;
+    std::shared_ptr<const std::vector<Variable>> globals;
     std::vector<Variable> locals;
     uint32_t insOffset { 0 };
 };
@@ -48,9 +57,63 @@ public:
     virtual const Routine &get(int index) = 0;
 };
 
+/**
+ * Interface through which scripts, compiled ahead of time into native code,
+ * drive the script VM. Implemented by ScriptExecution.
+ */
+class IInstructionExecutor {
+public:
+    virtual ~IInstructionExecutor() {
+    }
+
+    /**
+     * @return false if instruction is not supported, true otherwise
+     */
+    virtual bool executeInstruction(const Instruction &ins) = 0;
+
+    virtual uint32_t nextInstruction() const = 0;
+
+    /**
+     * @return VM stack, which compiled scripts manipulate directly for the most common instructions
+     */
+    virtual std::vector<Variable> &stack() = 0;
+
+    /**
+     * Must be called by compiled scripts whenever they modify the stack at or above the specified index.
+     */
+    virtual void invalidateSavedGlobals(int stackIdx) = 0;
+
+    /**
+     * Must be called by compiled scripts to account for instructions they executed without calling executeInstruction.
+     */
+    virtual void countInstructions(uint32_t count) = 0;
+};
+
+/**
+ * Script program compiled into native code by NcsTranspiler.
+ *
+ * @param executor VM, whose stack the compiled script operates on
+ * @param offset offset of the first instruction to execute
+ * @return false if execution was aborted, true otherwise
+ */
+typedef bool (*NativeScriptFunction)(IInstructionExecutor &executor, uint32_t offset);
+
+/**
+ * Side effects of engine routines, recorded to be applied later. Values
+ * written by deferred routines are also kept here, so that a script
+ * observes its own writes before they are applied.
+ */
+struct CommandBuffer {
+    std::vector<std::function<void()>> commands;
+    std::map<std::pair<uint32_t, int>, bool> localBooleans;
+    std::map<std::pair<uint32_t, int>, int> localNumbers;
+    std::set<uint32_t> destroyedObjects;
+};
+
 struct ExecutionContext {
     IRoutineProvider *routines { nullptr };
     std::shared_ptr<ExecutionState> savedState;
+    CommandBuffer *commands { nullptr };
     uint32_t callerId { kObjectInvalid };
     uint32_t triggererId { kObjectInvalid };
     int userDefinedEventNumber { -1 };
@@ -0,0 +1,469 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "verifier.h"
+
+#include <stdexcept>
+
+#include <boost/format.hpp>
+
+#include "routine.h"
+#include "util.h"
+
+using namespace std;
+
+namespace reone {
+
+namespace script {
+
+static const int kStartInstructionOffset = 13;
+static const int kMaxCallDepth = 64;
+static const int kMaxStateCount = 100000;
+
+static VariableType getReservedType(InstructionType type) {
+    switch (type) {
+        case InstructionType::Int:
+            return VariableType::Int;
+        case InstructionType::Float:
+            return VariableType::Float;
+        case InstructionType::String:
+            return VariableType::String;
+        case InstructionType::Object:
+            return VariableType::Object;
+        case InstructionType::Effect:
+            return VariableType::Effect;
+        case InstructionType::Event:
+            return VariableType::Event;
+        case InstructionType::Location:
+            return VariableType::Location;
+        case InstructionType::Talent:
+            return VariableType::Talent;
+        default:
+            return VariableType::Void;
+    }
+}
+
+static const string &describeType(VariableType type) {
+    static vector<string> names { "void", "int", "float", "string", "object", "vector", "effect", "event", "location", "talent", "action" };
+    return names[static_cast<int>(type)];
+}
+
+ScriptVerifier::ScriptVerifier(const ScriptProgram &program, IRoutineProvider &routines) : _program(program), _routines(routines) {
+}
+
+bool ScriptVerifier::verify() {
+    _states.clear();
+    _worklist.clear();
+    _errorOffset = kStartInstructionOffset;
+    _errorMessage.clear();
+
+    try {
+        enqueue(kStartInstructionOffset, vector<uint32_t>(), State());
+
+        while (!_worklist.empty()) {
+            StateKey key(move(_worklist.back()));
+            _worklist.pop_back();
+
+            _errorOffset = key.first;
+            step(key);
+        }
+    }
+    catch (const exception &ex) {
+        _errorMessage = ex.what();
+        return false;
+    }
+
+    return true;
+}
+
+void ScriptVerifier::enqueue(uint32_t offset, vector<uint32_t> returnOffsets, State state) {
+    // Like the interpreter, treat any offset past the end of the program as its end
+    if (offset >= _program.length()) return;
+
+    if (_program.instructions().count(offset) == 0) {
+        throw runtime_error(str(boost::format("no instruction at %08x") % offset));
+    }
+    if (returnOffsets.size() > kMaxCallDepth) {
+        throw runtime_error("call stack is too deep");
+    }
+    StateKey key(offset, move(returnOffsets));
+
+    auto maybeState = _states.find(key);
+    if (maybeState == _states.end()) {
+        if (_states.size() >= kMaxStateCount) {
+            throw runtime_error("too many states");
+        }
+        _states.insert(make_pair(key, move(state)));
+        _worklist.push_back(move(key));
+        return;
+    }
+    State &existing = maybeState->second;
+
+    if (existing.stack.size() != state.stack.size() || existing.bp != state.bp) {
+        throw runtime_error(str(boost::format("stack mismatch at join point %08x: depth %d vs %d") % offset % existing.stack.size() % state.stack.size()));
+    }
+    bool changed = false;
+
+    for (size_t i = 0; i < state.stack.size(); ++i) {
+        Slot &slot = existing.stack[i];
+        if (slot.type != state.stack[i].type) {
+            throw runtime_error(str(boost::format("stack mismatch at join point %08x: %s vs %s") % offset % describeType(slot.type) % describeType(state.stack[i].type)));
+        }
+        if (slot.savedBP != -1 && slot.savedBP != state.stack[i].savedBP) {
+            slot.savedBP = -1;
+            changed = true;
+        }
+    }
+    if (existing.stateStored && !state.stateStored) {
+        existing.stateStored = false;
+        changed = true;
+    }
+    if (changed) {
+        _worklist.push_back(move(key));
+    }
+}
+
+void ScriptVerifier::step(const StateKey &key) {
+    State state(_states.find(key)->second);
+    vector<uint32_t> returnOffsets(key.second);
+
+    const Instruction &ins = _program.getInstruction(key.first);
+    int depth = static_cast<int>(state.stack.size());
+
+    switch (ins.byteCode) {
+        case ByteCode::CopyDownSP:
+        case ByteCode::CopyDownBP: {
+            int count = ins.size / 4;
+            int base = ins.byteCode == ByteCode::CopyDownSP ? depth : state.bp;
+            int srcIdx = getStackIndex(state, depth, -4 * count, count);
+            int dstIdx = getStackIndex(state, base, ins.stackOffset, count);
+            for (int i = 0; i < count; ++i) {
+                state.stack[dstIdx + i] = state.stack[srcIdx + i];
+            }
+            break;
+        }
+        case ByteCode::CopyTopSP:
+        case ByteCode::CopyTopBP: {
+            int count = ins.size / 4;
+            int base = ins.byteCode == ByteCode::CopyTopSP ? depth : state.bp;
+            int srcIdx = getStackIndex(state, base, ins.stackOffset, count);
+            for (int i = 0; i < count; ++i) {
+                state.stack.push_back(state.stack[srcIdx + i]);
+            }
+            break;
+        }
+        case ByteCode::Reserve: {
+            Slot slot;
+            slot.type = getReservedType(ins.type);
+            state.stack.push_back(slot);
+            break;
+        }
+        case ByteCode::PushConstant: {
+            Slot slot;
+            switch (ins.type) {
+                case InstructionType::Int:
+                    slot.type = VariableType::Int;
+                    break;
+                case InstructionType::Float:
+                    slot.type = VariableType::Float;
+                    break;
+                case InstructionType::String:
+                    slot.type = VariableType::String;
+                    break;
+                case InstructionType::Object:
+                    slot.type = VariableType::Object;
+                    break;
+                default:
+                    throw runtime_error("unsupported constant type");
+            }
+            state.stack.push_back(slot);
+            break;
+        }
+        case ByteCode::CallRoutine: {
+            const Routine &routine = _routines.get(ins.routine);
+            if (ins.argCount > routine.argumentCount()) {
+                throw runtime_error(str(boost::format("too many arguments to %s") % routine.name()));
+            }
+            for (int i = 0; i < ins.argCount; ++i) {
+                VariableType type = routine.argumentType(i);
+                switch (type) {
+                    case VariableType::Vector:
+                        pop(state, VariableType::Float, 3);
+                        break;
+                    case VariableType::Action:
+                        if (!state.stateStored) {
+                            throw runtime_error(str(boost::format("action argument to %s without a stored state") % routine.name()));
+                        }
+                        break;
+                    default:
+                        pop(state, type);
+                        break;
+                }
+            }
+            Slot slot;
+            switch (routine.returnType()) {
+                case VariableType::Void:
+                    break;
+                case VariableType::Vector:
+                    slot.type = VariableType::Float;
+                    state.stack.insert(state.stack.end(), 3, slot);
+                    break;
+                default:
+                    slot.type = routine.returnType();
+                    state.stack.push_back(slot);
+                    break;
+            }
+            break;
+        }
+        case ByteCode::LogicalAnd:
+        case ByteCode::LogicalOr:
+        case ByteCode::InclusiveBitwiseOr:
+        case ByteCode::ExclusiveBitwiseOr:
+        case ByteCode::BitwiseAnd:
+        case ByteCode::ShiftLeft:
+        case ByteCode::ShiftRight:
+        case ByteCode::UnsignedShiftRight:
+        case ByteCode::Mod: {
+            pop(state, VariableType::Int, 2);
+            Slot slot;
+            slot.type = VariableType::Int;
+            state.stack.push_back(slot);
+            break;
+        }
+        case ByteCode::Equal:
+        case ByteCode::NotEqual: {
+            if (depth < 2) {
+                throw runtime_error("stack underflow");
+            }
+            VariableType type = state.stack[depth - 1].type;
+            if (type == VariableType::Void || ins.type == InstructionType::StructStruct || ins.type == InstructionType::VectorVector) {
+                throw runtime_error("unsupported operand types");
+            }
+            pop(state, type, 2);
+            Slot slot;
+            slot.type = VariableType::Int;
+            state.stack.push_back(slot);
+            break;
+        }
+        case ByteCode::GreaterThanOrEqual:
+        case ByteCode::GreaterThan:
+        case ByteCode::LessThan:
+        case ByteCode::LessThanOrEqual: {
+            switch (ins.type) {
+                case InstructionType::IntInt:
+                    pop(state, VariableType::Int, 2);
+                    break;
+                case InstructionType::FloatFloat:
+                    pop(state, VariableType::Float, 2);
+                    break;
+                default:
+                    throw runtime_error("unsupported operand types");
+            }
+            Slot slot;
+            slot.type = VariableType::Int;
+            state.stack.push_back(slot);
+            break;
+        }
+        case ByteCode::Add:
+        case ByteCode::Subtract:
+        case ByteCode::Multiply:
+        case ByteCode::Divide: {
+            Slot slot;
+            switch (ins.type) {
+                case InstructionType::IntInt:
+                    pop(state, VariableType::Int, 2);
+                    slot.type = VariableType::Int;
+                    break;
+                case InstructionType::IntFloat:
+                    pop(state, VariableType::Float);
+                    pop(state, VariableType::Int);
+                    slot.type = VariableType::Float;
+                    break;
+                case InstructionType::FloatInt:
+                    pop(state, VariableType::Int);
+                    pop(state, VariableType::Float);
+                    slot.type = VariableType::Float;
+                    break;
+                case InstructionType::FloatFloat:
+                    pop(state, VariableType::Float, 2);
+                    slot.type = VariableType::Float;
+                    break;
+                case InstructionType::StringString:
+                    if (ins.byteCode != ByteCode::Add) {
+                        throw runtime_error("unsupported operand types");
+                    }
+                    pop(state, VariableType::String, 2);
+                    slot.type = VariableType::String;
+                    break;
+                default:
+                    throw runtime_error("unsupported operand types");
+            }
+            state.stack.push_back(slot);
+            break;
+        }
+        case ByteCode::Negate: {
+            VariableType type = ins.type == InstructionType::Float ? VariableType::Float : VariableType::Int;
+            pop(state, type);
+            Slot slot;
+            slot.type = type;
+            state.stack.push_back(slot);
+            break;
+        }
+        case ByteCode::LogicalNot: {
+            pop(state, VariableType::Int);
+            Slot slot;
+            slot.type = VariableType::Int;
+            state.stack.push_back(slot);
+            break;
+        }
+        case ByteCode::AdjustSP: {
+            if (ins.stackOffset > 0 || ins.stackOffset % 4 != 0) {
+                throw runtime_error("invalid stack adjustment");
+            }
+            int count = -ins.stackOffset / 4;
+            if (count > depth) {
+                throw runtime_error("stack underflow");
+            }
+            state.stack.resize(depth - count);
+            break;
+        }
+        case ByteCode::Jump:
+            enqueue(ins.jumpOffset, move(returnOffsets), move(state));
+            return;
+        case ByteCode::JumpToSubroutine:
+            returnOffsets.push_back(ins.nextOffset);
+            enqueue(ins.jumpOffset, move(returnOffsets), move(state));
+            return;
+        case ByteCode::JumpIfZero:
+        case ByteCode::JumpIfNonZero:
+            pop(state, VariableType::Int);
+            enqueue(ins.jumpOffset, returnOffsets, state);
+            break;
+        case ByteCode::Return: {
+            if (returnOffsets.empty()) return;
+
+            uint32_t returnOffset = returnOffsets.back();
+            returnOffsets.pop_back();
+            enqueue(returnOffset, move(returnOffsets), move(state));
+            return;
+        }
+        case ByteCode::Destruct: {
+            int count = ins.size / 4;
+            int startIdx = getStackIndex(state, depth, -4 * count, count);
+            int countNoDestroy = ins.sizeNoDestroy / 4;
+            if (ins.stackOffset < 0 || ins.stackOffset / 4 + countNoDestroy > count) {
+                throw runtime_error("invalid destruct range");
+            }
+            int startIdxNoDestroy = startIdx + ins.stackOffset / 4;
+            for (int i = 0; i < countNoDestroy; ++i) {
+                state.stack[startIdx + i] = state.stack[startIdxNoDestroy + i];
+            }
+            state.stack.resize(startIdx + countNoDestroy);
+            break;
+        }
+        case ByteCode::DecRelToSP:
+        case ByteCode::IncRelToSP:
+        case ByteCode::DecRelToBP:
+        case ByteCode::IncRelToBP: {
+            bool relToSP = ins.byteCode == ByteCode::DecRelToSP || ins.byteCode == ByteCode::IncRelToSP;
+            int idx = getStackIndex(state, relToSP ? depth : state.bp, ins.stackOffset);
+            if (state.stack[idx].type != VariableType::Int) {
+                throw runtime_error(str(boost::format("expected int, got %s") % describeType(state.stack[idx].type)));
+            }
+            state.stack[idx].savedBP = -1;
+            break;
+        }
+        case ByteCode::SaveBP: {
+            state.bp = depth;
+            Slot slot;
+            slot.type = VariableType::Int;
+            slot.savedBP = depth;
+            state.stack.push_back(slot);
+            break;
+        }
+        case ByteCode::RestoreBP: {
+            if (depth == 0 || state.stack.back().savedBP == -1) {
+                throw runtime_error("no saved base pointer on top of the stack");
+            }
+            state.bp = state.stack.back().savedBP;
+            state.stack.pop_back();
+            break;
+        }
+        case ByteCode::StoreState: {
+            int globalCount = ins.size / 4;
+            int localCount = ins.sizeLocals / 4;
+            if (globalCount > state.bp || state.bp > depth || localCount > depth) {
+                throw runtime_error("invalid stored state size");
+            }
+            // Action block is executed later, starting with globals and locals of this state
+            State actionState;
+            actionState.stack.assign(state.stack.begin() + (state.bp - globalCount), state.stack.begin() + state.bp);
+            actionState.stack.insert(actionState.stack.end(), state.stack.end() - localCount, state.stack.end());
+            actionState.bp = globalCount;
+            enqueue(ins.offset + static_cast<int>(ins.type), vector<uint32_t>(), move(actionState));
+
+            state.stateStored = true;
+            break;
+        }
+        case ByteCode::Noop:
+            break;
+        default:
+            throw runtime_error("not implemented: " + describeByteCode(ins.byteCode));
+    }
+
+    enqueue(ins.nextOffset, move(returnOffsets), move(state));
+}
+
+void ScriptVerifier::pop(State &state, VariableType type, int count) {
+    for (int i = 0; i < count; ++i) {
+        if (state.stack.empty()) {
+            throw runtime_error("stack underflow");
+        }
+        VariableType actual = state.stack.back().type;
+        if (actual != type) {
+            throw runtime_error(str(boost::format("expected %s, got %s") % describeType(type) % describeType(actual)));
+        }
+        state.stack.pop_back();
+    }
+}
+
+int ScriptVerifier::getStackIndex(const State &state, int base, int stackOffset, int count) {
+    if (stackOffset % 4 != 0) {
+        throw runtime_error("unaligned stack offset");
+    }
+    int idx = base + stackOffset / 4;
+    if (idx < 0 || idx + count > static_cast<int>(state.stack.size())) {
+        throw runtime_error(str(boost::format("stack access out of bounds: %d") % stackOffset));
+    }
+    return idx;
+}
+
+uint32_t ScriptVerifier::errorOffset() const {
+    return _errorOffset;
+}
+
+const string &ScriptVerifier::errorMessage() const {
+    return _errorMessage;
+}
+
+int ScriptVerifier::stateCount() const {
+    return static_cast<int>(_states.size());
+}
+
+} // namespace script
+
+} // namespace reone
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "program.h"
+#include "types.h"
+#include "variable.h"
+
+namespace reone {
+
+namespace script {
+
+/**
+ * Verifies a script program by abstractly interpreting it: for every
+ * reachable instruction, the depth and types of the stack are computed and
+ * checked against what the instruction expects. Subroutines are analyzed
+ * per call site, action blocks of StoreState are analyzed as separate entry
+ * points.
+ *
+ * Verified programs are executed without runtime type checks.
+ */
+class ScriptVerifier {
+public:
+    ScriptVerifier(const ScriptProgram &program, IRoutineProvider &routines);
+
+    /**
+     * @return true if program is valid, false otherwise
+     */
+    bool verify();
+
+    /**
+     * @return offset of the instruction that failed verification
+     */
+    uint32_t errorOffset() const;
+
+    const std::string &errorMessage() const;
+
+    /**
+     * @return number of distinct (instruction, call stack) states visited
+     */
+    int stateCount() const;
+
+private:
+    struct Slot {
+        VariableType type { VariableType::Void };
+
+        // Value pushed by SaveBP, -1 for other slots
+        int savedBP { -1 };
+    };
+
+    struct State {
+        std::vector<Slot> stack;
+        int bp { 0 };
+        bool stateStored { false };
+    };
+
+    typedef std::pair<uint32_t, std::vector<uint32_t>> StateKey;
+
+    const ScriptProgram &_program;
+    IRoutineProvider &_routines;
+    std::map<StateKey, State> _states;
+    std::vector<StateKey> _worklist;
+    uint32_t _errorOffset { 0 };
+    std::string _errorMessage;
+
+    ScriptVerifier(const ScriptVerifier &) = delete;
+    ScriptVerifier &operator=(const ScriptVerifier &) = delete;
+
+    void enqueue(uint32_t offset, std::vector<uint32_t> returnOffsets, State state);
+    void step(const StateKey &key);
+
+    void pop(State &state, VariableType type, int count = 1);
+    int getStackIndex(const State &state, int base, int stackOffset, int count = 1);
+};
+
+} // namespace script
+
+} // namespace reone
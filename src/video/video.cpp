@@ -25,7 +25,9 @@
 
 #include "glm/ext.hpp"
 
+#include "../render/device/device.h"
 #include "../render/mesh/quad.h"
+#include "../render/renderstate.h"
 #include "../render/shaders.h"
 
 using namespace std;
@@ -40,14 +42,14 @@ namespace video {
 void Video::init() {
     if (_inited) return;
 
-    glGenTextures(1, &_textureId);
+    IGraphicsDevice &device = getGraphicsDevice();
+    _textureId = device.createTexture();
 
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, _textureId);
+    RenderState::instance().bindTexture(0, GL_TEXTURE_2D, _textureId);
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
     _inited = true;
 }
@@ -55,7 +57,8 @@ void Video::init() {
 void Video::deinit() {
     if (!_inited) return;
 
-    glDeleteTextures(1, &_textureId);
+    RenderState::instance().invalidateTexture(_textureId);
+    getGraphicsDevice().deleteTexture(_textureId);
 
     _inited = false;
 }
@@ -73,9 +76,8 @@ void Video::update(float dt) {
     }
     Frame &frame = _frames[frameIdx];
 
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, _textureId);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB8, _width, _height, 0, GL_RGB, GL_UNSIGNED_BYTE, &frame.data[0]);
+    RenderState::instance().bindTexture(0, GL_TEXTURE_2D, _textureId);
+    getGraphicsDevice().texImage2D(GL_TEXTURE_2D, 0, GL_RGB8, _width, _height, GL_RGB, GL_UNSIGNED_BYTE, &frame.data[0], frame.data.size());
 }
 
 void Video::render() {
@@ -88,12 +90,12 @@ void Video::render() {
     LocalUniforms locals;
     Shaders::instance().activate(ShaderProgram::GUIGUI, locals);
 
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, _textureId);
+    RenderState &state = RenderState::instance();
+    state.bindTexture(0, GL_TEXTURE_2D, _textureId);
 
     Quad::getDefault().renderTriangles();
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    state.bindTexture(0, GL_TEXTURE_2D, 0);
 }
 
 void Video::finish() {
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE aabbbatch
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "glm/gtc/matrix_transform.hpp"
+
+#include "../src/render/aabbbatch.h"
+#include "../src/scene/cameranode.h"
+
+using namespace std;
+
+using namespace reone::render;
+using namespace reone::scene;
+
+static AABB makeAABB(mt19937 &rng) {
+    uniform_real_distribution<float> positionDist(-60.0f, 60.0f);
+    uniform_real_distribution<float> sizeDist(0.0f, 20.0f);
+
+    glm::vec3 min(positionDist(rng), positionDist(rng), positionDist(rng));
+    glm::vec3 size(sizeDist(rng), sizeDist(rng), sizeDist(rng));
+
+    return AABB(min, min + size);
+}
+
+static glm::mat4 makeTransform(mt19937 &rng) {
+    uniform_real_distribution<float> positionDist(-20.0f, 20.0f);
+    uniform_real_distribution<float> angleDist(0.0f, glm::two_pi<float>());
+    uniform_real_distribution<float> scaleDist(-2.0f, 2.0f);
+    uniform_real_distribution<float> axisDist(-1.0f, 1.0f);
+
+    glm::mat4 transform(1.0f);
+    transform = glm::translate(transform, glm::vec3(positionDist(rng), positionDist(rng), positionDist(rng)));
+    transform = glm::rotate(transform, angleDist(rng), glm::normalize(glm::vec3(axisDist(rng), axisDist(rng), 1.0f)));
+    transform = glm::scale(transform, glm::vec3(scaleDist(rng), scaleDist(rng), scaleDist(rng)));
+
+    return move(transform);
+}
+
+BOOST_AUTO_TEST_CASE(test_transformed_boxes_match_scalar) {
+    mt19937 rng(1);
+    AABBBatch batch;
+    vector<AABB> expected;
+
+    for (int i = 0; i < 1000; ++i) {
+        AABB aabb(makeAABB(rng));
+        glm::mat4 transform(makeTransform(rng));
+        batch.add(aabb, transform);
+        expected.push_back(aabb * transform);
+    }
+    batch.add(AABB(), makeTransform(rng));
+    expected.push_back(AABB() * makeTransform(rng));
+
+    BOOST_REQUIRE(batch.count() == static_cast<int>(expected.size()));
+    for (int i = 0; i < batch.count(); ++i) {
+        BOOST_TEST((batch.min(i) == expected[i].min()));
+        BOOST_TEST((batch.max(i) == expected[i].max()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_transformed_box_contains_transformed_corners) {
+    mt19937 rng(2);
+
+    for (int i = 0; i < 100; ++i) {
+        AABB aabb(makeAABB(rng));
+        glm::mat4 transform(makeTransform(rng));
+        AABB transformed(aabb * transform);
+
+        glm::vec3 margin(1e-3f);
+        AABB bounds(transformed.min() - margin, transformed.max() + margin);
+
+        for (int corner = 0; corner < 8; ++corner) {
+            glm::vec3 point(
+                corner & 1 ? aabb.max().x : aabb.min().x,
+                corner & 2 ? aabb.max().y : aabb.min().y,
+                corner & 4 ? aabb.max().z : aabb.min().z);
+
+            BOOST_TEST(bounds.contains(glm::vec3(transform * glm::vec4(point, 1.0f))));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_frustum_test_matches_scalar) {
+    mt19937 rng(3);
+    uniform_real_distribution<float> angleDist(0.0f, glm::two_pi<float>());
+
+    CameraSceneNode camera(nullptr, glm::perspective(glm::radians(55.0f), 16.0f / 9.0f, 0.1f, 100.0f));
+    AABBBatch batch;
+    vector<AABB> aabbs;
+    vector<uint8_t> inside;
+
+    // Counts that are not multiples of four exercise the padding
+    for (int count : { 0, 1, 3, 4, 7, 1001 }) {
+        batch.clear();
+        aabbs.clear();
+        for (int i = 0; i < count; ++i) {
+            aabbs.push_back(makeAABB(rng));
+            batch.add(aabbs.back());
+        }
+        for (int view = 0; view < 10; ++view) {
+            glm::mat4 transform(glm::rotate(glm::mat4(1.0f), angleDist(rng), glm::vec3(0.0f, 0.0f, 1.0f)));
+            transform = glm::rotate(transform, angleDist(rng), glm::vec3(1.0f, 0.0f, 0.0f));
+            camera.setLocalTransform(transform);
+
+            batch.testPlanes(camera.frustum(), kFrustumPlaneCount, inside);
+
+            BOOST_REQUIRE(inside.size() == aabbs.size());
+            int insideCount = 0;
+            for (int i = 0; i < count; ++i) {
+                BOOST_TEST(inside[i] == (camera.isInFrustum(aabbs[i]) ? 1 : 0));
+                insideCount += inside[i];
+            }
+            if (count > 100) {
+                BOOST_TEST(insideCount > 0);
+                BOOST_TEST(insideCount < count);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_frustum_test_matches_corner_test) {
+    mt19937 rng(4);
+
+    CameraSceneNode camera(nullptr, glm::perspective(glm::radians(55.0f), 16.0f / 9.0f, 0.1f, 100.0f));
+    camera.setLocalTransform(glm::rotate(glm::mat4(1.0f), glm::half_pi<float>(), glm::vec3(1.0f, 0.0f, 0.0f)));
+
+    AABBBatch batch;
+    vector<AABB> aabbs;
+    for (int i = 0; i < 500; ++i) {
+        aabbs.push_back(makeAABB(rng));
+        batch.add(aabbs.back());
+    }
+    vector<uint8_t> inside;
+    batch.testPlanes(camera.frustum(), kFrustumPlaneCount, inside);
+
+    // A box is inside unless all eight of its corners are behind the same plane
+    for (size_t i = 0; i < aabbs.size(); ++i) {
+        bool expected = true;
+        for (int plane = 0; plane < kFrustumPlaneCount && expected; ++plane) {
+            bool anyInFront = false;
+            for (int corner = 0; corner < 8; ++corner) {
+                glm::vec4 point(
+                    corner & 1 ? aabbs[i].max().x : aabbs[i].min().x,
+                    corner & 2 ? aabbs[i].max().y : aabbs[i].min().y,
+                    corner & 4 ? aabbs[i].max().z : aabbs[i].min().z,
+                    1.0f);
+                anyInFront |= glm::dot(camera.frustum()[plane], point) >= 0.0f;
+            }
+            expected = anyInFront;
+        }
+        BOOST_TEST(inside[i] == (expected ? 1 : 0));
+    }
+}
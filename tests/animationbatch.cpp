@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE animationbatch
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "glm/gtc/quaternion.hpp"
+
+#include "../src/render/model/model.h"
+#include "../src/scene/animationbatch.h"
+#include "../src/scene/modelnodescenenode.h"
+#include "../src/scene/modelscenenode.h"
+
+using namespace std;
+
+using namespace reone::render;
+using namespace reone::scene;
+
+static const int kBoneCount = 16;
+static const int kModelCount = 37;
+static const int kFrameCount = 120;
+static const float kFrameTime = 1.0f / 60.0f;
+
+static shared_ptr<ModelNode> buildSkeleton(float phase) {
+    vector<shared_ptr<ModelNode>> nodes;
+
+    for (int i = 0; i < kBoneCount; ++i) {
+        ModelNode *parent = i > 0 ? nodes[(i - 1) / 2].get() : nullptr;
+        glm::vec3 position(0.0f, 0.0f, i > 0 ? 0.1f : 0.0f);
+        glm::quat orientation(1.0f, 0.0f, 0.0f, 0.0f);
+
+        shared_ptr<ModelNode> node(new ModelNode(i, parent, i, "bone" + to_string(i), position, orientation));
+        if (phase >= 0.0f) {
+            for (int j = 0; j < 10; ++j) {
+                float time = j / 9.0f;
+                float angle = glm::sin(time + i + phase);
+                node->addPositionKeyframe(time, glm::vec3(0.0f, 0.1f * angle, 0.0f));
+                node->addOrientationKeyframe(time, glm::angleAxis(angle, glm::vec3(1.0f, 0.0f, 0.0f)));
+            }
+        }
+        if (parent) {
+            nodes[(i - 1) / 2]->addChild(node);
+        }
+        nodes.push_back(move(node));
+    }
+
+    return nodes[0];
+}
+
+static shared_ptr<Model> buildModel() {
+    vector<unique_ptr<Animation>> anims;
+    anims.push_back(make_unique<Animation>("walk", 1.0f, 0.5f, buildSkeleton(0.0f)));
+    anims.push_back(make_unique<Animation>("run", 1.0f, 0.5f, buildSkeleton(1.0f)));
+
+    return shared_ptr<Model>(new Model("character", buildSkeleton(-1.0f), anims));
+}
+
+static vector<unique_ptr<ModelSceneNode>> buildModels(const shared_ptr<Model> &model) {
+    vector<unique_ptr<ModelSceneNode>> models;
+    for (int i = 0; i < kModelCount; ++i) {
+        unique_ptr<ModelSceneNode> sceneNode(new ModelSceneNode(nullptr, model));
+        sceneNode->playAnimation(i % 2 ? "walk" : "run", kAnimationLoop, 0.5f + 0.1f * (i % 7));
+        models.push_back(move(sceneNode));
+    }
+    return move(models);
+}
+
+static vector<glm::mat4> animate(const shared_ptr<Model> &model, int threadCount) {
+    vector<unique_ptr<ModelSceneNode>> models(buildModels(model));
+
+    AnimationBatch batch;
+    for (auto &sceneNode : models) {
+        batch.add(sceneNode.get());
+    }
+    for (int frame = 0; frame < kFrameCount; ++frame) {
+        if (frame == kFrameCount / 2) {
+            for (int i = 0; i < kModelCount; i += 3) {
+                models[i]->playAnimation(i % 2 ? "run" : "walk", kAnimationLoop | kAnimationBlend);
+            }
+        }
+        batch.run(kFrameTime, threadCount);
+    }
+
+    vector<glm::mat4> transforms;
+    for (auto &sceneNode : models) {
+        for (int i = 0; i < kBoneCount; ++i) {
+            ModelNodeSceneNode *nodeSceneNode = sceneNode->getModelNodeByIndex(i);
+            transforms.push_back(nodeSceneNode->absoluteTransform());
+            transforms.push_back(nodeSceneNode->boneTransform());
+        }
+    }
+
+    return move(transforms);
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_update_matches_serial) {
+    shared_ptr<Model> model(buildModel());
+    vector<glm::mat4> expected(animate(model, 1));
+
+    for (int threadCount = 2; threadCount <= 8; ++threadCount) {
+        vector<glm::mat4> actual(animate(model, threadCount));
+        BOOST_TEST((actual == expected), "thread count " << threadCount);
+    }
+}
+
+static vector<glm::mat4> getBoneTransforms(const ModelSceneNode &sceneNode) {
+    vector<glm::mat4> transforms;
+    for (int i = 0; i < kBoneCount; ++i) {
+        transforms.push_back(sceneNode.getModelNodeByIndex(i)->boneTransform());
+    }
+    return move(transforms);
+}
+
+BOOST_AUTO_TEST_CASE(test_get_animation_lod) {
+    AnimationLODOptions options;
+    options.halfRateDistance = 10.0f;
+    options.quarterRateDistance = 20.0f;
+    options.halfRateScreenSize = 0.2f;
+    options.quarterRateScreenSize = 0.1f;
+
+    BOOST_TEST((getAnimationLOD(options, 5.0f, 0.5f) == AnimationLOD::Full));
+    BOOST_TEST((getAnimationLOD(options, 15.0f, 0.5f) == AnimationLOD::Half));
+    BOOST_TEST((getAnimationLOD(options, 25.0f, 0.5f) == AnimationLOD::Quarter));
+    BOOST_TEST((getAnimationLOD(options, 5.0f, 0.15f) == AnimationLOD::Half));
+    BOOST_TEST((getAnimationLOD(options, 5.0f, 0.05f) == AnimationLOD::Quarter));
+
+    options.enabled = false;
+    BOOST_TEST((getAnimationLOD(options, 25.0f, 0.05f) == AnimationLOD::Full));
+}
+
+BOOST_AUTO_TEST_CASE(test_reduced_lod_accumulates_time) {
+    shared_ptr<Model> model(buildModel());
+    ModelSceneNode full(nullptr, model);
+    ModelSceneNode quarter(nullptr, model);
+    full.playAnimation("walk", kAnimationLoop);
+    quarter.playAnimation("walk", kAnimationLoop);
+    quarter.setAnimationLOD(AnimationLOD::Quarter);
+
+    full.update(kFrameTime);
+    quarter.update(kFrameTime);
+    BOOST_TEST((getBoneTransforms(quarter) == getBoneTransforms(full)));
+
+    int poseChanges = 0;
+    for (int frame = 0; frame < 8; ++frame) {
+        vector<glm::mat4> before(getBoneTransforms(quarter));
+        full.update(kFrameTime);
+        quarter.update(kFrameTime);
+        if (getBoneTransforms(quarter) != before) {
+            BOOST_TEST((getBoneTransforms(quarter) == getBoneTransforms(full)));
+            ++poseChanges;
+        }
+    }
+    BOOST_TEST(poseChanges == 2);
+
+    quarter.setAnimationLOD(AnimationLOD::Full);
+    full.update(kFrameTime);
+    quarter.update(kFrameTime);
+    BOOST_TEST((getBoneTransforms(quarter) == getBoneTransforms(full)));
+}
+
+BOOST_AUTO_TEST_CASE(test_off_screen_advances_time_only) {
+    shared_ptr<Model> model(buildModel());
+    ModelSceneNode onScreen(nullptr, model);
+    ModelSceneNode offScreen(nullptr, model);
+    onScreen.playAnimation("walk", kAnimationLoop);
+    offScreen.playAnimation("walk", kAnimationLoop);
+
+    onScreen.update(kFrameTime);
+    offScreen.update(kFrameTime);
+    offScreen.setOnScreen(false);
+    vector<glm::mat4> frozen(getBoneTransforms(offScreen));
+
+    for (int frame = 0; frame < 10; ++frame) {
+        onScreen.update(kFrameTime);
+        offScreen.update(kFrameTime);
+    }
+    BOOST_TEST((getBoneTransforms(offScreen) == frozen));
+
+    offScreen.setOnScreen(true);
+    onScreen.update(kFrameTime);
+    offScreen.update(kFrameTime);
+    BOOST_TEST((getBoneTransforms(offScreen) == getBoneTransforms(onScreen)));
+}
+
+BOOST_AUTO_TEST_CASE(test_quarter_lod_skips_non_essential_nodes) {
+    // Synthetic skeleton has neither meshes nor skins, so no node is essential
+    shared_ptr<Model> model(buildModel());
+    ModelSceneNode sceneNode(nullptr, model);
+    sceneNode.playAnimation("walk", kAnimationLoop);
+    sceneNode.setAnimationLOD(AnimationLOD::Quarter, true);
+    sceneNode.update(kFrameTime);
+
+    vector<glm::mat4> bindPose(kBoneCount, glm::mat4(1.0f));
+    BOOST_TEST((getBoneTransforms(sceneNode) == bindPose));
+
+    sceneNode.setAnimationLOD(AnimationLOD::Full, true);
+    sceneNode.update(kFrameTime);
+    BOOST_TEST((getBoneTransforms(sceneNode) != bindPose));
+}
+
+BOOST_AUTO_TEST_CASE(test_lod_counts) {
+    shared_ptr<Model> model(buildModel());
+    vector<unique_ptr<ModelSceneNode>> models(buildModels(model));
+    models[0]->setAnimationLOD(AnimationLOD::Half);
+    models[1]->setAnimationLOD(AnimationLOD::Quarter);
+    models[2]->setAnimationLOD(AnimationLOD::Quarter);
+    models[3]->setOnScreen(false);
+    models[4]->setVisible(false);
+
+    AnimationBatch batch;
+    for (auto &sceneNode : models) {
+        batch.add(sceneNode.get());
+    }
+    batch.run(kFrameTime, 2);
+
+    BOOST_TEST(batch.getLODCount(AnimationLOD::Full) == kModelCount - 5);
+    BOOST_TEST(batch.getLODCount(AnimationLOD::Half) == 1);
+    BOOST_TEST(batch.getLODCount(AnimationLOD::Quarter) == 2);
+    BOOST_TEST(batch.getLODCount(AnimationLOD::TimeOnly) == 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_run_empty_batch) {
+    AnimationBatch batch;
+    batch.run(kFrameTime, 4);
+    BOOST_TEST(batch.count() == 0);
+}
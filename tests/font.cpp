@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE font
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../src/render/font.h"
+
+using namespace std;
+
+using namespace reone::render;
+
+static const int kGlyphCount = 128;
+
+/**
+ * Builds a font where glyph i is i + 1 texels wide in a 256x16 texture.
+ */
+static shared_ptr<Font> buildFont() {
+    TextureFeatures features;
+    features.numChars = kGlyphCount;
+    features.fontHeight = 0.16f;
+
+    for (int i = 0; i < kGlyphCount; ++i) {
+        float left = (i % 16) / 16.0f;
+        float width = (i + 1) / 256.0f;
+        features.upperLeftCoords.push_back(glm::vec3(left, 1.0f, 0.0f));
+        features.lowerRightCoords.push_back(glm::vec3(left + width, 1.0f - 16.0f / 256.0f, 0.0f));
+    }
+
+    auto texture = make_shared<Texture>("font", TextureType::GUI);
+    texture->setFeatures(features);
+
+    auto font = make_shared<Font>();
+    font->load(texture);
+
+    return move(font);
+}
+
+BOOST_AUTO_TEST_CASE(test_text_is_laid_out_as_single_mesh) {
+    shared_ptr<Font> font(buildFont());
+    string text("Hello, world!");
+
+    vector<float> vertices;
+    vector<uint16_t> indices;
+    font->layout(text, TextGravity::Right, vertices, indices);
+
+    // One indexed mesh for the whole string, i.e. a single draw call
+    BOOST_TEST(vertices.size() == 5 * 4 * text.size());
+    BOOST_TEST(indices.size() == 6 * text.size());
+    for (auto &index : indices) {
+        BOOST_TEST(index < 4 * text.size());
+    }
+    BOOST_TEST(font->layoutCount() == 1);
+
+    // Glyphs follow each other
+    float width = font->measure(text);
+    BOOST_TEST(vertices[0] == 0.0f, boost::test_tools::tolerance(1e-4f));
+    BOOST_TEST(vertices[vertices.size() - 5 * 3] == width, boost::test_tools::tolerance(1e-4f));
+    for (size_t i = 1; i < text.size(); ++i) {
+        float previousRight = vertices[5 * 4 * (i - 1) + 5];
+        float left = vertices[5 * 4 * i];
+        BOOST_TEST(left == previousRight, boost::test_tools::tolerance(1e-4f));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_gravity_offsets_text) {
+    shared_ptr<Font> font(buildFont());
+    string text("abc");
+    float width = font->measure(text);
+
+    vector<float> vertices;
+    vector<uint16_t> indices;
+
+    font->layout(text, TextGravity::Left, vertices, indices);
+    BOOST_TEST(vertices[0] == -width, boost::test_tools::tolerance(1e-4f));
+    BOOST_TEST(vertices[1] == 0.5f * font->height(), boost::test_tools::tolerance(1e-4f));
+
+    font->layout(text, TextGravity::Center, vertices, indices);
+    BOOST_TEST(vertices[0] == -0.5f * width, boost::test_tools::tolerance(1e-4f));
+}
+
+BOOST_AUTO_TEST_CASE(test_unknown_glyphs_are_skipped) {
+    shared_ptr<Font> font(buildFont());
+    string text("a\xe9" "b");
+
+    vector<float> vertices;
+    vector<uint16_t> indices;
+    font->layout(text, TextGravity::Right, vertices, indices);
+
+    BOOST_TEST(indices.size() == 6 * 2);
+    BOOST_TEST(font->measure(text) == font->measure("ab"), boost::test_tools::tolerance(1e-4f));
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE jobs
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../src/common/jobs.h"
+
+using namespace std;
+
+using namespace reone;
+
+BOOST_AUTO_TEST_CASE(test_parallel_for_covers_all_items) {
+    for (int threadCount : { 1, 3, 8 }) {
+        vector<int> visits(100, 0);
+
+        int batchCount = JobExecutor::instance().parallelFor(static_cast<int>(visits.size()), threadCount, [&visits](int batch, int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                ++visits[i];
+            }
+        });
+
+        BOOST_TEST(batchCount == threadCount);
+        BOOST_TEST((visits == vector<int>(100, 1)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_for_rethrows_after_all_batches_finish) {
+    for (int failingBatch : { 0, 2 }) {
+        atomic_int finished { 0 };
+
+        BOOST_CHECK_THROW(JobExecutor::instance().parallelFor(40, 4, [&finished, failingBatch](int batch, int begin, int end) {
+            if (batch == failingBatch) {
+                throw runtime_error("batch failed");
+            }
+            this_thread::sleep_for(chrono::milliseconds(20));
+            ++finished;
+        }), runtime_error);
+
+        // Remaining batches must not outlive the call, as they reference its stack
+        BOOST_TEST(finished == 3);
+    }
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE lightgrid
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "glm/gtc/matrix_transform.hpp"
+
+#include "../src/scene/lightgrid.h"
+#include "../src/scene/lightnode.h"
+
+using namespace std;
+
+using namespace reone::scene;
+
+static const int kMaxLightCount = 8;
+
+/**
+ * Finds lights the way scene graphs did before light grids, by sorting all
+ * lights in range.
+ */
+static void getLightsAt(const vector<LightSceneNode *> &allLights, const glm::vec3 &position, vector<LightSceneNode *> &lights) {
+    unordered_map<LightSceneNode *, float> distances;
+    lights.clear();
+
+    for (auto &light : allLights) {
+        float distance = light->distanceTo(position);
+        float radius = light->radius();
+        if (distance > radius * radius) continue;
+
+        distances.insert(make_pair(light, distance));
+        lights.push_back(light);
+    }
+
+    sort(lights.begin(), lights.end(), [&distances](LightSceneNode *left, LightSceneNode *right) {
+        int leftPriority = left->priority();
+        int rightPriority = right->priority();
+
+        if (leftPriority < rightPriority) return true;
+        if (leftPriority > rightPriority) return false;
+
+        float leftDistance = distances.find(left)->second;
+        float rightDistance = distances.find(right)->second;
+
+        return leftDistance < rightDistance;
+    });
+
+    if (lights.size() > kMaxLightCount) {
+        lights.erase(lights.begin() + kMaxLightCount, lights.end());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_lights_match_sorting_all_lights) {
+    mt19937 rng(1);
+    uniform_real_distribution<float> positionDist(-100.0f, 100.0f);
+    uniform_real_distribution<float> radiusDist(1.0f, 30.0f);
+    uniform_int_distribution<int> priorityDist(1, 5);
+
+    vector<unique_ptr<LightSceneNode>> lightNodes;
+    vector<LightSceneNode *> lights;
+
+    for (int i = 0; i < 300; ++i) {
+        auto light = make_unique<LightSceneNode>(nullptr, priorityDist(rng), glm::vec3(1.0f), radiusDist(rng));
+        light->setLocalTransform(glm::translate(glm::mat4(1.0f), glm::vec3(positionDist(rng), positionDist(rng), 0.1f * positionDist(rng))));
+        lights.push_back(light.get());
+        lightNodes.push_back(move(light));
+    }
+
+    // Lights at the same position with the same priority, which only differ in order
+    for (int i = 0; i < 12; ++i) {
+        auto light = make_unique<LightSceneNode>(nullptr, 1, glm::vec3(1.0f), 10.0f);
+        light->setLocalTransform(glm::translate(glm::mat4(1.0f), glm::vec3(20.0f, 20.0f, 0.0f)));
+        lights.push_back(light.get());
+        lightNodes.push_back(move(light));
+    }
+
+    LightGrid grid;
+    grid.build(lights);
+    BOOST_TEST(grid.cellCount() > 1);
+
+    vector<LightSceneNode *> expected, actual;
+    int nonEmpty = 0;
+
+    for (int i = 0; i < 2000; ++i) {
+        glm::vec3 point(1.2f * positionDist(rng), 1.2f * positionDist(rng), 0.1f * positionDist(rng));
+        if (i < 20) {
+            point = glm::vec3(20.0f + 0.1f * i, 20.0f, 0.0f);
+        }
+        getLightsAt(lights, point, expected);
+        grid.getLightsAt(point, kMaxLightCount, actual);
+
+        BOOST_TEST((actual == expected));
+        if (!expected.empty()) {
+            ++nonEmpty;
+        }
+    }
+    BOOST_TEST(nonEmpty > 1000);
+}
+
+BOOST_AUTO_TEST_CASE(test_empty_grid_has_no_lights) {
+    LightGrid grid;
+    grid.build(vector<LightSceneNode *>());
+
+    vector<LightSceneNode *> lights { nullptr };
+    grid.getLightsAt(glm::vec3(0.0f), kMaxLightCount, lights);
+
+    BOOST_TEST(lights.empty());
+}
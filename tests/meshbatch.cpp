@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#define BOOST_TEST_MODULE meshbatch
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "glm/ext.hpp"
+
+#include "../src/render/mesh/meshbatch.h"
+
+using namespace std;
+
+using namespace reone::render;
+
+/**
+ * Grid of quads in the XY plane with positions, normals and texture
+ * coordinates, but without lightmap coordinates.
+ */
+class TestMesh : public Mesh {
+public:
+    TestMesh(int quadCount) {
+        for (int i = 0; i < quadCount; ++i) {
+            float x = static_cast<float>(i);
+            uint16_t base = static_cast<uint16_t>(4 * i);
+            _vertices.insert(_vertices.end(), {
+                x, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+                x + 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+                x + 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f,
+                x, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f
+            });
+            _indices.insert(_indices.end(), { base, static_cast<uint16_t>(base + 1), static_cast<uint16_t>(base + 2), static_cast<uint16_t>(base + 2), static_cast<uint16_t>(base + 3), base });
+        }
+        _offsets.normals = 3 * sizeof(float);
+        _offsets.texCoords1 = 6 * sizeof(float);
+        _offsets.stride = 8 * sizeof(float);
+    }
+};
+
+static const int kValuesPerVertex = 10;
+
+BOOST_AUTO_TEST_CASE(test_vertices_are_transformed) {
+    TestMesh mesh(1);
+    glm::mat4 transform(glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(10.0f, 20.0f, 30.0f)), glm::half_pi<float>(), glm::vec3(1.0f, 0.0f, 0.0f)));
+
+    MeshBatch batch;
+    batch.add(0, mesh, transform);
+    batch.add(0, mesh, glm::mat4(1.0f));
+    batch.end();
+
+    BOOST_TEST(batch.meshCount() == 2);
+    BOOST_TEST(batch.vertexCount() == 8);
+    BOOST_TEST(batch.indexCount() == 12);
+    BOOST_TEST(!batch.hasIndices32());
+
+    const vector<float> &vertices = batch.vertices();
+    for (int i = 0; i < 4; ++i) {
+        const float *src = &mesh.vertices()[8 * i];
+        const float *dst = &vertices[kValuesPerVertex * i];
+        glm::vec3 position(transform * glm::vec4(glm::make_vec3(src), 1.0f));
+        BOOST_TEST(glm::distance(glm::make_vec3(dst), position) < 1e-5f);
+
+        // Normal of the XY plane, rotated about the X axis
+        BOOST_TEST(glm::distance(glm::make_vec3(dst + 3), glm::vec3(0.0f, -1.0f, 0.0f)) < 1e-5f);
+
+        BOOST_TEST(dst[6] == src[6]);
+        BOOST_TEST(dst[7] == src[7]);
+        BOOST_TEST(dst[8] == 0.0f);
+        BOOST_TEST(dst[9] == 0.0f);
+    }
+
+    // Indices of the second mesh follow its vertices
+    BOOST_TEST(batch.indices()[6] == 4);
+    BOOST_TEST(batch.indices()[11] == 4);
+    BOOST_TEST(batch.aabb().max().z == 31.0f);
+}
+
+BOOST_AUTO_TEST_CASE(test_indices_are_32_bit_only_when_needed) {
+    // 16384 quads have exactly 65536 vertices
+    TestMesh mesh(0x4000);
+
+    MeshBatch small;
+    small.add(0, mesh, glm::mat4(1.0f));
+    small.end();
+    BOOST_TEST(!small.hasIndices32());
+    BOOST_TEST(small.indices().back() == 0xfffc);
+
+    TestMesh quad(1);
+    MeshBatch large;
+    large.add(0, mesh, glm::mat4(1.0f));
+    large.add(1, quad, glm::mat4(1.0f));
+    large.end();
+    BOOST_TEST(large.hasIndices32());
+    BOOST_TEST(large.indices().empty());
+    BOOST_TEST(large.indexCount() == 6 * 0x4001);
+}
+
+BOOST_AUTO_TEST_CASE(test_groups_must_be_added_in_order) {
+    TestMesh mesh(1);
+    MeshBatch batch;
+    batch.add(1, mesh, glm::mat4(1.0f));
+    BOOST_CHECK_THROW(batch.add(0, mesh, glm::mat4(1.0f)), invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(test_ranges_of_adjacent_visible_groups_are_merged) {
+    // Five rooms with 1 to 5 meshes each, room 3 has no batched meshes
+    vector<unique_ptr<TestMesh>> meshes;
+    MeshBatch batch;
+    int meshCount = 0;
+
+    for (int room = 0; room < 6; ++room) {
+        if (room == 3) continue;
+        for (int i = 0; i <= room; ++i) {
+            meshes.push_back(make_unique<TestMesh>(2));
+            batch.add(room, *meshes.back(), glm::mat4(1.0f));
+            ++meshCount;
+        }
+    }
+    batch.end();
+    BOOST_TEST(batch.meshCount() == meshCount);
+
+    vector<MeshBatch::Range> ranges;
+
+    vector<bool> allVisible(6, true);
+    batch.getRanges(allVisible, ranges);
+    BOOST_TEST(ranges.size() == 1ll);
+    BOOST_TEST(ranges[0].offset == 0);
+    BOOST_TEST(ranges[0].count == batch.indexCount());
+    BOOST_TEST(batch.getMeshCount(allVisible) == meshCount);
+
+    // Room 3 has no meshes, so rooms 2 and 4 are adjacent
+    ranges.clear();
+    vector<bool> visible { true, false, true, false, true, false };
+    batch.getRanges(visible, ranges);
+    BOOST_TEST(ranges.size() == 2ll);
+    BOOST_TEST(ranges[0].offset == 0);
+    BOOST_TEST(ranges[0].count == 12);
+    BOOST_TEST(ranges[1].offset == 12 * (1 + 2));
+    BOOST_TEST(ranges[1].count == 12 * (3 + 5));
+    BOOST_TEST(batch.getMeshCount(visible) == 1 + 3 + 5);
+
+    BOOST_TEST_MESSAGE("Draw calls for visible rooms: " << batch.getMeshCount(visible) << " unbatched, " << ranges.size() << " batched");
+
+    // Groups past the end of visibility are invisible
+    ranges.clear();
+    batch.getRanges(vector<bool> { true }, ranges);
+    BOOST_TEST(ranges.size() == 1ll);
+    BOOST_TEST(ranges[0].count == 12);
+
+    ranges.clear();
+    batch.getRanges(vector<bool>(6, false), ranges);
+    BOOST_TEST(ranges.empty());
+}
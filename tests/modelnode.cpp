@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE modelnode
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "glm/gtc/quaternion.hpp"
+
+#include "../src/render/model/modelnode.h"
+
+using namespace std;
+
+using namespace reone::render;
+
+// Accuracy of compressed keyframes
+static const float kTimeTolerance = 1.0f / 65535.0f; // relative to track duration
+static const float kPositionTolerance = 1.0f / 65535.0f; // relative to range of positions
+static const float kOrientationTolerance = 1e-4f; // per component
+
+struct PositionKeyframe {
+    float time { 0.0f };
+    glm::vec3 position { 0.0f };
+};
+
+struct OrientationKeyframe {
+    float time { 0.0f };
+    glm::quat orientation { 1.0f, 0.0f, 0.0f, 0.0f };
+};
+
+// Reference implementation: linear search over interleaved keyframes
+
+static glm::vec3 samplePosition(const vector<PositionKeyframe> &frames, float time, float scale) {
+    auto it = find_if(frames.begin(), frames.end(), [&time](const PositionKeyframe &frame) { return frame.time >= time; });
+    if (it == frames.begin() || it == frames.end()) {
+        return frames.front().position * scale;
+    }
+    auto left = it - 1;
+    float factor = (time - left->time) / (it->time - left->time);
+
+    return glm::mix(left->position, it->position, factor) * scale;
+}
+
+static glm::quat sampleOrientation(const vector<OrientationKeyframe> &frames, float time) {
+    auto it = find_if(frames.begin(), frames.end(), [&time](const OrientationKeyframe &frame) { return frame.time >= time; });
+    if (it == frames.begin() || it == frames.end()) {
+        return frames.front().orientation;
+    }
+    auto left = it - 1;
+    float factor = (time - left->time) / (it->time - left->time);
+
+    return glm::slerp(left->orientation, it->orientation, factor);
+}
+
+struct Track {
+    float length { 0.0f };
+    vector<PositionKeyframe> positions;
+    vector<OrientationKeyframe> orientations;
+    unique_ptr<ModelNode> node;
+};
+
+static Track makeTrack(mt19937 &rng) {
+    uniform_int_distribution<int> countDist(1, 40);
+    uniform_real_distribution<float> stepDist(0.01f, 0.5f);
+    uniform_real_distribution<float> valueDist(-1.0f, 1.0f);
+
+    Track track;
+    track.node = make_unique<ModelNode>(0);
+
+    float time = 0.0f;
+    int count = countDist(rng);
+    for (int i = 0; i < count; ++i) {
+        PositionKeyframe frame;
+        frame.time = time;
+        frame.position = glm::vec3(valueDist(rng), valueDist(rng), valueDist(rng));
+        track.positions.push_back(frame);
+        track.node->addPositionKeyframe(frame.time, frame.position);
+        time += stepDist(rng);
+    }
+    track.length = time;
+
+    time = 0.0f;
+    count = countDist(rng);
+    for (int i = 0; i < count; ++i) {
+        OrientationKeyframe frame;
+        frame.time = time;
+        frame.orientation = glm::normalize(glm::quat(valueDist(rng), valueDist(rng), valueDist(rng), valueDist(rng)));
+        track.orientations.push_back(frame);
+        track.node->addOrientationKeyframe(frame.time, frame.orientation);
+        time += stepDist(rng);
+    }
+    track.length = max(track.length, time);
+
+    return move(track);
+}
+
+static void checkSample(const Track &track, float time, ModelNode::SampleCursor &cursor) {
+    glm::vec3 position(0.0f);
+    BOOST_REQUIRE(track.node->getPosition(time, cursor, position, 2.0f));
+    BOOST_TEST((position == samplePosition(track.positions, time, 2.0f)));
+
+    glm::quat orientation(1.0f, 0.0f, 0.0f, 0.0f);
+    BOOST_REQUIRE(track.node->getOrientation(time, cursor, orientation));
+    BOOST_TEST((orientation == sampleOrientation(track.orientations, time)));
+}
+
+BOOST_AUTO_TEST_CASE(test_sample_forward_playback) {
+    mt19937 rng(1);
+    uniform_real_distribution<float> dtDist(0.0f, 0.1f);
+
+    for (int i = 0; i < 100; ++i) {
+        Track track(makeTrack(rng));
+        ModelNode::SampleCursor cursor;
+
+        // Play the animation twice, looping back to the beginning
+        for (int loop = 0; loop < 2; ++loop) {
+            for (float time = 0.0f; time < track.length + 0.2f; time += dtDist(rng)) {
+                checkSample(track, time, cursor);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_sample_random_seeks) {
+    mt19937 rng(2);
+
+    for (int i = 0; i < 100; ++i) {
+        Track track(makeTrack(rng));
+        uniform_real_distribution<float> timeDist(-0.5f, track.length + 0.5f);
+        ModelNode::SampleCursor cursor;
+
+        for (int j = 0; j < 200; ++j) {
+            checkSample(track, timeDist(rng), cursor);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_sample_at_keyframe_times) {
+    mt19937 rng(3);
+
+    for (int i = 0; i < 100; ++i) {
+        Track track(makeTrack(rng));
+        ModelNode::SampleCursor cursor;
+
+        for (auto &frame : track.positions) {
+            checkSample(track, frame.time, cursor);
+        }
+        for (auto &frame : track.orientations) {
+            checkSample(track, frame.time, cursor);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_sample_without_cursor) {
+    mt19937 rng(4);
+
+    for (int i = 0; i < 100; ++i) {
+        Track track(makeTrack(rng));
+        uniform_real_distribution<float> timeDist(-0.5f, track.length + 0.5f);
+
+        for (int j = 0; j < 50; ++j) {
+            float time = timeDist(rng);
+
+            glm::vec3 position(0.0f);
+            BOOST_REQUIRE(track.node->getPosition(time, position));
+            BOOST_TEST((position == samplePosition(track.positions, time, 1.0f)));
+
+            glm::quat orientation(1.0f, 0.0f, 0.0f, 0.0f);
+            BOOST_REQUIRE(track.node->getOrientation(time, orientation));
+            BOOST_TEST((orientation == sampleOrientation(track.orientations, time)));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_sample_empty_track) {
+    ModelNode node(0);
+    ModelNode::SampleCursor cursor;
+    glm::vec3 position(0.0f);
+    glm::quat orientation(1.0f, 0.0f, 0.0f, 0.0f);
+
+    BOOST_TEST(!node.getPosition(0.0f, cursor, position));
+    BOOST_TEST(!node.getOrientation(0.0f, cursor, orientation));
+}
+
+static bool isOrientationClose(glm::quat actual, const glm::quat &expected, float tolerance) {
+    if (glm::dot(actual, expected) < 0.0f) {
+        actual = -actual;
+    }
+    for (int i = 0; i < 4; ++i) {
+        if (glm::abs(actual[i] - expected[i]) > tolerance) return false;
+    }
+    return true;
+}
+
+BOOST_AUTO_TEST_CASE(test_compressed_keyframes_tolerance) {
+    mt19937 rng(5);
+    uniform_real_distribution<float> valueDist(-1.0f, 1.0f);
+
+    for (int i = 0; i < 100; ++i) {
+        Track track(makeTrack(rng));
+
+        vector<float> positionTimes;
+        vector<glm::vec3> positions;
+        for (auto &frame : track.positions) {
+            positionTimes.push_back(frame.time);
+            positions.push_back(frame.position * 10.0f);
+        }
+        vector<float> orientationTimes;
+        vector<glm::quat> orientations;
+        for (auto &frame : track.orientations) {
+            orientationTimes.push_back(frame.time);
+            orientations.push_back(frame.orientation);
+        }
+        CompressedKeyframes compressed(positionTimes, positions, orientationTimes, orientations);
+
+        BOOST_REQUIRE(compressed.positionCount() == static_cast<int>(positions.size()));
+        BOOST_REQUIRE(compressed.orientationCount() == static_cast<int>(orientations.size()));
+        BOOST_TEST(compressed.positionTime(compressed.positionCount() - 1) == positionTimes.back());
+        BOOST_TEST(compressed.orientationTime(compressed.orientationCount() - 1) == orientationTimes.back());
+
+        float positionDuration = positionTimes.back() - positionTimes.front();
+        for (int j = 0; j < compressed.positionCount(); ++j) {
+            BOOST_TEST(glm::abs(compressed.positionTime(j) - positionTimes[j]) <= kTimeTolerance * positionDuration + 1e-6f);
+            glm::vec3 error(glm::abs(compressed.position(j) - positions[j]));
+            BOOST_TEST(glm::max(error.x, glm::max(error.y, error.z)) <= kPositionTolerance * 20.0f + 1e-5f);
+        }
+        float orientationDuration = orientationTimes.back() - orientationTimes.front();
+        for (int j = 0; j < compressed.orientationCount(); ++j) {
+            BOOST_TEST(glm::abs(compressed.orientationTime(j) - orientationTimes[j]) <= kTimeTolerance * orientationDuration + 1e-6f);
+            BOOST_TEST(isOrientationClose(compressed.orientation(j), orientations[j], kOrientationTolerance));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_compressed_orientation_edge_cases) {
+    vector<glm::quat> orientations {
+        glm::quat(1.0f, 0.0f, 0.0f, 0.0f),
+        glm::quat(-1.0f, 0.0f, 0.0f, 0.0f),
+        glm::quat(0.0f, 1.0f, 0.0f, 0.0f),
+        glm::quat(0.0f, 0.0f, -1.0f, 0.0f),
+        glm::quat(0.0f, 0.0f, 0.0f, 1.0f),
+        glm::normalize(glm::quat(0.5f, -0.5f, 0.5f, -0.5f)),
+        glm::normalize(glm::quat(1.0f, 1.0f, 0.0f, 0.0f))
+    };
+    vector<float> times;
+    for (size_t i = 0; i < orientations.size(); ++i) {
+        times.push_back(static_cast<float>(i));
+    }
+    CompressedKeyframes compressed(vector<float>(), vector<glm::vec3>(), times, orientations);
+
+    BOOST_TEST(compressed.positionCount() == 0);
+    for (size_t i = 0; i < orientations.size(); ++i) {
+        BOOST_TEST(isOrientationClose(compressed.orientation(static_cast<int>(i)), orientations[i], kOrientationTolerance));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_sample_compressed_keyframes) {
+    mt19937 rng(6);
+
+    for (int i = 0; i < 100; ++i) {
+        Track track(makeTrack(rng));
+        ModelNode compressed(0);
+        for (auto &frame : track.positions) {
+            compressed.addPositionKeyframe(frame.time, frame.position);
+        }
+        for (auto &frame : track.orientations) {
+            compressed.addOrientationKeyframe(frame.time, frame.orientation);
+        }
+        size_t uncompressedSize = compressed.keyframesSize();
+
+        KeyframeStats stats;
+        compressed.compressKeyframes(stats);
+
+        BOOST_TEST(stats.maxTimeError <= kTimeTolerance * track.length + 1e-6f);
+        BOOST_TEST(stats.maxPositionError <= kPositionTolerance * 2.0f + 1e-6f);
+        BOOST_TEST(stats.maxOrientationError <= kOrientationTolerance);
+        BOOST_TEST(compressed.keyframesSize() <= uncompressedSize);
+        if (track.positions.size() + track.orientations.size() >= 20) {
+            BOOST_TEST(compressed.keyframesSize() < uncompressedSize);
+        }
+
+        // Quantized keyframe times shift interpolation factors by up to
+        // the time error over the shortest keyframe interval (0.01), on
+        // values that differ by up to 2 per component
+        float sampleTolerance = 2.0f * stats.maxTimeError / 0.01f + 1e-4f;
+
+        uniform_real_distribution<float> timeDist(-0.5f, track.length + 0.5f);
+        ModelNode::SampleCursor cursor;
+        ModelNode::SampleCursor compressedCursor;
+
+        for (int j = 0; j < 200; ++j) {
+            float time = timeDist(rng);
+
+            glm::vec3 expectedPosition(0.0f);
+            glm::vec3 position(0.0f);
+            track.node->getPosition(time, cursor, expectedPosition);
+            BOOST_REQUIRE(compressed.getPosition(time, compressedCursor, position));
+
+            glm::vec3 error(glm::abs(position - expectedPosition));
+            BOOST_TEST(glm::max(error.x, glm::max(error.y, error.z)) <= sampleTolerance);
+
+            glm::quat expectedOrientation(1.0f, 0.0f, 0.0f, 0.0f);
+            glm::quat orientation(1.0f, 0.0f, 0.0f, 0.0f);
+            track.node->getOrientation(time, cursor, expectedOrientation);
+            BOOST_REQUIRE(compressed.getOrientation(time, compressedCursor, orientation));
+            BOOST_TEST(isOrientationClose(orientation, expectedOrientation, sampleTolerance));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_sample_compressed_keyframes_with_equal_times) {
+    ModelNode node(0);
+
+    // Keyframes closer than the time quantization step
+    for (int i = 0; i < 30; ++i) {
+        float time = 0.7f * i;
+        node.addPositionKeyframe(time, glm::vec3(static_cast<float>(i)));
+        node.addPositionKeyframe(time + 1e-5f, glm::vec3(i + 0.5f));
+        node.addOrientationKeyframe(time, glm::angleAxis(0.1f * i, glm::vec3(0.0f, 0.0f, 1.0f)));
+        node.addOrientationKeyframe(time + 1e-5f, glm::angleAxis(0.1f * i + 0.05f, glm::vec3(0.0f, 0.0f, 1.0f)));
+    }
+    KeyframeStats stats;
+    node.compressKeyframes(stats);
+
+    ModelNode::SampleCursor cursor;
+
+    for (int i = 0; i < 2000; ++i) {
+        float time = 0.0105f * i;
+
+        glm::vec3 position(0.0f);
+        BOOST_REQUIRE(node.getPosition(time, cursor, position));
+        BOOST_TEST(!glm::any(glm::isnan(position)));
+
+        glm::quat orientation(1.0f, 0.0f, 0.0f, 0.0f);
+        BOOST_REQUIRE(node.getOrientation(time, cursor, orientation));
+        BOOST_TEST(!glm::any(glm::isnan(orientation)));
+    }
+}
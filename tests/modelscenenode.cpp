@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE modelscenenode
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
+#include <stack>
+#include <string>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "glm/gtc/quaternion.hpp"
+
+#include "../src/render/model/model.h"
+#include "../src/render/texture.h"
+#include "../src/scene/lightnode.h"
+#include "../src/scene/modelnodescenenode.h"
+#include "../src/scene/modelscenenode.h"
+
+using namespace std;
+
+using namespace reone::render;
+using namespace reone::scene;
+
+static const int kNodeCount = 40;
+static const int kAnimatedNodeCount = 7;
+static const float kAnimationLength = 1.0f;
+static const float kTransitionTime = 0.5f;
+static const float kFrameTime = 0.05f;
+
+/**
+ * Builds a model where every second node has a mesh and every fifth node
+ * has a light. Meshes have no diffuse texture, so they are only rendered
+ * with a texture override.
+ */
+static shared_ptr<Model> buildModel(const string &name, bool transparent = false) {
+    vector<shared_ptr<ModelNode>> nodes;
+
+    for (int i = 0; i < kNodeCount; ++i) {
+        ModelNode *parent = i > 0 ? nodes[(i - 1) / 2].get() : nullptr;
+        shared_ptr<ModelNode> node(new ModelNode(i, parent, i, name + to_string(i), glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f)));
+        if (i % 2 == 0) {
+            node->setMesh(make_shared<ModelMesh>(i % 4 != 2, transparent ? 1 : 0));
+        }
+        if (i % 5 == 0) {
+            node->setLight(make_shared<ModelNode::Light>());
+        }
+        if (parent) {
+            nodes[(i - 1) / 2]->addChild(node);
+        }
+        nodes.push_back(move(node));
+    }
+
+    vector<unique_ptr<Animation>> anims;
+    shared_ptr<Model> model(new Model(name, nodes[0], anims));
+    if (!transparent) {
+        model->setClassification(Model::Classification::Character);
+    }
+
+    return move(model);
+}
+
+/**
+ * Collects meshes and lights by traversing the scene tree, as scene graphs
+ * used to do before models kept render lists.
+ */
+static void traverse(SceneNode &root, set<ModelNodeSceneNode *> &opaque, set<ModelNodeSceneNode *> &transparent, set<LightSceneNode *> &lights) {
+    stack<SceneNode *> nodes;
+    nodes.push(&root);
+
+    while (!nodes.empty()) {
+        SceneNode *node = nodes.top();
+        nodes.pop();
+
+        ModelSceneNode *model = dynamic_cast<ModelSceneNode *>(node);
+        if (model) {
+            if (!model->isVisible() || !model->isOnScreen()) continue;
+
+        } else {
+            ModelNodeSceneNode *modelNode = dynamic_cast<ModelNodeSceneNode *>(node);
+            if (modelNode) {
+                if (modelNode->shouldRender()) {
+                    if (modelNode->isTransparent()) {
+                        transparent.insert(modelNode);
+                    } else {
+                        opaque.insert(modelNode);
+                    }
+                }
+            } else {
+                LightSceneNode *light = dynamic_cast<LightSceneNode *>(node);
+                if (light) {
+                    lights.insert(light);
+                }
+            }
+        }
+        for (auto &child : node->children()) {
+            nodes.push(child.get());
+        }
+    }
+}
+
+static void collect(const ModelSceneNode &model, set<ModelNodeSceneNode *> &opaque, set<ModelNodeSceneNode *> &transparent, set<LightSceneNode *> &lights) {
+    if (!model.isVisible() || !model.isOnScreen()) return;
+
+    opaque.insert(model.opaqueMeshes().begin(), model.opaqueMeshes().end());
+    transparent.insert(model.transparentMeshes().begin(), model.transparentMeshes().end());
+    lights.insert(model.lights().begin(), model.lights().end());
+
+    for (auto &attached : model.attachedModels()) {
+        collect(*attached, opaque, transparent, lights);
+    }
+}
+
+static void checkRenderLists(ModelSceneNode &model) {
+    set<ModelNodeSceneNode *> expectedOpaque, expectedTransparent, opaque, transparent;
+    set<LightSceneNode *> expectedLights, lights;
+
+    traverse(model, expectedOpaque, expectedTransparent, expectedLights);
+    collect(model, opaque, transparent, lights);
+
+    BOOST_TEST((opaque == expectedOpaque));
+    BOOST_TEST((transparent == expectedTransparent));
+    BOOST_TEST((lights == expectedLights));
+}
+
+BOOST_AUTO_TEST_CASE(test_render_lists_match_traversal) {
+    ModelSceneNode model(nullptr, buildModel("body"));
+    checkRenderLists(model);
+    BOOST_TEST(model.opaqueMeshes().empty());
+    BOOST_TEST(model.lights().size() == (kNodeCount - 1) / 5);
+
+    model.setTextureOverride(make_shared<Texture>("override", TextureType::Diffuse));
+    checkRenderLists(model);
+    BOOST_TEST(!model.opaqueMeshes().empty());
+
+    shared_ptr<ModelSceneNode> weapon(model.attach("body3", buildModel("weapon", true)));
+    BOOST_REQUIRE(weapon);
+    weapon->setTextureOverride(make_shared<Texture>("override", TextureType::Diffuse));
+    BOOST_TEST(model.attachedModels().size() == 1);
+    BOOST_TEST(!weapon->transparentMeshes().empty());
+    checkRenderLists(model);
+
+    weapon->setVisible(false);
+    checkRenderLists(model);
+    weapon->setVisible(true);
+
+    model.attach("body3", shared_ptr<Model>());
+    BOOST_TEST(model.attachedModels().empty());
+    checkRenderLists(model);
+
+    model.setModel(buildModel("head"));
+    checkRenderLists(model);
+    BOOST_TEST(model.lights().size() == (kNodeCount - 1) / 5);
+}
+
+BOOST_AUTO_TEST_CASE(test_bone_palettes_shared_by_skin) {
+    shared_ptr<Model> model(buildModel("body"));
+    vector<ModelNode *> meshNodes;
+
+    stack<ModelNode *> nodes;
+    nodes.push(&model->rootNode());
+    while (!nodes.empty()) {
+        ModelNode *node = nodes.top();
+        nodes.pop();
+        if (node->mesh()) {
+            meshNodes.push_back(node);
+        }
+        for (auto &child : node->children()) {
+            nodes.push(child.get());
+        }
+    }
+    BOOST_REQUIRE(meshNodes.size() >= 3);
+
+    auto body = make_shared<ModelNode::Skin>();
+    body->nodeIdxByBoneIdx = { 1, 3, kNoBoneNode, 5 };
+    auto head = make_shared<ModelNode::Skin>();
+    head->nodeIdxByBoneIdx = { 7 };
+
+    meshNodes[0]->setSkin(body);
+    meshNodes[1]->setSkin(body);
+    meshNodes[2]->setSkin(head);
+
+    ModelSceneNode sceneNode(nullptr, model);
+    BOOST_TEST(sceneNode.bonePalettesBuilt() == 2);
+
+    const BonePalette *bodyPalette = sceneNode.getModelNodeByIndex(meshNodes[0]->index())->bonePalette();
+    const BonePalette *headPalette = sceneNode.getModelNodeByIndex(meshNodes[2]->index())->bonePalette();
+    BOOST_REQUIRE(bodyPalette);
+    BOOST_REQUIRE(headPalette);
+    BOOST_TEST((sceneNode.getModelNodeByIndex(meshNodes[1]->index())->bonePalette() == bodyPalette));
+    BOOST_TEST((headPalette != bodyPalette));
+    BOOST_TEST(bodyPalette->bones.size() == 4);
+    BOOST_TEST(headPalette->bones.size() == 1);
+    BOOST_TEST(bodyPalette->revision != 0);
+    BOOST_TEST(bodyPalette->revision != headPalette->revision);
+    BOOST_TEST(!sceneNode.getModelNodeByIndex(meshNodes[3]->index())->bonePalette());
+}
+
+/**
+ * Builds a tree of kAnimatedNodeCount nodes, named after their indices. For
+ * an animation, the last node is omitted and keyframes are added to some of
+ * the nodes. For a model, nodes are offset and rotated.
+ */
+static shared_ptr<ModelNode> buildAnimatedNodes(bool animation, float phase = 0.0f) {
+    vector<shared_ptr<ModelNode>> nodes;
+    int nodeCount = animation ? kAnimatedNodeCount - 1 : kAnimatedNodeCount;
+
+    for (int i = 0; i < nodeCount; ++i) {
+        ModelNode *parent = i > 0 ? nodes[(i - 1) / 2].get() : nullptr;
+        glm::vec3 position(animation ? glm::vec3(0.0f) : glm::vec3(0.1f * i, 0.2f, -0.05f * i));
+        glm::quat orientation(animation ? glm::quat(1.0f, 0.0f, 0.0f, 0.0f) : glm::angleAxis(0.2f * i, glm::vec3(0.0f, 0.0f, 1.0f)));
+
+        shared_ptr<ModelNode> node(new ModelNode(i, parent, i, "node" + to_string(i), position, orientation));
+        if (animation) {
+            for (int j = 0; j <= 4; ++j) {
+                float time = kAnimationLength * j / 4;
+                if (i % 3 != 2) {
+                    node->addPositionKeyframe(time, glm::vec3(0.0f, 0.1f * glm::sin(phase + time + i), 0.05f * j));
+                }
+                if (i % 2 == 0) {
+                    node->addOrientationKeyframe(time, glm::angleAxis(glm::sin(phase + 2.0f * time + i), glm::normalize(glm::vec3(1.0f, 0.5f * i, 0.2f))));
+                }
+            }
+        }
+        if (parent) {
+            nodes[(i - 1) / 2]->addChild(node);
+        }
+        nodes.push_back(move(node));
+    }
+
+    return nodes[0];
+}
+
+struct ReferenceChannel {
+    Animation *animation { nullptr };
+    float time { 0.0f };
+    bool transition { false };
+    map<uint16_t, glm::mat4> localTransforms;
+};
+
+/**
+ * Computes local transforms of a channel by traversing the animation tree,
+ * as the animator used to do before it was bound to model node arrays.
+ */
+static void updateReferenceLocalTransforms(const ModelSceneNode &model, ReferenceChannel &channel, const ModelNode &animNode) {
+    ModelNodeSceneNode *sceneNode = model.getModelNode(animNode.name());
+    if (sceneNode) {
+        ModelNode *modelNode = sceneNode->modelNode();
+        glm::vec3 position(modelNode->position());
+        glm::quat orientation(modelNode->orientation());
+
+        float time = channel.transition ? channel.animation->transitionTime() : channel.time;
+        glm::vec3 animPosition(0.0f);
+        if (animNode.getPosition(time, animPosition, model.model()->animationScale())) {
+            position += animPosition;
+        }
+        glm::quat animOrientation(0.0f, 0.0f, 0.0f, 1.0f);
+        if (animNode.getOrientation(time, animOrientation)) {
+            orientation = animOrientation;
+        }
+
+        glm::mat4 transform(1.0f);
+        transform = glm::translate(transform, position);
+        transform *= glm::mat4_cast(orientation);
+        channel.localTransforms.insert(make_pair(modelNode->nodeNumber(), transform));
+    }
+
+    for (auto &child : animNode.children()) {
+        updateReferenceLocalTransforms(model, channel, *child);
+    }
+}
+
+/**
+ * Checks absolute transforms of model nodes against the ones computed by
+ * per-node evaluation of one or two channels, the latter being blended.
+ *
+ * @param delta blend factor between the second and the first channel
+ */
+static void checkNodeTransforms(const ModelSceneNode &model, ReferenceChannel &channel0, ReferenceChannel *channel1, float delta, const ModelNode &modelNode, const glm::mat4 &parentTransform) {
+    glm::mat4 localTransform(modelNode.localTransform());
+
+    auto maybeTransform0 = channel0.localTransforms.find(modelNode.nodeNumber());
+    bool hasTransform0 = maybeTransform0 != channel0.localTransforms.end();
+
+    if (channel0.transition && channel1) {
+        auto maybeTransform1 = channel1->localTransforms.find(modelNode.nodeNumber());
+        bool hasTransform1 = maybeTransform1 != channel1->localTransforms.end();
+        if (hasTransform0 && hasTransform1) {
+            glm::quat orientation0(glm::toQuat(maybeTransform0->second));
+            glm::quat orientation1(glm::toQuat(maybeTransform1->second));
+            localTransform = glm::translate(glm::mat4(1.0f), glm::vec3(maybeTransform0->second[3]));
+            localTransform *= glm::mat4_cast(glm::slerp(orientation1, orientation0, delta));
+        } else if (hasTransform0) {
+            localTransform = maybeTransform0->second;
+        } else if (hasTransform1) {
+            localTransform = maybeTransform1->second;
+        }
+    } else if (hasTransform0) {
+        localTransform = maybeTransform0->second;
+    }
+    glm::mat4 transform(parentTransform * localTransform);
+
+    const glm::mat4 &actual = model.getModelNodeByIndex(modelNode.index())->localTransform();
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            BOOST_TEST(glm::abs(actual[col][row] - transform[col][row]) < 1e-5f, modelNode.name() << ", column " << col << ", row " << row);
+        }
+    }
+
+    for (auto &child : modelNode.children()) {
+        checkNodeTransforms(model, channel0, channel1, delta, *child, transform);
+    }
+}
+
+static void checkAnimatedModel(const ModelSceneNode &model, ReferenceChannel &channel0, ReferenceChannel *channel1 = nullptr, float delta = 0.0f) {
+    channel0.localTransforms.clear();
+    updateReferenceLocalTransforms(model, channel0, *channel0.animation->rootNode());
+
+    if (channel1) {
+        channel1->localTransforms.clear();
+        updateReferenceLocalTransforms(model, *channel1, *channel1->animation->rootNode());
+    }
+    checkNodeTransforms(model, channel0, channel1, delta, model.model()->rootNode(), glm::mat4(1.0f));
+}
+
+BOOST_AUTO_TEST_CASE(test_animator_matches_per_node_evaluation) {
+    vector<unique_ptr<Animation>> anims;
+    anims.push_back(make_unique<Animation>("walk", kAnimationLength, kTransitionTime, buildAnimatedNodes(true)));
+    anims.push_back(make_unique<Animation>("wave", kAnimationLength, kTransitionTime, buildAnimatedNodes(true, 1.0f)));
+    Animation *walk = anims[0].get();
+    Animation *wave = anims[1].get();
+
+    ModelSceneNode model(nullptr, make_shared<Model>("character", buildAnimatedNodes(false), anims));
+
+    // Looping animation
+
+    ReferenceChannel walkChannel;
+    walkChannel.animation = walk;
+
+    model.playAnimation("walk", kAnimationLoop);
+
+    for (int frame = 0; frame < 25; ++frame) {
+        model.update(kFrameTime);
+        checkAnimatedModel(model, walkChannel);
+        walkChannel.time = glm::mod(walkChannel.time + kFrameTime, kAnimationLength);
+    }
+
+    // Transition from a frozen animation into the next one
+
+    ReferenceChannel waveChannel;
+    waveChannel.animation = wave;
+    waveChannel.time = kTransitionTime - 0.25f;
+    waveChannel.transition = true;
+
+    model.playAnimation("wave", kAnimationLoop | kAnimationBlend);
+
+    for (int frame = 0; frame < 10; ++frame) {
+        if (waveChannel.transition && waveChannel.time >= kTransitionTime) {
+            waveChannel.transition = false;
+        }
+        model.update(kFrameTime);
+
+        // Blend factor is computed after animation time is advanced
+        float nextTime = glm::mod(waveChannel.time + kFrameTime, kAnimationLength);
+        float delta = 1.0f - (kTransitionTime - nextTime) / kTransitionTime;
+
+        checkAnimatedModel(model, waveChannel, waveChannel.transition ? &walkChannel : nullptr, delta);
+        waveChannel.time = nextTime;
+    }
+}
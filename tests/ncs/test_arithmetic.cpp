@@ -0,0 +1,165 @@
+// Generated by reone-tools from test_arithmetic. Do not edit.
+
+#include "script/native.h"
+
+using namespace reone::script;
+
+static const uint32_t kLength = 95;
+
+static const Instruction g_instructions[] = {
+    makeInstruction(13, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 19, 0, 0, 1069547520), // CONSTx 1.500000
+    makeInstruction(19, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 25, 0, 0, 1073741824), // CONSTx 2.000000
+    makeInstruction(25, static_cast<ByteCode>(0x16), static_cast<InstructionType>(0x21), 27, 0, 0, 0), // MULxx
+    makeInstruction(27, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 33, 0, 0, 1075838976), // CONSTx 2.500000
+    makeInstruction(33, static_cast<ByteCode>(0x0e), static_cast<InstructionType>(0x21), 35, 0, 0, 0), // GTxx
+    makeInstruction(35, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 41, 0, 0, 7), // CONSTx 7
+    makeInstruction(41, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 47, 0, 0, 3), // CONSTx 3
+    makeInstruction(47, static_cast<ByteCode>(0x18), static_cast<InstructionType>(0x20), 49, 0, 0, 0), // MODII
+    makeInstruction(49, static_cast<ByteCode>(0x06), static_cast<InstructionType>(0x20), 51, 0, 0, 0), // LOGANDII
+    makeInstruction(51, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 57, 0, 0, 5), // CONSTx 5
+    makeInstruction(57, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x03), 59, 0, 0, 0), // NEGx
+    makeInstruction(59, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 65, 0, 0, 2), // CONSTx 2
+    makeInstruction(65, static_cast<ByteCode>(0x16), static_cast<InstructionType>(0x20), 67, 0, 0, 0), // MULxx
+    makeInstruction(67, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 72, 0, 0, 0, "x"), // CONSTx \"x\"
+    makeInstruction(72, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 77, 0, 0, 0, "x"), // CONSTx \"x\"
+    makeInstruction(77, static_cast<ByteCode>(0x0b), static_cast<InstructionType>(0x23), 79, 0, 0, 0), // EQUALxx
+    makeInstruction(79, static_cast<ByteCode>(0x14), static_cast<InstructionType>(0x20), 81, 0, 0, 0), // ADDxx
+    makeInstruction(81, static_cast<ByteCode>(0x15), static_cast<InstructionType>(0x20), 83, 0, 0, 0), // SUBxx
+    makeInstruction(83, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x00), 85, 0, 0, 0), // NOTI
+    makeInstruction(85, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 91, 0, 0, 4), // CONSTx 4
+    makeInstruction(91, static_cast<ByteCode>(0x10), static_cast<InstructionType>(0x20), 93, 0, 0, 0), // LEQxx
+    makeInstruction(93, static_cast<ByteCode>(0x20), static_cast<InstructionType>(0x00), 95, 0, 0, 0) // RETN
+};
+
+extern "C" REONE_NATIVE_SCRIPT_EXPORT bool reone_ncs_test_arithmetic(IInstructionExecutor &exec, uint32_t offset) {
+    std::vector<Variable> &stack = exec.stack();
+    uint32_t instructionCount = 0;
+
+dispatch:
+    switch (offset) {
+        case 13: goto ins_13;
+        case 19: goto ins_19;
+        case 25: goto ins_25;
+        case 27: goto ins_27;
+        case 33: goto ins_33;
+        case 35: goto ins_35;
+        case 41: goto ins_41;
+        case 47: goto ins_47;
+        case 49: goto ins_49;
+        case 51: goto ins_51;
+        case 57: goto ins_57;
+        case 59: goto ins_59;
+        case 65: goto ins_65;
+        case 67: goto ins_67;
+        case 72: goto ins_72;
+        case 77: goto ins_77;
+        case 79: goto ins_79;
+        case 81: goto ins_81;
+        case 83: goto ins_83;
+        case 85: goto ins_85;
+        case 91: goto ins_91;
+        case 93: goto ins_93;
+        default:
+            exec.countInstructions(instructionCount);
+            return offset >= kLength;
+    }
+
+ins_13:
+    stack.push_back(Variable(g_instructions[0].floatValue));
+    ++instructionCount;
+
+ins_19:
+    stack.push_back(Variable(g_instructions[1].floatValue));
+    ++instructionCount;
+
+ins_25:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue * stack.back().floatValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_27:
+    stack.push_back(Variable(g_instructions[3].floatValue));
+    ++instructionCount;
+
+ins_33:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue > stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_35:
+    stack.push_back(Variable(7));
+    ++instructionCount;
+
+ins_41:
+    stack.push_back(Variable(3));
+    ++instructionCount;
+
+ins_47:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue % stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_49:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue && stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_51:
+    stack.push_back(Variable(5));
+    ++instructionCount;
+
+ins_57:
+    stack.back() = Variable(-stack.back().intValue);
+    ++instructionCount;
+
+ins_59:
+    stack.push_back(Variable(2));
+    ++instructionCount;
+
+ins_65:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue * stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_67:
+    stack.push_back(Variable(g_instructions[13].strValue));
+    ++instructionCount;
+
+ins_72:
+    stack.push_back(Variable(g_instructions[14].strValue));
+    ++instructionCount;
+
+ins_77:
+    exec.executeInstruction(g_instructions[15]);
+
+ins_79:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue + stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_81:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue - stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_83:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_85:
+    stack.push_back(Variable(4));
+    ++instructionCount;
+
+ins_91:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue <= stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_93:
+    exec.executeInstruction(g_instructions[21]);
+    offset = exec.nextInstruction();
+    goto dispatch;
+
+    exec.countInstructions(instructionCount);
+    return true;
+}
@@ -0,0 +1,1446 @@
+// Generated by reone-tools from test_corpus_1. Do not edit.
+
+#include "script/native.h"
+
+using namespace reone::script;
+
+static const uint32_t kLength = 1074;
+
+static const Instruction g_instructions[] = {
+    makeInstruction(13, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 19, 0, 0, 1), // CONSTx 1
+    makeInstruction(19, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 25, 0, 0, 1084751872), // CONSTx 5.250000
+    makeInstruction(25, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 31, 0, 0, 1087373312), // CONSTx 6.500000
+    makeInstruction(31, static_cast<ByteCode>(0x0b), static_cast<InstructionType>(0x21), 33, 0, 0, 0), // EQUALxx
+    makeInstruction(33, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 39, 0, 0, 1080033280), // CONSTx 3.500000
+    makeInstruction(39, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 46, 0, 0, 0, "q\"z"), // CONSTx \"q\"z\"
+    makeInstruction(46, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 52, 0, 0, 1071644672), // CONSTx 1.750000
+    makeInstruction(52, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 58, 0, 0, 1088946176), // CONSTx 7.250000
+    makeInstruction(58, static_cast<ByteCode>(0x0f), static_cast<InstructionType>(0x21), 60, 0, 0, 0), // LTxx
+    makeInstruction(60, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 62, 0, 0, 0), // NOP
+    makeInstruction(62, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 68, 98, 0, 0), // JZ 00000062
+    makeInstruction(68, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 74, 0, 0, 0, "xy"), // CONSTx \"xy\"
+    makeInstruction(74, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 80, 0, 0, 0, "xy"), // CONSTx \"xy\"
+    makeInstruction(80, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 86, 0, 0, -8), // CONSTx -8
+    makeInstruction(86, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 92, -12, 0, 0), // MOVESP
+    makeInstruction(92, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 98, 110, 0, 0), // JMP 0000006e
+    makeInstruction(98, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 104, 0, 0, 16), // CONSTx 16
+    makeInstruction(104, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 110, -4, 0, 0), // MOVESP
+    makeInstruction(110, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 116, 0, 0, 14), // CONSTx 14
+    makeInstruction(116, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 122, 0, 0, -15), // CONSTx -15
+    makeInstruction(122, static_cast<ByteCode>(0x09), static_cast<InstructionType>(0x20), 124, 0, 0, 0), // EXCORII
+    makeInstruction(124, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 130, 160, 0, 0), // JZ 000000a0
+    makeInstruction(130, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 132, 0, 0, 0), // NOP
+    makeInstruction(132, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 140, -16, 4, 0), // CPTOPSP
+    makeInstruction(140, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 142, 0, 0, 0), // NOTI
+    makeInstruction(142, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 148, 0, 0, -12), // CONSTx -12
+    makeInstruction(148, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 154, -8, 0, 0), // MOVESP
+    makeInstruction(154, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 160, 181, 0, 0), // JMP 000000b5
+    makeInstruction(160, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 167, 0, 0, 0, "q\"z"), // CONSTx \"q\"z\"
+    makeInstruction(167, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 175, -16, 4, 0), // CPTOPSP
+    makeInstruction(175, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 181, -8, 0, 0), // MOVESP
+    makeInstruction(181, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 183, 0, 0, 0), // NOP
+    makeInstruction(183, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 191, -8, 8, 0), // CPTOPSP
+    makeInstruction(191, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 199, -12, 4, 0), // CPDOWNSP
+    makeInstruction(199, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 205, 0, 0, -9), // CONSTx -9
+    makeInstruction(205, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 211, 0, 0, 15), // CONSTx 15
+    makeInstruction(211, static_cast<ByteCode>(0x0a), static_cast<InstructionType>(0x20), 213, 0, 0, 0), // BOOLANDII
+    makeInstruction(213, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 215, 0, 0, 0), // NOP
+    makeInstruction(215, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 221, -4, 0, 0), // MOVESP
+    makeInstruction(221, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 229, -12, 4, 0), // CPDOWNSP
+    makeInstruction(229, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 235, 0, 0, 13), // CONSTx 13
+    makeInstruction(235, static_cast<ByteCode>(0x25), static_cast<InstructionType>(0x00), 241, 263, 0, 0), // JNZ 00000107
+    makeInstruction(241, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 247, 0, 0, -2), // CONSTx -2
+    makeInstruction(247, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x03), 249, 0, 0, 0), // NEGx
+    makeInstruction(249, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 251, 0, 0, 0), // NOP
+    makeInstruction(251, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 257, -4, 0, 0), // MOVESP
+    makeInstruction(257, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 263, 353, 0, 0), // JMP 00000161
+    makeInstruction(263, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 269, 0, 0, -10), // CONSTx -10
+    makeInstruction(269, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 275, 293, 0, 0), // JZ 00000125
+    makeInstruction(275, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 281, 0, 0, -9), // CONSTx -9
+    makeInstruction(281, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 287, -4, 0, 0), // MOVESP
+    makeInstruction(287, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 293, 341, 0, 0), // JMP 00000155
+    makeInstruction(293, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 299, 0, 0, -1064828928), // CONSTx -4.250000
+    makeInstruction(299, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 307, -16, 8, 0), // CPTOPSP
+    makeInstruction(307, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 313, 0, 0, 1073741824), // CONSTx 2.000000
+    makeInstruction(313, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 319, 0, 0, 1071644672), // CONSTx 1.750000
+    makeInstruction(319, static_cast<ByteCode>(0x0c), static_cast<InstructionType>(0x21), 321, 0, 0, 0), // NEQUALxx
+    makeInstruction(321, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 327, 0, 0, -17), // CONSTx -17
+    makeInstruction(327, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 333, 0, 0, 0), // CONSTx 0
+    makeInstruction(333, static_cast<ByteCode>(0x0f), static_cast<InstructionType>(0x20), 335, 0, 0, 0), // LTxx
+    makeInstruction(335, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 341, -20, 0, 0), // MOVESP
+    makeInstruction(341, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 347, 0, 0, -1060634624), // CONSTx -6.250000
+    makeInstruction(347, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 353, -4, 0, 0), // MOVESP
+    makeInstruction(353, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 355, 0, 0, 0), // NOP
+    makeInstruction(355, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 361, 0, 0, 0, "xy"), // CONSTx \"xy\"
+    makeInstruction(361, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 367, 0, 0, 1081081856), // CONSTx 3.750000
+    makeInstruction(367, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 373, 0, 0, -1067450368), // CONSTx -3.500000
+    makeInstruction(373, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 379, 0, 0, 1084751872), // CONSTx 5.250000
+    makeInstruction(379, static_cast<ByteCode>(0x0e), static_cast<InstructionType>(0x21), 381, 0, 0, 0), // GTxx
+    makeInstruction(381, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 387, 405, 0, 0), // JZ 00000195
+    makeInstruction(387, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 393, 0, 0, -1090519040), // CONSTx -0.500000
+    makeInstruction(393, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 399, -4, 0, 0), // MOVESP
+    makeInstruction(399, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 405, 423, 0, 0), // JMP 000001a7
+    makeInstruction(405, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 407, 0, 0, 0), // NOP
+    makeInstruction(407, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x04), 409, 0, 0, 0), // NEGx
+    makeInstruction(409, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 417, -16, 4, 0), // CPTOPSP
+    makeInstruction(417, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 423, -4, 0, 0), // MOVESP
+    makeInstruction(423, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 429, 0, 0, -8), // CONSTx -8
+    makeInstruction(429, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 431, 0, 0, 0), // NOTI
+    makeInstruction(431, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 433, 0, 0, 0), // NOP
+    makeInstruction(433, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 435, 0, 0, 0), // NOTI
+    makeInstruction(435, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 441, 0, 0, 15), // CONSTx 15
+    makeInstruction(441, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 447, 0, 0, -1058013184), // CONSTx -7.500000
+    makeInstruction(447, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 455, -8, 4, 0), // CPTOPSP
+    makeInstruction(455, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 461, 0, 0, 1081081856), // CONSTx 3.750000
+    makeInstruction(461, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 467, 0, 0, -20), // CONSTx -20
+    makeInstruction(467, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 469, 0, 0, 0), // NOP
+    makeInstruction(469, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 471, 0, 0, 0), // NOP
+    makeInstruction(471, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 477, 0, 0, 1076887552), // CONSTx 2.750000
+    makeInstruction(477, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 483, 0, 0, 1088946176), // CONSTx 7.250000
+    makeInstruction(483, static_cast<ByteCode>(0x0f), static_cast<InstructionType>(0x21), 485, 0, 0, 0), // LTxx
+    makeInstruction(485, static_cast<ByteCode>(0x25), static_cast<InstructionType>(0x00), 491, 517, 0, 0), // JNZ 00000205
+    makeInstruction(491, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 493, 0, 0, 0), // NOP
+    makeInstruction(493, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 501, -8, 8, 0), // CPTOPSP
+    makeInstruction(501, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x03), 503, 0, 0, 0), // NEGx
+    makeInstruction(503, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 505, 0, 0, 0), // NOP
+    makeInstruction(505, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 511, -8, 0, 0), // MOVESP
+    makeInstruction(511, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 517, 545, 0, 0), // JMP 00000221
+    makeInstruction(517, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 523, 0, 0, -1064828928), // CONSTx -4.250000
+    makeInstruction(523, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x04), 525, 0, 0, 0), // NEGx
+    makeInstruction(525, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 531, 0, 0, 1089470464), // CONSTx 7.500000
+    makeInstruction(531, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 537, 0, 0, 1061158912), // CONSTx 0.750000
+    makeInstruction(537, static_cast<ByteCode>(0x15), static_cast<InstructionType>(0x21), 539, 0, 0, 0), // SUBxx
+    makeInstruction(539, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 545, -8, 0, 0), // MOVESP
+    makeInstruction(545, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 551, 583, 0, 0), // JZ 00000247
+    makeInstruction(551, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 557, 0, 0, 12), // CONSTx 12
+    makeInstruction(557, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 563, 0, 0, -20), // CONSTx -20
+    makeInstruction(563, static_cast<ByteCode>(0x15), static_cast<InstructionType>(0x20), 565, 0, 0, 0), // SUBxx
+    makeInstruction(565, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 571, -4, 0, 0), // DECISP
+    makeInstruction(571, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 577, -4, 0, 0), // MOVESP
+    makeInstruction(577, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 583, 611, 0, 0), // JMP 00000263
+    makeInstruction(583, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 589, 0, 0, -1), // CONSTx -1
+    makeInstruction(589, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 597, -8, 8, 0), // CPTOPSP
+    makeInstruction(597, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 605, -12, 4, 0), // CPDOWNSP
+    makeInstruction(605, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 611, -12, 0, 0), // MOVESP
+    makeInstruction(611, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 619, -12, 4, 0), // CPDOWNSP
+    makeInstruction(619, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 627, -24, 4, 0), // CPTOPSP
+    makeInstruction(627, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 633, 0, 0, 7), // CONSTx 7
+    makeInstruction(633, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 639, 0, 0, -13), // CONSTx -13
+    makeInstruction(639, static_cast<ByteCode>(0x0f), static_cast<InstructionType>(0x20), 641, 0, 0, 0), // LTxx
+    makeInstruction(641, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 647, 0, 0, -2), // CONSTx -2
+    makeInstruction(647, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 649, 0, 0, 0), // NOP
+    makeInstruction(649, static_cast<ByteCode>(0x25), static_cast<InstructionType>(0x00), 655, 716, 0, 0), // JNZ 000002cc
+    makeInstruction(655, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 661, -24, 0, 0), // INCISP
+    makeInstruction(661, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 667, -24, 0, 0), // DECISP
+    makeInstruction(667, static_cast<ByteCode>(0x25), static_cast<InstructionType>(0x00), 673, 699, 0, 0), // JNZ 000002bb
+    makeInstruction(673, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 679, 0, 0, -1062731776), // CONSTx -5.250000
+    makeInstruction(679, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 687, -20, 4, 0), // CPDOWNSP
+    makeInstruction(687, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 693, -4, 0, 0), // MOVESP
+    makeInstruction(693, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 699, 710, 0, 0), // JMP 000002c6
+    makeInstruction(699, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 704, 0, 0, 0, "a"), // CONSTx \"a\"
+    makeInstruction(704, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 710, -4, 0, 0), // MOVESP
+    makeInstruction(710, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 716, 744, 0, 0), // JMP 000002e8
+    makeInstruction(716, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 722, 0, 0, 6), // CONSTx 6
+    makeInstruction(722, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 728, 0, 0, -19), // CONSTx -19
+    makeInstruction(728, static_cast<ByteCode>(0x07), static_cast<InstructionType>(0x20), 730, 0, 0, 0), // LOGORII
+    makeInstruction(730, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 738, -16, 4, 0), // CPDOWNSP
+    makeInstruction(738, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 744, -4, 0, 0), // MOVESP
+    makeInstruction(744, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x04), 746, 0, 0, 0), // NEGx
+    makeInstruction(746, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 752, 0, 0, 6), // CONSTx 6
+    makeInstruction(752, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 754, 0, 0, 0), // NOP
+    makeInstruction(754, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 756, 0, 0, 0), // NOP
+    makeInstruction(756, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 758, 0, 0, 0), // NOTI
+    makeInstruction(758, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x03), 760, 0, 0, 0), // NEGx
+    makeInstruction(760, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 766, 0, 0, -11), // CONSTx -11
+    makeInstruction(766, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 768, 0, 0, 0), // NOP
+    makeInstruction(768, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 774, -20, 0, 0), // INCISP
+    makeInstruction(774, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 780, 814, 0, 0), // JZ 0000032e
+    makeInstruction(780, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 786, 0, 0, 8), // CONSTx 8
+    makeInstruction(786, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 792, 0, 0, 4), // CONSTx 4
+    makeInstruction(792, static_cast<ByteCode>(0x08), static_cast<InstructionType>(0x20), 794, 0, 0, 0), // INCORII
+    makeInstruction(794, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 802, -20, 4, 0), // CPTOPSP
+    makeInstruction(802, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 808, -8, 0, 0), // MOVESP
+    makeInstruction(808, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 814, 847, 0, 0), // JMP 0000034f
+    makeInstruction(814, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 822, -24, 4, 0), // CPDOWNSP
+    makeInstruction(822, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 830, -24, 4, 0), // CPDOWNSP
+    makeInstruction(830, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 836, 0, 0, 11), // CONSTx 11
+    makeInstruction(836, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 841, 0, 0, 0, "a"), // CONSTx \"a\"
+    makeInstruction(841, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 847, -8, 0, 0), // MOVESP
+    makeInstruction(847, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 853, 0, 0, -14), // CONSTx -14
+    makeInstruction(853, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 859, 0, 0, 18), // CONSTx 18
+    makeInstruction(859, static_cast<ByteCode>(0x06), static_cast<InstructionType>(0x20), 861, 0, 0, 0), // LOGANDII
+    makeInstruction(861, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 863, 0, 0, 0), // NOTI
+    makeInstruction(863, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 869, 0, 0, 1087897600), // CONSTx 6.750000
+    makeInstruction(869, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 875, 0, 0, 19), // CONSTx 19
+    makeInstruction(875, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 881, 0, 0, 3), // CONSTx 3
+    makeInstruction(881, static_cast<ByteCode>(0x11), static_cast<InstructionType>(0x20), 883, 0, 0, 0), // SHLEFTII
+    makeInstruction(883, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 889, 0, 0, 12), // CONSTx 12
+    makeInstruction(889, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 895, -8, 0, 0), // MOVESP
+    makeInstruction(895, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 903, -20, 8, 0), // CPTOPSP
+    makeInstruction(903, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 905, 0, 0, 0), // NOP
+    makeInstruction(905, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x04), 907, 0, 0, 0), // NEGx
+    makeInstruction(907, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x04), 909, 0, 0, 0), // NEGx
+    makeInstruction(909, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x04), 911, 0, 0, 0), // NEGx
+    makeInstruction(911, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 917, 0, 0, 1087373312), // CONSTx 6.500000
+    makeInstruction(917, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 923, 0, 0, 11), // CONSTx 11
+    makeInstruction(923, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 929, 937, 0, 0), // JZ 000003a9
+    makeInstruction(929, static_cast<ByteCode>(0x0f), static_cast<InstructionType>(0x21), 931, 0, 0, 0), // LTxx
+    makeInstruction(931, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 937, 973, 0, 0), // JMP 000003cd
+    makeInstruction(937, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 943, -16, 0, 0), // DECISP
+    makeInstruction(943, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 951, -16, 4, 0), // CPDOWNSP
+    makeInstruction(951, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 957, 0, 0, 1073741824), // CONSTx 2.000000
+    makeInstruction(957, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 963, 0, 0, 1085276160), // CONSTx 5.500000
+    makeInstruction(963, static_cast<ByteCode>(0x0c), static_cast<InstructionType>(0x21), 965, 0, 0, 0), // NEQUALxx
+    makeInstruction(965, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 967, 0, 0, 0), // NOTI
+    makeInstruction(967, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 973, -4, 0, 0), // MOVESP
+    makeInstruction(973, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 981, -24, 8, 0), // CPTOPSP
+    makeInstruction(981, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 983, 0, 0, 0), // NOP
+    makeInstruction(983, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 989, 0, 0, 9), // CONSTx 9
+    makeInstruction(989, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 995, 0, 0, 5), // CONSTx 5
+    makeInstruction(995, static_cast<ByteCode>(0x14), static_cast<InstructionType>(0x20), 997, 0, 0, 0), // ADDxx
+    makeInstruction(997, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 1003, -4, 0, 0), // MOVESP
+    makeInstruction(1003, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 1011, -12, 4, 0), // CPDOWNSP
+    makeInstruction(1011, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 1017, -12, 0, 0), // MOVESP
+    makeInstruction(1017, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 1019, 0, 0, 0), // NOP
+    makeInstruction(1019, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 1025, 0, 0, 2), // CONSTx 2
+    makeInstruction(1025, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 1031, 0, 0, 13), // CONSTx 13
+    makeInstruction(1031, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 1037, 0, 0, -2), // CONSTx -2
+    makeInstruction(1037, static_cast<ByteCode>(0x06), static_cast<InstructionType>(0x20), 1039, 0, 0, 0), // LOGANDII
+    makeInstruction(1039, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 1041, 0, 0, 0), // NOP
+    makeInstruction(1041, static_cast<ByteCode>(0x15), static_cast<InstructionType>(0x20), 1043, 0, 0, 0), // SUBxx
+    makeInstruction(1043, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x03), 1045, 0, 0, 0), // NEGx
+    makeInstruction(1045, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 1047, 0, 0, 0), // NOTI
+    makeInstruction(1047, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 1049, 0, 0, 0), // NOTI
+    makeInstruction(1049, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 1053, 0, 0, 0), // CONSTx \"\"
+    makeInstruction(1053, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 1059, -20, 0, 0), // DECISP
+    makeInstruction(1059, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 1066, 0, 0, 0, "q\"z"), // CONSTx \"q\"z\"
+    makeInstruction(1066, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 1072, 0, 0, -10), // CONSTx -10
+    makeInstruction(1072, static_cast<ByteCode>(0x20), static_cast<InstructionType>(0x00), 1074, 0, 0, 0) // RETN
+};
+
+extern "C" REONE_NATIVE_SCRIPT_EXPORT bool reone_ncs_test_corpus_1(IInstructionExecutor &exec, uint32_t offset) {
+    std::vector<Variable> &stack = exec.stack();
+    uint32_t instructionCount = 0;
+
+dispatch:
+    switch (offset) {
+        case 13: goto ins_13;
+        case 19: goto ins_19;
+        case 25: goto ins_25;
+        case 31: goto ins_31;
+        case 33: goto ins_33;
+        case 39: goto ins_39;
+        case 46: goto ins_46;
+        case 52: goto ins_52;
+        case 58: goto ins_58;
+        case 60: goto ins_60;
+        case 62: goto ins_62;
+        case 68: goto ins_68;
+        case 74: goto ins_74;
+        case 80: goto ins_80;
+        case 86: goto ins_86;
+        case 92: goto ins_92;
+        case 98: goto ins_98;
+        case 104: goto ins_104;
+        case 110: goto ins_110;
+        case 116: goto ins_116;
+        case 122: goto ins_122;
+        case 124: goto ins_124;
+        case 130: goto ins_130;
+        case 132: goto ins_132;
+        case 140: goto ins_140;
+        case 142: goto ins_142;
+        case 148: goto ins_148;
+        case 154: goto ins_154;
+        case 160: goto ins_160;
+        case 167: goto ins_167;
+        case 175: goto ins_175;
+        case 181: goto ins_181;
+        case 183: goto ins_183;
+        case 191: goto ins_191;
+        case 199: goto ins_199;
+        case 205: goto ins_205;
+        case 211: goto ins_211;
+        case 213: goto ins_213;
+        case 215: goto ins_215;
+        case 221: goto ins_221;
+        case 229: goto ins_229;
+        case 235: goto ins_235;
+        case 241: goto ins_241;
+        case 247: goto ins_247;
+        case 249: goto ins_249;
+        case 251: goto ins_251;
+        case 257: goto ins_257;
+        case 263: goto ins_263;
+        case 269: goto ins_269;
+        case 275: goto ins_275;
+        case 281: goto ins_281;
+        case 287: goto ins_287;
+        case 293: goto ins_293;
+        case 299: goto ins_299;
+        case 307: goto ins_307;
+        case 313: goto ins_313;
+        case 319: goto ins_319;
+        case 321: goto ins_321;
+        case 327: goto ins_327;
+        case 333: goto ins_333;
+        case 335: goto ins_335;
+        case 341: goto ins_341;
+        case 347: goto ins_347;
+        case 353: goto ins_353;
+        case 355: goto ins_355;
+        case 361: goto ins_361;
+        case 367: goto ins_367;
+        case 373: goto ins_373;
+        case 379: goto ins_379;
+        case 381: goto ins_381;
+        case 387: goto ins_387;
+        case 393: goto ins_393;
+        case 399: goto ins_399;
+        case 405: goto ins_405;
+        case 407: goto ins_407;
+        case 409: goto ins_409;
+        case 417: goto ins_417;
+        case 423: goto ins_423;
+        case 429: goto ins_429;
+        case 431: goto ins_431;
+        case 433: goto ins_433;
+        case 435: goto ins_435;
+        case 441: goto ins_441;
+        case 447: goto ins_447;
+        case 455: goto ins_455;
+        case 461: goto ins_461;
+        case 467: goto ins_467;
+        case 469: goto ins_469;
+        case 471: goto ins_471;
+        case 477: goto ins_477;
+        case 483: goto ins_483;
+        case 485: goto ins_485;
+        case 491: goto ins_491;
+        case 493: goto ins_493;
+        case 501: goto ins_501;
+        case 503: goto ins_503;
+        case 505: goto ins_505;
+        case 511: goto ins_511;
+        case 517: goto ins_517;
+        case 523: goto ins_523;
+        case 525: goto ins_525;
+        case 531: goto ins_531;
+        case 537: goto ins_537;
+        case 539: goto ins_539;
+        case 545: goto ins_545;
+        case 551: goto ins_551;
+        case 557: goto ins_557;
+        case 563: goto ins_563;
+        case 565: goto ins_565;
+        case 571: goto ins_571;
+        case 577: goto ins_577;
+        case 583: goto ins_583;
+        case 589: goto ins_589;
+        case 597: goto ins_597;
+        case 605: goto ins_605;
+        case 611: goto ins_611;
+        case 619: goto ins_619;
+        case 627: goto ins_627;
+        case 633: goto ins_633;
+        case 639: goto ins_639;
+        case 641: goto ins_641;
+        case 647: goto ins_647;
+        case 649: goto ins_649;
+        case 655: goto ins_655;
+        case 661: goto ins_661;
+        case 667: goto ins_667;
+        case 673: goto ins_673;
+        case 679: goto ins_679;
+        case 687: goto ins_687;
+        case 693: goto ins_693;
+        case 699: goto ins_699;
+        case 704: goto ins_704;
+        case 710: goto ins_710;
+        case 716: goto ins_716;
+        case 722: goto ins_722;
+        case 728: goto ins_728;
+        case 730: goto ins_730;
+        case 738: goto ins_738;
+        case 744: goto ins_744;
+        case 746: goto ins_746;
+        case 752: goto ins_752;
+        case 754: goto ins_754;
+        case 756: goto ins_756;
+        case 758: goto ins_758;
+        case 760: goto ins_760;
+        case 766: goto ins_766;
+        case 768: goto ins_768;
+        case 774: goto ins_774;
+        case 780: goto ins_780;
+        case 786: goto ins_786;
+        case 792: goto ins_792;
+        case 794: goto ins_794;
+        case 802: goto ins_802;
+        case 808: goto ins_808;
+        case 814: goto ins_814;
+        case 822: goto ins_822;
+        case 830: goto ins_830;
+        case 836: goto ins_836;
+        case 841: goto ins_841;
+        case 847: goto ins_847;
+        case 853: goto ins_853;
+        case 859: goto ins_859;
+        case 861: goto ins_861;
+        case 863: goto ins_863;
+        case 869: goto ins_869;
+        case 875: goto ins_875;
+        case 881: goto ins_881;
+        case 883: goto ins_883;
+        case 889: goto ins_889;
+        case 895: goto ins_895;
+        case 903: goto ins_903;
+        case 905: goto ins_905;
+        case 907: goto ins_907;
+        case 909: goto ins_909;
+        case 911: goto ins_911;
+        case 917: goto ins_917;
+        case 923: goto ins_923;
+        case 929: goto ins_929;
+        case 931: goto ins_931;
+        case 937: goto ins_937;
+        case 943: goto ins_943;
+        case 951: goto ins_951;
+        case 957: goto ins_957;
+        case 963: goto ins_963;
+        case 965: goto ins_965;
+        case 967: goto ins_967;
+        case 973: goto ins_973;
+        case 981: goto ins_981;
+        case 983: goto ins_983;
+        case 989: goto ins_989;
+        case 995: goto ins_995;
+        case 997: goto ins_997;
+        case 1003: goto ins_1003;
+        case 1011: goto ins_1011;
+        case 1017: goto ins_1017;
+        case 1019: goto ins_1019;
+        case 1025: goto ins_1025;
+        case 1031: goto ins_1031;
+        case 1037: goto ins_1037;
+        case 1039: goto ins_1039;
+        case 1041: goto ins_1041;
+        case 1043: goto ins_1043;
+        case 1045: goto ins_1045;
+        case 1047: goto ins_1047;
+        case 1049: goto ins_1049;
+        case 1053: goto ins_1053;
+        case 1059: goto ins_1059;
+        case 1066: goto ins_1066;
+        case 1072: goto ins_1072;
+        default:
+            exec.countInstructions(instructionCount);
+            return offset >= kLength;
+    }
+
+ins_13:
+    stack.push_back(Variable(1));
+    ++instructionCount;
+
+ins_19:
+    stack.push_back(Variable(g_instructions[1].floatValue));
+    ++instructionCount;
+
+ins_25:
+    stack.push_back(Variable(g_instructions[2].floatValue));
+    ++instructionCount;
+
+ins_31:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue == stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_33:
+    stack.push_back(Variable(g_instructions[4].floatValue));
+    ++instructionCount;
+
+ins_39:
+    stack.push_back(Variable(g_instructions[5].strValue));
+    ++instructionCount;
+
+ins_46:
+    stack.push_back(Variable(g_instructions[6].floatValue));
+    ++instructionCount;
+
+ins_52:
+    stack.push_back(Variable(g_instructions[7].floatValue));
+    ++instructionCount;
+
+ins_58:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue < stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_60:
+    ++instructionCount;
+
+ins_62:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_98;
+        }
+    }
+
+ins_68:
+    stack.push_back(Variable(g_instructions[11].strValue));
+    ++instructionCount;
+
+ins_74:
+    stack.push_back(Variable(g_instructions[12].strValue));
+    ++instructionCount;
+
+ins_80:
+    stack.push_back(Variable(-8));
+    ++instructionCount;
+
+ins_86:
+    stack.erase(stack.end() - 3, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_92:
+    ++instructionCount;
+    goto ins_110;
+
+ins_98:
+    stack.push_back(Variable(16));
+    ++instructionCount;
+
+ins_104:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_110:
+    stack.push_back(Variable(14));
+    ++instructionCount;
+
+ins_116:
+    stack.push_back(Variable(-15));
+    ++instructionCount;
+
+ins_122:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue ^ stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_124:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_160;
+        }
+    }
+
+ins_130:
+    ++instructionCount;
+
+ins_132:
+    stack.push_back(stack[stack.size() - 4]);
+    ++instructionCount;
+
+ins_140:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_142:
+    stack.push_back(Variable(-12));
+    ++instructionCount;
+
+ins_148:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_154:
+    ++instructionCount;
+    goto ins_181;
+
+ins_160:
+    stack.push_back(Variable(g_instructions[28].strValue));
+    ++instructionCount;
+
+ins_167:
+    stack.push_back(stack[stack.size() - 4]);
+    ++instructionCount;
+
+ins_175:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_181:
+    ++instructionCount;
+
+ins_183:
+    for (size_t src = stack.size() - 2, end = src + 2; src < end; ++src) {
+        stack.push_back(stack[src]);
+    }
+    ++instructionCount;
+
+ins_191:
+    {
+        size_t dst = stack.size() - 3;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_199:
+    stack.push_back(Variable(-9));
+    ++instructionCount;
+
+ins_205:
+    stack.push_back(Variable(15));
+    ++instructionCount;
+
+ins_211:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue & stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_213:
+    ++instructionCount;
+
+ins_215:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_221:
+    {
+        size_t dst = stack.size() - 3;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_229:
+    stack.push_back(Variable(13));
+    ++instructionCount;
+
+ins_235:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (!zero) {
+            goto ins_263;
+        }
+    }
+
+ins_241:
+    stack.push_back(Variable(-2));
+    ++instructionCount;
+
+ins_247:
+    stack.back() = Variable(-stack.back().intValue);
+    ++instructionCount;
+
+ins_249:
+    ++instructionCount;
+
+ins_251:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_257:
+    ++instructionCount;
+    goto ins_353;
+
+ins_263:
+    stack.push_back(Variable(-10));
+    ++instructionCount;
+
+ins_269:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_293;
+        }
+    }
+
+ins_275:
+    stack.push_back(Variable(-9));
+    ++instructionCount;
+
+ins_281:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_287:
+    ++instructionCount;
+    goto ins_341;
+
+ins_293:
+    stack.push_back(Variable(g_instructions[52].floatValue));
+    ++instructionCount;
+
+ins_299:
+    for (size_t src = stack.size() - 4, end = src + 2; src < end; ++src) {
+        stack.push_back(stack[src]);
+    }
+    ++instructionCount;
+
+ins_307:
+    stack.push_back(Variable(g_instructions[54].floatValue));
+    ++instructionCount;
+
+ins_313:
+    stack.push_back(Variable(g_instructions[55].floatValue));
+    ++instructionCount;
+
+ins_319:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue != stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_321:
+    stack.push_back(Variable(-17));
+    ++instructionCount;
+
+ins_327:
+    stack.push_back(Variable(0));
+    ++instructionCount;
+
+ins_333:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue < stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_335:
+    stack.erase(stack.end() - 5, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_341:
+    stack.push_back(Variable(g_instructions[61].floatValue));
+    ++instructionCount;
+
+ins_347:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_353:
+    ++instructionCount;
+
+ins_355:
+    stack.push_back(Variable(g_instructions[64].strValue));
+    ++instructionCount;
+
+ins_361:
+    stack.push_back(Variable(g_instructions[65].floatValue));
+    ++instructionCount;
+
+ins_367:
+    stack.push_back(Variable(g_instructions[66].floatValue));
+    ++instructionCount;
+
+ins_373:
+    stack.push_back(Variable(g_instructions[67].floatValue));
+    ++instructionCount;
+
+ins_379:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue > stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_381:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_405;
+        }
+    }
+
+ins_387:
+    stack.push_back(Variable(g_instructions[70].floatValue));
+    ++instructionCount;
+
+ins_393:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_399:
+    ++instructionCount;
+    goto ins_423;
+
+ins_405:
+    ++instructionCount;
+
+ins_407:
+    stack.back() = Variable(-stack.back().floatValue);
+    ++instructionCount;
+
+ins_409:
+    stack.push_back(stack[stack.size() - 4]);
+    ++instructionCount;
+
+ins_417:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_423:
+    stack.push_back(Variable(-8));
+    ++instructionCount;
+
+ins_429:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_431:
+    ++instructionCount;
+
+ins_433:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_435:
+    stack.push_back(Variable(15));
+    ++instructionCount;
+
+ins_441:
+    stack.push_back(Variable(g_instructions[82].floatValue));
+    ++instructionCount;
+
+ins_447:
+    stack.push_back(stack[stack.size() - 2]);
+    ++instructionCount;
+
+ins_455:
+    stack.push_back(Variable(g_instructions[84].floatValue));
+    ++instructionCount;
+
+ins_461:
+    stack.push_back(Variable(-20));
+    ++instructionCount;
+
+ins_467:
+    ++instructionCount;
+
+ins_469:
+    ++instructionCount;
+
+ins_471:
+    stack.push_back(Variable(g_instructions[88].floatValue));
+    ++instructionCount;
+
+ins_477:
+    stack.push_back(Variable(g_instructions[89].floatValue));
+    ++instructionCount;
+
+ins_483:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue < stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_485:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (!zero) {
+            goto ins_517;
+        }
+    }
+
+ins_491:
+    ++instructionCount;
+
+ins_493:
+    for (size_t src = stack.size() - 2, end = src + 2; src < end; ++src) {
+        stack.push_back(stack[src]);
+    }
+    ++instructionCount;
+
+ins_501:
+    stack.back() = Variable(-stack.back().intValue);
+    ++instructionCount;
+
+ins_503:
+    ++instructionCount;
+
+ins_505:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_511:
+    ++instructionCount;
+    goto ins_545;
+
+ins_517:
+    stack.push_back(Variable(g_instructions[98].floatValue));
+    ++instructionCount;
+
+ins_523:
+    stack.back() = Variable(-stack.back().floatValue);
+    ++instructionCount;
+
+ins_525:
+    stack.push_back(Variable(g_instructions[100].floatValue));
+    ++instructionCount;
+
+ins_531:
+    stack.push_back(Variable(g_instructions[101].floatValue));
+    ++instructionCount;
+
+ins_537:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue - stack.back().floatValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_539:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_545:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_583;
+        }
+    }
+
+ins_551:
+    stack.push_back(Variable(12));
+    ++instructionCount;
+
+ins_557:
+    stack.push_back(Variable(-20));
+    ++instructionCount;
+
+ins_563:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue - stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_565:
+    {
+        size_t dst = stack.size() - 1;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_571:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_577:
+    ++instructionCount;
+    goto ins_611;
+
+ins_583:
+    stack.push_back(Variable(-1));
+    ++instructionCount;
+
+ins_589:
+    for (size_t src = stack.size() - 2, end = src + 2; src < end; ++src) {
+        stack.push_back(stack[src]);
+    }
+    ++instructionCount;
+
+ins_597:
+    {
+        size_t dst = stack.size() - 3;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_605:
+    stack.erase(stack.end() - 3, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_611:
+    {
+        size_t dst = stack.size() - 3;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_619:
+    stack.push_back(stack[stack.size() - 6]);
+    ++instructionCount;
+
+ins_627:
+    stack.push_back(Variable(7));
+    ++instructionCount;
+
+ins_633:
+    stack.push_back(Variable(-13));
+    ++instructionCount;
+
+ins_639:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue < stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_641:
+    stack.push_back(Variable(-2));
+    ++instructionCount;
+
+ins_647:
+    ++instructionCount;
+
+ins_649:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (!zero) {
+            goto ins_716;
+        }
+    }
+
+ins_655:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_661:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_667:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (!zero) {
+            goto ins_699;
+        }
+    }
+
+ins_673:
+    stack.push_back(Variable(g_instructions[126].floatValue));
+    ++instructionCount;
+
+ins_679:
+    {
+        size_t dst = stack.size() - 5;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_687:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_693:
+    ++instructionCount;
+    goto ins_710;
+
+ins_699:
+    stack.push_back(Variable(g_instructions[130].strValue));
+    ++instructionCount;
+
+ins_704:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_710:
+    ++instructionCount;
+    goto ins_744;
+
+ins_716:
+    stack.push_back(Variable(6));
+    ++instructionCount;
+
+ins_722:
+    stack.push_back(Variable(-19));
+    ++instructionCount;
+
+ins_728:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue || stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_730:
+    {
+        size_t dst = stack.size() - 4;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_738:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_744:
+    stack.back() = Variable(-stack.back().floatValue);
+    ++instructionCount;
+
+ins_746:
+    stack.push_back(Variable(6));
+    ++instructionCount;
+
+ins_752:
+    ++instructionCount;
+
+ins_754:
+    ++instructionCount;
+
+ins_756:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_758:
+    stack.back() = Variable(-stack.back().intValue);
+    ++instructionCount;
+
+ins_760:
+    stack.push_back(Variable(-11));
+    ++instructionCount;
+
+ins_766:
+    ++instructionCount;
+
+ins_768:
+    {
+        size_t dst = stack.size() - 5;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_774:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_814;
+        }
+    }
+
+ins_780:
+    stack.push_back(Variable(8));
+    ++instructionCount;
+
+ins_786:
+    stack.push_back(Variable(4));
+    ++instructionCount;
+
+ins_792:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue | stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_794:
+    stack.push_back(stack[stack.size() - 5]);
+    ++instructionCount;
+
+ins_802:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_808:
+    ++instructionCount;
+    goto ins_847;
+
+ins_814:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_822:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_830:
+    stack.push_back(Variable(11));
+    ++instructionCount;
+
+ins_836:
+    stack.push_back(Variable(g_instructions[157].strValue));
+    ++instructionCount;
+
+ins_841:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_847:
+    stack.push_back(Variable(-14));
+    ++instructionCount;
+
+ins_853:
+    stack.push_back(Variable(18));
+    ++instructionCount;
+
+ins_859:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue && stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_861:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_863:
+    stack.push_back(Variable(g_instructions[163].floatValue));
+    ++instructionCount;
+
+ins_869:
+    stack.push_back(Variable(19));
+    ++instructionCount;
+
+ins_875:
+    stack.push_back(Variable(3));
+    ++instructionCount;
+
+ins_881:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue << stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_883:
+    stack.push_back(Variable(12));
+    ++instructionCount;
+
+ins_889:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_895:
+    for (size_t src = stack.size() - 5, end = src + 2; src < end; ++src) {
+        stack.push_back(stack[src]);
+    }
+    ++instructionCount;
+
+ins_903:
+    ++instructionCount;
+
+ins_905:
+    stack.back() = Variable(-stack.back().floatValue);
+    ++instructionCount;
+
+ins_907:
+    stack.back() = Variable(-stack.back().floatValue);
+    ++instructionCount;
+
+ins_909:
+    stack.back() = Variable(-stack.back().floatValue);
+    ++instructionCount;
+
+ins_911:
+    stack.push_back(Variable(g_instructions[174].floatValue));
+    ++instructionCount;
+
+ins_917:
+    stack.push_back(Variable(11));
+    ++instructionCount;
+
+ins_923:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_937;
+        }
+    }
+
+ins_929:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue < stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_931:
+    ++instructionCount;
+    goto ins_973;
+
+ins_937:
+    {
+        size_t dst = stack.size() - 4;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_943:
+    {
+        size_t dst = stack.size() - 4;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_951:
+    stack.push_back(Variable(g_instructions[181].floatValue));
+    ++instructionCount;
+
+ins_957:
+    stack.push_back(Variable(g_instructions[182].floatValue));
+    ++instructionCount;
+
+ins_963:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue != stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_965:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_967:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_973:
+    for (size_t src = stack.size() - 6, end = src + 2; src < end; ++src) {
+        stack.push_back(stack[src]);
+    }
+    ++instructionCount;
+
+ins_981:
+    ++instructionCount;
+
+ins_983:
+    stack.push_back(Variable(9));
+    ++instructionCount;
+
+ins_989:
+    stack.push_back(Variable(5));
+    ++instructionCount;
+
+ins_995:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue + stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_997:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_1003:
+    {
+        size_t dst = stack.size() - 3;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_1011:
+    stack.erase(stack.end() - 3, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_1017:
+    ++instructionCount;
+
+ins_1019:
+    stack.push_back(Variable(2));
+    ++instructionCount;
+
+ins_1025:
+    stack.push_back(Variable(13));
+    ++instructionCount;
+
+ins_1031:
+    stack.push_back(Variable(-2));
+    ++instructionCount;
+
+ins_1037:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue && stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_1039:
+    ++instructionCount;
+
+ins_1041:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue - stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_1043:
+    stack.back() = Variable(-stack.back().intValue);
+    ++instructionCount;
+
+ins_1045:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_1047:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_1049:
+    stack.push_back(Variable(g_instructions[204].strValue));
+    ++instructionCount;
+
+ins_1053:
+    {
+        size_t dst = stack.size() - 5;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_1059:
+    stack.push_back(Variable(g_instructions[206].strValue));
+    ++instructionCount;
+
+ins_1066:
+    stack.push_back(Variable(-10));
+    ++instructionCount;
+
+ins_1072:
+    exec.executeInstruction(g_instructions[208]);
+    offset = exec.nextInstruction();
+    goto dispatch;
+
+    exec.countInstructions(instructionCount);
+    return true;
+}
@@ -0,0 +1,1381 @@
+// Generated by reone-tools from test_corpus_2. Do not edit.
+
+#include "script/native.h"
+
+using namespace reone::script;
+
+static const uint32_t kLength = 1031;
+
+static const Instruction g_instructions[] = {
+    makeInstruction(13, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 19, 0, 0, 12), // CONSTx 12
+    makeInstruction(19, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 25, 0, 0, -1068498944), // CONSTx -3.250000
+    makeInstruction(25, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 31, 0, 0, 1069547520), // CONSTx 1.500000
+    makeInstruction(31, static_cast<ByteCode>(0x15), static_cast<InstructionType>(0x21), 33, 0, 0, 0), // SUBxx
+    makeInstruction(33, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 39, 0, 0, 0, "xy"), // CONSTx \"xy\"
+    makeInstruction(39, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 47, -12, 8, 0), // CPTOPSP
+    makeInstruction(47, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 53, 0, 0, -10), // CONSTx -10
+    makeInstruction(53, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 59, 0, 0, 5), // CONSTx 5
+    makeInstruction(59, static_cast<ByteCode>(0x15), static_cast<InstructionType>(0x20), 61, 0, 0, 0), // SUBxx
+    makeInstruction(61, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 67, -12, 0, 0), // DECISP
+    makeInstruction(67, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 73, -4, 0, 0), // INCISP
+    makeInstruction(73, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 79, 0, 0, 7), // CONSTx 7
+    makeInstruction(79, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 81, 0, 0, 0), // NOP
+    makeInstruction(81, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 87, -8, 0, 0), // MOVESP
+    makeInstruction(87, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 93, -8, 0, 0), // MOVESP
+    makeInstruction(93, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 99, 0, 0, -14), // CONSTx -14
+    makeInstruction(99, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 105, 0, 0, -1056964608), // CONSTx -8.000000
+    makeInstruction(105, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 111, 0, 0, 9), // CONSTx 9
+    makeInstruction(111, static_cast<ByteCode>(0x25), static_cast<InstructionType>(0x00), 117, 207, 0, 0), // JNZ 000000cf
+    makeInstruction(117, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 123, 0, 0, 17), // CONSTx 17
+    makeInstruction(123, static_cast<ByteCode>(0x25), static_cast<InstructionType>(0x00), 129, 157, 0, 0), // JNZ 0000009d
+    makeInstruction(129, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 135, 0, 0, -5), // CONSTx -5
+    makeInstruction(135, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 141, 0, 0, -9), // CONSTx -9
+    makeInstruction(141, static_cast<ByteCode>(0x0b), static_cast<InstructionType>(0x20), 143, 0, 0, 0), // EQUALxx
+    makeInstruction(143, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 145, 0, 0, 0), // NOP
+    makeInstruction(145, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 151, -4, 0, 0), // MOVESP
+    makeInstruction(151, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 157, 187, 0, 0), // JMP 000000bb
+    makeInstruction(157, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 163, 0, 0, 1080033280), // CONSTx 3.500000
+    makeInstruction(163, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 167, 0, 0, 0), // CONSTx \"\"
+    makeInstruction(167, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 173, 0, 0, 9), // CONSTx 9
+    makeInstruction(173, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 179, 0, 0, 3), // CONSTx 3
+    makeInstruction(179, static_cast<ByteCode>(0x11), static_cast<InstructionType>(0x20), 181, 0, 0, 0), // SHLEFTII
+    makeInstruction(181, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 187, -12, 0, 0), // MOVESP
+    makeInstruction(187, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 189, 0, 0, 0), // NOP
+    makeInstruction(189, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 195, 0, 0, -1077936128), // CONSTx -1.500000
+    makeInstruction(195, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 201, -4, 0, 0), // MOVESP
+    makeInstruction(201, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 207, 267, 0, 0), // JMP 0000010b
+    makeInstruction(207, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 213, 0, 0, -1069547520), // CONSTx -3.000000
+    makeInstruction(213, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 219, 0, 0, 0), // CONSTx 0.000000
+    makeInstruction(219, static_cast<ByteCode>(0x0e), static_cast<InstructionType>(0x21), 221, 0, 0, 0), // GTxx
+    makeInstruction(221, static_cast<ByteCode>(0x25), static_cast<InstructionType>(0x00), 227, 261, 0, 0), // JNZ 00000105
+    makeInstruction(227, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 229, 0, 0, 0), // NOP
+    makeInstruction(229, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 235, 0, 0, 1087897600), // CONSTx 6.750000
+    makeInstruction(235, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 241, 0, 0, 6), // CONSTx 6
+    makeInstruction(241, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 247, 0, 0, -3), // CONSTx -3
+    makeInstruction(247, static_cast<ByteCode>(0x15), static_cast<InstructionType>(0x20), 249, 0, 0, 0), // SUBxx
+    makeInstruction(249, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 255, -8, 0, 0), // MOVESP
+    makeInstruction(255, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 261, 267, 0, 0), // JMP 0000010b
+    makeInstruction(261, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 267, -20, 0, 0), // DECISP
+    makeInstruction(267, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 275, -16, 4, 0), // CPDOWNSP
+    makeInstruction(275, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 281, 0, 0, 17), // CONSTx 17
+    makeInstruction(281, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 287, 0, 0, -6), // CONSTx -6
+    makeInstruction(287, static_cast<ByteCode>(0x0d), static_cast<InstructionType>(0x20), 289, 0, 0, 0), // GEQxx
+    makeInstruction(289, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 293, 0, 0, 0), // CONSTx \"\"
+    makeInstruction(293, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 295, 0, 0, 0), // NOP
+    makeInstruction(295, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 301, 0, 0, -1080033280), // CONSTx -1.250000
+    makeInstruction(301, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 303, 0, 0, 0), // NOP
+    makeInstruction(303, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 309, 0, 0, 1077936128), // CONSTx 3.000000
+    makeInstruction(309, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 315, 0, 0, 1088946176), // CONSTx 7.250000
+    makeInstruction(315, static_cast<ByteCode>(0x0f), static_cast<InstructionType>(0x21), 317, 0, 0, 0), // LTxx
+    makeInstruction(317, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 323, 0, 0, -6), // CONSTx -6
+    makeInstruction(323, static_cast<ByteCode>(0x18), static_cast<InstructionType>(0x20), 325, 0, 0, 0), // MODII
+    makeInstruction(325, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 331, -16, 0, 0), // DECISP
+    makeInstruction(331, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 337, -16, 0, 0), // INCISP
+    makeInstruction(337, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 345, -16, 4, 0), // CPDOWNSP
+    makeInstruction(345, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 351, 377, 0, 0), // JZ 00000179
+    makeInstruction(351, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 357, 0, 0, 1086324736), // CONSTx 6.000000
+    makeInstruction(357, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 363, 0, 0, 1089994752), // CONSTx 7.750000
+    makeInstruction(363, static_cast<ByteCode>(0x0c), static_cast<InstructionType>(0x21), 365, 0, 0, 0), // NEQUALxx
+    makeInstruction(365, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 371, -4, 0, 0), // MOVESP
+    makeInstruction(371, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 377, 403, 0, 0), // JMP 00000193
+    makeInstruction(377, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 383, 0, 0, -2), // CONSTx -2
+    makeInstruction(383, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 389, 0, 0, -5), // CONSTx -5
+    makeInstruction(389, static_cast<ByteCode>(0x0c), static_cast<InstructionType>(0x20), 391, 0, 0, 0), // NEQUALxx
+    makeInstruction(391, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 397, 0, 0, 9), // CONSTx 9
+    makeInstruction(397, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 403, -8, 0, 0), // MOVESP
+    makeInstruction(403, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 411, -16, 4, 0), // CPDOWNSP
+    makeInstruction(411, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 416, 0, 0, 0, "a"), // CONSTx \"a\"
+    makeInstruction(416, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 424, -24, 8, 0), // CPTOPSP
+    makeInstruction(424, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 430, -8, 0, 0), // DECISP
+    makeInstruction(430, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x04), 432, 0, 0, 0), // NEGx
+    makeInstruction(432, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 438, 0, 0, -2), // CONSTx -2
+    makeInstruction(438, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 444, 0, 0, 2), // CONSTx 2
+    makeInstruction(444, static_cast<ByteCode>(0x15), static_cast<InstructionType>(0x20), 446, 0, 0, 0), // SUBxx
+    makeInstruction(446, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 452, -4, 0, 0), // MOVESP
+    makeInstruction(452, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 458, -8, 0, 0), // INCISP
+    makeInstruction(458, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 466, -16, 4, 0), // CPDOWNSP
+    makeInstruction(466, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 472, 0, 0, 1088421888), // CONSTx 7.000000
+    makeInstruction(472, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 478, -12, 0, 0), // DECISP
+    makeInstruction(478, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 486, -24, 4, 0), // CPTOPSP
+    makeInstruction(486, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 494, -16, 8, 0), // CPTOPSP
+    makeInstruction(494, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 502, -16, 4, 0), // CPTOPSP
+    makeInstruction(502, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 510, -12, 8, 0), // CPTOPSP
+    makeInstruction(510, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 516, 0, 0, -8), // CONSTx -8
+    makeInstruction(516, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 518, 0, 0, 0), // NOTI
+    makeInstruction(518, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 524, 0, 0, 9), // CONSTx 9
+    makeInstruction(524, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 530, 0, 0, -3), // CONSTx -3
+    makeInstruction(530, static_cast<ByteCode>(0x14), static_cast<InstructionType>(0x20), 532, 0, 0, 0), // ADDxx
+    makeInstruction(532, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 534, 0, 0, 0), // NOP
+    makeInstruction(534, static_cast<ByteCode>(0x0c), static_cast<InstructionType>(0x20), 536, 0, 0, 0), // NEQUALxx
+    makeInstruction(536, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 542, 0, 0, 0, "xy"), // CONSTx \"xy\"
+    makeInstruction(542, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 548, -12, 0, 0), // MOVESP
+    makeInstruction(548, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x03), 550, 0, 0, 0), // NEGx
+    makeInstruction(550, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 556, 0, 0, -1066401792), // CONSTx -3.750000
+    makeInstruction(556, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 558, 0, 0, 0), // NOP
+    makeInstruction(558, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 564, 0, 0, 1069547520), // CONSTx 1.500000
+    makeInstruction(564, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 570, -24, 0, 0), // DECISP
+    makeInstruction(570, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 574, 0, 0, 0), // CONSTx \"\"
+    makeInstruction(574, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 580, -8, 0, 0), // MOVESP
+    makeInstruction(580, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 586, 0, 0, 11), // CONSTx 11
+    makeInstruction(586, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 592, 704, 0, 0), // JZ 000002c0
+    makeInstruction(592, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 598, 0, 0, -2), // CONSTx -2
+    makeInstruction(598, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 604, 0, 0, -11), // CONSTx -11
+    makeInstruction(604, static_cast<ByteCode>(0x10), static_cast<InstructionType>(0x20), 606, 0, 0, 0), // LEQxx
+    makeInstruction(606, static_cast<ByteCode>(0x25), static_cast<InstructionType>(0x00), 612, 656, 0, 0), // JNZ 00000290
+    makeInstruction(612, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 618, 0, 0, 0, "xy"), // CONSTx \"xy\"
+    makeInstruction(618, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 624, 0, 0, 1082654720), // CONSTx 4.250000
+    makeInstruction(624, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 630, 0, 0, -1062207488), // CONSTx -5.500000
+    makeInstruction(630, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 636, 0, 0, -1061683200), // CONSTx -5.750000
+    makeInstruction(636, static_cast<ByteCode>(0x10), static_cast<InstructionType>(0x21), 638, 0, 0, 0), // LEQxx
+    makeInstruction(638, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 644, 0, 0, -12), // CONSTx -12
+    makeInstruction(644, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 650, -16, 0, 0), // MOVESP
+    makeInstruction(650, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 656, 678, 0, 0), // JMP 000002a6
+    makeInstruction(656, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 664, -16, 4, 0), // CPDOWNSP
+    makeInstruction(664, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 670, 0, 0, -11), // CONSTx -11
+    makeInstruction(670, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 672, 0, 0, 0), // NOTI
+    makeInstruction(672, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 678, -4, 0, 0), // MOVESP
+    makeInstruction(678, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 684, 0, 0, -1070596096), // CONSTx -2.750000
+    makeInstruction(684, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 690, 0, 0, 1086849024), // CONSTx 6.250000
+    makeInstruction(690, static_cast<ByteCode>(0x0c), static_cast<InstructionType>(0x21), 692, 0, 0, 0), // NEQUALxx
+    makeInstruction(692, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 698, -4, 0, 0), // MOVESP
+    makeInstruction(698, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 704, 811, 0, 0), // JMP 0000032b
+    makeInstruction(704, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 710, 0, 0, 6), // CONSTx 6
+    makeInstruction(710, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 716, 0, 0, -7), // CONSTx -7
+    makeInstruction(716, static_cast<ByteCode>(0x08), static_cast<InstructionType>(0x20), 718, 0, 0, 0), // INCORII
+    makeInstruction(718, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 725, 0, 0, 0, "q\"z"), // CONSTx \"q\"z\"
+    makeInstruction(725, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 731, 0, 0, 6), // CONSTx 6
+    makeInstruction(731, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 737, 0, 0, 18), // CONSTx 18
+    makeInstruction(737, static_cast<ByteCode>(0x08), static_cast<InstructionType>(0x20), 739, 0, 0, 0), // INCORII
+    makeInstruction(739, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 745, 765, 0, 0), // JZ 000002fd
+    makeInstruction(745, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 751, 0, 0, -10), // CONSTx -10
+    makeInstruction(751, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 753, 0, 0, 0), // NOTI
+    makeInstruction(753, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 759, -4, 0, 0), // MOVESP
+    makeInstruction(759, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 765, 805, 0, 0), // JMP 00000325
+    makeInstruction(765, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 771, 0, 0, -19), // CONSTx -19
+    makeInstruction(771, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 777, 0, 0, -15), // CONSTx -15
+    makeInstruction(777, static_cast<ByteCode>(0x08), static_cast<InstructionType>(0x20), 779, 0, 0, 0), // INCORII
+    makeInstruction(779, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 785, 0, 0, -16), // CONSTx -16
+    makeInstruction(785, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 791, 0, 0, 5), // CONSTx 5
+    makeInstruction(791, static_cast<ByteCode>(0x06), static_cast<InstructionType>(0x20), 793, 0, 0, 0), // LOGANDII
+    makeInstruction(793, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 799, 0, 0, 17), // CONSTx 17
+    makeInstruction(799, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 805, -12, 0, 0), // MOVESP
+    makeInstruction(805, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 811, -8, 0, 0), // MOVESP
+    makeInstruction(811, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 817, -12, 0, 0), // MOVESP
+    makeInstruction(817, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 823, 0, 0, 6), // CONSTx 6
+    makeInstruction(823, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 829, 0, 0, 7), // CONSTx 7
+    makeInstruction(829, static_cast<ByteCode>(0x08), static_cast<InstructionType>(0x20), 831, 0, 0, 0), // INCORII
+    makeInstruction(831, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 833, 0, 0, 0), // NOTI
+    makeInstruction(833, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 839, 0, 0, 17), // CONSTx 17
+    makeInstruction(839, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 845, -8, 0, 0), // MOVESP
+    makeInstruction(845, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 853, -16, 4, 0), // CPDOWNSP
+    makeInstruction(853, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 859, 0, 0, 1090519040), // CONSTx 8.000000
+    makeInstruction(859, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 865, 0, 0, 1084227584), // CONSTx 5.000000
+    makeInstruction(865, static_cast<ByteCode>(0x0e), static_cast<InstructionType>(0x21), 867, 0, 0, 0), // GTxx
+    makeInstruction(867, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 875, -12, 4, 0), // CPDOWNSP
+    makeInstruction(875, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 881, 0, 0, -14), // CONSTx -14
+    makeInstruction(881, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 887, 0, 0, -16), // CONSTx -16
+    makeInstruction(887, static_cast<ByteCode>(0x14), static_cast<InstructionType>(0x20), 889, 0, 0, 0), // ADDxx
+    makeInstruction(889, static_cast<ByteCode>(0x16), static_cast<InstructionType>(0x20), 891, 0, 0, 0), // MULxx
+    makeInstruction(891, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 897, -4, 0, 0), // MOVESP
+    makeInstruction(897, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 903, 0, 0, 10), // CONSTx 10
+    makeInstruction(903, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 909, 0, 0, 4), // CONSTx 4
+    makeInstruction(909, static_cast<ByteCode>(0x12), static_cast<InstructionType>(0x20), 911, 0, 0, 0), // SHRIGHTII
+    makeInstruction(911, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 913, 0, 0, 0), // NOP
+    makeInstruction(913, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x03), 915, 0, 0, 0), // NEGx
+    makeInstruction(915, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 921, 0, 0, 2), // CONSTx 2
+    makeInstruction(921, static_cast<ByteCode>(0x11), static_cast<InstructionType>(0x20), 923, 0, 0, 0), // SHLEFTII
+    makeInstruction(923, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 931, -24, 4, 0), // CPTOPSP
+    makeInstruction(931, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 937, 0, 0, -1067450368), // CONSTx -3.500000
+    makeInstruction(937, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 943, 0, 0, -1080033280), // CONSTx -1.250000
+    makeInstruction(943, static_cast<ByteCode>(0x0e), static_cast<InstructionType>(0x21), 945, 0, 0, 0), // GTxx
+    makeInstruction(945, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 951, 0, 0, 1081081856), // CONSTx 3.750000
+    makeInstruction(951, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 957, -8, 0, 0), // INCISP
+    makeInstruction(957, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 963, -12, 0, 0), // MOVESP
+    makeInstruction(963, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 969, 0, 0, -16), // CONSTx -16
+    makeInstruction(969, static_cast<ByteCode>(0x14), static_cast<InstructionType>(0x20), 971, 0, 0, 0), // ADDxx
+    makeInstruction(971, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 977, 997, 0, 0), // JZ 000003e5
+    makeInstruction(977, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 983, 0, 0, 1061158912), // CONSTx 0.750000
+    makeInstruction(983, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x04), 985, 0, 0, 0), // NEGx
+    makeInstruction(985, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 991, -4, 0, 0), // MOVESP
+    makeInstruction(991, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 997, 1011, 0, 0), // JMP 000003f3
+    makeInstruction(997, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 1005, -12, 8, 0), // CPTOPSP
+    makeInstruction(1005, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 1011, -8, 0, 0), // MOVESP
+    makeInstruction(1011, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 1017, 0, 0, 1061158912), // CONSTx 0.750000
+    makeInstruction(1017, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 1023, -12, 0, 0), // DECISP
+    makeInstruction(1023, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 1029, 0, 0, 10), // CONSTx 10
+    makeInstruction(1029, static_cast<ByteCode>(0x20), static_cast<InstructionType>(0x00), 1031, 0, 0, 0) // RETN
+};
+
+extern "C" REONE_NATIVE_SCRIPT_EXPORT bool reone_ncs_test_corpus_2(IInstructionExecutor &exec, uint32_t offset) {
+    std::vector<Variable> &stack = exec.stack();
+    uint32_t instructionCount = 0;
+
+dispatch:
+    switch (offset) {
+        case 13: goto ins_13;
+        case 19: goto ins_19;
+        case 25: goto ins_25;
+        case 31: goto ins_31;
+        case 33: goto ins_33;
+        case 39: goto ins_39;
+        case 47: goto ins_47;
+        case 53: goto ins_53;
+        case 59: goto ins_59;
+        case 61: goto ins_61;
+        case 67: goto ins_67;
+        case 73: goto ins_73;
+        case 79: goto ins_79;
+        case 81: goto ins_81;
+        case 87: goto ins_87;
+        case 93: goto ins_93;
+        case 99: goto ins_99;
+        case 105: goto ins_105;
+        case 111: goto ins_111;
+        case 117: goto ins_117;
+        case 123: goto ins_123;
+        case 129: goto ins_129;
+        case 135: goto ins_135;
+        case 141: goto ins_141;
+        case 143: goto ins_143;
+        case 145: goto ins_145;
+        case 151: goto ins_151;
+        case 157: goto ins_157;
+        case 163: goto ins_163;
+        case 167: goto ins_167;
+        case 173: goto ins_173;
+        case 179: goto ins_179;
+        case 181: goto ins_181;
+        case 187: goto ins_187;
+        case 189: goto ins_189;
+        case 195: goto ins_195;
+        case 201: goto ins_201;
+        case 207: goto ins_207;
+        case 213: goto ins_213;
+        case 219: goto ins_219;
+        case 221: goto ins_221;
+        case 227: goto ins_227;
+        case 229: goto ins_229;
+        case 235: goto ins_235;
+        case 241: goto ins_241;
+        case 247: goto ins_247;
+        case 249: goto ins_249;
+        case 255: goto ins_255;
+        case 261: goto ins_261;
+        case 267: goto ins_267;
+        case 275: goto ins_275;
+        case 281: goto ins_281;
+        case 287: goto ins_287;
+        case 289: goto ins_289;
+        case 293: goto ins_293;
+        case 295: goto ins_295;
+        case 301: goto ins_301;
+        case 303: goto ins_303;
+        case 309: goto ins_309;
+        case 315: goto ins_315;
+        case 317: goto ins_317;
+        case 323: goto ins_323;
+        case 325: goto ins_325;
+        case 331: goto ins_331;
+        case 337: goto ins_337;
+        case 345: goto ins_345;
+        case 351: goto ins_351;
+        case 357: goto ins_357;
+        case 363: goto ins_363;
+        case 365: goto ins_365;
+        case 371: goto ins_371;
+        case 377: goto ins_377;
+        case 383: goto ins_383;
+        case 389: goto ins_389;
+        case 391: goto ins_391;
+        case 397: goto ins_397;
+        case 403: goto ins_403;
+        case 411: goto ins_411;
+        case 416: goto ins_416;
+        case 424: goto ins_424;
+        case 430: goto ins_430;
+        case 432: goto ins_432;
+        case 438: goto ins_438;
+        case 444: goto ins_444;
+        case 446: goto ins_446;
+        case 452: goto ins_452;
+        case 458: goto ins_458;
+        case 466: goto ins_466;
+        case 472: goto ins_472;
+        case 478: goto ins_478;
+        case 486: goto ins_486;
+        case 494: goto ins_494;
+        case 502: goto ins_502;
+        case 510: goto ins_510;
+        case 516: goto ins_516;
+        case 518: goto ins_518;
+        case 524: goto ins_524;
+        case 530: goto ins_530;
+        case 532: goto ins_532;
+        case 534: goto ins_534;
+        case 536: goto ins_536;
+        case 542: goto ins_542;
+        case 548: goto ins_548;
+        case 550: goto ins_550;
+        case 556: goto ins_556;
+        case 558: goto ins_558;
+        case 564: goto ins_564;
+        case 570: goto ins_570;
+        case 574: goto ins_574;
+        case 580: goto ins_580;
+        case 586: goto ins_586;
+        case 592: goto ins_592;
+        case 598: goto ins_598;
+        case 604: goto ins_604;
+        case 606: goto ins_606;
+        case 612: goto ins_612;
+        case 618: goto ins_618;
+        case 624: goto ins_624;
+        case 630: goto ins_630;
+        case 636: goto ins_636;
+        case 638: goto ins_638;
+        case 644: goto ins_644;
+        case 650: goto ins_650;
+        case 656: goto ins_656;
+        case 664: goto ins_664;
+        case 670: goto ins_670;
+        case 672: goto ins_672;
+        case 678: goto ins_678;
+        case 684: goto ins_684;
+        case 690: goto ins_690;
+        case 692: goto ins_692;
+        case 698: goto ins_698;
+        case 704: goto ins_704;
+        case 710: goto ins_710;
+        case 716: goto ins_716;
+        case 718: goto ins_718;
+        case 725: goto ins_725;
+        case 731: goto ins_731;
+        case 737: goto ins_737;
+        case 739: goto ins_739;
+        case 745: goto ins_745;
+        case 751: goto ins_751;
+        case 753: goto ins_753;
+        case 759: goto ins_759;
+        case 765: goto ins_765;
+        case 771: goto ins_771;
+        case 777: goto ins_777;
+        case 779: goto ins_779;
+        case 785: goto ins_785;
+        case 791: goto ins_791;
+        case 793: goto ins_793;
+        case 799: goto ins_799;
+        case 805: goto ins_805;
+        case 811: goto ins_811;
+        case 817: goto ins_817;
+        case 823: goto ins_823;
+        case 829: goto ins_829;
+        case 831: goto ins_831;
+        case 833: goto ins_833;
+        case 839: goto ins_839;
+        case 845: goto ins_845;
+        case 853: goto ins_853;
+        case 859: goto ins_859;
+        case 865: goto ins_865;
+        case 867: goto ins_867;
+        case 875: goto ins_875;
+        case 881: goto ins_881;
+        case 887: goto ins_887;
+        case 889: goto ins_889;
+        case 891: goto ins_891;
+        case 897: goto ins_897;
+        case 903: goto ins_903;
+        case 909: goto ins_909;
+        case 911: goto ins_911;
+        case 913: goto ins_913;
+        case 915: goto ins_915;
+        case 921: goto ins_921;
+        case 923: goto ins_923;
+        case 931: goto ins_931;
+        case 937: goto ins_937;
+        case 943: goto ins_943;
+        case 945: goto ins_945;
+        case 951: goto ins_951;
+        case 957: goto ins_957;
+        case 963: goto ins_963;
+        case 969: goto ins_969;
+        case 971: goto ins_971;
+        case 977: goto ins_977;
+        case 983: goto ins_983;
+        case 985: goto ins_985;
+        case 991: goto ins_991;
+        case 997: goto ins_997;
+        case 1005: goto ins_1005;
+        case 1011: goto ins_1011;
+        case 1017: goto ins_1017;
+        case 1023: goto ins_1023;
+        case 1029: goto ins_1029;
+        default:
+            exec.countInstructions(instructionCount);
+            return offset >= kLength;
+    }
+
+ins_13:
+    stack.push_back(Variable(12));
+    ++instructionCount;
+
+ins_19:
+    stack.push_back(Variable(g_instructions[1].floatValue));
+    ++instructionCount;
+
+ins_25:
+    stack.push_back(Variable(g_instructions[2].floatValue));
+    ++instructionCount;
+
+ins_31:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue - stack.back().floatValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_33:
+    stack.push_back(Variable(g_instructions[4].strValue));
+    ++instructionCount;
+
+ins_39:
+    for (size_t src = stack.size() - 3, end = src + 2; src < end; ++src) {
+        stack.push_back(stack[src]);
+    }
+    ++instructionCount;
+
+ins_47:
+    stack.push_back(Variable(-10));
+    ++instructionCount;
+
+ins_53:
+    stack.push_back(Variable(5));
+    ++instructionCount;
+
+ins_59:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue - stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_61:
+    {
+        size_t dst = stack.size() - 3;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_67:
+    {
+        size_t dst = stack.size() - 1;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_73:
+    stack.push_back(Variable(7));
+    ++instructionCount;
+
+ins_79:
+    ++instructionCount;
+
+ins_81:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_87:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_93:
+    stack.push_back(Variable(-14));
+    ++instructionCount;
+
+ins_99:
+    stack.push_back(Variable(g_instructions[16].floatValue));
+    ++instructionCount;
+
+ins_105:
+    stack.push_back(Variable(9));
+    ++instructionCount;
+
+ins_111:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (!zero) {
+            goto ins_207;
+        }
+    }
+
+ins_117:
+    stack.push_back(Variable(17));
+    ++instructionCount;
+
+ins_123:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (!zero) {
+            goto ins_157;
+        }
+    }
+
+ins_129:
+    stack.push_back(Variable(-5));
+    ++instructionCount;
+
+ins_135:
+    stack.push_back(Variable(-9));
+    ++instructionCount;
+
+ins_141:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue == stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_143:
+    ++instructionCount;
+
+ins_145:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_151:
+    ++instructionCount;
+    goto ins_187;
+
+ins_157:
+    stack.push_back(Variable(g_instructions[27].floatValue));
+    ++instructionCount;
+
+ins_163:
+    stack.push_back(Variable(g_instructions[28].strValue));
+    ++instructionCount;
+
+ins_167:
+    stack.push_back(Variable(9));
+    ++instructionCount;
+
+ins_173:
+    stack.push_back(Variable(3));
+    ++instructionCount;
+
+ins_179:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue << stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_181:
+    stack.erase(stack.end() - 3, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_187:
+    ++instructionCount;
+
+ins_189:
+    stack.push_back(Variable(g_instructions[34].floatValue));
+    ++instructionCount;
+
+ins_195:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_201:
+    ++instructionCount;
+    goto ins_267;
+
+ins_207:
+    stack.push_back(Variable(g_instructions[37].floatValue));
+    ++instructionCount;
+
+ins_213:
+    stack.push_back(Variable(g_instructions[38].floatValue));
+    ++instructionCount;
+
+ins_219:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue > stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_221:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (!zero) {
+            goto ins_261;
+        }
+    }
+
+ins_227:
+    ++instructionCount;
+
+ins_229:
+    stack.push_back(Variable(g_instructions[42].floatValue));
+    ++instructionCount;
+
+ins_235:
+    stack.push_back(Variable(6));
+    ++instructionCount;
+
+ins_241:
+    stack.push_back(Variable(-3));
+    ++instructionCount;
+
+ins_247:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue - stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_249:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_255:
+    ++instructionCount;
+    goto ins_267;
+
+ins_261:
+    {
+        size_t dst = stack.size() - 5;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_267:
+    {
+        size_t dst = stack.size() - 4;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_275:
+    stack.push_back(Variable(17));
+    ++instructionCount;
+
+ins_281:
+    stack.push_back(Variable(-6));
+    ++instructionCount;
+
+ins_287:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue >= stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_289:
+    stack.push_back(Variable(g_instructions[53].strValue));
+    ++instructionCount;
+
+ins_293:
+    ++instructionCount;
+
+ins_295:
+    stack.push_back(Variable(g_instructions[55].floatValue));
+    ++instructionCount;
+
+ins_301:
+    ++instructionCount;
+
+ins_303:
+    stack.push_back(Variable(g_instructions[57].floatValue));
+    ++instructionCount;
+
+ins_309:
+    stack.push_back(Variable(g_instructions[58].floatValue));
+    ++instructionCount;
+
+ins_315:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue < stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_317:
+    stack.push_back(Variable(-6));
+    ++instructionCount;
+
+ins_323:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue % stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_325:
+    {
+        size_t dst = stack.size() - 4;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_331:
+    {
+        size_t dst = stack.size() - 4;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_337:
+    {
+        size_t dst = stack.size() - 4;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_345:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_377;
+        }
+    }
+
+ins_351:
+    stack.push_back(Variable(g_instructions[66].floatValue));
+    ++instructionCount;
+
+ins_357:
+    stack.push_back(Variable(g_instructions[67].floatValue));
+    ++instructionCount;
+
+ins_363:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue != stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_365:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_371:
+    ++instructionCount;
+    goto ins_403;
+
+ins_377:
+    stack.push_back(Variable(-2));
+    ++instructionCount;
+
+ins_383:
+    stack.push_back(Variable(-5));
+    ++instructionCount;
+
+ins_389:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue != stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_391:
+    stack.push_back(Variable(9));
+    ++instructionCount;
+
+ins_397:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_403:
+    {
+        size_t dst = stack.size() - 4;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_411:
+    stack.push_back(Variable(g_instructions[77].strValue));
+    ++instructionCount;
+
+ins_416:
+    for (size_t src = stack.size() - 6, end = src + 2; src < end; ++src) {
+        stack.push_back(stack[src]);
+    }
+    ++instructionCount;
+
+ins_424:
+    {
+        size_t dst = stack.size() - 2;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_430:
+    stack.back() = Variable(-stack.back().floatValue);
+    ++instructionCount;
+
+ins_432:
+    stack.push_back(Variable(-2));
+    ++instructionCount;
+
+ins_438:
+    stack.push_back(Variable(2));
+    ++instructionCount;
+
+ins_444:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue - stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_446:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_452:
+    {
+        size_t dst = stack.size() - 2;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_458:
+    {
+        size_t dst = stack.size() - 4;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_466:
+    stack.push_back(Variable(g_instructions[87].floatValue));
+    ++instructionCount;
+
+ins_472:
+    {
+        size_t dst = stack.size() - 3;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_478:
+    stack.push_back(stack[stack.size() - 6]);
+    ++instructionCount;
+
+ins_486:
+    for (size_t src = stack.size() - 4, end = src + 2; src < end; ++src) {
+        stack.push_back(stack[src]);
+    }
+    ++instructionCount;
+
+ins_494:
+    stack.push_back(stack[stack.size() - 4]);
+    ++instructionCount;
+
+ins_502:
+    for (size_t src = stack.size() - 3, end = src + 2; src < end; ++src) {
+        stack.push_back(stack[src]);
+    }
+    ++instructionCount;
+
+ins_510:
+    stack.push_back(Variable(-8));
+    ++instructionCount;
+
+ins_516:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_518:
+    stack.push_back(Variable(9));
+    ++instructionCount;
+
+ins_524:
+    stack.push_back(Variable(-3));
+    ++instructionCount;
+
+ins_530:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue + stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_532:
+    ++instructionCount;
+
+ins_534:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue != stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_536:
+    stack.push_back(Variable(g_instructions[100].strValue));
+    ++instructionCount;
+
+ins_542:
+    stack.erase(stack.end() - 3, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_548:
+    stack.back() = Variable(-stack.back().intValue);
+    ++instructionCount;
+
+ins_550:
+    stack.push_back(Variable(g_instructions[103].floatValue));
+    ++instructionCount;
+
+ins_556:
+    ++instructionCount;
+
+ins_558:
+    stack.push_back(Variable(g_instructions[105].floatValue));
+    ++instructionCount;
+
+ins_564:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_570:
+    stack.push_back(Variable(g_instructions[107].strValue));
+    ++instructionCount;
+
+ins_574:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_580:
+    stack.push_back(Variable(11));
+    ++instructionCount;
+
+ins_586:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_704;
+        }
+    }
+
+ins_592:
+    stack.push_back(Variable(-2));
+    ++instructionCount;
+
+ins_598:
+    stack.push_back(Variable(-11));
+    ++instructionCount;
+
+ins_604:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue <= stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_606:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (!zero) {
+            goto ins_656;
+        }
+    }
+
+ins_612:
+    stack.push_back(Variable(g_instructions[115].strValue));
+    ++instructionCount;
+
+ins_618:
+    stack.push_back(Variable(g_instructions[116].floatValue));
+    ++instructionCount;
+
+ins_624:
+    stack.push_back(Variable(g_instructions[117].floatValue));
+    ++instructionCount;
+
+ins_630:
+    stack.push_back(Variable(g_instructions[118].floatValue));
+    ++instructionCount;
+
+ins_636:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue <= stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_638:
+    stack.push_back(Variable(-12));
+    ++instructionCount;
+
+ins_644:
+    stack.erase(stack.end() - 4, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_650:
+    ++instructionCount;
+    goto ins_678;
+
+ins_656:
+    {
+        size_t dst = stack.size() - 4;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_664:
+    stack.push_back(Variable(-11));
+    ++instructionCount;
+
+ins_670:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_672:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_678:
+    stack.push_back(Variable(g_instructions[127].floatValue));
+    ++instructionCount;
+
+ins_684:
+    stack.push_back(Variable(g_instructions[128].floatValue));
+    ++instructionCount;
+
+ins_690:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue != stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_692:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_698:
+    ++instructionCount;
+    goto ins_811;
+
+ins_704:
+    stack.push_back(Variable(6));
+    ++instructionCount;
+
+ins_710:
+    stack.push_back(Variable(-7));
+    ++instructionCount;
+
+ins_716:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue | stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_718:
+    stack.push_back(Variable(g_instructions[135].strValue));
+    ++instructionCount;
+
+ins_725:
+    stack.push_back(Variable(6));
+    ++instructionCount;
+
+ins_731:
+    stack.push_back(Variable(18));
+    ++instructionCount;
+
+ins_737:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue | stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_739:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_765;
+        }
+    }
+
+ins_745:
+    stack.push_back(Variable(-10));
+    ++instructionCount;
+
+ins_751:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_753:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_759:
+    ++instructionCount;
+    goto ins_805;
+
+ins_765:
+    stack.push_back(Variable(-19));
+    ++instructionCount;
+
+ins_771:
+    stack.push_back(Variable(-15));
+    ++instructionCount;
+
+ins_777:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue | stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_779:
+    stack.push_back(Variable(-16));
+    ++instructionCount;
+
+ins_785:
+    stack.push_back(Variable(5));
+    ++instructionCount;
+
+ins_791:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue && stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_793:
+    stack.push_back(Variable(17));
+    ++instructionCount;
+
+ins_799:
+    stack.erase(stack.end() - 3, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_805:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_811:
+    stack.erase(stack.end() - 3, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_817:
+    stack.push_back(Variable(6));
+    ++instructionCount;
+
+ins_823:
+    stack.push_back(Variable(7));
+    ++instructionCount;
+
+ins_829:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue | stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_831:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_833:
+    stack.push_back(Variable(17));
+    ++instructionCount;
+
+ins_839:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_845:
+    {
+        size_t dst = stack.size() - 4;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_853:
+    stack.push_back(Variable(g_instructions[161].floatValue));
+    ++instructionCount;
+
+ins_859:
+    stack.push_back(Variable(g_instructions[162].floatValue));
+    ++instructionCount;
+
+ins_865:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue > stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_867:
+    {
+        size_t dst = stack.size() - 3;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_875:
+    stack.push_back(Variable(-14));
+    ++instructionCount;
+
+ins_881:
+    stack.push_back(Variable(-16));
+    ++instructionCount;
+
+ins_887:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue + stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_889:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue * stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_891:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_897:
+    stack.push_back(Variable(10));
+    ++instructionCount;
+
+ins_903:
+    stack.push_back(Variable(4));
+    ++instructionCount;
+
+ins_909:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue >> stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_911:
+    ++instructionCount;
+
+ins_913:
+    stack.back() = Variable(-stack.back().intValue);
+    ++instructionCount;
+
+ins_915:
+    stack.push_back(Variable(2));
+    ++instructionCount;
+
+ins_921:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue << stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_923:
+    stack.push_back(stack[stack.size() - 6]);
+    ++instructionCount;
+
+ins_931:
+    stack.push_back(Variable(g_instructions[178].floatValue));
+    ++instructionCount;
+
+ins_937:
+    stack.push_back(Variable(g_instructions[179].floatValue));
+    ++instructionCount;
+
+ins_943:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue > stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_945:
+    stack.push_back(Variable(g_instructions[181].floatValue));
+    ++instructionCount;
+
+ins_951:
+    {
+        size_t dst = stack.size() - 2;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_957:
+    stack.erase(stack.end() - 3, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_963:
+    stack.push_back(Variable(-16));
+    ++instructionCount;
+
+ins_969:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue + stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_971:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_997;
+        }
+    }
+
+ins_977:
+    stack.push_back(Variable(g_instructions[187].floatValue));
+    ++instructionCount;
+
+ins_983:
+    stack.back() = Variable(-stack.back().floatValue);
+    ++instructionCount;
+
+ins_985:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_991:
+    ++instructionCount;
+    goto ins_1011;
+
+ins_997:
+    for (size_t src = stack.size() - 3, end = src + 2; src < end; ++src) {
+        stack.push_back(stack[src]);
+    }
+    ++instructionCount;
+
+ins_1005:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_1011:
+    stack.push_back(Variable(g_instructions[193].floatValue));
+    ++instructionCount;
+
+ins_1017:
+    {
+        size_t dst = stack.size() - 3;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_1023:
+    stack.push_back(Variable(10));
+    ++instructionCount;
+
+ins_1029:
+    exec.executeInstruction(g_instructions[196]);
+    offset = exec.nextInstruction();
+    goto dispatch;
+
+    exec.countInstructions(instructionCount);
+    return true;
+}
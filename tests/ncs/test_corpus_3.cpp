@@ -0,0 +1,1356 @@
+// Generated by reone-tools from test_corpus_3. Do not edit.
+
+#include "script/native.h"
+
+using namespace reone::script;
+
+static const uint32_t kLength = 1029;
+
+static const Instruction g_instructions[] = {
+    makeInstruction(13, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 19, 0, 0, 7), // CONSTx 7
+    makeInstruction(19, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 25, -4, 0, 0), // DECISP
+    makeInstruction(25, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 31, 0, 0, 9), // CONSTx 9
+    makeInstruction(31, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 37, -4, 0, 0), // MOVESP
+    makeInstruction(37, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 39, 0, 0, 0), // NOP
+    makeInstruction(39, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 45, -4, 0, 0), // INCISP
+    makeInstruction(45, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 51, 0, 0, 1077936128), // CONSTx 3.000000
+    makeInstruction(51, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 57, -4, 0, 0), // MOVESP
+    makeInstruction(57, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 65, -4, 4, 0), // CPTOPSP
+    makeInstruction(65, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 71, 0, 0, 4), // CONSTx 4
+    makeInstruction(71, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 73, 0, 0, 0), // NOP
+    makeInstruction(73, static_cast<ByteCode>(0x0e), static_cast<InstructionType>(0x20), 75, 0, 0, 0), // GTxx
+    makeInstruction(75, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 77, 0, 0, 0), // NOP
+    makeInstruction(77, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 79, 0, 0, 0), // NOTI
+    makeInstruction(79, static_cast<ByteCode>(0x0b), static_cast<InstructionType>(0x20), 81, 0, 0, 0), // EQUALxx
+    makeInstruction(81, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 87, 197, 0, 0), // JZ 000000c5
+    makeInstruction(87, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 93, 0, 0, 4), // CONSTx 4
+    makeInstruction(93, static_cast<ByteCode>(0x25), static_cast<InstructionType>(0x00), 99, 143, 0, 0), // JNZ 0000008f
+    makeInstruction(99, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 105, 0, 0, 6), // CONSTx 6
+    makeInstruction(105, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 111, -4, 0, 0), // MOVESP
+    makeInstruction(111, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 117, 0, 0, -8), // CONSTx -8
+    makeInstruction(117, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 123, 0, 0, -1086324736), // CONSTx -0.750000
+    makeInstruction(123, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 129, 0, 0, 1056964608), // CONSTx 0.500000
+    makeInstruction(129, static_cast<ByteCode>(0x17), static_cast<InstructionType>(0x21), 131, 0, 0, 0), // DIVxx
+    makeInstruction(131, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 137, -8, 0, 0), // MOVESP
+    makeInstruction(137, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 143, 179, 0, 0), // JMP 000000b3
+    makeInstruction(143, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 149, 0, 0, 13), // CONSTx 13
+    makeInstruction(149, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 157, -4, 4, 0), // CPTOPSP
+    makeInstruction(157, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 159, 0, 0, 0), // NOP
+    makeInstruction(159, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 165, 0, 0, 1087373312), // CONSTx 6.500000
+    makeInstruction(165, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 171, 0, 0, 1080033280), // CONSTx 3.500000
+    makeInstruction(171, static_cast<ByteCode>(0x15), static_cast<InstructionType>(0x21), 173, 0, 0, 0), // SUBxx
+    makeInstruction(173, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 179, -12, 0, 0), // MOVESP
+    makeInstruction(179, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 185, 0, 0, 6), // CONSTx 6
+    makeInstruction(185, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 191, -4, 0, 0), // MOVESP
+    makeInstruction(191, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 197, 209, 0, 0), // JMP 000000d1
+    makeInstruction(197, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 203, 0, 0, 10), // CONSTx 10
+    makeInstruction(203, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 209, -4, 0, 0), // MOVESP
+    makeInstruction(209, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 215, 0, 0, -18), // CONSTx -18
+    makeInstruction(215, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 221, 0, 0, -4), // CONSTx -4
+    makeInstruction(221, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 227, 0, 0, -6), // CONSTx -6
+    makeInstruction(227, static_cast<ByteCode>(0x08), static_cast<InstructionType>(0x20), 229, 0, 0, 0), // INCORII
+    makeInstruction(229, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x03), 231, 0, 0, 0), // NEGx
+    makeInstruction(231, static_cast<ByteCode>(0x07), static_cast<InstructionType>(0x20), 233, 0, 0, 0), // LOGORII
+    makeInstruction(233, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 239, -4, 0, 0), // DECISP
+    makeInstruction(239, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 241, 0, 0, 0), // NOP
+    makeInstruction(241, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 247, 0, 0, 1088421888), // CONSTx 7.000000
+    makeInstruction(247, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 249, 0, 0, 0), // NOP
+    makeInstruction(249, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 255, -4, 0, 0), // MOVESP
+    makeInstruction(255, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 261, 0, 0, 17), // CONSTx 17
+    makeInstruction(261, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 267, 0, 0, -12), // CONSTx -12
+    makeInstruction(267, static_cast<ByteCode>(0x10), static_cast<InstructionType>(0x20), 269, 0, 0, 0), // LEQxx
+    makeInstruction(269, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 271, 0, 0, 0), // NOP
+    makeInstruction(271, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 276, 0, 0, 0, "a"), // CONSTx \"a\"
+    makeInstruction(276, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 282, 0, 0, -18), // CONSTx -18
+    makeInstruction(282, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x03), 284, 0, 0, 0), // NEGx
+    makeInstruction(284, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 286, 0, 0, 0), // NOP
+    makeInstruction(286, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 294, -12, 4, 0), // CPDOWNSP
+    makeInstruction(294, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 301, 0, 0, 0, "q\"z"), // CONSTx \"q\"z\"
+    makeInstruction(301, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 309, -16, 4, 0), // CPTOPSP
+    makeInstruction(309, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 315, 0, 0, 2), // CONSTx 2
+    makeInstruction(315, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 321, 0, 0, 1088421888), // CONSTx 7.000000
+    makeInstruction(321, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 327, -8, 0, 0), // DECISP
+    makeInstruction(327, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 333, 0, 0, -1068498944), // CONSTx -3.250000
+    makeInstruction(333, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 339, -16, 0, 0), // INCISP
+    makeInstruction(339, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 345, 0, 0, -11), // CONSTx -11
+    makeInstruction(345, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 353, -20, 4, 0), // CPDOWNSP
+    makeInstruction(353, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 359, 0, 0, 1083179008), // CONSTx 4.500000
+    makeInstruction(359, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 365, 0, 0, 1082654720), // CONSTx 4.250000
+    makeInstruction(365, static_cast<ByteCode>(0x14), static_cast<InstructionType>(0x21), 367, 0, 0, 0), // ADDxx
+    makeInstruction(367, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 373, 0, 0, 6), // CONSTx 6
+    makeInstruction(373, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 379, 0, 0, 0), // CONSTx 0
+    makeInstruction(379, static_cast<ByteCode>(0x0f), static_cast<InstructionType>(0x20), 381, 0, 0, 0), // LTxx
+    makeInstruction(381, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 389, -24, 4, 0), // CPDOWNSP
+    makeInstruction(389, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 391, 0, 0, 0), // NOP
+    makeInstruction(391, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 397, 0, 0, 1076887552), // CONSTx 2.750000
+    makeInstruction(397, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 403, 0, 0, 1089470464), // CONSTx 7.500000
+    makeInstruction(403, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 409, 0, 0, -1098907648), // CONSTx -0.250000
+    makeInstruction(409, static_cast<ByteCode>(0x10), static_cast<InstructionType>(0x21), 411, 0, 0, 0), // LEQxx
+    makeInstruction(411, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 415, 0, 0, 0), // CONSTx \"\"
+    makeInstruction(415, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 421, 0, 0, -11), // CONSTx -11
+    makeInstruction(421, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 427, 439, 0, 0), // JZ 000001b7
+    makeInstruction(427, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 433, -8, 0, 0), // DECISP
+    makeInstruction(433, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 439, 474, 0, 0), // JMP 000001da
+    makeInstruction(439, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 441, 0, 0, 0), // NOP
+    makeInstruction(441, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 448, 0, 0, 0, "q\"z"), // CONSTx \"q\"z\"
+    makeInstruction(448, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 454, -4, 0, 0), // MOVESP
+    makeInstruction(454, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 460, 0, 0, 10), // CONSTx 10
+    makeInstruction(460, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 466, 0, 0, -5), // CONSTx -5
+    makeInstruction(466, static_cast<ByteCode>(0x09), static_cast<InstructionType>(0x20), 468, 0, 0, 0), // EXCORII
+    makeInstruction(468, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 474, -4, 0, 0), // MOVESP
+    makeInstruction(474, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 480, 0, 0, -18), // CONSTx -18
+    makeInstruction(480, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 486, -8, 0, 0), // MOVESP
+    makeInstruction(486, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 492, 0, 0, 0), // CONSTx 0
+    makeInstruction(492, static_cast<ByteCode>(0x12), static_cast<InstructionType>(0x20), 494, 0, 0, 0), // SHRIGHTII
+    makeInstruction(494, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 500, 0, 0, -1066401792), // CONSTx -3.750000
+    makeInstruction(500, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 508, -8, 4, 0), // CPTOPSP
+    makeInstruction(508, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 514, 0, 0, 4), // CONSTx 4
+    makeInstruction(514, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 520, 0, 0, -18), // CONSTx -18
+    makeInstruction(520, static_cast<ByteCode>(0x0b), static_cast<InstructionType>(0x20), 522, 0, 0, 0), // EQUALxx
+    makeInstruction(522, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 528, 0, 0, -3), // CONSTx -3
+    makeInstruction(528, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 534, 0, 0, 1), // CONSTx 1
+    makeInstruction(534, static_cast<ByteCode>(0x12), static_cast<InstructionType>(0x20), 536, 0, 0, 0), // SHRIGHTII
+    makeInstruction(536, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 542, 558, 0, 0), // JZ 0000022e
+    makeInstruction(542, static_cast<ByteCode>(0x16), static_cast<InstructionType>(0x20), 544, 0, 0, 0), // MULxx
+    makeInstruction(544, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 550, 0, 0, 1), // CONSTx 1
+    makeInstruction(550, static_cast<ByteCode>(0x12), static_cast<InstructionType>(0x20), 552, 0, 0, 0), // SHRIGHTII
+    makeInstruction(552, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 558, 578, 0, 0), // JMP 00000242
+    makeInstruction(558, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 566, -20, 8, 0), // CPTOPSP
+    makeInstruction(566, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 572, -20, 0, 0), // INCISP
+    makeInstruction(572, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 578, -8, 0, 0), // MOVESP
+    makeInstruction(578, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 580, 0, 0, 0), // NOP
+    makeInstruction(580, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 586, -4, 0, 0), // MOVESP
+    makeInstruction(586, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 592, 0, 0, -20), // CONSTx -20
+    makeInstruction(592, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 598, 618, 0, 0), // JZ 0000026a
+    makeInstruction(598, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 604, 0, 0, -9), // CONSTx -9
+    makeInstruction(604, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 606, 0, 0, 0), // NOTI
+    makeInstruction(606, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 612, -4, 0, 0), // MOVESP
+    makeInstruction(612, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 618, 638, 0, 0), // JMP 0000027e
+    makeInstruction(618, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 624, 0, 0, -10), // CONSTx -10
+    makeInstruction(624, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 630, 0, 0, 9), // CONSTx 9
+    makeInstruction(630, static_cast<ByteCode>(0x0f), static_cast<InstructionType>(0x20), 632, 0, 0, 0), // LTxx
+    makeInstruction(632, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 638, -4, 0, 0), // MOVESP
+    makeInstruction(638, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 644, 0, 0, 1084751872), // CONSTx 5.250000
+    makeInstruction(644, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 650, 0, 0, 1056964608), // CONSTx 0.500000
+    makeInstruction(650, static_cast<ByteCode>(0x0b), static_cast<InstructionType>(0x21), 652, 0, 0, 0), // EQUALxx
+    makeInstruction(652, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 658, 0, 0, -8), // CONSTx -8
+    makeInstruction(658, static_cast<ByteCode>(0x18), static_cast<InstructionType>(0x20), 660, 0, 0, 0), // MODII
+    makeInstruction(660, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 666, -4, 0, 0), // MOVESP
+    makeInstruction(666, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 672, 0, 0, 1048576000), // CONSTx 0.250000
+    makeInstruction(672, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 680, -12, 8, 0), // CPTOPSP
+    makeInstruction(680, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 686, 0, 0, 1080033280), // CONSTx 3.500000
+    makeInstruction(686, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 692, -8, 0, 0), // MOVESP
+    makeInstruction(692, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 698, 0, 0, 6), // CONSTx 6
+    makeInstruction(698, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 704, 0, 0, -1), // CONSTx -1
+    makeInstruction(704, static_cast<ByteCode>(0x0d), static_cast<InstructionType>(0x20), 706, 0, 0, 0), // GEQxx
+    makeInstruction(706, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 708, 0, 0, 0), // NOTI
+    makeInstruction(708, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 714, 0, 0, -1060634624), // CONSTx -6.250000
+    makeInstruction(714, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 719, 0, 0, 0, "a"), // CONSTx \"a\"
+    makeInstruction(719, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 726, 0, 0, 0, "q\"z"), // CONSTx \"q\"z\"
+    makeInstruction(726, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 733, 0, 0, 0, "q\"z"), // CONSTx \"q\"z\"
+    makeInstruction(733, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 739, 0, 0, 8), // CONSTx 8
+    makeInstruction(739, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 745, 827, 0, 0), // JZ 0000033b
+    makeInstruction(745, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 751, 0, 0, -20), // CONSTx -20
+    makeInstruction(751, static_cast<ByteCode>(0x25), static_cast<InstructionType>(0x00), 757, 805, 0, 0), // JNZ 00000325
+    makeInstruction(757, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 763, 0, 0, -13), // CONSTx -13
+    makeInstruction(763, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 769, 0, 0, -9), // CONSTx -9
+    makeInstruction(769, static_cast<ByteCode>(0x0b), static_cast<InstructionType>(0x20), 771, 0, 0, 0), // EQUALxx
+    makeInstruction(771, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 777, 0, 0, -1056964608), // CONSTx -8.000000
+    makeInstruction(777, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 783, 0, 0, 1083179008), // CONSTx 4.500000
+    makeInstruction(783, static_cast<ByteCode>(0x0d), static_cast<InstructionType>(0x21), 785, 0, 0, 0), // GEQxx
+    makeInstruction(785, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 793, -8, 4, 0), // CPTOPSP
+    makeInstruction(793, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 799, -12, 0, 0), // MOVESP
+    makeInstruction(799, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 805, 807, 0, 0), // JMP 00000327
+    makeInstruction(805, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 807, 0, 0, 0), // NOP
+    makeInstruction(807, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 813, 0, 0, -7), // CONSTx -7
+    makeInstruction(813, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x03), 815, 0, 0, 0), // NEGx
+    makeInstruction(815, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 821, -4, 0, 0), // MOVESP
+    makeInstruction(821, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 827, 839, 0, 0), // JMP 00000347
+    makeInstruction(827, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 833, 0, 0, 1087373312), // CONSTx 6.500000
+    makeInstruction(833, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 839, -4, 0, 0), // MOVESP
+    makeInstruction(839, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 845, -24, 0, 0), // INCISP
+    makeInstruction(845, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 847, 0, 0, 0), // NOP
+    makeInstruction(847, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 853, 0, 0, 3), // CONSTx 3
+    makeInstruction(853, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 859, 965, 0, 0), // JZ 000003c5
+    makeInstruction(859, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 865, 0, 0, 13), // CONSTx 13
+    makeInstruction(865, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 871, 915, 0, 0), // JZ 00000393
+    makeInstruction(871, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 877, -24, 0, 0), // INCISP
+    makeInstruction(877, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 883, 0, 0, -2), // CONSTx -2
+    makeInstruction(883, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 889, 0, 0, 0), // CONSTx 0
+    makeInstruction(889, static_cast<ByteCode>(0x12), static_cast<InstructionType>(0x20), 891, 0, 0, 0), // SHRIGHTII
+    makeInstruction(891, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 897, 0, 0, 7), // CONSTx 7
+    makeInstruction(897, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 903, -8, 0, 0), // DECISP
+    makeInstruction(903, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 909, -8, 0, 0), // MOVESP
+    makeInstruction(909, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 915, 927, 0, 0), // JMP 0000039f
+    makeInstruction(915, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 921, 0, 0, 1073741824), // CONSTx 2.000000
+    makeInstruction(921, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 927, -4, 0, 0), // MOVESP
+    makeInstruction(927, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 933, 0, 0, 1061158912), // CONSTx 0.750000
+    makeInstruction(933, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 939, 0, 0, -1090519040), // CONSTx -0.500000
+    makeInstruction(939, static_cast<ByteCode>(0x10), static_cast<InstructionType>(0x21), 941, 0, 0, 0), // LEQxx
+    makeInstruction(941, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 947, 0, 0, -11), // CONSTx -11
+    makeInstruction(947, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 953, 0, 0, -1062731776), // CONSTx -5.250000
+    makeInstruction(953, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 959, -12, 0, 0), // MOVESP
+    makeInstruction(959, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 965, 999, 0, 0), // JMP 000003e7
+    makeInstruction(965, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 971, 0, 0, 4), // CONSTx 4
+    makeInstruction(971, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 977, 0, 0, -13), // CONSTx -13
+    makeInstruction(977, static_cast<ByteCode>(0x15), static_cast<InstructionType>(0x20), 979, 0, 0, 0), // SUBxx
+    makeInstruction(979, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 985, 0, 0, 1), // CONSTx 1
+    makeInstruction(985, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 991, 0, 0, -12), // CONSTx -12
+    makeInstruction(991, static_cast<ByteCode>(0x0c), static_cast<InstructionType>(0x20), 993, 0, 0, 0), // NEQUALxx
+    makeInstruction(993, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 999, -8, 0, 0), // MOVESP
+    makeInstruction(999, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 1005, 0, 0, 1082130432), // CONSTx 4.000000
+    makeInstruction(1005, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 1011, 0, 0, 1056964608), // CONSTx 0.500000
+    makeInstruction(1011, static_cast<ByteCode>(0x17), static_cast<InstructionType>(0x21), 1013, 0, 0, 0), // DIVxx
+    makeInstruction(1013, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 1021, -8, 4, 0), // CPTOPSP
+    makeInstruction(1021, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 1027, 0, 0, -6), // CONSTx -6
+    makeInstruction(1027, static_cast<ByteCode>(0x20), static_cast<InstructionType>(0x00), 1029, 0, 0, 0) // RETN
+};
+
+extern "C" REONE_NATIVE_SCRIPT_EXPORT bool reone_ncs_test_corpus_3(IInstructionExecutor &exec, uint32_t offset) {
+    std::vector<Variable> &stack = exec.stack();
+    uint32_t instructionCount = 0;
+
+dispatch:
+    switch (offset) {
+        case 13: goto ins_13;
+        case 19: goto ins_19;
+        case 25: goto ins_25;
+        case 31: goto ins_31;
+        case 37: goto ins_37;
+        case 39: goto ins_39;
+        case 45: goto ins_45;
+        case 51: goto ins_51;
+        case 57: goto ins_57;
+        case 65: goto ins_65;
+        case 71: goto ins_71;
+        case 73: goto ins_73;
+        case 75: goto ins_75;
+        case 77: goto ins_77;
+        case 79: goto ins_79;
+        case 81: goto ins_81;
+        case 87: goto ins_87;
+        case 93: goto ins_93;
+        case 99: goto ins_99;
+        case 105: goto ins_105;
+        case 111: goto ins_111;
+        case 117: goto ins_117;
+        case 123: goto ins_123;
+        case 129: goto ins_129;
+        case 131: goto ins_131;
+        case 137: goto ins_137;
+        case 143: goto ins_143;
+        case 149: goto ins_149;
+        case 157: goto ins_157;
+        case 159: goto ins_159;
+        case 165: goto ins_165;
+        case 171: goto ins_171;
+        case 173: goto ins_173;
+        case 179: goto ins_179;
+        case 185: goto ins_185;
+        case 191: goto ins_191;
+        case 197: goto ins_197;
+        case 203: goto ins_203;
+        case 209: goto ins_209;
+        case 215: goto ins_215;
+        case 221: goto ins_221;
+        case 227: goto ins_227;
+        case 229: goto ins_229;
+        case 231: goto ins_231;
+        case 233: goto ins_233;
+        case 239: goto ins_239;
+        case 241: goto ins_241;
+        case 247: goto ins_247;
+        case 249: goto ins_249;
+        case 255: goto ins_255;
+        case 261: goto ins_261;
+        case 267: goto ins_267;
+        case 269: goto ins_269;
+        case 271: goto ins_271;
+        case 276: goto ins_276;
+        case 282: goto ins_282;
+        case 284: goto ins_284;
+        case 286: goto ins_286;
+        case 294: goto ins_294;
+        case 301: goto ins_301;
+        case 309: goto ins_309;
+        case 315: goto ins_315;
+        case 321: goto ins_321;
+        case 327: goto ins_327;
+        case 333: goto ins_333;
+        case 339: goto ins_339;
+        case 345: goto ins_345;
+        case 353: goto ins_353;
+        case 359: goto ins_359;
+        case 365: goto ins_365;
+        case 367: goto ins_367;
+        case 373: goto ins_373;
+        case 379: goto ins_379;
+        case 381: goto ins_381;
+        case 389: goto ins_389;
+        case 391: goto ins_391;
+        case 397: goto ins_397;
+        case 403: goto ins_403;
+        case 409: goto ins_409;
+        case 411: goto ins_411;
+        case 415: goto ins_415;
+        case 421: goto ins_421;
+        case 427: goto ins_427;
+        case 433: goto ins_433;
+        case 439: goto ins_439;
+        case 441: goto ins_441;
+        case 448: goto ins_448;
+        case 454: goto ins_454;
+        case 460: goto ins_460;
+        case 466: goto ins_466;
+        case 468: goto ins_468;
+        case 474: goto ins_474;
+        case 480: goto ins_480;
+        case 486: goto ins_486;
+        case 492: goto ins_492;
+        case 494: goto ins_494;
+        case 500: goto ins_500;
+        case 508: goto ins_508;
+        case 514: goto ins_514;
+        case 520: goto ins_520;
+        case 522: goto ins_522;
+        case 528: goto ins_528;
+        case 534: goto ins_534;
+        case 536: goto ins_536;
+        case 542: goto ins_542;
+        case 544: goto ins_544;
+        case 550: goto ins_550;
+        case 552: goto ins_552;
+        case 558: goto ins_558;
+        case 566: goto ins_566;
+        case 572: goto ins_572;
+        case 578: goto ins_578;
+        case 580: goto ins_580;
+        case 586: goto ins_586;
+        case 592: goto ins_592;
+        case 598: goto ins_598;
+        case 604: goto ins_604;
+        case 606: goto ins_606;
+        case 612: goto ins_612;
+        case 618: goto ins_618;
+        case 624: goto ins_624;
+        case 630: goto ins_630;
+        case 632: goto ins_632;
+        case 638: goto ins_638;
+        case 644: goto ins_644;
+        case 650: goto ins_650;
+        case 652: goto ins_652;
+        case 658: goto ins_658;
+        case 660: goto ins_660;
+        case 666: goto ins_666;
+        case 672: goto ins_672;
+        case 680: goto ins_680;
+        case 686: goto ins_686;
+        case 692: goto ins_692;
+        case 698: goto ins_698;
+        case 704: goto ins_704;
+        case 706: goto ins_706;
+        case 708: goto ins_708;
+        case 714: goto ins_714;
+        case 719: goto ins_719;
+        case 726: goto ins_726;
+        case 733: goto ins_733;
+        case 739: goto ins_739;
+        case 745: goto ins_745;
+        case 751: goto ins_751;
+        case 757: goto ins_757;
+        case 763: goto ins_763;
+        case 769: goto ins_769;
+        case 771: goto ins_771;
+        case 777: goto ins_777;
+        case 783: goto ins_783;
+        case 785: goto ins_785;
+        case 793: goto ins_793;
+        case 799: goto ins_799;
+        case 805: goto ins_805;
+        case 807: goto ins_807;
+        case 813: goto ins_813;
+        case 815: goto ins_815;
+        case 821: goto ins_821;
+        case 827: goto ins_827;
+        case 833: goto ins_833;
+        case 839: goto ins_839;
+        case 845: goto ins_845;
+        case 847: goto ins_847;
+        case 853: goto ins_853;
+        case 859: goto ins_859;
+        case 865: goto ins_865;
+        case 871: goto ins_871;
+        case 877: goto ins_877;
+        case 883: goto ins_883;
+        case 889: goto ins_889;
+        case 891: goto ins_891;
+        case 897: goto ins_897;
+        case 903: goto ins_903;
+        case 909: goto ins_909;
+        case 915: goto ins_915;
+        case 921: goto ins_921;
+        case 927: goto ins_927;
+        case 933: goto ins_933;
+        case 939: goto ins_939;
+        case 941: goto ins_941;
+        case 947: goto ins_947;
+        case 953: goto ins_953;
+        case 959: goto ins_959;
+        case 965: goto ins_965;
+        case 971: goto ins_971;
+        case 977: goto ins_977;
+        case 979: goto ins_979;
+        case 985: goto ins_985;
+        case 991: goto ins_991;
+        case 993: goto ins_993;
+        case 999: goto ins_999;
+        case 1005: goto ins_1005;
+        case 1011: goto ins_1011;
+        case 1013: goto ins_1013;
+        case 1021: goto ins_1021;
+        case 1027: goto ins_1027;
+        default:
+            exec.countInstructions(instructionCount);
+            return offset >= kLength;
+    }
+
+ins_13:
+    stack.push_back(Variable(7));
+    ++instructionCount;
+
+ins_19:
+    {
+        size_t dst = stack.size() - 1;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_25:
+    stack.push_back(Variable(9));
+    ++instructionCount;
+
+ins_31:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_37:
+    ++instructionCount;
+
+ins_39:
+    {
+        size_t dst = stack.size() - 1;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_45:
+    stack.push_back(Variable(g_instructions[6].floatValue));
+    ++instructionCount;
+
+ins_51:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_57:
+    stack.push_back(stack[stack.size() - 1]);
+    ++instructionCount;
+
+ins_65:
+    stack.push_back(Variable(4));
+    ++instructionCount;
+
+ins_71:
+    ++instructionCount;
+
+ins_73:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue > stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_75:
+    ++instructionCount;
+
+ins_77:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_79:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue == stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_81:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_197;
+        }
+    }
+
+ins_87:
+    stack.push_back(Variable(4));
+    ++instructionCount;
+
+ins_93:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (!zero) {
+            goto ins_143;
+        }
+    }
+
+ins_99:
+    stack.push_back(Variable(6));
+    ++instructionCount;
+
+ins_105:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_111:
+    stack.push_back(Variable(-8));
+    ++instructionCount;
+
+ins_117:
+    stack.push_back(Variable(g_instructions[21].floatValue));
+    ++instructionCount;
+
+ins_123:
+    stack.push_back(Variable(g_instructions[22].floatValue));
+    ++instructionCount;
+
+ins_129:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue / stack.back().floatValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_131:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_137:
+    ++instructionCount;
+    goto ins_179;
+
+ins_143:
+    stack.push_back(Variable(13));
+    ++instructionCount;
+
+ins_149:
+    stack.push_back(stack[stack.size() - 1]);
+    ++instructionCount;
+
+ins_157:
+    ++instructionCount;
+
+ins_159:
+    stack.push_back(Variable(g_instructions[29].floatValue));
+    ++instructionCount;
+
+ins_165:
+    stack.push_back(Variable(g_instructions[30].floatValue));
+    ++instructionCount;
+
+ins_171:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue - stack.back().floatValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_173:
+    stack.erase(stack.end() - 3, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_179:
+    stack.push_back(Variable(6));
+    ++instructionCount;
+
+ins_185:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_191:
+    ++instructionCount;
+    goto ins_209;
+
+ins_197:
+    stack.push_back(Variable(10));
+    ++instructionCount;
+
+ins_203:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_209:
+    stack.push_back(Variable(-18));
+    ++instructionCount;
+
+ins_215:
+    stack.push_back(Variable(-4));
+    ++instructionCount;
+
+ins_221:
+    stack.push_back(Variable(-6));
+    ++instructionCount;
+
+ins_227:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue | stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_229:
+    stack.back() = Variable(-stack.back().intValue);
+    ++instructionCount;
+
+ins_231:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue || stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_233:
+    {
+        size_t dst = stack.size() - 1;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_239:
+    ++instructionCount;
+
+ins_241:
+    stack.push_back(Variable(g_instructions[46].floatValue));
+    ++instructionCount;
+
+ins_247:
+    ++instructionCount;
+
+ins_249:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_255:
+    stack.push_back(Variable(17));
+    ++instructionCount;
+
+ins_261:
+    stack.push_back(Variable(-12));
+    ++instructionCount;
+
+ins_267:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue <= stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_269:
+    ++instructionCount;
+
+ins_271:
+    stack.push_back(Variable(g_instructions[53].strValue));
+    ++instructionCount;
+
+ins_276:
+    stack.push_back(Variable(-18));
+    ++instructionCount;
+
+ins_282:
+    stack.back() = Variable(-stack.back().intValue);
+    ++instructionCount;
+
+ins_284:
+    ++instructionCount;
+
+ins_286:
+    {
+        size_t dst = stack.size() - 3;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_294:
+    stack.push_back(Variable(g_instructions[58].strValue));
+    ++instructionCount;
+
+ins_301:
+    stack.push_back(stack[stack.size() - 4]);
+    ++instructionCount;
+
+ins_309:
+    stack.push_back(Variable(2));
+    ++instructionCount;
+
+ins_315:
+    stack.push_back(Variable(g_instructions[61].floatValue));
+    ++instructionCount;
+
+ins_321:
+    {
+        size_t dst = stack.size() - 2;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_327:
+    stack.push_back(Variable(g_instructions[63].floatValue));
+    ++instructionCount;
+
+ins_333:
+    {
+        size_t dst = stack.size() - 4;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_339:
+    stack.push_back(Variable(-11));
+    ++instructionCount;
+
+ins_345:
+    {
+        size_t dst = stack.size() - 5;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_353:
+    stack.push_back(Variable(g_instructions[67].floatValue));
+    ++instructionCount;
+
+ins_359:
+    stack.push_back(Variable(g_instructions[68].floatValue));
+    ++instructionCount;
+
+ins_365:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue + stack.back().floatValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_367:
+    stack.push_back(Variable(6));
+    ++instructionCount;
+
+ins_373:
+    stack.push_back(Variable(0));
+    ++instructionCount;
+
+ins_379:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue < stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_381:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_389:
+    ++instructionCount;
+
+ins_391:
+    stack.push_back(Variable(g_instructions[75].floatValue));
+    ++instructionCount;
+
+ins_397:
+    stack.push_back(Variable(g_instructions[76].floatValue));
+    ++instructionCount;
+
+ins_403:
+    stack.push_back(Variable(g_instructions[77].floatValue));
+    ++instructionCount;
+
+ins_409:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue <= stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_411:
+    stack.push_back(Variable(g_instructions[79].strValue));
+    ++instructionCount;
+
+ins_415:
+    stack.push_back(Variable(-11));
+    ++instructionCount;
+
+ins_421:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_439;
+        }
+    }
+
+ins_427:
+    {
+        size_t dst = stack.size() - 2;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_433:
+    ++instructionCount;
+    goto ins_474;
+
+ins_439:
+    ++instructionCount;
+
+ins_441:
+    stack.push_back(Variable(g_instructions[85].strValue));
+    ++instructionCount;
+
+ins_448:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_454:
+    stack.push_back(Variable(10));
+    ++instructionCount;
+
+ins_460:
+    stack.push_back(Variable(-5));
+    ++instructionCount;
+
+ins_466:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue ^ stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_468:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_474:
+    stack.push_back(Variable(-18));
+    ++instructionCount;
+
+ins_480:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_486:
+    stack.push_back(Variable(0));
+    ++instructionCount;
+
+ins_492:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue >> stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_494:
+    stack.push_back(Variable(g_instructions[95].floatValue));
+    ++instructionCount;
+
+ins_500:
+    stack.push_back(stack[stack.size() - 2]);
+    ++instructionCount;
+
+ins_508:
+    stack.push_back(Variable(4));
+    ++instructionCount;
+
+ins_514:
+    stack.push_back(Variable(-18));
+    ++instructionCount;
+
+ins_520:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue == stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_522:
+    stack.push_back(Variable(-3));
+    ++instructionCount;
+
+ins_528:
+    stack.push_back(Variable(1));
+    ++instructionCount;
+
+ins_534:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue >> stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_536:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_558;
+        }
+    }
+
+ins_542:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue * stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_544:
+    stack.push_back(Variable(1));
+    ++instructionCount;
+
+ins_550:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue >> stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_552:
+    ++instructionCount;
+    goto ins_578;
+
+ins_558:
+    for (size_t src = stack.size() - 5, end = src + 2; src < end; ++src) {
+        stack.push_back(stack[src]);
+    }
+    ++instructionCount;
+
+ins_566:
+    {
+        size_t dst = stack.size() - 5;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_572:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_578:
+    ++instructionCount;
+
+ins_580:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_586:
+    stack.push_back(Variable(-20));
+    ++instructionCount;
+
+ins_592:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_618;
+        }
+    }
+
+ins_598:
+    stack.push_back(Variable(-9));
+    ++instructionCount;
+
+ins_604:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_606:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_612:
+    ++instructionCount;
+    goto ins_638;
+
+ins_618:
+    stack.push_back(Variable(-10));
+    ++instructionCount;
+
+ins_624:
+    stack.push_back(Variable(9));
+    ++instructionCount;
+
+ins_630:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue < stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_632:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_638:
+    stack.push_back(Variable(g_instructions[123].floatValue));
+    ++instructionCount;
+
+ins_644:
+    stack.push_back(Variable(g_instructions[124].floatValue));
+    ++instructionCount;
+
+ins_650:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue == stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_652:
+    stack.push_back(Variable(-8));
+    ++instructionCount;
+
+ins_658:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue % stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_660:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_666:
+    stack.push_back(Variable(g_instructions[129].floatValue));
+    ++instructionCount;
+
+ins_672:
+    for (size_t src = stack.size() - 3, end = src + 2; src < end; ++src) {
+        stack.push_back(stack[src]);
+    }
+    ++instructionCount;
+
+ins_680:
+    stack.push_back(Variable(g_instructions[131].floatValue));
+    ++instructionCount;
+
+ins_686:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_692:
+    stack.push_back(Variable(6));
+    ++instructionCount;
+
+ins_698:
+    stack.push_back(Variable(-1));
+    ++instructionCount;
+
+ins_704:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue >= stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_706:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_708:
+    stack.push_back(Variable(g_instructions[137].floatValue));
+    ++instructionCount;
+
+ins_714:
+    stack.push_back(Variable(g_instructions[138].strValue));
+    ++instructionCount;
+
+ins_719:
+    stack.push_back(Variable(g_instructions[139].strValue));
+    ++instructionCount;
+
+ins_726:
+    stack.push_back(Variable(g_instructions[140].strValue));
+    ++instructionCount;
+
+ins_733:
+    stack.push_back(Variable(8));
+    ++instructionCount;
+
+ins_739:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_827;
+        }
+    }
+
+ins_745:
+    stack.push_back(Variable(-20));
+    ++instructionCount;
+
+ins_751:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (!zero) {
+            goto ins_805;
+        }
+    }
+
+ins_757:
+    stack.push_back(Variable(-13));
+    ++instructionCount;
+
+ins_763:
+    stack.push_back(Variable(-9));
+    ++instructionCount;
+
+ins_769:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue == stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_771:
+    stack.push_back(Variable(g_instructions[148].floatValue));
+    ++instructionCount;
+
+ins_777:
+    stack.push_back(Variable(g_instructions[149].floatValue));
+    ++instructionCount;
+
+ins_783:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue >= stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_785:
+    stack.push_back(stack[stack.size() - 2]);
+    ++instructionCount;
+
+ins_793:
+    stack.erase(stack.end() - 3, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_799:
+    ++instructionCount;
+    goto ins_807;
+
+ins_805:
+    ++instructionCount;
+
+ins_807:
+    stack.push_back(Variable(-7));
+    ++instructionCount;
+
+ins_813:
+    stack.back() = Variable(-stack.back().intValue);
+    ++instructionCount;
+
+ins_815:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_821:
+    ++instructionCount;
+    goto ins_839;
+
+ins_827:
+    stack.push_back(Variable(g_instructions[159].floatValue));
+    ++instructionCount;
+
+ins_833:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_839:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_845:
+    ++instructionCount;
+
+ins_847:
+    stack.push_back(Variable(3));
+    ++instructionCount;
+
+ins_853:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_965;
+        }
+    }
+
+ins_859:
+    stack.push_back(Variable(13));
+    ++instructionCount;
+
+ins_865:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_915;
+        }
+    }
+
+ins_871:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_877:
+    stack.push_back(Variable(-2));
+    ++instructionCount;
+
+ins_883:
+    stack.push_back(Variable(0));
+    ++instructionCount;
+
+ins_889:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue >> stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_891:
+    stack.push_back(Variable(7));
+    ++instructionCount;
+
+ins_897:
+    {
+        size_t dst = stack.size() - 2;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_903:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_909:
+    ++instructionCount;
+    goto ins_927;
+
+ins_915:
+    stack.push_back(Variable(g_instructions[175].floatValue));
+    ++instructionCount;
+
+ins_921:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_927:
+    stack.push_back(Variable(g_instructions[177].floatValue));
+    ++instructionCount;
+
+ins_933:
+    stack.push_back(Variable(g_instructions[178].floatValue));
+    ++instructionCount;
+
+ins_939:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue <= stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_941:
+    stack.push_back(Variable(-11));
+    ++instructionCount;
+
+ins_947:
+    stack.push_back(Variable(g_instructions[181].floatValue));
+    ++instructionCount;
+
+ins_953:
+    stack.erase(stack.end() - 3, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_959:
+    ++instructionCount;
+    goto ins_999;
+
+ins_965:
+    stack.push_back(Variable(4));
+    ++instructionCount;
+
+ins_971:
+    stack.push_back(Variable(-13));
+    ++instructionCount;
+
+ins_977:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue - stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_979:
+    stack.push_back(Variable(1));
+    ++instructionCount;
+
+ins_985:
+    stack.push_back(Variable(-12));
+    ++instructionCount;
+
+ins_991:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue != stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_993:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_999:
+    stack.push_back(Variable(g_instructions[191].floatValue));
+    ++instructionCount;
+
+ins_1005:
+    stack.push_back(Variable(g_instructions[192].floatValue));
+    ++instructionCount;
+
+ins_1011:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue / stack.back().floatValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_1013:
+    stack.push_back(stack[stack.size() - 2]);
+    ++instructionCount;
+
+ins_1021:
+    stack.push_back(Variable(-6));
+    ++instructionCount;
+
+ins_1027:
+    exec.executeInstruction(g_instructions[196]);
+    offset = exec.nextInstruction();
+    goto dispatch;
+
+    exec.countInstructions(instructionCount);
+    return true;
+}
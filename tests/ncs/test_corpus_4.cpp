@@ -0,0 +1,1452 @@
+// Generated by reone-tools from test_corpus_4. Do not edit.
+
+#include "script/native.h"
+
+using namespace reone::script;
+
+static const uint32_t kLength = 1113;
+
+static const Instruction g_instructions[] = {
+    makeInstruction(13, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 19, 0, 0, 10), // CONSTx 10
+    makeInstruction(19, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 27, -4, 4, 0), // CPTOPSP
+    makeInstruction(27, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 33, 0, 0, 1085276160), // CONSTx 5.500000
+    makeInstruction(33, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 39, 0, 0, 16), // CONSTx 16
+    makeInstruction(39, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 45, 0, 0, 1083703296), // CONSTx 4.750000
+    makeInstruction(45, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 51, 0, 0, 1069547520), // CONSTx 1.500000
+    makeInstruction(51, static_cast<ByteCode>(0x16), static_cast<InstructionType>(0x21), 53, 0, 0, 0), // MULxx
+    makeInstruction(53, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 59, -16, 0, 0), // DECISP
+    makeInstruction(59, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 65, -8, 0, 0), // MOVESP
+    makeInstruction(65, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 71, 0, 0, -17), // CONSTx -17
+    makeInstruction(71, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 77, 0, 0, -7), // CONSTx -7
+    makeInstruction(77, static_cast<ByteCode>(0x0c), static_cast<InstructionType>(0x20), 79, 0, 0, 0), // NEQUALxx
+    makeInstruction(79, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 85, 0, 0, 20), // CONSTx 20
+    makeInstruction(85, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 91, 0, 0, 19), // CONSTx 19
+    makeInstruction(91, static_cast<ByteCode>(0x16), static_cast<InstructionType>(0x20), 93, 0, 0, 0), // MULxx
+    makeInstruction(93, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 99, 0, 0, -1059061760), // CONSTx -7.000000
+    makeInstruction(99, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 107, -16, 4, 0), // CPDOWNSP
+    makeInstruction(107, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 113, 0, 0, -7), // CONSTx -7
+    makeInstruction(113, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 119, 0, 0, -17), // CONSTx -17
+    makeInstruction(119, static_cast<ByteCode>(0x08), static_cast<InstructionType>(0x20), 121, 0, 0, 0), // INCORII
+    makeInstruction(121, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x03), 123, 0, 0, 0), // NEGx
+    makeInstruction(123, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 125, 0, 0, 0), // NOP
+    makeInstruction(125, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 131, 0, 0, 7), // CONSTx 7
+    makeInstruction(131, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 139, -8, 4, 0), // CPDOWNSP
+    makeInstruction(139, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 145, 0, 0, -1060634624), // CONSTx -6.250000
+    makeInstruction(145, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 151, 0, 0, -4), // CONSTx -4
+    makeInstruction(151, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 157, 195, 0, 0), // JZ 000000c3
+    makeInstruction(157, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 163, -24, 0, 0), // INCISP
+    makeInstruction(163, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 171, -8, 4, 0), // CPTOPSP
+    makeInstruction(171, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 177, -4, 0, 0), // MOVESP
+    makeInstruction(177, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 183, 0, 0, 1065353216), // CONSTx 1.000000
+    makeInstruction(183, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 189, -4, 0, 0), // MOVESP
+    makeInstruction(189, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 195, 303, 0, 0), // JMP 0000012f
+    makeInstruction(195, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 201, 0, 0, -18), // CONSTx -18
+    makeInstruction(201, static_cast<ByteCode>(0x25), static_cast<InstructionType>(0x00), 207, 243, 0, 0), // JNZ 000000f3
+    makeInstruction(207, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 209, 0, 0, 0), // NOP
+    makeInstruction(209, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 215, 0, 0, 1089470464), // CONSTx 7.500000
+    makeInstruction(215, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 221, 0, 0, -1063780352), // CONSTx -4.750000
+    makeInstruction(221, static_cast<ByteCode>(0x0c), static_cast<InstructionType>(0x21), 223, 0, 0, 0), // NEQUALxx
+    makeInstruction(223, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 231, -24, 4, 0), // CPDOWNSP
+    makeInstruction(231, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 237, -4, 0, 0), // MOVESP
+    makeInstruction(237, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 243, 269, 0, 0), // JMP 0000010d
+    makeInstruction(243, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 249, 0, 0, -1066401792), // CONSTx -3.750000
+    makeInstruction(249, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 255, 0, 0, -16), // CONSTx -16
+    makeInstruction(255, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 261, 0, 0, -18), // CONSTx -18
+    makeInstruction(261, static_cast<ByteCode>(0x07), static_cast<InstructionType>(0x20), 263, 0, 0, 0), // LOGORII
+    makeInstruction(263, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 269, -8, 0, 0), // MOVESP
+    makeInstruction(269, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 275, 0, 0, 0), // CONSTx 0
+    makeInstruction(275, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 277, 0, 0, 0), // NOTI
+    makeInstruction(277, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 283, -24, 0, 0), // INCISP
+    makeInstruction(283, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 289, 0, 0, 15), // CONSTx 15
+    makeInstruction(289, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 295, 0, 0, 4), // CONSTx 4
+    makeInstruction(295, static_cast<ByteCode>(0x07), static_cast<InstructionType>(0x20), 297, 0, 0, 0), // LOGORII
+    makeInstruction(297, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 303, -8, 0, 0), // MOVESP
+    makeInstruction(303, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 309, 0, 0, -3), // CONSTx -3
+    makeInstruction(309, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 315, 0, 0, 1), // CONSTx 1
+    makeInstruction(315, static_cast<ByteCode>(0x10), static_cast<InstructionType>(0x20), 317, 0, 0, 0), // LEQxx
+    makeInstruction(317, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 319, 0, 0, 0), // NOP
+    makeInstruction(319, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 327, -24, 4, 0), // CPTOPSP
+    makeInstruction(327, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 335, -20, 8, 0), // CPTOPSP
+    makeInstruction(335, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 342, 0, 0, 0, "q\"z"), // CONSTx \"q\"z\"
+    makeInstruction(342, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 348, 0, 0, -1077936128), // CONSTx -1.500000
+    makeInstruction(348, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 354, 0, 0, -1065353216), // CONSTx -4.000000
+    makeInstruction(354, static_cast<ByteCode>(0x17), static_cast<InstructionType>(0x21), 356, 0, 0, 0), // DIVxx
+    makeInstruction(356, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 362, 0, 0, -1060110336), // CONSTx -6.500000
+    makeInstruction(362, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 368, 0, 0, 16), // CONSTx 16
+    makeInstruction(368, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 374, 410, 0, 0), // JZ 0000019a
+    makeInstruction(374, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 380, 0, 0, -3), // CONSTx -3
+    makeInstruction(380, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 388, -4, 4, 0), // CPTOPSP
+    makeInstruction(388, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 390, 0, 0, 0), // NOTI
+    makeInstruction(390, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 396, 0, 0, 1), // CONSTx 1
+    makeInstruction(396, static_cast<ByteCode>(0x17), static_cast<InstructionType>(0x20), 398, 0, 0, 0), // DIVxx
+    makeInstruction(398, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 404, -8, 0, 0), // MOVESP
+    makeInstruction(404, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 410, 436, 0, 0), // JMP 000001b4
+    makeInstruction(410, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 416, -24, 0, 0), // DECISP
+    makeInstruction(416, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x04), 418, 0, 0, 0), // NEGx
+    makeInstruction(418, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 424, 0, 0, -1057488896), // CONSTx -7.750000
+    makeInstruction(424, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 430, -24, 0, 0), // INCISP
+    makeInstruction(430, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 436, -4, 0, 0), // MOVESP
+    makeInstruction(436, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 442, -24, 0, 0), // INCISP
+    makeInstruction(442, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 448, 0, 0, 7), // CONSTx 7
+    makeInstruction(448, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 454, 468, 0, 0), // JZ 000001d4
+    makeInstruction(454, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 460, 0, 0, -1065353216), // CONSTx -4.000000
+    makeInstruction(460, static_cast<ByteCode>(0x17), static_cast<InstructionType>(0x21), 462, 0, 0, 0), // DIVxx
+    makeInstruction(462, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 468, 542, 0, 0), // JMP 0000021e
+    makeInstruction(468, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 474, 0, 0, -15), // CONSTx -15
+    makeInstruction(474, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 480, 514, 0, 0), // JZ 00000202
+    makeInstruction(480, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 486, 0, 0, -1065353216), // CONSTx -4.000000
+    makeInstruction(486, static_cast<ByteCode>(0x0b), static_cast<InstructionType>(0x21), 488, 0, 0, 0), // EQUALxx
+    makeInstruction(488, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 494, 0, 0, 17), // CONSTx 17
+    makeInstruction(494, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 500, 0, 0, -17), // CONSTx -17
+    makeInstruction(500, static_cast<ByteCode>(0x0f), static_cast<InstructionType>(0x20), 502, 0, 0, 0), // LTxx
+    makeInstruction(502, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 508, -4, 0, 0), // MOVESP
+    makeInstruction(508, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 514, 534, 0, 0), // JMP 00000216
+    makeInstruction(514, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 522, -20, 4, 0), // CPDOWNSP
+    makeInstruction(522, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 528, 0, 0, -2), // CONSTx -2
+    makeInstruction(528, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 534, -4, 0, 0), // MOVESP
+    makeInstruction(534, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 542, -16, 4, 0), // CPDOWNSP
+    makeInstruction(542, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 548, 0, 0, -1063780352), // CONSTx -4.750000
+    makeInstruction(548, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 554, 0, 0, -19), // CONSTx -19
+    makeInstruction(554, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 560, 0, 0, -1064304640), // CONSTx -4.500000
+    makeInstruction(560, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 566, 0, 0, 1087897600), // CONSTx 6.750000
+    makeInstruction(566, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 572, 0, 0, 1073741824), // CONSTx 2.000000
+    makeInstruction(572, static_cast<ByteCode>(0x0f), static_cast<InstructionType>(0x21), 574, 0, 0, 0), // LTxx
+    makeInstruction(574, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 582, -20, 4, 0), // CPDOWNSP
+    makeInstruction(582, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 588, -4, 0, 0), // MOVESP
+    makeInstruction(588, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 596, -12, 4, 0), // CPDOWNSP
+    makeInstruction(596, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 602, 0, 0, 7), // CONSTx 7
+    makeInstruction(602, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 608, -8, 0, 0), // MOVESP
+    makeInstruction(608, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 616, -8, 4, 0), // CPTOPSP
+    makeInstruction(616, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 622, 0, 0, 11), // CONSTx 11
+    makeInstruction(622, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 628, 0, 0, -15), // CONSTx -15
+    makeInstruction(628, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 634, -12, 0, 0), // MOVESP
+    makeInstruction(634, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 640, 0, 0, -5), // CONSTx -5
+    makeInstruction(640, static_cast<ByteCode>(0x18), static_cast<InstructionType>(0x20), 642, 0, 0, 0), // MODII
+    makeInstruction(642, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 648, -8, 0, 0), // MOVESP
+    makeInstruction(648, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 656, -16, 4, 0), // CPTOPSP
+    makeInstruction(656, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 662, 0, 0, 7), // CONSTx 7
+    makeInstruction(662, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 668, 711, 0, 0), // JZ 000002c7
+    makeInstruction(668, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 670, 0, 0, 0), // NOTI
+    makeInstruction(670, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 677, 0, 0, 0, "q\"z"), // CONSTx \"q\"z\"
+    makeInstruction(677, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 683, 0, 0, -2), // CONSTx -2
+    makeInstruction(683, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 689, 0, 0, -4), // CONSTx -4
+    makeInstruction(689, static_cast<ByteCode>(0x14), static_cast<InstructionType>(0x20), 691, 0, 0, 0), // ADDxx
+    makeInstruction(691, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 699, -16, 4, 0), // CPTOPSP
+    makeInstruction(699, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 705, -12, 0, 0), // MOVESP
+    makeInstruction(705, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 711, 733, 0, 0), // JMP 000002dd
+    makeInstruction(711, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 713, 0, 0, 0), // NOP
+    makeInstruction(713, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 719, 0, 0, -1063780352), // CONSTx -4.750000
+    makeInstruction(719, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 725, 0, 0, -1058537472), // CONSTx -7.250000
+    makeInstruction(725, static_cast<ByteCode>(0x0f), static_cast<InstructionType>(0x21), 727, 0, 0, 0), // LTxx
+    makeInstruction(727, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 733, -4, 0, 0), // MOVESP
+    makeInstruction(733, static_cast<ByteCode>(0x09), static_cast<InstructionType>(0x20), 735, 0, 0, 0), // EXCORII
+    makeInstruction(735, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 743, -12, 8, 0), // CPTOPSP
+    makeInstruction(743, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 751, -20, 4, 0), // CPTOPSP
+    makeInstruction(751, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 757, 0, 0, 3), // CONSTx 3
+    makeInstruction(757, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 763, 0, 0, 8), // CONSTx 8
+    makeInstruction(763, static_cast<ByteCode>(0x10), static_cast<InstructionType>(0x20), 765, 0, 0, 0), // LEQxx
+    makeInstruction(765, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 771, -8, 0, 0), // MOVESP
+    makeInstruction(771, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 773, 0, 0, 0), // NOP
+    makeInstruction(773, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 779, -12, 0, 0), // INCISP
+    makeInstruction(779, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 785, 0, 0, 0), // CONSTx 0
+    makeInstruction(785, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 791, 0, 0, 8), // CONSTx 8
+    makeInstruction(791, static_cast<ByteCode>(0x0c), static_cast<InstructionType>(0x20), 793, 0, 0, 0), // NEQUALxx
+    makeInstruction(793, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 799, 0, 0, 1080033280), // CONSTx 3.500000
+    makeInstruction(799, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x04), 801, 0, 0, 0), // NEGx
+    makeInstruction(801, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 807, 0, 0, -2), // CONSTx -2
+    makeInstruction(807, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 813, 0, 0, 4), // CONSTx 4
+    makeInstruction(813, static_cast<ByteCode>(0x12), static_cast<InstructionType>(0x20), 815, 0, 0, 0), // SHRIGHTII
+    makeInstruction(815, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 821, 0, 0, 1085276160), // CONSTx 5.500000
+    makeInstruction(821, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 827, 0, 0, 1082130432), // CONSTx 4.000000
+    makeInstruction(827, static_cast<ByteCode>(0x0d), static_cast<InstructionType>(0x21), 829, 0, 0, 0), // GEQxx
+    makeInstruction(829, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 837, -12, 8, 0), // CPTOPSP
+    makeInstruction(837, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 845, -24, 4, 0), // CPDOWNSP
+    makeInstruction(845, static_cast<ByteCode>(0x25), static_cast<InstructionType>(0x00), 851, 872, 0, 0), // JNZ 00000368
+    makeInstruction(851, static_cast<ByteCode>(0x2d), static_cast<InstructionType>(0x00), 853, 0, 0, 0), // NOP
+    makeInstruction(853, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 860, 0, 0, 0, "q\"z"), // CONSTx \"q\"z\"
+    makeInstruction(860, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 866, -4, 0, 0), // MOVESP
+    makeInstruction(866, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 872, 898, 0, 0), // JMP 00000382
+    makeInstruction(872, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 878, -8, 0, 0), // DECISP
+    makeInstruction(878, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 884, 0, 0, -13), // CONSTx -13
+    makeInstruction(884, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 890, 0, 0, 8), // CONSTx 8
+    makeInstruction(890, static_cast<ByteCode>(0x08), static_cast<InstructionType>(0x20), 892, 0, 0, 0), // INCORII
+    makeInstruction(892, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 898, -4, 0, 0), // MOVESP
+    makeInstruction(898, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 904, 0, 0, -5), // CONSTx -5
+    makeInstruction(904, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 910, 0, 0, 18), // CONSTx 18
+    makeInstruction(910, static_cast<ByteCode>(0x16), static_cast<InstructionType>(0x20), 912, 0, 0, 0), // MULxx
+    makeInstruction(912, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 918, 0, 0, -8), // CONSTx -8
+    makeInstruction(918, static_cast<ByteCode>(0x18), static_cast<InstructionType>(0x20), 920, 0, 0, 0), // MODII
+    makeInstruction(920, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 928, -24, 4, 0), // CPDOWNSP
+    makeInstruction(928, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 934, -8, 0, 0), // MOVESP
+    makeInstruction(934, static_cast<ByteCode>(0x16), static_cast<InstructionType>(0x20), 936, 0, 0, 0), // MULxx
+    makeInstruction(936, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x03), 938, 0, 0, 0), // NEGx
+    makeInstruction(938, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 944, -8, 0, 0), // MOVESP
+    makeInstruction(944, static_cast<ByteCode>(0x22), static_cast<InstructionType>(0x03), 946, 0, 0, 0), // NOTI
+    makeInstruction(946, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 952, 0, 0, -1058013184), // CONSTx -7.500000
+    makeInstruction(952, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 959, 0, 0, 0, "q\"z"), // CONSTx \"q\"z\"
+    makeInstruction(959, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 965, 0, 0, 1065353216), // CONSTx 1.000000
+    makeInstruction(965, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 971, 0, 0, -1058013184), // CONSTx -7.500000
+    makeInstruction(971, static_cast<ByteCode>(0x14), static_cast<InstructionType>(0x21), 973, 0, 0, 0), // ADDxx
+    makeInstruction(973, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 979, 0, 0, 6), // CONSTx 6
+    makeInstruction(979, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 985, 0, 0, 10), // CONSTx 10
+    makeInstruction(985, static_cast<ByteCode>(0x0e), static_cast<InstructionType>(0x20), 987, 0, 0, 0), // GTxx
+    makeInstruction(987, static_cast<ByteCode>(0x24), static_cast<InstructionType>(0x03), 993, -4, 0, 0), // INCISP
+    makeInstruction(993, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 1001, -16, 4, 0), // CPTOPSP
+    makeInstruction(1001, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 1009, -12, 4, 0), // CPDOWNSP
+    makeInstruction(1009, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 1015, -8, 0, 0), // MOVESP
+    makeInstruction(1015, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 1021, -16, 0, 0), // DECISP
+    makeInstruction(1021, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 1027, 0, 0, -9), // CONSTx -9
+    makeInstruction(1027, static_cast<ByteCode>(0x25), static_cast<InstructionType>(0x00), 1033, 1047, 0, 0), // JNZ 00000417
+    makeInstruction(1033, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 1041, -20, 4, 0), // CPDOWNSP
+    makeInstruction(1041, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 1047, 1091, 0, 0), // JMP 00000443
+    makeInstruction(1047, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 1053, 0, 0, 12), // CONSTx 12
+    makeInstruction(1053, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 1059, 0, 0, 1), // CONSTx 1
+    makeInstruction(1059, static_cast<ByteCode>(0x12), static_cast<InstructionType>(0x20), 1061, 0, 0, 0), // SHRIGHTII
+    makeInstruction(1061, static_cast<ByteCode>(0x19), static_cast<InstructionType>(0x03), 1063, 0, 0, 0), // NEGx
+    makeInstruction(1063, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 1069, 0, 0, -20), // CONSTx -20
+    makeInstruction(1069, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 1075, 0, 0, -15), // CONSTx -15
+    makeInstruction(1075, static_cast<ByteCode>(0x08), static_cast<InstructionType>(0x20), 1077, 0, 0, 0), // INCORII
+    makeInstruction(1077, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 1085, -24, 4, 0), // CPDOWNSP
+    makeInstruction(1085, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 1091, -8, 0, 0), // MOVESP
+    makeInstruction(1091, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 1097, 0, 0, 3), // CONSTx 3
+    makeInstruction(1097, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 1103, 0, 0, -6), // CONSTx -6
+    makeInstruction(1103, static_cast<ByteCode>(0x0b), static_cast<InstructionType>(0x20), 1105, 0, 0, 0), // EQUALxx
+    makeInstruction(1105, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 1111, 0, 0, -17), // CONSTx -17
+    makeInstruction(1111, static_cast<ByteCode>(0x20), static_cast<InstructionType>(0x00), 1113, 0, 0, 0) // RETN
+};
+
+extern "C" REONE_NATIVE_SCRIPT_EXPORT bool reone_ncs_test_corpus_4(IInstructionExecutor &exec, uint32_t offset) {
+    std::vector<Variable> &stack = exec.stack();
+    uint32_t instructionCount = 0;
+
+dispatch:
+    switch (offset) {
+        case 13: goto ins_13;
+        case 19: goto ins_19;
+        case 27: goto ins_27;
+        case 33: goto ins_33;
+        case 39: goto ins_39;
+        case 45: goto ins_45;
+        case 51: goto ins_51;
+        case 53: goto ins_53;
+        case 59: goto ins_59;
+        case 65: goto ins_65;
+        case 71: goto ins_71;
+        case 77: goto ins_77;
+        case 79: goto ins_79;
+        case 85: goto ins_85;
+        case 91: goto ins_91;
+        case 93: goto ins_93;
+        case 99: goto ins_99;
+        case 107: goto ins_107;
+        case 113: goto ins_113;
+        case 119: goto ins_119;
+        case 121: goto ins_121;
+        case 123: goto ins_123;
+        case 125: goto ins_125;
+        case 131: goto ins_131;
+        case 139: goto ins_139;
+        case 145: goto ins_145;
+        case 151: goto ins_151;
+        case 157: goto ins_157;
+        case 163: goto ins_163;
+        case 171: goto ins_171;
+        case 177: goto ins_177;
+        case 183: goto ins_183;
+        case 189: goto ins_189;
+        case 195: goto ins_195;
+        case 201: goto ins_201;
+        case 207: goto ins_207;
+        case 209: goto ins_209;
+        case 215: goto ins_215;
+        case 221: goto ins_221;
+        case 223: goto ins_223;
+        case 231: goto ins_231;
+        case 237: goto ins_237;
+        case 243: goto ins_243;
+        case 249: goto ins_249;
+        case 255: goto ins_255;
+        case 261: goto ins_261;
+        case 263: goto ins_263;
+        case 269: goto ins_269;
+        case 275: goto ins_275;
+        case 277: goto ins_277;
+        case 283: goto ins_283;
+        case 289: goto ins_289;
+        case 295: goto ins_295;
+        case 297: goto ins_297;
+        case 303: goto ins_303;
+        case 309: goto ins_309;
+        case 315: goto ins_315;
+        case 317: goto ins_317;
+        case 319: goto ins_319;
+        case 327: goto ins_327;
+        case 335: goto ins_335;
+        case 342: goto ins_342;
+        case 348: goto ins_348;
+        case 354: goto ins_354;
+        case 356: goto ins_356;
+        case 362: goto ins_362;
+        case 368: goto ins_368;
+        case 374: goto ins_374;
+        case 380: goto ins_380;
+        case 388: goto ins_388;
+        case 390: goto ins_390;
+        case 396: goto ins_396;
+        case 398: goto ins_398;
+        case 404: goto ins_404;
+        case 410: goto ins_410;
+        case 416: goto ins_416;
+        case 418: goto ins_418;
+        case 424: goto ins_424;
+        case 430: goto ins_430;
+        case 436: goto ins_436;
+        case 442: goto ins_442;
+        case 448: goto ins_448;
+        case 454: goto ins_454;
+        case 460: goto ins_460;
+        case 462: goto ins_462;
+        case 468: goto ins_468;
+        case 474: goto ins_474;
+        case 480: goto ins_480;
+        case 486: goto ins_486;
+        case 488: goto ins_488;
+        case 494: goto ins_494;
+        case 500: goto ins_500;
+        case 502: goto ins_502;
+        case 508: goto ins_508;
+        case 514: goto ins_514;
+        case 522: goto ins_522;
+        case 528: goto ins_528;
+        case 534: goto ins_534;
+        case 542: goto ins_542;
+        case 548: goto ins_548;
+        case 554: goto ins_554;
+        case 560: goto ins_560;
+        case 566: goto ins_566;
+        case 572: goto ins_572;
+        case 574: goto ins_574;
+        case 582: goto ins_582;
+        case 588: goto ins_588;
+        case 596: goto ins_596;
+        case 602: goto ins_602;
+        case 608: goto ins_608;
+        case 616: goto ins_616;
+        case 622: goto ins_622;
+        case 628: goto ins_628;
+        case 634: goto ins_634;
+        case 640: goto ins_640;
+        case 642: goto ins_642;
+        case 648: goto ins_648;
+        case 656: goto ins_656;
+        case 662: goto ins_662;
+        case 668: goto ins_668;
+        case 670: goto ins_670;
+        case 677: goto ins_677;
+        case 683: goto ins_683;
+        case 689: goto ins_689;
+        case 691: goto ins_691;
+        case 699: goto ins_699;
+        case 705: goto ins_705;
+        case 711: goto ins_711;
+        case 713: goto ins_713;
+        case 719: goto ins_719;
+        case 725: goto ins_725;
+        case 727: goto ins_727;
+        case 733: goto ins_733;
+        case 735: goto ins_735;
+        case 743: goto ins_743;
+        case 751: goto ins_751;
+        case 757: goto ins_757;
+        case 763: goto ins_763;
+        case 765: goto ins_765;
+        case 771: goto ins_771;
+        case 773: goto ins_773;
+        case 779: goto ins_779;
+        case 785: goto ins_785;
+        case 791: goto ins_791;
+        case 793: goto ins_793;
+        case 799: goto ins_799;
+        case 801: goto ins_801;
+        case 807: goto ins_807;
+        case 813: goto ins_813;
+        case 815: goto ins_815;
+        case 821: goto ins_821;
+        case 827: goto ins_827;
+        case 829: goto ins_829;
+        case 837: goto ins_837;
+        case 845: goto ins_845;
+        case 851: goto ins_851;
+        case 853: goto ins_853;
+        case 860: goto ins_860;
+        case 866: goto ins_866;
+        case 872: goto ins_872;
+        case 878: goto ins_878;
+        case 884: goto ins_884;
+        case 890: goto ins_890;
+        case 892: goto ins_892;
+        case 898: goto ins_898;
+        case 904: goto ins_904;
+        case 910: goto ins_910;
+        case 912: goto ins_912;
+        case 918: goto ins_918;
+        case 920: goto ins_920;
+        case 928: goto ins_928;
+        case 934: goto ins_934;
+        case 936: goto ins_936;
+        case 938: goto ins_938;
+        case 944: goto ins_944;
+        case 946: goto ins_946;
+        case 952: goto ins_952;
+        case 959: goto ins_959;
+        case 965: goto ins_965;
+        case 971: goto ins_971;
+        case 973: goto ins_973;
+        case 979: goto ins_979;
+        case 985: goto ins_985;
+        case 987: goto ins_987;
+        case 993: goto ins_993;
+        case 1001: goto ins_1001;
+        case 1009: goto ins_1009;
+        case 1015: goto ins_1015;
+        case 1021: goto ins_1021;
+        case 1027: goto ins_1027;
+        case 1033: goto ins_1033;
+        case 1041: goto ins_1041;
+        case 1047: goto ins_1047;
+        case 1053: goto ins_1053;
+        case 1059: goto ins_1059;
+        case 1061: goto ins_1061;
+        case 1063: goto ins_1063;
+        case 1069: goto ins_1069;
+        case 1075: goto ins_1075;
+        case 1077: goto ins_1077;
+        case 1085: goto ins_1085;
+        case 1091: goto ins_1091;
+        case 1097: goto ins_1097;
+        case 1103: goto ins_1103;
+        case 1105: goto ins_1105;
+        case 1111: goto ins_1111;
+        default:
+            exec.countInstructions(instructionCount);
+            return offset >= kLength;
+    }
+
+ins_13:
+    stack.push_back(Variable(10));
+    ++instructionCount;
+
+ins_19:
+    stack.push_back(stack[stack.size() - 1]);
+    ++instructionCount;
+
+ins_27:
+    stack.push_back(Variable(g_instructions[2].floatValue));
+    ++instructionCount;
+
+ins_33:
+    stack.push_back(Variable(16));
+    ++instructionCount;
+
+ins_39:
+    stack.push_back(Variable(g_instructions[4].floatValue));
+    ++instructionCount;
+
+ins_45:
+    stack.push_back(Variable(g_instructions[5].floatValue));
+    ++instructionCount;
+
+ins_51:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue * stack.back().floatValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_53:
+    {
+        size_t dst = stack.size() - 4;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_59:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_65:
+    stack.push_back(Variable(-17));
+    ++instructionCount;
+
+ins_71:
+    stack.push_back(Variable(-7));
+    ++instructionCount;
+
+ins_77:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue != stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_79:
+    stack.push_back(Variable(20));
+    ++instructionCount;
+
+ins_85:
+    stack.push_back(Variable(19));
+    ++instructionCount;
+
+ins_91:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue * stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_93:
+    stack.push_back(Variable(g_instructions[15].floatValue));
+    ++instructionCount;
+
+ins_99:
+    {
+        size_t dst = stack.size() - 4;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_107:
+    stack.push_back(Variable(-7));
+    ++instructionCount;
+
+ins_113:
+    stack.push_back(Variable(-17));
+    ++instructionCount;
+
+ins_119:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue | stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_121:
+    stack.back() = Variable(-stack.back().intValue);
+    ++instructionCount;
+
+ins_123:
+    ++instructionCount;
+
+ins_125:
+    stack.push_back(Variable(7));
+    ++instructionCount;
+
+ins_131:
+    {
+        size_t dst = stack.size() - 2;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_139:
+    stack.push_back(Variable(g_instructions[24].floatValue));
+    ++instructionCount;
+
+ins_145:
+    stack.push_back(Variable(-4));
+    ++instructionCount;
+
+ins_151:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_195;
+        }
+    }
+
+ins_157:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_163:
+    stack.push_back(stack[stack.size() - 2]);
+    ++instructionCount;
+
+ins_171:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_177:
+    stack.push_back(Variable(g_instructions[30].floatValue));
+    ++instructionCount;
+
+ins_183:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_189:
+    ++instructionCount;
+    goto ins_303;
+
+ins_195:
+    stack.push_back(Variable(-18));
+    ++instructionCount;
+
+ins_201:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (!zero) {
+            goto ins_243;
+        }
+    }
+
+ins_207:
+    ++instructionCount;
+
+ins_209:
+    stack.push_back(Variable(g_instructions[36].floatValue));
+    ++instructionCount;
+
+ins_215:
+    stack.push_back(Variable(g_instructions[37].floatValue));
+    ++instructionCount;
+
+ins_221:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue != stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_223:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_231:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_237:
+    ++instructionCount;
+    goto ins_269;
+
+ins_243:
+    stack.push_back(Variable(g_instructions[42].floatValue));
+    ++instructionCount;
+
+ins_249:
+    stack.push_back(Variable(-16));
+    ++instructionCount;
+
+ins_255:
+    stack.push_back(Variable(-18));
+    ++instructionCount;
+
+ins_261:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue || stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_263:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_269:
+    stack.push_back(Variable(0));
+    ++instructionCount;
+
+ins_275:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_277:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_283:
+    stack.push_back(Variable(15));
+    ++instructionCount;
+
+ins_289:
+    stack.push_back(Variable(4));
+    ++instructionCount;
+
+ins_295:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue || stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_297:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_303:
+    stack.push_back(Variable(-3));
+    ++instructionCount;
+
+ins_309:
+    stack.push_back(Variable(1));
+    ++instructionCount;
+
+ins_315:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue <= stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_317:
+    ++instructionCount;
+
+ins_319:
+    stack.push_back(stack[stack.size() - 6]);
+    ++instructionCount;
+
+ins_327:
+    for (size_t src = stack.size() - 5, end = src + 2; src < end; ++src) {
+        stack.push_back(stack[src]);
+    }
+    ++instructionCount;
+
+ins_335:
+    stack.push_back(Variable(g_instructions[60].strValue));
+    ++instructionCount;
+
+ins_342:
+    stack.push_back(Variable(g_instructions[61].floatValue));
+    ++instructionCount;
+
+ins_348:
+    stack.push_back(Variable(g_instructions[62].floatValue));
+    ++instructionCount;
+
+ins_354:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue / stack.back().floatValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_356:
+    stack.push_back(Variable(g_instructions[64].floatValue));
+    ++instructionCount;
+
+ins_362:
+    stack.push_back(Variable(16));
+    ++instructionCount;
+
+ins_368:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_410;
+        }
+    }
+
+ins_374:
+    stack.push_back(Variable(-3));
+    ++instructionCount;
+
+ins_380:
+    stack.push_back(stack[stack.size() - 1]);
+    ++instructionCount;
+
+ins_388:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_390:
+    stack.push_back(Variable(1));
+    ++instructionCount;
+
+ins_396:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue / stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_398:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_404:
+    ++instructionCount;
+    goto ins_436;
+
+ins_410:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_416:
+    stack.back() = Variable(-stack.back().floatValue);
+    ++instructionCount;
+
+ins_418:
+    stack.push_back(Variable(g_instructions[76].floatValue));
+    ++instructionCount;
+
+ins_424:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_430:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_436:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_442:
+    stack.push_back(Variable(7));
+    ++instructionCount;
+
+ins_448:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_468;
+        }
+    }
+
+ins_454:
+    stack.push_back(Variable(g_instructions[82].floatValue));
+    ++instructionCount;
+
+ins_460:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue / stack.back().floatValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_462:
+    ++instructionCount;
+    goto ins_542;
+
+ins_468:
+    stack.push_back(Variable(-15));
+    ++instructionCount;
+
+ins_474:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_514;
+        }
+    }
+
+ins_480:
+    stack.push_back(Variable(g_instructions[87].floatValue));
+    ++instructionCount;
+
+ins_486:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue == stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_488:
+    stack.push_back(Variable(17));
+    ++instructionCount;
+
+ins_494:
+    stack.push_back(Variable(-17));
+    ++instructionCount;
+
+ins_500:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue < stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_502:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_508:
+    ++instructionCount;
+    goto ins_534;
+
+ins_514:
+    {
+        size_t dst = stack.size() - 5;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_522:
+    stack.push_back(Variable(-2));
+    ++instructionCount;
+
+ins_528:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_534:
+    {
+        size_t dst = stack.size() - 4;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_542:
+    stack.push_back(Variable(g_instructions[98].floatValue));
+    ++instructionCount;
+
+ins_548:
+    stack.push_back(Variable(-19));
+    ++instructionCount;
+
+ins_554:
+    stack.push_back(Variable(g_instructions[100].floatValue));
+    ++instructionCount;
+
+ins_560:
+    stack.push_back(Variable(g_instructions[101].floatValue));
+    ++instructionCount;
+
+ins_566:
+    stack.push_back(Variable(g_instructions[102].floatValue));
+    ++instructionCount;
+
+ins_572:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue < stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_574:
+    {
+        size_t dst = stack.size() - 5;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_582:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_588:
+    {
+        size_t dst = stack.size() - 3;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_596:
+    stack.push_back(Variable(7));
+    ++instructionCount;
+
+ins_602:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_608:
+    stack.push_back(stack[stack.size() - 2]);
+    ++instructionCount;
+
+ins_616:
+    stack.push_back(Variable(11));
+    ++instructionCount;
+
+ins_622:
+    stack.push_back(Variable(-15));
+    ++instructionCount;
+
+ins_628:
+    stack.erase(stack.end() - 3, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_634:
+    stack.push_back(Variable(-5));
+    ++instructionCount;
+
+ins_640:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue % stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_642:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_648:
+    stack.push_back(stack[stack.size() - 4]);
+    ++instructionCount;
+
+ins_656:
+    stack.push_back(Variable(7));
+    ++instructionCount;
+
+ins_662:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_711;
+        }
+    }
+
+ins_668:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_670:
+    stack.push_back(Variable(g_instructions[120].strValue));
+    ++instructionCount;
+
+ins_677:
+    stack.push_back(Variable(-2));
+    ++instructionCount;
+
+ins_683:
+    stack.push_back(Variable(-4));
+    ++instructionCount;
+
+ins_689:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue + stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_691:
+    stack.push_back(stack[stack.size() - 4]);
+    ++instructionCount;
+
+ins_699:
+    stack.erase(stack.end() - 3, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_705:
+    ++instructionCount;
+    goto ins_733;
+
+ins_711:
+    ++instructionCount;
+
+ins_713:
+    stack.push_back(Variable(g_instructions[128].floatValue));
+    ++instructionCount;
+
+ins_719:
+    stack.push_back(Variable(g_instructions[129].floatValue));
+    ++instructionCount;
+
+ins_725:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue < stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_727:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_733:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue ^ stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_735:
+    for (size_t src = stack.size() - 3, end = src + 2; src < end; ++src) {
+        stack.push_back(stack[src]);
+    }
+    ++instructionCount;
+
+ins_743:
+    stack.push_back(stack[stack.size() - 5]);
+    ++instructionCount;
+
+ins_751:
+    stack.push_back(Variable(3));
+    ++instructionCount;
+
+ins_757:
+    stack.push_back(Variable(8));
+    ++instructionCount;
+
+ins_763:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue <= stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_765:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_771:
+    ++instructionCount;
+
+ins_773:
+    {
+        size_t dst = stack.size() - 3;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_779:
+    stack.push_back(Variable(0));
+    ++instructionCount;
+
+ins_785:
+    stack.push_back(Variable(8));
+    ++instructionCount;
+
+ins_791:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue != stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_793:
+    stack.push_back(Variable(g_instructions[144].floatValue));
+    ++instructionCount;
+
+ins_799:
+    stack.back() = Variable(-stack.back().floatValue);
+    ++instructionCount;
+
+ins_801:
+    stack.push_back(Variable(-2));
+    ++instructionCount;
+
+ins_807:
+    stack.push_back(Variable(4));
+    ++instructionCount;
+
+ins_813:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue >> stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_815:
+    stack.push_back(Variable(g_instructions[149].floatValue));
+    ++instructionCount;
+
+ins_821:
+    stack.push_back(Variable(g_instructions[150].floatValue));
+    ++instructionCount;
+
+ins_827:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue >= stack.back().floatValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_829:
+    for (size_t src = stack.size() - 3, end = src + 2; src < end; ++src) {
+        stack.push_back(stack[src]);
+    }
+    ++instructionCount;
+
+ins_837:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_845:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (!zero) {
+            goto ins_872;
+        }
+    }
+
+ins_851:
+    ++instructionCount;
+
+ins_853:
+    stack.push_back(Variable(g_instructions[156].strValue));
+    ++instructionCount;
+
+ins_860:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_866:
+    ++instructionCount;
+    goto ins_898;
+
+ins_872:
+    {
+        size_t dst = stack.size() - 2;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_878:
+    stack.push_back(Variable(-13));
+    ++instructionCount;
+
+ins_884:
+    stack.push_back(Variable(8));
+    ++instructionCount;
+
+ins_890:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue | stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_892:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_898:
+    stack.push_back(Variable(-5));
+    ++instructionCount;
+
+ins_904:
+    stack.push_back(Variable(18));
+    ++instructionCount;
+
+ins_910:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue * stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_912:
+    stack.push_back(Variable(-8));
+    ++instructionCount;
+
+ins_918:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue % stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_920:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_928:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_934:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue * stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_936:
+    stack.back() = Variable(-stack.back().intValue);
+    ++instructionCount;
+
+ins_938:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_944:
+    stack.back() = Variable(stack.back().intValue == 0 ? 1 : 0);
+    ++instructionCount;
+
+ins_946:
+    stack.push_back(Variable(g_instructions[175].floatValue));
+    ++instructionCount;
+
+ins_952:
+    stack.push_back(Variable(g_instructions[176].strValue));
+    ++instructionCount;
+
+ins_959:
+    stack.push_back(Variable(g_instructions[177].floatValue));
+    ++instructionCount;
+
+ins_965:
+    stack.push_back(Variable(g_instructions[178].floatValue));
+    ++instructionCount;
+
+ins_971:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].floatValue + stack.back().floatValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_973:
+    stack.push_back(Variable(6));
+    ++instructionCount;
+
+ins_979:
+    stack.push_back(Variable(10));
+    ++instructionCount;
+
+ins_985:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue > stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_987:
+    {
+        size_t dst = stack.size() - 1;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue++;
+    }
+    ++instructionCount;
+
+ins_993:
+    stack.push_back(stack[stack.size() - 4]);
+    ++instructionCount;
+
+ins_1001:
+    {
+        size_t dst = stack.size() - 3;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_1009:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_1015:
+    {
+        size_t dst = stack.size() - 4;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_1021:
+    stack.push_back(Variable(-9));
+    ++instructionCount;
+
+ins_1027:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (!zero) {
+            goto ins_1047;
+        }
+    }
+
+ins_1033:
+    {
+        size_t dst = stack.size() - 5;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_1041:
+    ++instructionCount;
+    goto ins_1091;
+
+ins_1047:
+    stack.push_back(Variable(12));
+    ++instructionCount;
+
+ins_1053:
+    stack.push_back(Variable(1));
+    ++instructionCount;
+
+ins_1059:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue >> stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_1061:
+    stack.back() = Variable(-stack.back().intValue);
+    ++instructionCount;
+
+ins_1063:
+    stack.push_back(Variable(-20));
+    ++instructionCount;
+
+ins_1069:
+    stack.push_back(Variable(-15));
+    ++instructionCount;
+
+ins_1075:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue | stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_1077:
+    {
+        size_t dst = stack.size() - 6;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_1085:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_1091:
+    stack.push_back(Variable(3));
+    ++instructionCount;
+
+ins_1097:
+    stack.push_back(Variable(-6));
+    ++instructionCount;
+
+ins_1103:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue == stack.back().intValue ? 1 : 0);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_1105:
+    stack.push_back(Variable(-17));
+    ++instructionCount;
+
+ins_1111:
+    exec.executeInstruction(g_instructions[205]);
+    offset = exec.nextInstruction();
+    goto dispatch;
+
+    exec.countInstructions(instructionCount);
+    return true;
+}
@@ -0,0 +1,153 @@
+// Generated by reone-tools from test_sum. Do not edit.
+
+#include "script/native.h"
+
+using namespace reone::script;
+
+static const uint32_t kLength = 118;
+
+static const Instruction g_instructions[] = {
+    makeInstruction(13, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x04), 19, 0, 0, 1069547520), // CONSTx 1.500000
+    makeInstruction(19, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x05), 26, 0, 0, 0, "a\"b"), // CONSTx \"a\"b\"
+    makeInstruction(26, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 32, -8, 0, 0), // MOVESP
+    makeInstruction(32, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 38, 0, 0, 0), // CONSTx 0
+    makeInstruction(38, static_cast<ByteCode>(0x04), static_cast<InstructionType>(0x03), 44, 0, 0, 4), // CONSTx 4
+    makeInstruction(44, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 52, -4, 4, 0), // CPTOPSP
+    makeInstruction(52, static_cast<ByteCode>(0x1f), static_cast<InstructionType>(0x00), 58, 106, 0, 0), // JZ 0000006a
+    makeInstruction(58, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 66, -8, 4, 0), // CPTOPSP
+    makeInstruction(66, static_cast<ByteCode>(0x03), static_cast<InstructionType>(0x01), 74, -8, 4, 0), // CPTOPSP
+    makeInstruction(74, static_cast<ByteCode>(0x1e), static_cast<InstructionType>(0x00), 80, 114, 0, 0), // JSR 00000072
+    makeInstruction(80, static_cast<ByteCode>(0x01), static_cast<InstructionType>(0x01), 88, -12, 4, 0), // CPDOWNSP
+    makeInstruction(88, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 94, -4, 0, 0), // MOVESP
+    makeInstruction(94, static_cast<ByteCode>(0x23), static_cast<InstructionType>(0x03), 100, -4, 0, 0), // DECISP
+    makeInstruction(100, static_cast<ByteCode>(0x1d), static_cast<InstructionType>(0x00), 106, 44, 0, 0), // JMP 0000002c
+    makeInstruction(106, static_cast<ByteCode>(0x1b), static_cast<InstructionType>(0x00), 112, -4, 0, 0), // MOVESP
+    makeInstruction(112, static_cast<ByteCode>(0x20), static_cast<InstructionType>(0x00), 114, 0, 0, 0), // RETN
+    makeInstruction(114, static_cast<ByteCode>(0x14), static_cast<InstructionType>(0x20), 116, 0, 0, 0), // ADDxx
+    makeInstruction(116, static_cast<ByteCode>(0x20), static_cast<InstructionType>(0x00), 118, 0, 0, 0) // RETN
+};
+
+extern "C" REONE_NATIVE_SCRIPT_EXPORT bool reone_ncs_test_sum(IInstructionExecutor &exec, uint32_t offset) {
+    std::vector<Variable> &stack = exec.stack();
+    uint32_t instructionCount = 0;
+
+dispatch:
+    switch (offset) {
+        case 13: goto ins_13;
+        case 19: goto ins_19;
+        case 26: goto ins_26;
+        case 32: goto ins_32;
+        case 38: goto ins_38;
+        case 44: goto ins_44;
+        case 52: goto ins_52;
+        case 58: goto ins_58;
+        case 66: goto ins_66;
+        case 74: goto ins_74;
+        case 80: goto ins_80;
+        case 88: goto ins_88;
+        case 94: goto ins_94;
+        case 100: goto ins_100;
+        case 106: goto ins_106;
+        case 112: goto ins_112;
+        case 114: goto ins_114;
+        case 116: goto ins_116;
+        default:
+            exec.countInstructions(instructionCount);
+            return offset >= kLength;
+    }
+
+ins_13:
+    stack.push_back(Variable(g_instructions[0].floatValue));
+    ++instructionCount;
+
+ins_19:
+    stack.push_back(Variable(g_instructions[1].strValue));
+    ++instructionCount;
+
+ins_26:
+    stack.erase(stack.end() - 2, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_32:
+    stack.push_back(Variable(0));
+    ++instructionCount;
+
+ins_38:
+    stack.push_back(Variable(4));
+    ++instructionCount;
+
+ins_44:
+    stack.push_back(stack[stack.size() - 1]);
+    ++instructionCount;
+
+ins_52:
+    ++instructionCount;
+    {
+        bool zero = stack.back().intValue == 0;
+        stack.pop_back();
+        if (zero) {
+            goto ins_106;
+        }
+    }
+
+ins_58:
+    stack.push_back(stack[stack.size() - 2]);
+    ++instructionCount;
+
+ins_66:
+    stack.push_back(stack[stack.size() - 2]);
+    ++instructionCount;
+
+ins_74:
+    exec.executeInstruction(g_instructions[9]);
+    goto ins_114;
+
+ins_80:
+    {
+        size_t dst = stack.size() - 3;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst] = stack.back();
+    }
+    ++instructionCount;
+
+ins_88:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_94:
+    {
+        size_t dst = stack.size() - 1;
+        exec.invalidateSavedGlobals(static_cast<int>(dst));
+        stack[dst].intValue--;
+    }
+    ++instructionCount;
+
+ins_100:
+    ++instructionCount;
+    goto ins_44;
+
+ins_106:
+    stack.erase(stack.end() - 1, stack.end());
+    exec.invalidateSavedGlobals(static_cast<int>(stack.size()));
+    ++instructionCount;
+
+ins_112:
+    exec.executeInstruction(g_instructions[15]);
+    offset = exec.nextInstruction();
+    goto dispatch;
+
+ins_114:
+    stack[stack.size() - 2] = Variable(stack[stack.size() - 2].intValue + stack.back().intValue);
+    stack.pop_back();
+    ++instructionCount;
+
+ins_116:
+    exec.executeInstruction(g_instructions[17]);
+    offset = exec.nextInstruction();
+    goto dispatch;
+
+    exec.countInstructions(instructionCount);
+    return true;
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE nulldevice
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "GL/glew.h"
+
+#include "../src/render/device/null.h"
+#include "../src/render/instancebuffer.h"
+#include "../src/render/mesh/mesh.h"
+#include "../src/render/renderqueue.h"
+#include "../src/render/renderstate.h"
+#include "../src/render/shaders.h"
+
+using namespace std;
+
+using namespace reone::render;
+
+class TestMesh : public Mesh {
+public:
+    TestMesh(int quadCount) {
+        for (int i = 0; i < quadCount; ++i) {
+            float x = static_cast<float>(i);
+            uint16_t base = static_cast<uint16_t>(4 * i);
+            _vertices.insert(_vertices.end(), {
+                x, 0.0f, 0.0f, 0.0f, 0.0f,
+                x + 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+                x + 1.0f, 1.0f, 0.0f, 1.0f, 1.0f,
+                x, 1.0f, 0.0f, 0.0f, 1.0f
+            });
+            _indices.insert(_indices.end(), { base, static_cast<uint16_t>(base + 1), static_cast<uint16_t>(base + 2), static_cast<uint16_t>(base + 2), static_cast<uint16_t>(base + 3), base });
+        }
+        _offsets.texCoords1 = 3 * sizeof(float);
+        _offsets.stride = 5 * sizeof(float);
+    }
+};
+
+class TestDrawable : public IDrawable {
+public:
+    TestDrawable(const Mesh *mesh) : _mesh(mesh) {
+    }
+
+    void draw() const override {
+        _mesh->drawTriangles();
+    }
+
+    void drawInstanced(int count) const override {
+        _mesh->drawTrianglesInstanced(count);
+    }
+
+private:
+    const Mesh *_mesh;
+};
+
+/**
+ * Makes the null device current for the lifetime of a test.
+ */
+struct NullDeviceFixture {
+    NullGraphicsDevice *device { nullptr };
+
+    NullDeviceFixture() {
+        auto nullDevice = make_unique<NullGraphicsDevice>(800, 600);
+        device = nullDevice.get();
+        setGraphicsDevice(move(nullDevice));
+    }
+
+    ~NullDeviceFixture() {
+        Shaders::instance().deinitGL();
+        InstanceBuffer::instance().deinitGL();
+        setGraphicsDevice(nullptr);
+    }
+
+    int count(GraphicsCommandType type) const {
+        return static_cast<int>(count_if(device->commands().begin(), device->commands().end(), [&type](auto &command) {
+            return command.type == type;
+        }));
+    }
+
+    size_t bytes(GraphicsCommandType type) const {
+        size_t result = 0;
+        for (auto &command : device->commands()) {
+            if (command.type == type) {
+                result += command.bytes;
+            }
+        }
+        return result;
+    }
+
+    vector<GraphicsCommand> draws() const {
+        vector<GraphicsCommand> result;
+        copy_if(device->commands().begin(), device->commands().end(), back_inserter(result), [](auto &command) {
+            return command.type == GraphicsCommandType::Draw;
+        });
+        return move(result);
+    }
+};
+
+BOOST_FIXTURE_TEST_CASE(test_mesh_commands_are_recorded, NullDeviceFixture) {
+    TestMesh mesh(2);
+    mesh.initGL();
+
+    BOOST_TEST(count(GraphicsCommandType::Create) == 3); // vertex array, vertex and index buffers
+    BOOST_TEST(bytes(GraphicsCommandType::UploadBuffer) == 40 * sizeof(float) + 12 * sizeof(uint16_t));
+
+    device->clearCommands();
+    mesh.renderTriangles();
+
+    vector<GraphicsCommand> recorded(draws());
+    BOOST_REQUIRE(recorded.size() == 1u);
+    BOOST_TEST(recorded[0].target == static_cast<uint32_t>(GL_TRIANGLES));
+    BOOST_TEST(recorded[0].count == 12);
+    BOOST_TEST(recorded[0].instanceCount == 1);
+
+    device->clearCommands();
+    mesh.deinitGL();
+
+    BOOST_TEST(count(GraphicsCommandType::Delete) == 3);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_render_queue_draws_are_recorded, NullDeviceFixture) {
+    RenderState::instance().initGL();
+    Shaders::instance().initGL();
+    InstanceBuffer::instance().initGL();
+
+    TestMesh quad(1);
+    TestMesh strip(3);
+    quad.initGL();
+    strip.initGL();
+
+    vector<unique_ptr<TestDrawable>> drawables;
+    RenderQueue queue;
+
+    // Three instances of one mesh and a single draw of another
+    for (int i = 0; i < 4; ++i) {
+        const Mesh *mesh = i < 3 ? static_cast<const Mesh *>(&quad) : &strip;
+        drawables.push_back(make_unique<TestDrawable>(mesh));
+
+        DrawItem item;
+        item.program = ShaderProgram::ModelModel;
+        item.mesh = mesh;
+        item.drawable = drawables.back().get();
+        item.instanceState = 1;
+        queue.add(RenderPass::Opaque, item, static_cast<float>(i));
+    }
+    queue.prepare();
+
+    device->clearCommands();
+    queue.render();
+
+    vector<GraphicsCommand> recorded(draws());
+    BOOST_REQUIRE(recorded.size() == 2u);
+    BOOST_TEST(static_cast<int>(recorded.size()) == queue.stats().drawCalls);
+    BOOST_TEST(recorded[0].count + recorded[1].count == 6 + 18);
+    BOOST_TEST(recorded[0].instanceCount * recorded[1].instanceCount == 3);
+    BOOST_TEST(bytes(GraphicsCommandType::UploadBuffer) == 3 * sizeof(InstanceData));
+    BOOST_TEST(count(GraphicsCommandType::UseProgram) == 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_frames_are_logged_separately, NullDeviceFixture) {
+    TestMesh mesh(1);
+    mesh.initGL();
+    mesh.renderTriangles();
+    device->endFrame();
+
+    BOOST_TEST(device->frameCount() == 1);
+    BOOST_TEST(device->commands().empty());
+    BOOST_TEST(!device->lastFrameCommands().empty());
+
+    mesh.renderTriangles();
+    device->endFrame();
+
+    BOOST_TEST(device->frameCount() == 2);
+    BOOST_TEST(device->lastFrameCommands().size() == 1u);
+    BOOST_TEST((device->lastFrameCommands()[0].type == GraphicsCommandType::Draw));
+}
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE octree
+
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "glm/gtc/matrix_transform.hpp"
+
+#include "../src/scene/cameranode.h"
+#include "../src/scene/octree.h"
+
+using namespace std;
+
+using namespace reone::render;
+using namespace reone::scene;
+
+static const int kObjectCount = 500;
+static const float kAreaSize = 200.0f;
+
+class TestSceneNode : public SceneNode {
+public:
+    TestSceneNode() : SceneNode(nullptr) {
+    }
+};
+
+struct TestScene {
+    vector<unique_ptr<TestSceneNode>> sceneNodes;
+    vector<AABB> aabbs;
+    Octree octree;
+};
+
+static AABB makeAABB(mt19937 &rng) {
+    uniform_real_distribution<float> positionDist(-0.5f * kAreaSize, 0.5f * kAreaSize);
+    uniform_real_distribution<float> sizeDist(0.5f, 20.0f);
+
+    glm::vec3 min(positionDist(rng), positionDist(rng), 0.0f);
+    glm::vec3 size(sizeDist(rng), sizeDist(rng), sizeDist(rng));
+
+    return AABB(min, min + size);
+}
+
+static unique_ptr<TestScene> makeScene(mt19937 &rng) {
+    auto scene = make_unique<TestScene>();
+
+    for (int i = 0; i < kObjectCount; ++i) {
+        scene->sceneNodes.push_back(make_unique<TestSceneNode>());
+        scene->aabbs.push_back(makeAABB(rng));
+        scene->octree.registerObject(scene->sceneNodes.back().get(), scene->aabbs.back());
+    }
+    scene->octree.build();
+
+    return move(scene);
+}
+
+static unique_ptr<CameraSceneNode> makeCamera(mt19937 &rng) {
+    uniform_real_distribution<float> positionDist(-0.5f * kAreaSize, 0.5f * kAreaSize);
+    uniform_real_distribution<float> angleDist(0.0f, glm::two_pi<float>());
+
+    auto camera = make_unique<CameraSceneNode>(nullptr, glm::perspective(glm::radians(55.0f), 16.0f / 9.0f, 0.1f, 100.0f));
+
+    glm::mat4 transform(1.0f);
+    transform = glm::translate(transform, glm::vec3(positionDist(rng), positionDist(rng), 2.0f));
+    transform = glm::rotate(transform, angleDist(rng), glm::vec3(0.0f, 0.0f, 1.0f));
+    transform = glm::rotate(transform, glm::half_pi<float>(), glm::vec3(1.0f, 0.0f, 0.0f));
+    camera->setLocalTransform(transform);
+
+    return move(camera);
+}
+
+static float getDistance(const AABB &aabb, const glm::vec3 &point) {
+    glm::vec3 delta(glm::clamp(point, aabb.min(), aabb.max()) - point);
+    return glm::dot(delta, delta);
+}
+
+static void checkFrustumQuery(const TestScene &scene, const CameraSceneNode &camera) {
+    vector<SceneNode *> visible;
+    CullingStats stats;
+    scene.octree.getNodesInFrustum(camera, visible, stats);
+
+    set<SceneNode *> expected;
+    map<SceneNode *, const AABB *> aabbs;
+    for (size_t i = 0; i < scene.sceneNodes.size(); ++i) {
+        aabbs.insert(make_pair(scene.sceneNodes[i].get(), &scene.aabbs[i]));
+        if (camera.isInFrustum(scene.aabbs[i])) {
+            expected.insert(scene.sceneNodes[i].get());
+        }
+    }
+    BOOST_TEST((set<SceneNode *>(visible.begin(), visible.end()) == expected));
+    BOOST_TEST(visible.size() == expected.size());
+    BOOST_TEST(static_cast<int>(visible.size()) + stats.culledObjects == scene.octree.objectCount());
+    BOOST_TEST(stats.visitedObjects <= scene.octree.objectCount());
+
+    glm::vec3 cameraPosition(camera.absoluteTransform()[3]);
+    for (size_t i = 1; i < visible.size(); ++i) {
+        BOOST_TEST(getDistance(*aabbs[visible[i - 1]], cameraPosition) <= getDistance(*aabbs[visible[i]], cameraPosition));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_frustum_query_matches_brute_force) {
+    mt19937 rng(1);
+    unique_ptr<TestScene> scene(makeScene(rng));
+
+    int visitedObjects = 0;
+    for (int i = 0; i < 50; ++i) {
+        unique_ptr<CameraSceneNode> camera(makeCamera(rng));
+        checkFrustumQuery(*scene, *camera);
+
+        vector<SceneNode *> visible;
+        CullingStats stats;
+        scene->octree.getNodesInFrustum(*camera, visible, stats);
+        visitedObjects += stats.visitedObjects;
+    }
+
+    // Culling whole nodes must save most object tests
+    BOOST_TEST(visitedObjects < 50 * kObjectCount / 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_incremental_updates) {
+    mt19937 rng(2);
+    unique_ptr<TestScene> scene(makeScene(rng));
+    uniform_int_distribution<int> indexDist(0, kObjectCount - 1);
+    uniform_real_distribution<float> stepDist(-2.0f, 2.0f);
+
+    for (int frame = 0; frame < 100; ++frame) {
+        // Move some objects slightly, and teleport one, possibly out of bounds
+        for (int i = 0; i < 20; ++i) {
+            int index = indexDist(rng);
+            glm::vec3 step(stepDist(rng), stepDist(rng), 0.0f);
+            scene->aabbs[index] = AABB(scene->aabbs[index].min() + step, scene->aabbs[index].max() + step);
+            scene->octree.updateObject(scene->sceneNodes[index].get(), scene->aabbs[index]);
+        }
+        int index = indexDist(rng);
+        AABB aabb(makeAABB(rng));
+        scene->aabbs[index] = frame % 10 == 0 ? AABB(aabb.min() * 2.0f, aabb.min() * 2.0f + aabb.size()) : aabb;
+        scene->octree.updateObject(scene->sceneNodes[index].get(), scene->aabbs[index]);
+
+        if (scene->octree.needsRebuild()) {
+            scene->octree.build();
+        }
+        unique_ptr<CameraSceneNode> camera(makeCamera(rng));
+        checkFrustumQuery(*scene, *camera);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_unregister_object) {
+    mt19937 rng(3);
+    unique_ptr<TestScene> scene(makeScene(rng));
+
+    for (int i = 0; i < kObjectCount / 2; ++i) {
+        scene->octree.unregisterObject(scene->sceneNodes.back().get());
+        scene->sceneNodes.pop_back();
+        scene->aabbs.pop_back();
+    }
+    BOOST_TEST(scene->octree.objectCount() == kObjectCount - kObjectCount / 2);
+
+    for (int i = 0; i < 20; ++i) {
+        unique_ptr<CameraSceneNode> camera(makeCamera(rng));
+        checkFrustumQuery(*scene, *camera);
+    }
+}
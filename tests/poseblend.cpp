@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE poseblend
+
+#include <random>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "glm/gtc/quaternion.hpp"
+
+#include "../src/scene/poseblend.h"
+
+using namespace std;
+
+using namespace reone::scene;
+
+static const float kTolerance = 1e-6f;
+
+static vector<glm::quat> makeQuats(mt19937 &rng, int count) {
+    uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    vector<glm::quat> quats;
+    for (int i = 0; i < count; ++i) {
+        quats.push_back(glm::normalize(glm::quat(dist(rng), dist(rng), dist(rng), dist(rng))));
+    }
+    return move(quats);
+}
+
+static bool isClose(const glm::quat &a, const glm::quat &b) {
+    for (int i = 0; i < 4; ++i) {
+        if (glm::abs(a[i] - b[i]) > kTolerance) return false;
+    }
+    return true;
+}
+
+BOOST_AUTO_TEST_CASE(test_slerp_quats_matches_glm) {
+    mt19937 rng(1);
+
+    // Odd count exercises both vector and scalar code paths
+    const int count = 1023;
+    vector<glm::quat> a(makeQuats(rng, count));
+    vector<glm::quat> b(makeQuats(rng, count));
+
+    // Identical quaternions take the linear path
+    for (int i = 0; i < count; i += 7) {
+        b[i] = a[i];
+    }
+    vector<glm::quat> out(count);
+
+    for (float t : { 0.0f, 0.25f, 0.5f, 0.9f, 1.0f }) {
+        slerpQuats(a.data(), b.data(), t, count, out.data());
+
+        for (int i = 0; i < count; ++i) {
+            glm::quat expected(glm::slerp(a[i], b[i], t));
+            BOOST_TEST(isClose(out[i], expected), "index " << i << ", t " << t);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_nlerp_quats_takes_shortest_path) {
+    mt19937 rng(2);
+
+    const int count = 1023;
+    vector<glm::quat> a(makeQuats(rng, count));
+    vector<glm::quat> b(makeQuats(rng, count));
+    vector<glm::quat> out(count);
+
+    nlerpQuats(a.data(), b.data(), 0.5f, count, out.data());
+
+    for (int i = 0; i < count; ++i) {
+        glm::quat target(glm::dot(a[i], b[i]) < 0.0f ? -b[i] : b[i]);
+        glm::quat expected(glm::normalize(glm::quat(
+            0.5f * (a[i].w + target.w),
+            0.5f * (a[i].x + target.x),
+            0.5f * (a[i].y + target.y),
+            0.5f * (a[i].z + target.z))));
+
+        BOOST_TEST(isClose(out[i], expected), "index " << i);
+        BOOST_TEST(glm::abs(glm::length(out[i]) - 1.0f) < kTolerance);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_slerp_quats_in_place) {
+    mt19937 rng(3);
+
+    const int count = 10;
+    vector<glm::quat> a(makeQuats(rng, count));
+    vector<glm::quat> b(makeQuats(rng, count));
+    vector<glm::quat> expected(count);
+
+    slerpQuats(a.data(), b.data(), 0.3f, count, expected.data());
+    slerpQuats(a.data(), b.data(), 0.3f, count, a.data());
+
+    for (int i = 0; i < count; ++i) {
+        BOOST_TEST((a[i] == expected[i]));
+    }
+}
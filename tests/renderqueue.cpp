@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE renderqueue
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../src/render/mesh/modelmesh.h"
+#include "../src/render/renderqueue.h"
+#include "../src/render/texture.h"
+
+using namespace std;
+
+using namespace reone::render;
+
+class TestDrawable : public IDrawable {
+public:
+    void draw() const override {
+    }
+};
+
+struct TestEntry {
+    uint64_t key { 0 };
+    int index { 0 };
+};
+
+struct TestScene {
+    vector<unique_ptr<Texture>> textures;
+    vector<unique_ptr<ModelMesh>> meshes;
+    vector<unique_ptr<TestDrawable>> drawables;
+};
+
+static unique_ptr<TestScene> makeScene() {
+    auto scene = make_unique<TestScene>();
+    for (int i = 0; i < 4; ++i) {
+        scene->textures.push_back(make_unique<Texture>("texture" + to_string(i), TextureType::Diffuse));
+        scene->meshes.push_back(make_unique<ModelMesh>(true, 0));
+    }
+    for (int i = 0; i < 100; ++i) {
+        scene->drawables.push_back(make_unique<TestDrawable>());
+    }
+    return move(scene);
+}
+
+static int countCommands(const RenderQueue &queue, RenderCommandType type) {
+    return static_cast<int>(count_if(queue.commands().begin(), queue.commands().end(), [&type](auto &command) {
+        return command.type == type;
+    }));
+}
+
+BOOST_AUTO_TEST_CASE(test_radix_sort_matches_stable_sort) {
+    mt19937_64 rng(1);
+
+    for (int size : { 0, 1, 2, 17, 1000 }) {
+        vector<TestEntry> entries;
+        for (int i = 0; i < size; ++i) {
+            TestEntry entry;
+            // Few distinct high bytes and many duplicates exercise skipped passes and stability
+            entry.key = (rng() % 4) << 60 | (rng() % 8);
+            entry.index = i;
+            entries.push_back(entry);
+        }
+        vector<TestEntry> expected(entries);
+        stable_sort(expected.begin(), expected.end(), [](auto &left, auto &right) { return left.key < right.key; });
+
+        vector<TestEntry> buffer;
+        radixSort(entries, buffer);
+
+        BOOST_REQUIRE(entries.size() == expected.size());
+        for (size_t i = 0; i < entries.size(); ++i) {
+            BOOST_TEST(entries[i].key == expected[i].key);
+            BOOST_TEST(entries[i].index == expected[i].index);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_draw_order) {
+    unique_ptr<TestScene> scene(makeScene());
+    RenderQueue queue;
+
+    // Transparent items are added first, to check that opaque ones come before them
+    vector<pair<int, float>> transparent { { 1, 5.0f }, { 0, 1.0f }, { 1, 9.0f }, { 0, 3.0f } };
+    for (size_t i = 0; i < transparent.size(); ++i) {
+        DrawItem item;
+        item.program = ShaderProgram::ModelModel;
+        item.textures[0] = scene->textures[i].get();
+        item.mesh = scene->meshes[i].get();
+        item.drawable = scene->drawables[i].get();
+        item.transparency = transparent[i].first;
+        queue.add(RenderPass::Transparent, item, transparent[i].second);
+    }
+
+    // Opaque items alternate between two texture sets at increasing depths
+    for (int i = 0; i < 8; ++i) {
+        DrawItem item;
+        item.program = ShaderProgram::ModelModel;
+        item.textures[0] = scene->textures[i % 2].get();
+        item.mesh = scene->meshes[i % 2].get();
+        item.drawable = scene->drawables[10 + i].get();
+        queue.add(RenderPass::Opaque, item, 10.0f - i);
+    }
+    queue.prepare();
+
+    vector<const IDrawable *> draws;
+    for (auto &command : queue.commands()) {
+        if (command.type == RenderCommandType::Draw) {
+            draws.push_back(command.drawable);
+        }
+    }
+    vector<const IDrawable *> expected {
+        // First texture set, front to back
+        scene->drawables[16].get(), scene->drawables[14].get(), scene->drawables[12].get(), scene->drawables[10].get(),
+        // Second texture set, front to back
+        scene->drawables[17].get(), scene->drawables[15].get(), scene->drawables[13].get(), scene->drawables[11].get(),
+        // Transparent, by transparency, then back to front
+        scene->drawables[3].get(), scene->drawables[1].get(), scene->drawables[2].get(), scene->drawables[0].get()
+    };
+    BOOST_TEST((draws == expected));
+}
+
+BOOST_AUTO_TEST_CASE(test_redundant_binds_are_skipped) {
+    unique_ptr<TestScene> scene(makeScene());
+    mt19937 rng(2);
+    uniform_int_distribution<int> textureDist(0, 1);
+    uniform_real_distribution<float> depthDist(0.0f, 100.0f);
+
+    RenderQueue queue;
+    int naiveStateChanges = 0;
+
+    for (int i = 0; i < 100; ++i) {
+        int texture = textureDist(rng);
+
+        DrawItem item;
+        item.program = i % 10 == 0 ? ShaderProgram::ModelWhite : ShaderProgram::ModelModel;
+        item.textures[0] = scene->textures[texture].get();
+        item.textures[2] = scene->textures[3].get();
+        item.mesh = scene->meshes[texture].get();
+        item.drawable = scene->drawables[i].get();
+        queue.add(RenderPass::Opaque, item, depthDist(rng));
+
+        // Program, two textures and a vertex array per draw
+        naiveStateChanges += 4;
+    }
+    queue.prepare();
+
+    const RenderQueueStats &stats = queue.stats();
+    BOOST_TEST(stats.drawCalls == 100);
+    BOOST_TEST(stats.programChanges == 2);
+    BOOST_TEST(stats.textureChanges == 5); // both diffuse textures per program, lightmap once
+    BOOST_TEST(stats.vertexArrayChanges == 4);
+    BOOST_TEST(stats.sortTime >= 0.0f);
+
+    BOOST_TEST(countCommands(queue, RenderCommandType::Draw) == stats.drawCalls);
+    BOOST_TEST(countCommands(queue, RenderCommandType::UseProgram) == stats.programChanges);
+    BOOST_TEST(countCommands(queue, RenderCommandType::BindTexture) == stats.textureChanges);
+    BOOST_TEST(countCommands(queue, RenderCommandType::BindVertexArray) == stats.vertexArrayChanges);
+    BOOST_TEST(stats.programChanges + stats.textureChanges + stats.vertexArrayChanges < naiveStateChanges / 10);
+
+    queue.clear();
+    BOOST_TEST(queue.commands().empty());
+}
+
+static DrawItem makeInstancedItem(TestScene &scene, int mesh, int drawable, uint32_t state) {
+    DrawItem item;
+    item.program = ShaderProgram::ModelModel;
+    item.textures[0] = scene.textures[mesh].get();
+    item.mesh = scene.meshes[mesh].get();
+    item.drawable = scene.drawables[drawable].get();
+    item.instanceState = state;
+    item.transform[3][0] = static_cast<float>(drawable);
+    item.alpha = 0.5f;
+    return move(item);
+}
+
+BOOST_AUTO_TEST_CASE(test_identical_meshes_are_instanced) {
+    unique_ptr<TestScene> scene(makeScene());
+    RenderQueue queue;
+
+    // Two groups of the same mesh, separated by state, and a single item of another mesh
+    for (int i = 0; i < 6; ++i) {
+        queue.add(RenderPass::Opaque, makeInstancedItem(*scene, 0, i, i % 2 == 0 ? 1 : 2), static_cast<float>(i));
+    }
+    queue.add(RenderPass::Opaque, makeInstancedItem(*scene, 1, 6, 1), 0.0f);
+    queue.prepare();
+
+    const RenderQueueStats &stats = queue.stats();
+    BOOST_TEST(stats.drawCalls == 3);
+    BOOST_TEST(stats.instancedDrawCalls == 2);
+    BOOST_TEST(stats.instances == 6);
+    BOOST_TEST(countCommands(queue, RenderCommandType::DrawInstanced) == 2);
+    BOOST_TEST(countCommands(queue, RenderCommandType::Draw) == 1);
+    BOOST_TEST(queue.instances().size() == 6u);
+
+    for (auto &command : queue.commands()) {
+        if (command.type != RenderCommandType::DrawInstanced) continue;
+
+        BOOST_TEST(command.instanceCount == 3);
+        float parity = -1.0f;
+        for (int i = command.firstInstance; i < command.firstInstance + command.instanceCount; ++i) {
+            const InstanceData &instance = queue.instances()[i];
+            float drawable = instance.transform[3][0];
+            if (parity < 0.0f) {
+                parity = fmodf(drawable, 2.0f);
+            }
+            BOOST_TEST(fmodf(drawable, 2.0f) == parity);
+            BOOST_TEST(instance.alpha == 0.5f);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_instancing_requires_instance_state_and_opaque_pass) {
+    unique_ptr<TestScene> scene(makeScene());
+    RenderQueue queue;
+
+    for (int i = 0; i < 4; ++i) {
+        queue.add(RenderPass::Opaque, makeInstancedItem(*scene, 0, i, 0), static_cast<float>(i));
+    }
+    for (int i = 4; i < 8; ++i) {
+        queue.add(RenderPass::Transparent, makeInstancedItem(*scene, 1, i, 1), static_cast<float>(i));
+    }
+    queue.prepare();
+
+    const RenderQueueStats &stats = queue.stats();
+    BOOST_TEST(stats.drawCalls == 8);
+    BOOST_TEST(stats.instancedDrawCalls == 0);
+    BOOST_TEST(stats.instances == 0);
+    BOOST_TEST(queue.instances().empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_instancing_requires_identical_textures) {
+    unique_ptr<TestScene> scene(makeScene());
+    RenderQueue queue;
+
+    for (int i = 0; i < 4; ++i) {
+        DrawItem item(makeInstancedItem(*scene, 0, i, 1));
+        item.textures[1] = scene->textures[2 + i % 2].get();
+        queue.add(RenderPass::Opaque, item, static_cast<float>(i));
+    }
+    queue.prepare();
+
+    const RenderQueueStats &stats = queue.stats();
+    BOOST_TEST(stats.drawCalls == 2);
+    BOOST_TEST(stats.instancedDrawCalls == 2);
+    BOOST_TEST(stats.instances == 4);
+    BOOST_TEST(stats.vertexArrayChanges == 1);
+}
+
+class UniformDrawable : public IDrawable {
+public:
+    UniformDrawable(int id) : _id(id) {
+    }
+
+    void getUniforms(LocalUniforms &locals, bool instanced) const override {
+        locals.features.instancingEnabled = instanced;
+        locals.alpha = static_cast<float>(_id);
+        for (int i = 0; i < _id % 4; ++i) {
+            locals.lighting.lights.push_back(ShaderLight());
+        }
+    }
+
+    void draw() const override {
+    }
+
+private:
+    int _id;
+};
+
+static void addUniformItems(TestScene &scene, const vector<unique_ptr<UniformDrawable>> &drawables, RenderQueue &queue) {
+    for (int i = 0; i < static_cast<int>(drawables.size()); ++i) {
+        DrawItem item;
+        item.program = ShaderProgram::ModelModel;
+        item.textures[0] = scene.textures[i % 3].get();
+        item.mesh = scene.meshes[i % 2].get();
+        item.drawable = drawables[i].get();
+        item.instanceState = i % 5 == 0 ? 1 : 0;
+        queue.add(i % 4 == 0 ? RenderPass::Transparent : RenderPass::Opaque, item, static_cast<float>(i % 7));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_threaded_prepare_matches_serial) {
+    unique_ptr<TestScene> scene(makeScene());
+    vector<unique_ptr<UniformDrawable>> drawables;
+    for (int i = 0; i < 200; ++i) {
+        drawables.push_back(make_unique<UniformDrawable>(i));
+    }
+
+    RenderQueue serial;
+    addUniformItems(*scene, drawables, serial);
+    serial.prepare(1);
+
+    RenderQueue threaded;
+    for (int frame = 0; frame < 2; ++frame) {
+        threaded.clear();
+        addUniformItems(*scene, drawables, threaded);
+        threaded.prepare(4);
+    }
+    BOOST_TEST(serial.stats().threads == 1);
+    BOOST_TEST(threaded.stats().threads == 4);
+
+    const vector<RenderCommand> &expected = serial.commands();
+    const vector<RenderCommand> &actual = threaded.commands();
+    BOOST_REQUIRE(actual.size() == expected.size());
+    BOOST_TEST(threaded.stats().drawCalls == serial.stats().drawCalls);
+    BOOST_TEST(threaded.instances().size() == serial.instances().size());
+
+    for (size_t i = 0; i < expected.size(); ++i) {
+        BOOST_TEST((actual[i].type == expected[i].type));
+        BOOST_TEST(actual[i].drawable == expected[i].drawable);
+        BOOST_TEST(actual[i].firstInstance == expected[i].firstInstance);
+        BOOST_TEST(actual[i].instanceCount == expected[i].instanceCount);
+        if (actual[i].drawable) {
+            // Uniforms must not leak from the previous frame
+            const LocalUniforms &locals = threaded.uniforms()[actual[i].uniforms];
+            int id = static_cast<int>(locals.alpha);
+            BOOST_TEST(static_cast<const IDrawable *>(drawables[id].get()) == actual[i].drawable);
+            BOOST_TEST(locals.lighting.lights.size() == static_cast<size_t>(id % 4));
+            BOOST_TEST(locals.features.instancingEnabled == (actual[i].type == RenderCommandType::DrawInstanced));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_transparent_items_with_equal_keys_are_not_instanced) {
+    unique_ptr<TestScene> scene(makeScene());
+    RenderQueue queue;
+
+    // Same transparency, depth and textures, but different meshes
+    for (int i = 0; i < 2; ++i) {
+        queue.add(RenderPass::Transparent, makeInstancedItem(*scene, i, i, 1), 5.0f);
+    }
+    queue.prepare();
+
+    const RenderQueueStats &stats = queue.stats();
+    BOOST_TEST(stats.drawCalls == 2);
+    BOOST_TEST(stats.instancedDrawCalls == 0);
+    BOOST_TEST(countCommands(queue, RenderCommandType::BindVertexArray) == 2);
+
+    vector<const IDrawable *> draws;
+    for (auto &command : queue.commands()) {
+        if (command.type == RenderCommandType::Draw) {
+            draws.push_back(command.drawable);
+        }
+    }
+    BOOST_TEST((draws == vector<const IDrawable *> { scene->drawables[0].get(), scene->drawables[1].get() }));
+}
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE scriptbatch
+
+#include <atomic>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../src/game/script/batch.h"
+#include "../src/script/native.h"
+#include "../src/script/routine.h"
+
+using namespace std;
+
+using namespace reone::game;
+using namespace reone::script;
+
+static const int kValueCount = 16;
+
+/**
+ * Heartbeat invocations of a recorded session, one tick per line, in the
+ * form of "program@caller".
+ */
+static const char kRecordedSession[] =
+    "read2@23 read9@6 double0@23 transfer12@27 transfer0@3 read3@29 read7@23 transfer2@32 transfer10@39 fail@27 read6@29 read5@15 transfer13@27 double5@13 fail@28 transfer9@18 double0@15 read13@31 double5@10 transfer9@20 read15@26 read3@24 read4@17 transfer4@22\n"
+    "read2@36 transfer12@11 read13@28 transfer14@19 transfer4@21 transfer6@18 read0@2 transfer12@27 read4@28 transfer4@19 read0@4 read1@20 transfer3@1 double5@4 read1@33 read0@10 transfer5@29 transfer11@15 read2@2 read6@17 transfer15@2 read4@13 transfer3@11 read1@25\n"
+    "read7@13 transfer6@35 transfer7@22 read7@1 transfer3@37 read8@21 read7@27 transfer1@21 read13@19 read5@19 read13@8 transfer13@4 read12@27 transfer15@2 read10@25 read4@10 read5@23 read15@26 double0@6 read10@13 read15@3 read14@15 read7@29 transfer5@33\n"
+    "transfer10@11 transfer5@3 transfer14@4 transfer14@20 transfer1@7 transfer9@15 read10@15 transfer3@13 read5@13 read3@17 read10@24 read0@10 transfer11@13 read7@28 read7@17 read8@35 transfer10@21 transfer12@30 transfer9@14 transfer3@11 read2@17 read2@7 read7@14 read4@3\n"
+    "transfer8@24 read10@5 read9@7 transfer10@27 transfer11@8 transfer11@19 transfer3@40 fail@23 read4@34 transfer5@33 transfer0@29 read7@21 transfer6@28 transfer6@14 transfer12@29 read12@35 double0@40 transfer1@13 transfer7@30 read11@21 double0@19 double5@36 transfer6@17 double0@15\n"
+    "read7@14 transfer7@16 transfer6@31 transfer9@3 read3@28 transfer4@1 transfer8@38 transfer10@26 transfer9@5 transfer7@6 read1@8 transfer9@12 read5@25 read10@10 fail@30 read5@8 transfer11@10 transfer0@3 double0@26 read5@27 read0@6 double0@26 transfer13@13 read10@13\n"
+    "read3@17 transfer8@2 transfer2@22 transfer8@6 read0@37 read8@36 fail@35 read4@29 transfer6@22 transfer11@16 transfer6@21 transfer6@18 transfer7@14 read0@25 transfer5@24 read8@33 transfer3@17 transfer0@16 read14@32 transfer5@8 read11@15 transfer3@13 double0@39 read9@2\n"
+    "transfer9@27 double5@35 fail@33 read1@28 transfer2@15 read10@10 read4@2 read11@29 transfer7@40 read0@3 transfer6@35 read8@34 transfer4@15 read2@35 transfer3@17 transfer9@16 transfer0@6 transfer10@38 read10@13 transfer10@5 read11@16 transfer15@16 read6@10 read12@11\n";
+
+/**
+ * Values at the end of the recorded session.
+ */
+static const vector<int> kRecordedValues { 2501, 261, 248, 3967, 264, 168, 262, 56, 2090, 105, 23, 159, 79, 791, 169, 266 };
+
+/**
+ * Fake world with a parallel-safe read routine, a parallel-safe write
+ * routine that defers its side effect, a write routine that is not
+ * parallel-safe, and a parallel-safe routine that always fails.
+ */
+class WorldRoutines : public IRoutineProvider {
+public:
+    vector<int> values;
+    vector<string> log;
+    atomic_int readCount { 0 };
+
+    WorldRoutines() : values(kValueCount, 1) {
+        _routines.push_back(Routine("GetValue", VariableType::Int, { VariableType::Int }, [this](const vector<Variable> &args, ExecutionContext &ctx) {
+            ++readCount;
+            return Variable(getValue(args[0].intValue, ctx));
+        }));
+        _routines.push_back(Routine("AddValue", VariableType::Void, { VariableType::Int, VariableType::Int }, [this](const vector<Variable> &args, ExecutionContext &ctx) {
+            int index = args[0].intValue;
+            int delta = args[1].intValue;
+            if (ctx.commands) {
+                ctx.commands->localNumbers[make_pair(0, index)] = getValue(index, ctx) + delta;
+            }
+            defer(ctx, [this, index, delta]() {
+                values[index] += delta;
+                log.push_back("add " + to_string(index) + " " + to_string(delta));
+            });
+            return Variable();
+        }));
+        _routines.push_back(Routine("DoubleValue", VariableType::Void, { VariableType::Int }, [this](const vector<Variable> &args, ExecutionContext &ctx) {
+            int index = args[0].intValue;
+            values[index] *= 2;
+            log.push_back("double " + to_string(index));
+            return Variable();
+        }));
+        _routines.push_back(Routine("Fail", VariableType::Void, { VariableType::Int }, [this](const vector<Variable> &args, ExecutionContext &ctx) -> Variable {
+            if (args[0].intValue != 0) {
+                throw runtime_error("Fail");
+            }
+            throw args[0].intValue;
+        }));
+    }
+
+    const Routine &get(int index) override {
+        return _routines[index];
+    }
+
+    static bool isParallelSafe(int index) {
+        return index != 2;
+    }
+
+private:
+    vector<Routine> _routines;
+
+    int getValue(int index, const ExecutionContext &ctx) const {
+        if (ctx.commands) {
+            auto maybePending = ctx.commands->localNumbers.find(make_pair(0, index));
+            if (maybePending != ctx.commands->localNumbers.end()) {
+                return maybePending->second;
+            }
+        }
+        return values[index];
+    }
+
+    void defer(ExecutionContext &ctx, const function<void()> &command) {
+        if (ctx.commands) {
+            ctx.commands->commands.push_back(command);
+        } else {
+            command();
+        }
+    }
+};
+
+static shared_ptr<ScriptProgram> makeReadProgram(const string &name, int index) {
+    shared_ptr<ScriptProgram> program(new ScriptProgram(name));
+    program->add(makeInstruction(13, ByteCode::PushConstant, InstructionType::Int, 19, 0, 0, index));
+    program->add(makeInstruction(19, ByteCode::CallRoutine, InstructionType::None, 24, 0, 1, 0));
+    program->setLength(24);
+    return move(program);
+}
+
+/**
+ * @return program that increments source value, then adds it to target value
+ */
+static shared_ptr<ScriptProgram> makeTransferProgram(const string &name, int source, int target) {
+    shared_ptr<ScriptProgram> program(new ScriptProgram(name));
+    program->add(makeInstruction(13, ByteCode::PushConstant, InstructionType::Int, 19, 0, 0, 1));
+    program->add(makeInstruction(19, ByteCode::PushConstant, InstructionType::Int, 25, 0, 0, source));
+    program->add(makeInstruction(25, ByteCode::CallRoutine, InstructionType::None, 30, 0, 2, 1));
+    program->add(makeInstruction(30, ByteCode::PushConstant, InstructionType::Int, 36, 0, 0, source));
+    program->add(makeInstruction(36, ByteCode::CallRoutine, InstructionType::None, 41, 0, 1, 0));
+    program->add(makeInstruction(41, ByteCode::PushConstant, InstructionType::Int, 47, 0, 0, target));
+    program->add(makeInstruction(47, ByteCode::CallRoutine, InstructionType::None, 52, 0, 2, 1));
+    program->setLength(52);
+    return move(program);
+}
+
+static shared_ptr<ScriptProgram> makeDoubleProgram(const string &name, int index) {
+    shared_ptr<ScriptProgram> program(new ScriptProgram(name));
+    program->add(makeInstruction(13, ByteCode::PushConstant, InstructionType::Int, 19, 0, 0, index));
+    program->add(makeInstruction(19, ByteCode::CallRoutine, InstructionType::None, 24, 0, 1, 2));
+    program->setLength(24);
+    return move(program);
+}
+
+static shared_ptr<ScriptProgram> makeFailProgram(const string &name, int code) {
+    shared_ptr<ScriptProgram> program(new ScriptProgram(name));
+    program->add(makeInstruction(13, ByteCode::PushConstant, InstructionType::Int, 19, 0, 0, code));
+    program->add(makeInstruction(19, ByteCode::CallRoutine, InstructionType::None, 24, 0, 1, 3));
+    program->setLength(24);
+    return move(program);
+}
+
+static void replaySession(WorldRoutines &routines, bool parallel) {
+    map<string, shared_ptr<ScriptProgram>> programs;
+    for (int i = 0; i < kValueCount; ++i) {
+        programs["read" + to_string(i)] = makeReadProgram("read" + to_string(i), i);
+        programs["transfer" + to_string(i)] = makeTransferProgram("transfer" + to_string(i), i, (i * 7 + 3) % kValueCount);
+    }
+    programs["double0"] = makeDoubleProgram("double0", 0);
+    programs["double5"] = makeDoubleProgram("double5", 5);
+    programs["fail"] = makeFailProgram("fail", 1);
+
+    ScriptBatch batch(&routines, &WorldRoutines::isParallelSafe);
+    istringstream session(kRecordedSession);
+    string tick;
+
+    while (getline(session, tick)) {
+        batch.clear();
+        istringstream invocations(tick);
+        string invocation;
+        while (invocations >> invocation) {
+            size_t separatorIdx = invocation.find('@');
+            batch.add(programs.at(invocation.substr(0, separatorIdx)), stoi(invocation.substr(separatorIdx + 1)));
+        }
+        batch.run(parallel);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_recorded_session_parallel_matches_serial) {
+    WorldRoutines serial;
+    replaySession(serial, false);
+
+    WorldRoutines parallel;
+    replaySession(parallel, true);
+
+    BOOST_TEST(!serial.log.empty());
+    BOOST_TEST((serial.values == kRecordedValues));
+    BOOST_TEST((parallel.values == kRecordedValues));
+    BOOST_TEST((serial.log == parallel.log));
+    BOOST_TEST(serial.readCount == parallel.readCount);
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_safety_classification) {
+    WorldRoutines routines;
+    ScriptBatch batch(&routines, &WorldRoutines::isParallelSafe);
+    batch.add(makeTransferProgram("transfer", 0, 1), 1);
+    batch.add(makeDoubleProgram("double", 2), 2);
+    batch.add(makeTransferProgram("transfer", 3, 4), 3);
+    batch.add(makeReadProgram("read", 5), 4);
+
+    BOOST_TEST((batch.parallelCount() == 3));
+    BOOST_TEST((batch.serialCount() == 1));
+
+    batch.run(true);
+
+    // Writes are deferred until all parallel-safe scripts are finished
+    BOOST_TEST(routines.readCount == 3);
+    BOOST_TEST((routines.log == vector<string> { "add 0 1", "add 1 2", "add 3 1", "add 4 2", "double 2" }));
+}
+
+BOOST_AUTO_TEST_CASE(test_deferred_writes) {
+    WorldRoutines routines;
+    ScriptBatch batch(&routines, &WorldRoutines::isParallelSafe);
+    batch.add(makeTransferProgram("transfer", 0, 1), 1);
+    batch.add(makeTransferProgram("transfer", 1, 2), 2);
+
+    batch.run(true);
+
+    // Each script observes its own writes, but not writes of other scripts in the batch
+    BOOST_TEST(routines.values[0] == 2);
+    BOOST_TEST(routines.values[1] == 4);
+    BOOST_TEST(routines.values[2] == 3);
+}
+
+BOOST_AUTO_TEST_CASE(test_failing_scripts_do_not_stop_batch) {
+    WorldRoutines routines;
+    ScriptBatch batch(&routines, &WorldRoutines::isParallelSafe);
+    for (int i = 0; i < 64; ++i) {
+        batch.add(makeReadProgram("read", i % kValueCount), i);
+        batch.add(makeFailProgram(i % 2 == 0 ? "fail_exception" : "fail_other", i % 2 == 0 ? 1 : 0), i);
+    }
+    batch.add(makeDoubleProgram("double", 0), 64);
+
+    batch.run(true);
+
+    BOOST_TEST(routines.readCount == 64);
+    BOOST_TEST((routines.log == vector<string> { "double 0" }));
+}
@@ -20,6 +20,8 @@
 #include <boost/test/included/unit_test.hpp>
 
 #include "../src/script/execution.h"
+#include "../src/script/profiler.h"
+#include "../src/script/routine.h"
 
 using namespace std;
 
@@ -113,3 +115,183 @@ BOOST_AUTO_TEST_CASE(test_cptopbp) {
     BOOST_TEST((execution.getStackVariable(4).intValue == 1));
     BOOST_TEST((execution.getStackVariable(5).intValue == 2));
 }
+
+BOOST_AUTO_TEST_CASE(test_profiler) {
+    Instruction instr;
+    shared_ptr<ScriptProgram> program(new ScriptProgram("profiled"));
+
+    instr.offset = 13;
+    instr.byteCode = ByteCode::PushConstant;
+    instr.type = InstructionType::Int;
+    instr.intValue = 0;
+    instr.nextOffset = instr.offset + 6;
+    program->add(instr);
+
+    instr.offset = instr.nextOffset;
+    instr.byteCode = ByteCode::AdjustSP;
+    instr.type = InstructionType::None;
+    instr.stackOffset = -4;
+    instr.nextOffset = instr.offset + 6;
+    program->add(instr);
+
+    program->setLength(instr.nextOffset);
+
+    ScriptProfiler &profiler = ScriptProfiler::instance();
+    profiler.reset();
+
+    ExecutionContext context;
+    ScriptExecution(program, context).run();
+
+    BOOST_TEST((profiler.getHotScripts(-1).empty()));
+
+    profiler.setEnabled(true);
+    ScriptExecution(program, context).run();
+    ScriptExecution(program, context).run();
+    profiler.setEnabled(false);
+
+    vector<ScriptProfile> profiles(profiler.getHotScripts(-1));
+    BOOST_TEST((profiles.size() == 1));
+    BOOST_TEST((profiles[0].name == "profiled"));
+    BOOST_TEST((profiles[0].executionCount == 2));
+    BOOST_TEST((profiles[0].instructionCount == 4));
+    BOOST_TEST((profiles[0].routineCallCount == 0));
+}
+
+class ActionRoutines : public IRoutineProvider {
+public:
+    vector<shared_ptr<ExecutionState>> states;
+
+    ActionRoutines() : _routine("Action", VariableType::Void, { VariableType::Action }, [this](const vector<Variable> &args, ExecutionContext &ctx) {
+        states.push_back(args[0].context.savedState);
+        return Variable();
+    }) {
+    }
+
+    const Routine &get(int index) override {
+        return _routine;
+    }
+
+private:
+    Routine _routine;
+};
+
+BOOST_AUTO_TEST_CASE(test_store_state_shares_globals) {
+    Instruction instr;
+    shared_ptr<ScriptProgram> program(new ScriptProgram(""));
+
+    auto addStoreStateAndAction = [&]() {
+        instr.offset = instr.nextOffset;
+        instr.byteCode = ByteCode::StoreState;
+        instr.type = static_cast<InstructionType>(0x10);
+        instr.size = 4;
+        instr.sizeLocals = 4;
+        instr.nextOffset = instr.offset + 10;
+        program->add(instr);
+
+        instr.offset = instr.nextOffset;
+        instr.byteCode = ByteCode::CallRoutine;
+        instr.type = InstructionType::None;
+        instr.routine = 0;
+        instr.argCount = 1;
+        instr.nextOffset = instr.offset + 5;
+        program->add(instr);
+    };
+
+    instr.offset = 13;
+    instr.byteCode = ByteCode::PushConstant;
+    instr.type = InstructionType::Int;
+    instr.intValue = 7;
+    instr.nextOffset = instr.offset + 6;
+    program->add(instr);
+
+    instr.offset = instr.nextOffset;
+    instr.byteCode = ByteCode::SaveBP;
+    instr.type = InstructionType::None;
+    instr.nextOffset = instr.offset + 2;
+    program->add(instr);
+
+    instr.offset = instr.nextOffset;
+    instr.byteCode = ByteCode::PushConstant;
+    instr.type = InstructionType::Int;
+    instr.intValue = 1;
+    instr.nextOffset = instr.offset + 6;
+    program->add(instr);
+
+    addStoreStateAndAction();
+    addStoreStateAndAction();
+
+    instr.offset = instr.nextOffset;
+    instr.byteCode = ByteCode::PushConstant;
+    instr.type = InstructionType::Int;
+    instr.intValue = 9;
+    instr.nextOffset = instr.offset + 6;
+    program->add(instr);
+
+    instr.offset = instr.nextOffset;
+    instr.byteCode = ByteCode::CopyDownBP;
+    instr.type = InstructionType::One;
+    instr.stackOffset = -4;
+    instr.size = 4;
+    instr.nextOffset = instr.offset + 8;
+    program->add(instr);
+
+    instr.offset = instr.nextOffset;
+    instr.byteCode = ByteCode::AdjustSP;
+    instr.type = InstructionType::None;
+    instr.stackOffset = -4;
+    instr.nextOffset = instr.offset + 6;
+    program->add(instr);
+
+    addStoreStateAndAction();
+
+    program->setLength(instr.nextOffset);
+
+    ActionRoutines routines;
+    ExecutionContext context;
+    context.routines = &routines;
+    ScriptExecution(program, context).run();
+
+    BOOST_TEST_REQUIRE((routines.states.size() == 3));
+    BOOST_TEST((routines.states[0] != routines.states[1]));
+    BOOST_TEST((routines.states[0]->globals == routines.states[1]->globals));
+    BOOST_TEST((routines.states[1]->globals != routines.states[2]->globals));
+    BOOST_TEST(((*routines.states[1]->globals)[0].intValue == 7));
+    BOOST_TEST(((*routines.states[2]->globals)[0].intValue == 9));
+    BOOST_TEST((routines.states[2]->locals.size() == 1));
+    BOOST_TEST((routines.states[2]->locals[0].intValue == 1));
+}
+
+BOOST_AUTO_TEST_CASE(test_instruction_budget) {
+    Instruction instr;
+    shared_ptr<ScriptProgram> program(new ScriptProgram(""));
+
+    instr.nextOffset = 13;
+    for (int i = 0; i < 10; ++i) {
+        instr.offset = instr.nextOffset;
+        instr.byteCode = ByteCode::PushConstant;
+        instr.type = InstructionType::Int;
+        instr.intValue = i;
+        instr.nextOffset = instr.offset + 6;
+        program->add(instr);
+    }
+    program->setLength(instr.nextOffset);
+
+    ExecutionContext context;
+    ScriptExecution execution(program, context);
+    execution.setInstructionBudget(3);
+
+    BOOST_TEST((execution.run() == -1));
+    BOOST_TEST(execution.isSuspended());
+    BOOST_TEST((execution.stackSize() == 3));
+
+    int runCount = 1;
+    int result = -1;
+    while (execution.isSuspended()) {
+        result = execution.run();
+        ++runCount;
+    }
+
+    BOOST_TEST((runCount == 4));
+    BOOST_TEST((result == 9));
+    BOOST_TEST((execution.stackSize() == 10));
+}
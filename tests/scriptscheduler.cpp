@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE scriptscheduler
+
+#include <chrono>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../src/game/script/scheduler.h"
+#include "../src/script/native.h"
+#include "../src/script/routine.h"
+
+using namespace std;
+
+using namespace reone::game;
+using namespace reone::script;
+
+class MarkRoutines : public IRoutineProvider {
+public:
+    int markCount { 0 };
+    vector<uint32_t> callers;
+
+    MarkRoutines() : _routine("Mark", VariableType::Void, { }, [this](const vector<Variable> &args, ExecutionContext &ctx) {
+        ++markCount;
+        callers.push_back(ctx.callerId);
+        return Variable();
+    }) {
+    }
+
+    const Routine &get(int index) override {
+        return _routine;
+    }
+
+private:
+    Routine _routine;
+};
+
+BOOST_AUTO_TEST_CASE(test_runaway_script_does_not_block_queue) {
+    shared_ptr<ScriptProgram> runaway(new ScriptProgram("runaway"));
+    runaway->add(makeInstruction(13, ByteCode::Noop, InstructionType::None, 15, 0, 0, 0));
+    runaway->add(makeInstruction(15, ByteCode::Jump, InstructionType::None, 21, 13, 0, 0));
+    runaway->setLength(21);
+
+    shared_ptr<ScriptProgram> mark(new ScriptProgram("mark"));
+    mark->add(makeInstruction(13, ByteCode::CallRoutine, InstructionType::None, 18, 0, 0, 0));
+    mark->setLength(18);
+
+    MarkRoutines routines;
+    ExecutionContext ctx;
+    ctx.routines = &routines;
+
+    ScriptScheduler &scheduler = ScriptScheduler::instance();
+    scheduler.setFrameBudget(1.0f);
+    scheduler.setSliceInstructionCount(1000);
+    scheduler.enqueue(runaway, ctx);
+    scheduler.enqueue(mark, ctx);
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    scheduler.update();
+    int64_t millis = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+
+    BOOST_TEST((routines.markCount == 1));
+    BOOST_TEST((scheduler.queueSize() == 1));
+    BOOST_TEST((millis < 100));
+
+    scheduler.update();
+
+    BOOST_TEST((scheduler.queueSize() == 1));
+
+    scheduler.clear();
+}
+
+BOOST_AUTO_TEST_CASE(test_queued_scripts_run_in_order) {
+    shared_ptr<ScriptProgram> mark(new ScriptProgram("mark"));
+    mark->add(makeInstruction(13, ByteCode::CallRoutine, InstructionType::None, 18, 0, 0, 0));
+    mark->setLength(18);
+
+    MarkRoutines routines;
+    ScriptScheduler &scheduler = ScriptScheduler::instance();
+    scheduler.setFrameBudget(1.0f);
+    scheduler.setSliceInstructionCount(1000);
+
+    for (uint32_t callerId = 1; callerId <= 3; ++callerId) {
+        ExecutionContext ctx;
+        ctx.routines = &routines;
+        ctx.callerId = callerId;
+        scheduler.enqueue(mark, ctx);
+    }
+    BOOST_TEST((routines.markCount == 0));
+
+    scheduler.update();
+
+    BOOST_TEST((routines.callers == vector<uint32_t> { 1, 2, 3 }));
+    BOOST_TEST((scheduler.queueSize() == 0));
+}
@@ -0,0 +1,769 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE scripttranspiler
+
+#include <cmath>
+#include <random>
+#include <set>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+#include "../src/script/execution.h"
+#include "../src/script/native.h"
+#include "../src/script/transpiler.h"
+#include "../src/script/util.h"
+
+// Output of NcsTranspiler for the programs built by buildProgram,
+// buildArithmeticProgram and ProgramGenerator. Namespaces separate their
+// instruction tables.
+
+namespace sum {
+
+#include "ncs/test_sum.cpp"
+
+}
+
+namespace arithmetic {
+
+#include "ncs/test_arithmetic.cpp"
+
+}
+
+namespace corpus1 {
+
+#include "ncs/test_corpus_1.cpp"
+
+}
+
+namespace corpus2 {
+
+#include "ncs/test_corpus_2.cpp"
+
+}
+
+namespace corpus3 {
+
+#include "ncs/test_corpus_3.cpp"
+
+}
+
+namespace corpus4 {
+
+#include "ncs/test_corpus_4.cpp"
+
+}
+
+using namespace std;
+
+using namespace reone::script;
+
+namespace fs = boost::filesystem;
+
+static const int kCorpusSize = 4;
+static const int kCorpusStepCount = 80;
+
+static const NativeScriptFunction kCorpus[kCorpusSize] {
+    &corpus1::reone_ncs_test_corpus_1,
+    &corpus2::reone_ncs_test_corpus_2,
+    &corpus3::reone_ncs_test_corpus_3,
+    &corpus4::reone_ncs_test_corpus_4
+};
+
+static shared_ptr<ScriptProgram> buildProgram() {
+    shared_ptr<ScriptProgram> program(new ScriptProgram("test_sum"));
+    uint32_t offset = 13;
+
+    auto add = [&](Instruction ins, uint32_t size) {
+        ins.offset = offset;
+        ins.nextOffset = offset + size;
+        program->add(ins);
+        offset = ins.nextOffset;
+    };
+    auto makeIns = [](ByteCode byteCode, InstructionType type = InstructionType::None) {
+        Instruction ins;
+        ins.byteCode = byteCode;
+        ins.type = type;
+        return ins;
+    };
+
+    Instruction ins(makeIns(ByteCode::PushConstant, InstructionType::Float));
+    ins.floatValue = 1.5f;
+    add(ins, 6);
+
+    ins = makeIns(ByteCode::PushConstant, InstructionType::String);
+    ins.strValue = "a\"b";
+    add(ins, 7);
+
+    ins = makeIns(ByteCode::AdjustSP);
+    ins.stackOffset = -8;
+    add(ins, 6);
+
+    ins = makeIns(ByteCode::PushConstant, InstructionType::Int);
+    ins.intValue = 0;
+    add(ins, 6);
+
+    ins.intValue = 4;
+    add(ins, 6);
+
+    // 44: loop
+
+    ins = makeIns(ByteCode::CopyTopSP, InstructionType::One);
+    ins.stackOffset = -4;
+    ins.size = 4;
+    add(ins, 8);
+
+    ins = makeIns(ByteCode::JumpIfZero);
+    ins.jumpOffset = 106;
+    add(ins, 6);
+
+    ins = makeIns(ByteCode::CopyTopSP, InstructionType::One);
+    ins.stackOffset = -8;
+    ins.size = 4;
+    add(ins, 8);
+    add(ins, 8);
+
+    ins = makeIns(ByteCode::JumpToSubroutine);
+    ins.jumpOffset = 114;
+    add(ins, 6);
+
+    ins = makeIns(ByteCode::CopyDownSP, InstructionType::One);
+    ins.stackOffset = -12;
+    ins.size = 4;
+    add(ins, 8);
+
+    ins = makeIns(ByteCode::AdjustSP);
+    ins.stackOffset = -4;
+    add(ins, 6);
+
+    ins = makeIns(ByteCode::DecRelToSP, InstructionType::Int);
+    ins.stackOffset = -4;
+    add(ins, 6);
+
+    ins = makeIns(ByteCode::Jump);
+    ins.jumpOffset = 44;
+    add(ins, 6);
+
+    // 106: end of loop
+
+    ins = makeIns(ByteCode::AdjustSP);
+    ins.stackOffset = -4;
+    add(ins, 6);
+
+    add(makeIns(ByteCode::Return), 2);
+
+    // 114: subroutine
+
+    add(makeIns(ByteCode::Add, InstructionType::IntInt), 2);
+    add(makeIns(ByteCode::Return), 2);
+
+    program->setLength(offset);
+
+    return move(program);
+}
+
+static shared_ptr<ScriptProgram> buildArithmeticProgram() {
+    shared_ptr<ScriptProgram> program(new ScriptProgram("test_arithmetic"));
+    uint32_t offset = 13;
+
+    auto add = [&](Instruction ins, uint32_t size) {
+        ins.offset = offset;
+        ins.nextOffset = offset + size;
+        program->add(ins);
+        offset = ins.nextOffset;
+    };
+    auto makeIns = [](ByteCode byteCode, InstructionType type = InstructionType::None) {
+        Instruction ins;
+        ins.byteCode = byteCode;
+        ins.type = type;
+        return ins;
+    };
+    auto makeInt = [&](int value) {
+        Instruction ins(makeIns(ByteCode::PushConstant, InstructionType::Int));
+        ins.intValue = value;
+        return ins;
+    };
+    auto makeFloat = [&](float value) {
+        Instruction ins(makeIns(ByteCode::PushConstant, InstructionType::Float));
+        ins.floatValue = value;
+        return ins;
+    };
+
+    // (1.5 * 2.0 > 2.5) && (7 % 3)
+    add(makeFloat(1.5f), 6);
+    add(makeFloat(2.0f), 6);
+    add(makeIns(ByteCode::Multiply, InstructionType::FloatFloat), 2);
+    add(makeFloat(2.5f), 6);
+    add(makeIns(ByteCode::GreaterThan, InstructionType::FloatFloat), 2);
+    add(makeInt(7), 6);
+    add(makeInt(3), 6);
+    add(makeIns(ByteCode::Mod, InstructionType::IntInt), 2);
+    add(makeIns(ByteCode::LogicalAnd, InstructionType::IntInt), 2);
+
+    // -5 * 2
+    add(makeInt(5), 6);
+    add(makeIns(ByteCode::Negate, InstructionType::Int), 2);
+    add(makeInt(2), 6);
+    add(makeIns(ByteCode::Multiply, InstructionType::IntInt), 2);
+
+    // "x" == "x", executed by the VM
+    Instruction ins(makeIns(ByteCode::PushConstant, InstructionType::String));
+    ins.strValue = "x";
+    add(ins, 5);
+    add(ins, 5);
+    add(makeIns(ByteCode::Equal, InstructionType::StringString), 2);
+
+    // !(1 - (-10 + 1)) <= 4
+    add(makeIns(ByteCode::Add, InstructionType::IntInt), 2);
+    add(makeIns(ByteCode::Subtract, InstructionType::IntInt), 2);
+    add(makeIns(ByteCode::LogicalNot), 2);
+    add(makeInt(4), 6);
+    add(makeIns(ByteCode::LessThanOrEqual, InstructionType::IntInt), 2);
+    add(makeIns(ByteCode::Return), 2);
+
+    program->setLength(offset);
+
+    return move(program);
+}
+
+/**
+ * Generates programs of random instructions that the transpiler inlines,
+ * including branches. Instructions that are executed are also applied to a
+ * VM stack while generating, so that divisors are non-zero, shifts are in
+ * range and arithmetic neither overflows nor loses precision.
+ */
+class ProgramGenerator {
+public:
+    ProgramGenerator(uint32_t seed) : _random(seed) {
+    }
+
+    shared_ptr<ScriptProgram> generate(const string &name, int stepCount) {
+        shared_ptr<ScriptProgram> program(new ScriptProgram(name));
+        _instructions.clear();
+        _types.clear();
+        _offset = 13;
+        _floor = 1;
+        _live = true;
+        _vm.reset(new ScriptExecution(program, ExecutionContext()));
+
+        pushInt();
+        for (int i = 0; i < stepCount; ++i) {
+            step(2);
+        }
+        if (_types.back() != VariableType::Int) {
+            pushInt();
+        }
+        add(makeIns(ByteCode::Return), 2);
+
+        for (auto &ins : _instructions) {
+            program->add(ins);
+        }
+        program->setLength(_offset);
+
+        return move(program);
+    }
+
+private:
+    mt19937 _random;
+    vector<Instruction> _instructions;
+    vector<VariableType> _types;
+    uint32_t _offset { 0 };
+    int _floor { 0 }; /**< stack size below which elements must not be popped */
+    bool _live { false }; /**< whether instructions being generated are executed */
+    unique_ptr<ScriptExecution> _vm;
+
+    static Instruction makeIns(ByteCode byteCode, InstructionType type = InstructionType::None) {
+        Instruction ins;
+        ins.byteCode = byteCode;
+        ins.type = type;
+        return ins;
+    }
+
+    int next(int count) {
+        return static_cast<int>(_random() % count);
+    }
+
+    int add(Instruction ins, uint32_t size) {
+        ins.offset = _offset;
+        ins.nextOffset = _offset + size;
+        _offset = ins.nextOffset;
+        _instructions.push_back(ins);
+        if (_live) {
+            _vm->executeInstruction(ins);
+        }
+        return static_cast<int>(_instructions.size()) - 1;
+    }
+
+    const Variable &top(int distance = 1) {
+        return _vm->stack()[_vm->stack().size() - distance];
+    }
+
+    int stackSize() const {
+        return static_cast<int>(_types.size());
+    }
+
+    void step(int depth) {
+        if (_types.empty()) {
+            pushInt();
+            return;
+        }
+        switch (next(depth > 0 ? 13 : 12)) {
+            case 0:
+                pushInt();
+                break;
+            case 1:
+                pushFloat();
+                break;
+            case 2:
+                pushString();
+                break;
+            case 3:
+                copyTop();
+                break;
+            case 4:
+                copyDown();
+                break;
+            case 5:
+                adjust();
+                break;
+            case 6:
+                incOrDec();
+                break;
+            case 7:
+            case 8:
+                intOperator();
+                break;
+            case 9:
+                floatOperator();
+                break;
+            case 10:
+                unaryOperator();
+                break;
+            case 11:
+                add(makeIns(ByteCode::Noop), 2);
+                break;
+            default:
+                branch(depth - 1);
+                break;
+        }
+    }
+
+    void pushInt(int value) {
+        Instruction ins(makeIns(ByteCode::PushConstant, InstructionType::Int));
+        ins.intValue = value;
+        add(ins, 6);
+        _types.push_back(VariableType::Int);
+    }
+
+    void pushInt() {
+        pushInt(next(41) - 20);
+    }
+
+    void pushFloat(float value) {
+        Instruction ins(makeIns(ByteCode::PushConstant, InstructionType::Float));
+        ins.floatValue = value;
+        add(ins, 6);
+        _types.push_back(VariableType::Float);
+    }
+
+    void pushFloat() {
+        pushFloat(0.25f * (next(65) - 32));
+    }
+
+    void pushString() {
+        static const char *strings[] { "", "a", "xy", "q\"z" };
+
+        Instruction ins(makeIns(ByteCode::PushConstant, InstructionType::String));
+        ins.strValue = strings[next(4)];
+        add(ins, 4 + static_cast<uint32_t>(ins.strValue.size()));
+        _types.push_back(VariableType::String);
+    }
+
+    void copyTop() {
+        int count = stackSize() >= 2 && next(2) == 0 ? 2 : 1;
+        int distance = count + next(min(stackSize(), 6) - count + 1);
+
+        Instruction ins(makeIns(ByteCode::CopyTopSP, InstructionType::One));
+        ins.stackOffset = -4 * distance;
+        ins.size = 4 * count;
+        add(ins, 8);
+
+        for (int i = 0; i < count; ++i) {
+            _types.push_back(_types[_types.size() - distance]);
+        }
+    }
+
+    void copyDown() {
+        vector<int> distances;
+        for (int distance = 2; distance <= min(stackSize(), 6); ++distance) {
+            if (_types[_types.size() - distance] == _types.back()) {
+                distances.push_back(distance);
+            }
+        }
+        if (distances.empty()) {
+            pushInt();
+            return;
+        }
+        Instruction ins(makeIns(ByteCode::CopyDownSP, InstructionType::One));
+        ins.stackOffset = -4 * distances[next(static_cast<int>(distances.size()))];
+        ins.size = 4;
+        add(ins, 8);
+    }
+
+    void adjust() {
+        int maxCount = min(stackSize() - _floor, 3);
+        if (maxCount <= 0) {
+            pushFloat();
+            return;
+        }
+        int count = 1 + next(maxCount);
+
+        Instruction ins(makeIns(ByteCode::AdjustSP));
+        ins.stackOffset = -4 * count;
+        add(ins, 6);
+
+        _types.resize(_types.size() - count);
+    }
+
+    void incOrDec() {
+        vector<int> distances;
+        for (int distance = 1; distance <= min(stackSize(), 6); ++distance) {
+            if (_types[_types.size() - distance] == VariableType::Int) {
+                distances.push_back(distance);
+            }
+        }
+        if (distances.empty()) {
+            pushInt();
+            return;
+        }
+        Instruction ins(makeIns(next(2) == 0 ? ByteCode::IncRelToSP : ByteCode::DecRelToSP, InstructionType::Int));
+        ins.stackOffset = -4 * distances[next(static_cast<int>(distances.size()))];
+        add(ins, 6);
+    }
+
+    void ensureTop(VariableType type, int count) {
+        for (int i = 1; i <= count; ++i) {
+            if (_types[_types.size() - i] != type) {
+                for (int j = 0; j < count; ++j) {
+                    if (type == VariableType::Int) {
+                        pushInt();
+                    } else {
+                        pushFloat();
+                    }
+                }
+                return;
+            }
+        }
+    }
+
+    void intOperator() {
+        static const ByteCode operators[] {
+            ByteCode::Add, ByteCode::Subtract, ByteCode::Multiply, ByteCode::Divide, ByteCode::Mod,
+            ByteCode::LogicalAnd, ByteCode::LogicalOr,
+            ByteCode::InclusiveBitwiseOr, ByteCode::ExclusiveBitwiseOr, ByteCode::BitwiseAnd,
+            ByteCode::ShiftLeft, ByteCode::ShiftRight,
+            ByteCode::Equal, ByteCode::NotEqual,
+            ByteCode::GreaterThanOrEqual, ByteCode::GreaterThan, ByteCode::LessThan, ByteCode::LessThanOrEqual
+        };
+        ByteCode op = operators[next(18)];
+
+        switch (op) {
+            case ByteCode::Divide:
+            case ByteCode::Mod:
+                ensureTop(VariableType::Int, 1);
+                pushInt((1 + next(9)) * (next(2) == 0 ? 1 : -1));
+                break;
+            case ByteCode::ShiftLeft:
+            case ByteCode::ShiftRight:
+                ensureTop(VariableType::Int, 1);
+                pushInt(next(5));
+                if (op == ByteCode::ShiftLeft && _live && (top(2).intValue < 0 || top(2).intValue >= (1 << 20))) {
+                    op = ByteCode::ShiftRight;
+                }
+                break;
+            default:
+                ensureTop(VariableType::Int, 2);
+                if (_live) {
+                    int64_t left = top(2).intValue;
+                    int64_t right = top().intValue;
+                    int64_t result = op == ByteCode::Add ? left + right : (op == ByteCode::Subtract ? left - right : left * right);
+                    bool arithmetic = op == ByteCode::Add || op == ByteCode::Subtract || op == ByteCode::Multiply;
+                    if (arithmetic && (result < -(1 << 20) || result > (1 << 20))) {
+                        op = ByteCode::ExclusiveBitwiseOr;
+                    }
+                }
+                break;
+        }
+        add(makeIns(op, InstructionType::IntInt), 2);
+
+        _types.pop_back();
+    }
+
+    void floatOperator() {
+        static const ByteCode operators[] {
+            ByteCode::Add, ByteCode::Subtract, ByteCode::Multiply, ByteCode::Divide,
+            ByteCode::Equal, ByteCode::NotEqual,
+            ByteCode::GreaterThanOrEqual, ByteCode::GreaterThan, ByteCode::LessThan, ByteCode::LessThanOrEqual
+        };
+        ByteCode op = operators[next(10)];
+
+        if (op == ByteCode::Divide) {
+            ensureTop(VariableType::Float, 1);
+            pushFloat(next(2) == 0 ? 0.5f : -4.0f);
+        } else {
+            ensureTop(VariableType::Float, 2);
+        }
+        if (_live && (op == ByteCode::Multiply || op == ByteCode::Divide)) {
+            float left = top(2).floatValue;
+            float right = top().floatValue;
+            if (fabs(left) > 1024.0f || fabs(right) > 1024.0f) {
+                op = ByteCode::Subtract;
+            }
+        }
+        bool comparison = op != ByteCode::Add && op != ByteCode::Subtract && op != ByteCode::Multiply && op != ByteCode::Divide;
+        add(makeIns(op, InstructionType::FloatFloat), 2);
+
+        _types.pop_back();
+        _types.back() = comparison ? VariableType::Int : VariableType::Float;
+    }
+
+    void unaryOperator() {
+        if (next(2) == 0) {
+            ensureTop(VariableType::Int, 1);
+            add(makeIns(ByteCode::LogicalNot, InstructionType::Int), 2);
+            return;
+        }
+        if (_types.back() == VariableType::String) {
+            pushInt();
+        }
+        add(makeIns(ByteCode::Negate, _types.back() == VariableType::Int ? InstructionType::Int : InstructionType::Float), 2);
+    }
+
+    /**
+     * Generates if-else with a condition on top of the stack. Both branches
+     * leave the stack as they found it, except for values of its elements.
+     */
+    void branch(int depth) {
+        ensureTop(VariableType::Int, 1);
+
+        ByteCode byteCode = next(2) == 0 ? ByteCode::JumpIfZero : ByteCode::JumpIfNonZero;
+        bool live = _live;
+        bool jump = false;
+        if (live) {
+            bool zero = top().intValue == 0;
+            jump = byteCode == ByteCode::JumpIfZero ? zero : !zero;
+        }
+        int condIdx = add(makeIns(byteCode), 6);
+        _types.pop_back();
+
+        _live = live && !jump;
+        generateBlock(depth);
+        int jumpIdx = add(makeIns(ByteCode::Jump), 6);
+        _instructions[condIdx].jumpOffset = _offset;
+        _live = live && jump;
+        generateBlock(depth);
+        _instructions[jumpIdx].jumpOffset = _offset;
+
+        _live = live;
+    }
+
+    void generateBlock(int depth) {
+        int floor = _floor;
+        int size = stackSize();
+        _floor = size;
+
+        int stepCount = 1 + next(4);
+        for (int i = 0; i < stepCount; ++i) {
+            step(depth);
+        }
+        if (stackSize() > size) {
+            Instruction ins(makeIns(ByteCode::AdjustSP));
+            ins.stackOffset = -4 * (stackSize() - size);
+            add(ins, 6);
+            _types.resize(size);
+        }
+
+        _floor = floor;
+    }
+};
+
+static void compareExecutions(const shared_ptr<ScriptProgram> &program, NativeScriptFunction nativeFunc) {
+    ExecutionContext context;
+
+    program->setNativeFunction(nullptr);
+    ScriptExecution interpreted(program, context);
+    int interpretedResult = interpreted.run();
+
+    program->setNativeFunction(nativeFunc);
+    ScriptExecution native(program, context);
+    int nativeResult = native.run();
+
+    program->setNativeFunction(nullptr);
+
+    BOOST_TEST((interpretedResult == nativeResult));
+    BOOST_TEST((interpreted.instructionCount() == native.instructionCount()));
+    BOOST_TEST_REQUIRE((interpreted.stackSize() == native.stackSize()));
+
+    for (int i = 0; i < interpreted.stackSize(); ++i) {
+        const Variable &left = interpreted.getStackVariable(i);
+        const Variable &right = native.getStackVariable(i);
+        BOOST_TEST((left.type == right.type));
+        BOOST_TEST((left == right));
+    }
+}
+
+static string readExpected(const string &filename) {
+    fs::path expectedPath(fs::path(__FILE__).parent_path());
+    expectedPath.append("ncs");
+    expectedPath.append(filename);
+
+    fs::ifstream expected(expectedPath, ios::binary);
+    BOOST_TEST_REQUIRE(expected.is_open());
+
+    ostringstream expectedText;
+    expectedText << expected.rdbuf();
+
+    return expectedText.str();
+}
+
+BOOST_AUTO_TEST_CASE(test_transpile) {
+    ostringstream text;
+    NcsTranspiler(buildProgram()).transpile(text);
+
+    BOOST_TEST((text.str() == readExpected("test_sum.cpp")));
+}
+
+BOOST_AUTO_TEST_CASE(test_native_matches_interpreted) {
+    shared_ptr<ScriptProgram> program(buildProgram());
+
+    compareExecutions(program, &sum::reone_ncs_test_sum);
+
+    ExecutionContext context;
+    program->setNativeFunction(&sum::reone_ncs_test_sum);
+    ScriptExecution execution(program, context);
+    execution.run();
+
+    BOOST_TEST((execution.stackSize() == 1));
+    BOOST_TEST((execution.getStackVariable(0).intValue == 10));
+}
+
+BOOST_AUTO_TEST_CASE(test_native_resumes_from_offset) {
+    shared_ptr<ScriptProgram> program(buildProgram());
+
+    auto state = make_shared<ExecutionState>();
+    state->program = program;
+    state->locals.push_back(Variable(5));
+    state->locals.push_back(Variable(2));
+    state->insOffset = 44;
+
+    ExecutionContext context;
+    context.savedState = state;
+
+    ScriptExecution interpreted(program, context);
+    interpreted.run();
+
+    program->setNativeFunction(&sum::reone_ncs_test_sum);
+    ScriptExecution native(program, context);
+    native.run();
+
+    BOOST_TEST_REQUIRE((interpreted.stackSize() == 1));
+    BOOST_TEST_REQUIRE((native.stackSize() == 1));
+    BOOST_TEST((interpreted.getStackVariable(0).intValue == 8));
+    BOOST_TEST((native.getStackVariable(0).intValue == 8));
+}
+
+BOOST_AUTO_TEST_CASE(test_transpile_arithmetic) {
+    ostringstream text;
+    NcsTranspiler(buildArithmeticProgram()).transpile(text);
+
+    BOOST_TEST((text.str() == readExpected("test_arithmetic.cpp")));
+}
+
+BOOST_AUTO_TEST_CASE(test_native_arithmetic_matches_interpreted) {
+    shared_ptr<ScriptProgram> program(buildArithmeticProgram());
+
+    compareExecutions(program, &arithmetic::reone_ncs_test_arithmetic);
+
+    ExecutionContext context;
+    program->setNativeFunction(&arithmetic::reone_ncs_test_arithmetic);
+    ScriptExecution execution(program, context);
+
+    BOOST_TEST((execution.run() == 1));
+    BOOST_TEST((execution.stackSize() == 1));
+}
+
+BOOST_AUTO_TEST_CASE(test_transpile_corpus) {
+    for (int seed = 1; seed <= kCorpusSize; ++seed) {
+        string name("test_corpus_" + to_string(seed));
+
+        ostringstream text;
+        NcsTranspiler(ProgramGenerator(seed).generate(name, kCorpusStepCount)).transpile(text);
+
+        BOOST_TEST((text.str() == readExpected(name + ".cpp")), name);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_corpus_covers_inlined_instructions) {
+    set<pair<ByteCode, InstructionType>> expected {
+        { ByteCode::PushConstant, InstructionType::Int },
+        { ByteCode::PushConstant, InstructionType::Float },
+        { ByteCode::PushConstant, InstructionType::String },
+        { ByteCode::CopyTopSP, InstructionType::One },
+        { ByteCode::CopyDownSP, InstructionType::One },
+        { ByteCode::AdjustSP, InstructionType::None },
+        { ByteCode::IncRelToSP, InstructionType::Int },
+        { ByteCode::DecRelToSP, InstructionType::Int },
+        { ByteCode::LogicalNot, InstructionType::Int },
+        { ByteCode::Negate, InstructionType::Int },
+        { ByteCode::Negate, InstructionType::Float },
+        { ByteCode::JumpIfZero, InstructionType::None },
+        { ByteCode::JumpIfNonZero, InstructionType::None },
+        { ByteCode::Jump, InstructionType::None },
+        { ByteCode::Noop, InstructionType::None }
+    };
+    for (int i = static_cast<int>(ByteCode::LogicalAnd); i <= static_cast<int>(ByteCode::Mod); ++i) {
+        if (i != static_cast<int>(ByteCode::UnsignedShiftRight)) {
+            expected.insert(make_pair(static_cast<ByteCode>(i), InstructionType::IntInt));
+        }
+    }
+    for (int i = static_cast<int>(ByteCode::Equal); i <= static_cast<int>(ByteCode::LessThanOrEqual); ++i) {
+        expected.insert(make_pair(static_cast<ByteCode>(i), InstructionType::FloatFloat));
+    }
+    for (int i = static_cast<int>(ByteCode::Add); i <= static_cast<int>(ByteCode::Divide); ++i) {
+        expected.insert(make_pair(static_cast<ByteCode>(i), InstructionType::FloatFloat));
+    }
+
+    set<pair<ByteCode, InstructionType>> generated;
+    for (int seed = 1; seed <= kCorpusSize; ++seed) {
+        shared_ptr<ScriptProgram> program(ProgramGenerator(seed).generate("test_corpus_" + to_string(seed), kCorpusStepCount));
+        for (auto &pair : program->instructions()) {
+            generated.insert(make_pair(pair.second.byteCode, pair.second.type));
+        }
+    }
+    for (auto &instruction : expected) {
+        BOOST_TEST((generated.count(instruction) > 0), describeInstruction(makeInstruction(0, instruction.first, instruction.second, 0, 0, 0, 0)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_native_corpus_matches_interpreted) {
+    for (int seed = 1; seed <= kCorpusSize; ++seed) {
+        shared_ptr<ScriptProgram> program(ProgramGenerator(seed).generate("test_corpus_" + to_string(seed), kCorpusStepCount));
+        compareExecutions(program, kCorpus[seed - 1]);
+    }
+}
@@ -0,0 +1,408 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE scriptverifier
+
+#include <cmath>
+#include <sstream>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "../src/script/execution.h"
+#include "../src/script/ncsfile.h"
+#include "../src/script/routine.h"
+#include "../src/script/verifier.h"
+
+using namespace std;
+
+using namespace reone;
+using namespace reone::script;
+
+class TestRoutines : public IRoutineProvider {
+public:
+    TestRoutines() {
+        _routines.push_back(Routine("ActionX", VariableType::Void, { }));
+        _routines.push_back(Routine("DelayCommand", VariableType::Void, { VariableType::Float, VariableType::Action }));
+        _routines.push_back(Routine("VectorMagnitude", VariableType::Float, { VariableType::Vector }, [](const vector<Variable> &args, ExecutionContext &ctx) {
+            const Vector3 &vec = args[0].vecValue;
+            return Variable(sqrtf(vec.x * vec.x + vec.y * vec.y + vec.z * vec.z));
+        }));
+        _routines.push_back(Routine("GetPosition", VariableType::Vector, { VariableType::Object }, [](const vector<Variable> &args, ExecutionContext &ctx) {
+            return Variable(Vector3(1.0f, 2.0f, 3.0f));
+        }));
+        _routines.push_back(Routine("PrintString", VariableType::Void, { VariableType::String }, [](const vector<Variable> &args, ExecutionContext &ctx) {
+            return Variable();
+        }));
+    }
+
+    const Routine &get(int index) override {
+        return _routines[index];
+    }
+
+private:
+    vector<Routine> _routines;
+};
+
+static const int kActionX = 0;
+static const int kDelayCommand = 1;
+static const int kVectorMagnitude = 2;
+static const int kGetPosition = 3;
+static const int kPrintString = 4;
+
+/**
+ * Assembles NCS files in the format, that NcsFile reads.
+ */
+class NcsAssembler {
+public:
+    uint32_t offset() const {
+        return 13 + static_cast<uint32_t>(_code.size());
+    }
+
+    void op(ByteCode byteCode, InstructionType type = InstructionType::None) {
+        _code.push_back(static_cast<char>(byteCode));
+        _code.push_back(static_cast<char>(type));
+    }
+
+    void constInt(int value) {
+        op(ByteCode::PushConstant, InstructionType::Int);
+        write32(value);
+    }
+
+    void constFloat(float value) {
+        op(ByteCode::PushConstant, InstructionType::Float);
+        write32(*reinterpret_cast<uint32_t *>(&value));
+    }
+
+    void constString(const string &value) {
+        op(ByteCode::PushConstant, InstructionType::String);
+        write16(static_cast<uint16_t>(value.size()));
+        _code.append(value);
+    }
+
+    void constObject(int value) {
+        op(ByteCode::PushConstant, InstructionType::Object);
+        write32(value);
+    }
+
+    void copy(ByteCode byteCode, int stackOffset, int size) {
+        op(byteCode, InstructionType::One);
+        write32(stackOffset);
+        write16(size);
+    }
+
+    void adjustSP(int stackOffset) {
+        op(ByteCode::AdjustSP);
+        write32(stackOffset);
+    }
+
+    void relative(ByteCode byteCode, int stackOffset) {
+        op(byteCode, InstructionType::Int);
+        write32(stackOffset);
+    }
+
+    void callRoutine(int routine, int argCount) {
+        op(ByteCode::CallRoutine);
+        write16(routine);
+        _code.push_back(static_cast<char>(argCount));
+    }
+
+    void destruct(int size, int stackOffset, int sizeNoDestroy) {
+        op(ByteCode::Destruct, InstructionType::One);
+        write16(size);
+        write16(stackOffset);
+        write16(sizeNoDestroy);
+    }
+
+    void storeState(int size, int sizeLocals) {
+        op(ByteCode::StoreState, static_cast<InstructionType>(0x10));
+        write32(size);
+        write32(sizeLocals);
+    }
+
+    /**
+     * @return position of the jump, to be passed to patchJump
+     */
+    size_t jump(ByteCode byteCode) {
+        size_t pos = _code.size();
+        op(byteCode);
+        write32(0);
+        return pos;
+    }
+
+    void patchJump(size_t pos, uint32_t target) {
+        uint32_t value = target - static_cast<uint32_t>(13 + pos);
+        for (int i = 0; i < 4; ++i) {
+            _code[pos + 2 + i] = static_cast<char>((value >> (24 - 8 * i)) & 0xff);
+        }
+    }
+
+    shared_ptr<ScriptProgram> load(const string &name) const {
+        string data("NCS V1.0");
+        data.push_back(0x42);
+        uint32_t length = offset();
+        for (int i = 0; i < 4; ++i) {
+            data.push_back(static_cast<char>((length >> (24 - 8 * i)) & 0xff));
+        }
+        data.append(_code);
+
+        NcsFile ncs(name);
+        ncs.load(make_shared<istringstream>(data));
+
+        return ncs.program();
+    }
+
+private:
+    string _code;
+
+    void write16(uint16_t value) {
+        _code.push_back(static_cast<char>(value >> 8));
+        _code.push_back(static_cast<char>(value & 0xff));
+    }
+
+    void write32(uint32_t value) {
+        for (int i = 0; i < 4; ++i) {
+            _code.push_back(static_cast<char>((value >> (24 - 8 * i)) & 0xff));
+        }
+    }
+};
+
+// Valid programs
+
+static shared_ptr<ScriptProgram> assembleLoop() {
+    NcsAssembler a;
+    size_t jsrMain = a.jump(ByteCode::JumpToSubroutine);
+    a.op(ByteCode::Return);
+
+    a.patchJump(jsrMain, a.offset());
+    a.op(ByteCode::Reserve, InstructionType::Int);
+    a.constInt(0);
+    a.copy(ByteCode::CopyDownSP, -8, 4);
+    a.adjustSP(-4);
+    uint32_t loop = a.offset();
+    a.copy(ByteCode::CopyTopSP, -4, 4);
+    a.constInt(10);
+    a.op(ByteCode::LessThan, InstructionType::IntInt);
+    size_t jzEnd = a.jump(ByteCode::JumpIfZero);
+    a.relative(ByteCode::IncRelToSP, -4);
+    size_t jmpLoop = a.jump(ByteCode::Jump);
+    a.patchJump(jmpLoop, loop);
+    a.patchJump(jzEnd, a.offset());
+    a.op(ByteCode::Return);
+
+    return a.load("loop");
+}
+
+static shared_ptr<ScriptProgram> assembleGlobals() {
+    NcsAssembler a;
+    a.op(ByteCode::Reserve, InstructionType::Int);
+    a.constInt(5);
+    a.copy(ByteCode::CopyDownSP, -8, 4);
+    a.adjustSP(-4);
+    a.op(ByteCode::SaveBP);
+    size_t jsrMain = a.jump(ByteCode::JumpToSubroutine);
+    a.op(ByteCode::RestoreBP);
+    a.op(ByteCode::Return);
+
+    a.patchJump(jsrMain, a.offset());
+    a.copy(ByteCode::CopyTopBP, -4, 4);
+    a.constInt(1);
+    a.op(ByteCode::Add, InstructionType::IntInt);
+    a.copy(ByteCode::CopyDownBP, -4, 4);
+    a.adjustSP(-4);
+    a.relative(ByteCode::DecRelToBP, -4);
+    a.op(ByteCode::Return);
+
+    return a.load("globals");
+}
+
+static shared_ptr<ScriptProgram> assembleAction() {
+    NcsAssembler a;
+    a.constString("local");
+    a.storeState(0, 4);
+    size_t jmpOver = a.jump(ByteCode::Jump);
+    a.copy(ByteCode::CopyTopSP, -4, 4);
+    a.callRoutine(kPrintString, 1);
+    a.callRoutine(kActionX, 0);
+    a.op(ByteCode::Return);
+    a.patchJump(jmpOver, a.offset());
+    a.constFloat(1.0f);
+    a.callRoutine(kDelayCommand, 2);
+    a.adjustSP(-4);
+    a.op(ByteCode::Return);
+
+    return a.load("action");
+}
+
+static shared_ptr<ScriptProgram> assembleVectors() {
+    NcsAssembler a;
+    a.constFloat(3.0f);
+    a.constFloat(0.0f);
+    a.constFloat(4.0f);
+    a.callRoutine(kVectorMagnitude, 1);
+    a.constObject(0);
+    a.callRoutine(kGetPosition, 1);
+    a.adjustSP(-12);
+    a.constFloat(5.0f);
+    a.op(ByteCode::Equal, InstructionType::FloatFloat);
+    a.op(ByteCode::Return);
+
+    return a.load("vectors");
+}
+
+static shared_ptr<ScriptProgram> assembleStrings() {
+    NcsAssembler a;
+    a.constString("a");
+    a.constString("b");
+    a.op(ByteCode::Add, InstructionType::StringString);
+    a.constString("ab");
+    a.op(ByteCode::Equal, InstructionType::StringString);
+    size_t jzEnd = a.jump(ByteCode::JumpIfZero);
+    a.constInt(1);
+    a.constInt(2);
+    a.constInt(3);
+    a.destruct(12, 4, 4);
+    a.op(ByteCode::Negate, InstructionType::Int);
+    a.adjustSP(-4);
+    a.patchJump(jzEnd, a.offset());
+    a.op(ByteCode::Return);
+
+    return a.load("strings");
+}
+
+// END Valid programs
+
+static void verify(const shared_ptr<ScriptProgram> &program, bool &valid, uint32_t &errorOffset, string &errorMessage) {
+    TestRoutines routines;
+    ScriptVerifier verifier(*program, routines);
+    valid = verifier.verify();
+    errorOffset = verifier.errorOffset();
+    errorMessage = verifier.errorMessage();
+}
+
+BOOST_AUTO_TEST_CASE(test_corpus_passes_verification) {
+    vector<shared_ptr<ScriptProgram>> corpus {
+        assembleLoop(),
+        assembleGlobals(),
+        assembleAction(),
+        assembleVectors(),
+        assembleStrings()
+    };
+    for (auto &program : corpus) {
+        bool valid;
+        uint32_t errorOffset;
+        string errorMessage;
+        verify(program, valid, errorOffset, errorMessage);
+
+        BOOST_TEST(valid, program->name() << ": " << errorOffset << ": " << errorMessage);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_invalid_programs_fail_verification) {
+    bool valid;
+    uint32_t errorOffset;
+    string errorMessage;
+
+    // Stack underflow
+    {
+        NcsAssembler a;
+        a.constInt(1);
+        uint32_t add = a.offset();
+        a.op(ByteCode::Add, InstructionType::IntInt);
+        a.op(ByteCode::Return);
+        verify(a.load("underflow"), valid, errorOffset, errorMessage);
+
+        BOOST_TEST(!valid);
+        BOOST_TEST((errorOffset == add));
+        BOOST_TEST((errorMessage == "stack underflow"));
+    }
+
+    // Routine argument of a wrong type
+    {
+        NcsAssembler a;
+        a.constInt(1);
+        uint32_t call = a.offset();
+        a.callRoutine(kPrintString, 1);
+        a.op(ByteCode::Return);
+        verify(a.load("argtype"), valid, errorOffset, errorMessage);
+
+        BOOST_TEST(!valid);
+        BOOST_TEST((errorOffset == call));
+        BOOST_TEST((errorMessage == "expected string, got int"));
+    }
+
+    // Different stack depths at a join point
+    {
+        NcsAssembler a;
+        a.constInt(1);
+        a.constInt(1);
+        size_t jz = a.jump(ByteCode::JumpIfZero);
+        uint32_t push = a.offset();
+        a.constInt(2);
+        a.patchJump(jz, a.offset());
+        a.adjustSP(-4);
+        a.op(ByteCode::Return);
+        verify(a.load("join"), valid, errorOffset, errorMessage);
+
+        BOOST_TEST(!valid);
+        BOOST_TEST((errorOffset == push));
+        BOOST_TEST((errorMessage.find("stack mismatch at join point") == 0));
+    }
+
+    // Jump into the middle of an instruction
+    {
+        NcsAssembler a;
+        size_t jmp = a.jump(ByteCode::Jump);
+        a.constInt(1);
+        a.patchJump(jmp, a.offset() - 2);
+        a.op(ByteCode::Return);
+        verify(a.load("jump"), valid, errorOffset, errorMessage);
+
+        BOOST_TEST(!valid);
+        BOOST_TEST((errorOffset == 13));
+        BOOST_TEST((errorMessage == "no instruction at 00000017"));
+    }
+
+    // Action argument without a stored state
+    {
+        NcsAssembler a;
+        a.constFloat(1.0f);
+        uint32_t call = a.offset();
+        a.callRoutine(kDelayCommand, 2);
+        a.op(ByteCode::Return);
+        verify(a.load("action"), valid, errorOffset, errorMessage);
+
+        BOOST_TEST(!valid);
+        BOOST_TEST((errorOffset == call));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_verified_program_runs_without_checks) {
+    TestRoutines routines;
+    ExecutionContext ctx;
+    ctx.routines = &routines;
+
+    shared_ptr<ScriptProgram> program(assembleVectors());
+    int checkedResult = ScriptExecution(program, ctx).run();
+
+    ScriptVerifier verifier(*program, routines);
+    BOOST_TEST_REQUIRE(verifier.verify());
+    program->setVerified(true);
+    int result = ScriptExecution(program, ctx).run();
+
+    BOOST_TEST((checkedResult == 1));
+    BOOST_TEST((result == checkedResult));
+}
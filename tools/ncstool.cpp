@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2020 Vsevolod Kremianskii
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tools.h"
+
+#include "../src/script/ncsfile.h"
+#include "../src/script/transpiler.h"
+
+using namespace std;
+
+using namespace reone::script;
+
+namespace fs = boost::filesystem;
+
+namespace reone {
+
+namespace tools {
+
+void NcsTool::convert(const fs::path &path, const fs::path &destPath) const {
+    NcsFile ncs(path.stem().string());
+    ncs.load(path);
+
+    fs::path cppPath(destPath);
+    cppPath.append(path.stem().string() + ".cpp");
+
+    fs::ofstream cpp(cppPath);
+    NcsTranspiler(ncs.program()).transpile(cpp);
+}
+
+} // namespace tools
+
+} // namespace reone
@@ -92,6 +92,11 @@ public:
     void convert(const boost::filesystem::path &path, const boost::filesystem::path &destPath) const override;
 };
 
+class NcsTool : public Tool {
+public:
+    void convert(const boost::filesystem::path &path, const boost::filesystem::path &destPath) const override;
+};
+
 class GffTool : public Tool {
 public:
     void convert(const boost::filesystem::path &path, const boost::filesystem::path &destPath) const override;